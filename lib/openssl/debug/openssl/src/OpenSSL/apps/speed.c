@@ -286,6 +286,7 @@ static double Time_F(int s)
 #endif
 
 static void multiblock_speed(const EVP_CIPHER *evp_cipher);
+static void multi_sha256_speed(void);
 
 #define found(value, pairs, result)\
     opt_found(value, result, pairs, OSSL_NELEM(pairs))
@@ -317,7 +318,7 @@ OPTIONS speed_options[] = {
      "Time decryption instead of encryption (only EVP)"},
     {"mr", OPT_MR, '-', "Produce machine readable output"},
     {"mb", OPT_MB, '-',
-     "Enable (tls1.1) multi-block mode on evp_cipher requested with -evp"},
+     "Enable (tls1.1) multi-block mode on -evp cipher, or batch sha256"},
     {"misalign", OPT_MISALIGN, 'n', "Amount to mis-align buffers"},
     {"elapsed", OPT_ELAPSED, '-',
      "Measure time in real time instead of CPU user time"},
@@ -1936,6 +1937,15 @@ int speed_main(int argc, char **argv)
         }
     }
     if (doit[D_SHA256]) {
+        if (multiblock && evp_cipher == NULL) {
+            if (async_jobs > 0) {
+                BIO_printf(bio_err, "Async mode is not supported, exiting...");
+                exit(1);
+            }
+            multi_sha256_speed();
+            ret = 0;
+            goto end;
+        }
         for (testnum = 0; testnum < SIZE_NUM; testnum++) {
             print_message(names[D_SHA256], c[D_SHA256][testnum], lengths[testnum]);
             Time_F(START);
@@ -3141,3 +3151,100 @@ static void multiblock_speed(const EVP_CIPHER *evp_cipher)
     OPENSSL_free(out);
     EVP_CIPHER_CTX_free(ctx);
 }
+
+/*
+ * Digests per second over batches of MB_DIGESTS independent messages,
+ * one EVP_Digest or HMAC call per message against one SHA256_multi or
+ * HMAC_SHA256_multi call per batch.
+ */
+#define MB_DIGESTS      64
+
+static void multi_sha256_speed(void)
+{
+    static int mblengths[] = { 16, 64, 256, 1024, 8 * 1024 };
+    static const char *mbnames[] = {
+        "sha256 EVP_Digest", "SHA256_multi",
+        "hmac(sha256) HMAC", "HMAC_SHA256_multi"
+    };
+    double dps[OSSL_NELEM(mbnames)][OSSL_NELEM(mblengths)];
+    const unsigned char *d[MB_DIGESTS], *key[MB_DIGESTS];
+    unsigned char *inp, *out, *md[MB_DIGESTS];
+    size_t n[MB_DIGESTS];
+    int key_len[MB_DIGESTS];
+    int i, j, k, count, num = OSSL_NELEM(mblengths);
+    double t = 0.0;
+
+    inp = app_malloc(MB_DIGESTS * mblengths[num - 1], "multi input buffer");
+    out = app_malloc(MB_DIGESTS * SHA256_DIGEST_LENGTH, "multi output buffer");
+    RAND_bytes(inp, MB_DIGESTS * mblengths[num - 1]);
+    for (i = 0; i < MB_DIGESTS; i++) {
+        d[i] = inp + i * mblengths[num - 1];
+        md[i] = out + i * SHA256_DIGEST_LENGTH;
+        key[i] = d[i];
+        key_len[i] = SHA256_DIGEST_LENGTH;
+    }
+
+    for (k = 0; k < (int)OSSL_NELEM(mbnames); k++) {
+        for (j = 0; j < num; j++) {
+            for (i = 0; i < MB_DIGESTS; i++)
+                n[i] = mblengths[j];
+            print_message(mbnames[k], 0, mblengths[j]);
+            Time_F(START);
+            for (count = 0, run = 1; run && count < 0x7fffffff;
+                 count += MB_DIGESTS) {
+                switch (k) {
+                case 0:
+                    for (i = 0; i < MB_DIGESTS; i++)
+                        EVP_Digest(d[i], n[i], md[i], NULL, EVP_sha256(),
+                                   NULL);
+                    break;
+                case 1:
+                    SHA256_multi(d, n, md, MB_DIGESTS);
+                    break;
+                case 2:
+                    for (i = 0; i < MB_DIGESTS; i++)
+                        HMAC(EVP_sha256(), key[i], key_len[i], d[i], n[i],
+                             md[i], NULL);
+                    break;
+                case 3:
+                    HMAC_SHA256_multi(key, key_len, d, n, md, MB_DIGESTS);
+                    break;
+                }
+            }
+            t = Time_F(STOP);
+            BIO_printf(bio_err, mr ? "+R:%d:%s:%f\n"
+                       : "%d %s's in %.2fs\n", count, mbnames[k], t);
+            dps[k][j] = ((double)count) / t;
+        }
+    }
+
+    if (mr) {
+        fprintf(stdout, "+H");
+        for (j = 0; j < num; j++)
+            fprintf(stdout, ":%d", mblengths[j]);
+        fprintf(stdout, "\n");
+        for (k = 0; k < (int)OSSL_NELEM(mbnames); k++) {
+            fprintf(stdout, "+F:%d:%s", k, mbnames[k]);
+            for (j = 0; j < num; j++)
+                fprintf(stdout, ":%.2f", dps[k][j]);
+            fprintf(stdout, "\n");
+        }
+    } else {
+        fprintf(stdout,
+                "The 'numbers' are in digests per second, %d messages "
+                "per batch.\n", MB_DIGESTS);
+        fprintf(stdout, "type                    ");
+        for (j = 0; j < num; j++)
+            fprintf(stdout, "%7d bytes", mblengths[j]);
+        fprintf(stdout, "\n");
+        for (k = 0; k < (int)OSSL_NELEM(mbnames); k++) {
+            fprintf(stdout, "%-24s", mbnames[k]);
+            for (j = 0; j < num; j++)
+                fprintf(stdout, " %11.0f ", dps[k][j]);
+            fprintf(stdout, "\n");
+        }
+    }
+
+    OPENSSL_free(inp);
+    OPENSSL_free(out);
+}
@@ -0,0 +1,417 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * AES-NI for no-asm builds. This is the subset of asm/aesni-x86_64.pl
+ * that the EVP layer calls through function pointers: key schedules,
+ * single blocks, ECB, CBC and CTR32, written with compiler intrinsics.
+ * Key schedules use the same layout as the assembly version, so rounds
+ * holds the number of rounds and rd_key the 16-byte round keys in the
+ * order AESENC and AESDEC consume them.
+ *
+ * Nothing here may be called unless AES-NI was found in
+ * OPENSSL_ia32cap_P, see AESNI_CAPABLE in crypto/evp/e_aes.c.
+ */
+
+#include <openssl/aes.h>
+#include "internal/cpu_intrin.h"
+
+#ifdef OPENSSL_IA32_INTRIN
+
+# include <immintrin.h>
+
+# define AESNI_TARGET    INTRIN_TARGET("aes,ssse3")
+
+/* Number of blocks kept in flight to cover the AESENC/AESDEC latency */
+# define AESNI_LANES     8
+
+AESNI_TARGET
+static __m128i aesni_expand_128(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/*
+ * AES-192 produces round keys six words at a time. |lo| holds the first
+ * four words of the previous group, the low half of |hi| the last two.
+ */
+AESNI_TARGET
+static void aesni_expand_192(__m128i *lo, __m128i *hi, __m128i assist)
+{
+    __m128i t;
+
+    assist = _mm_shuffle_epi32(assist, 0x55);
+    t = _mm_slli_si128(*lo, 4);
+    *lo = _mm_xor_si128(*lo, t);
+    t = _mm_slli_si128(t, 4);
+    *lo = _mm_xor_si128(*lo, t);
+    t = _mm_slli_si128(t, 4);
+    *lo = _mm_xor_si128(*lo, t);
+    *lo = _mm_xor_si128(*lo, assist);
+    assist = _mm_shuffle_epi32(*lo, 0xff);
+    t = _mm_slli_si128(*hi, 4);
+    *hi = _mm_xor_si128(*hi, t);
+    *hi = _mm_xor_si128(*hi, assist);
+}
+
+/* second half of an AES-256 step: SubWord without RotWord or Rcon */
+AESNI_TARGET
+static __m128i aesni_expand_256b(__m128i key, __m128i prev)
+{
+    __m128i assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(prev, 0),
+                                       0xaa);
+
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+# define EXPAND_128(i, rcon) \
+        rk[i] = aesni_expand_128(rk[i - 1], \
+                                 _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+# define EXPAND_192(i, rcon1, rcon2) do { \
+        aesni_expand_192(&lo, &hi, _mm_aeskeygenassist_si128(hi, rcon1)); \
+        rk[i] = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(rk[i]), \
+                                                _mm_castsi128_pd(lo), 0)); \
+        rk[i + 1] = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(lo), \
+                                                    _mm_castsi128_pd(hi), 1)); \
+        aesni_expand_192(&lo, &hi, _mm_aeskeygenassist_si128(hi, rcon2)); \
+        rk[i + 2] = lo; \
+        rk[i + 3] = hi; \
+        } while (0)
+
+# define EXPAND_256(i, rcon) do { \
+        rk[i] = aesni_expand_128(rk[i - 2], \
+                                 _mm_aeskeygenassist_si128(rk[i - 1], rcon)); \
+        rk[i + 1] = aesni_expand_256b(rk[i - 1], rk[i]); \
+        } while (0)
+
+AESNI_TARGET
+int aesni_set_encrypt_key(const unsigned char *userKey, int bits,
+                          AES_KEY *key)
+{
+    __m128i rk[AES_MAXNR + 1], lo, hi;
+    int i;
+
+    if (userKey == NULL || key == NULL)
+        return -1;
+
+    rk[0] = _mm_loadu_si128((const __m128i *)userKey);
+    switch (bits) {
+    case 128:
+        EXPAND_128(1, 0x01);
+        EXPAND_128(2, 0x02);
+        EXPAND_128(3, 0x04);
+        EXPAND_128(4, 0x08);
+        EXPAND_128(5, 0x10);
+        EXPAND_128(6, 0x20);
+        EXPAND_128(7, 0x40);
+        EXPAND_128(8, 0x80);
+        EXPAND_128(9, 0x1b);
+        EXPAND_128(10, 0x36);
+        key->rounds = 10;
+        break;
+    case 192:
+        lo = rk[0];
+        hi = rk[1] = _mm_loadl_epi64((const __m128i *)(userKey + 16));
+        EXPAND_192(1, 0x01, 0x02);
+        EXPAND_192(4, 0x04, 0x08);
+        EXPAND_192(7, 0x10, 0x20);
+        aesni_expand_192(&lo, &hi, _mm_aeskeygenassist_si128(hi, 0x40));
+        rk[10] = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(rk[10]),
+                                                 _mm_castsi128_pd(lo), 0));
+        rk[11] = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(lo),
+                                                 _mm_castsi128_pd(hi), 1));
+        aesni_expand_192(&lo, &hi, _mm_aeskeygenassist_si128(hi, 0x80));
+        rk[12] = lo;
+        key->rounds = 12;
+        break;
+    case 256:
+        rk[1] = _mm_loadu_si128((const __m128i *)(userKey + 16));
+        EXPAND_256(2, 0x01);
+        EXPAND_256(4, 0x02);
+        EXPAND_256(6, 0x04);
+        EXPAND_256(8, 0x08);
+        EXPAND_256(10, 0x10);
+        EXPAND_256(12, 0x20);
+        rk[14] = aesni_expand_128(rk[12],
+                                  _mm_aeskeygenassist_si128(rk[13], 0x40));
+        key->rounds = 14;
+        break;
+    default:
+        return -2;
+    }
+
+    for (i = 0; i <= key->rounds; i++)
+        _mm_storeu_si128((__m128i *)key->rd_key + i, rk[i]);
+
+    return 0;
+}
+
+AESNI_TARGET
+int aesni_set_decrypt_key(const unsigned char *userKey, int bits,
+                          AES_KEY *key)
+{
+    __m128i *rk = (__m128i *)key->rd_key;
+    __m128i t;
+    int ret, i, j;
+
+    if ((ret = aesni_set_encrypt_key(userKey, bits, key)) != 0)
+        return ret;
+
+    /* reverse the schedule, InvMixColumns on all but the outer keys */
+    for (i = 0, j = key->rounds; i < j; i++, j--) {
+        t = _mm_loadu_si128(rk + i);
+        _mm_storeu_si128(rk + i, _mm_loadu_si128(rk + j));
+        _mm_storeu_si128(rk + j, t);
+    }
+    for (i = 1; i < key->rounds; i++)
+        _mm_storeu_si128(rk + i, _mm_aesimc_si128(_mm_loadu_si128(rk + i)));
+
+    return 0;
+}
+
+AESNI_TARGET
+static int aesni_load_key(__m128i rk[AES_MAXNR + 1], const AES_KEY *key)
+{
+    int i;
+
+    for (i = 0; i <= key->rounds; i++)
+        rk[i] = _mm_loadu_si128((const __m128i *)key->rd_key + i);
+
+    return key->rounds;
+}
+
+AESNI_TARGET
+static __m128i aesni_encrypt1(__m128i b, const __m128i *rk, int rounds)
+{
+    int r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < rounds; r++)
+        b = _mm_aesenc_si128(b, rk[r]);
+    return _mm_aesenclast_si128(b, rk[rounds]);
+}
+
+AESNI_TARGET
+static __m128i aesni_decrypt1(__m128i b, const __m128i *rk, int rounds)
+{
+    int r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < rounds; r++)
+        b = _mm_aesdec_si128(b, rk[r]);
+    return _mm_aesdeclast_si128(b, rk[rounds]);
+}
+
+AESNI_TARGET
+static void aesni_encrypt8(__m128i b[AESNI_LANES], const __m128i *rk,
+                           int rounds)
+{
+    int r, j;
+
+    for (j = 0; j < AESNI_LANES; j++)
+        b[j] = _mm_xor_si128(b[j], rk[0]);
+    for (r = 1; r < rounds; r++)
+        for (j = 0; j < AESNI_LANES; j++)
+            b[j] = _mm_aesenc_si128(b[j], rk[r]);
+    for (j = 0; j < AESNI_LANES; j++)
+        b[j] = _mm_aesenclast_si128(b[j], rk[rounds]);
+}
+
+AESNI_TARGET
+static void aesni_decrypt8(__m128i b[AESNI_LANES], const __m128i *rk,
+                           int rounds)
+{
+    int r, j;
+
+    for (j = 0; j < AESNI_LANES; j++)
+        b[j] = _mm_xor_si128(b[j], rk[0]);
+    for (r = 1; r < rounds; r++)
+        for (j = 0; j < AESNI_LANES; j++)
+            b[j] = _mm_aesdec_si128(b[j], rk[r]);
+    for (j = 0; j < AESNI_LANES; j++)
+        b[j] = _mm_aesdeclast_si128(b[j], rk[rounds]);
+}
+
+AESNI_TARGET
+void aesni_encrypt(const unsigned char *in, unsigned char *out,
+                   const AES_KEY *key)
+{
+    const __m128i *rk = (const __m128i *)key->rd_key;
+    __m128i b = _mm_loadu_si128((const __m128i *)in);
+    int r;
+
+    b = _mm_xor_si128(b, _mm_loadu_si128(rk));
+    for (r = 1; r < key->rounds; r++)
+        b = _mm_aesenc_si128(b, _mm_loadu_si128(rk + r));
+    b = _mm_aesenclast_si128(b, _mm_loadu_si128(rk + r));
+    _mm_storeu_si128((__m128i *)out, b);
+}
+
+AESNI_TARGET
+void aesni_decrypt(const unsigned char *in, unsigned char *out,
+                   const AES_KEY *key)
+{
+    const __m128i *rk = (const __m128i *)key->rd_key;
+    __m128i b = _mm_loadu_si128((const __m128i *)in);
+    int r;
+
+    b = _mm_xor_si128(b, _mm_loadu_si128(rk));
+    for (r = 1; r < key->rounds; r++)
+        b = _mm_aesdec_si128(b, _mm_loadu_si128(rk + r));
+    b = _mm_aesdeclast_si128(b, _mm_loadu_si128(rk + r));
+    _mm_storeu_si128((__m128i *)out, b);
+}
+
+/* |length| is in bytes, a trailing partial block is left alone */
+AESNI_TARGET
+void aesni_ecb_encrypt(const unsigned char *in, unsigned char *out,
+                       size_t length, const AES_KEY *key, int enc)
+{
+    __m128i rk[AES_MAXNR + 1], b[AESNI_LANES];
+    size_t blocks = length / 16;
+    int rounds = aesni_load_key(rk, key), j;
+
+    while (blocks >= AESNI_LANES) {
+        for (j = 0; j < AESNI_LANES; j++)
+            b[j] = _mm_loadu_si128((const __m128i *)in + j);
+        if (enc)
+            aesni_encrypt8(b, rk, rounds);
+        else
+            aesni_decrypt8(b, rk, rounds);
+        for (j = 0; j < AESNI_LANES; j++)
+            _mm_storeu_si128((__m128i *)out + j, b[j]);
+        in += 16 * AESNI_LANES;
+        out += 16 * AESNI_LANES;
+        blocks -= AESNI_LANES;
+    }
+    while (blocks--) {
+        b[0] = _mm_loadu_si128((const __m128i *)in);
+        b[0] = enc ? aesni_encrypt1(b[0], rk, rounds)
+                   : aesni_decrypt1(b[0], rk, rounds);
+        _mm_storeu_si128((__m128i *)out, b[0]);
+        in += 16;
+        out += 16;
+    }
+}
+
+/*
+ * Like CRYPTO_cbc128_encrypt, a trailing partial block is zero padded
+ * when encrypting. Decryption works on whole blocks, which is all the
+ * EVP layer hands in.
+ */
+AESNI_TARGET
+void aesni_cbc_encrypt(const unsigned char *in, unsigned char *out,
+                       size_t length, const AES_KEY *key,
+                       unsigned char *ivec, int enc)
+{
+    __m128i rk[AES_MAXNR + 1], b[AESNI_LANES], c[AESNI_LANES];
+    __m128i iv = _mm_loadu_si128((const __m128i *)ivec);
+    int rounds = aesni_load_key(rk, key), j;
+
+    if (enc) {
+        while (length >= 16) {
+            iv = _mm_xor_si128(iv, _mm_loadu_si128((const __m128i *)in));
+            iv = aesni_encrypt1(iv, rk, rounds);
+            _mm_storeu_si128((__m128i *)out, iv);
+            in += 16;
+            out += 16;
+            length -= 16;
+        }
+        if (length > 0) {
+            unsigned char tmp[16];
+            size_t n;
+
+            for (n = 0; n < length; n++)
+                tmp[n] = in[n];
+            for (; n < 16; n++)
+                tmp[n] = 0;
+            iv = _mm_xor_si128(iv, _mm_loadu_si128((const __m128i *)tmp));
+            iv = aesni_encrypt1(iv, rk, rounds);
+            _mm_storeu_si128((__m128i *)out, iv);
+        }
+    } else {
+        while (length >= 16 * AESNI_LANES) {
+            for (j = 0; j < AESNI_LANES; j++)
+                b[j] = c[j] = _mm_loadu_si128((const __m128i *)in + j);
+            aesni_decrypt8(b, rk, rounds);
+            _mm_storeu_si128((__m128i *)out, _mm_xor_si128(b[0], iv));
+            for (j = 1; j < AESNI_LANES; j++)
+                _mm_storeu_si128((__m128i *)out + j,
+                                 _mm_xor_si128(b[j], c[j - 1]));
+            iv = c[AESNI_LANES - 1];
+            in += 16 * AESNI_LANES;
+            out += 16 * AESNI_LANES;
+            length -= 16 * AESNI_LANES;
+        }
+        while (length >= 16) {
+            c[0] = _mm_loadu_si128((const __m128i *)in);
+            b[0] = aesni_decrypt1(c[0], rk, rounds);
+            _mm_storeu_si128((__m128i *)out, _mm_xor_si128(b[0], iv));
+            iv = c[0];
+            in += 16;
+            out += 16;
+            length -= 16;
+        }
+    }
+    _mm_storeu_si128((__m128i *)ivec, iv);
+}
+
+/*
+ * The last four bytes of |ivec| are a big-endian counter that wraps
+ * modulo 2^32, |ivec| itself is not updated. The counter block is kept
+ * byte reversed so that the counter sits in the low 32-bit lane.
+ */
+AESNI_TARGET
+void aesni_ctr32_encrypt_blocks(const unsigned char *in, unsigned char *out,
+                                size_t blocks, const void *key,
+                                const unsigned char *ivec)
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+    __m128i rk[AES_MAXNR + 1], b[AESNI_LANES];
+    __m128i ctr = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ivec),
+                                   bswap);
+    int rounds = aesni_load_key(rk, key), j;
+
+    while (blocks >= AESNI_LANES) {
+        for (j = 0; j < AESNI_LANES; j++) {
+            b[j] = _mm_shuffle_epi8(ctr, bswap);
+            ctr = _mm_add_epi32(ctr, one);
+        }
+        aesni_encrypt8(b, rk, rounds);
+        for (j = 0; j < AESNI_LANES; j++)
+            _mm_storeu_si128((__m128i *)out + j,
+                             _mm_xor_si128(b[j],
+                                           _mm_loadu_si128((const __m128i *)in
+                                                           + j)));
+        in += 16 * AESNI_LANES;
+        out += 16 * AESNI_LANES;
+        blocks -= AESNI_LANES;
+    }
+    while (blocks--) {
+        b[0] = aesni_encrypt1(_mm_shuffle_epi8(ctr, bswap), rk, rounds);
+        ctr = _mm_add_epi32(ctr, one);
+        _mm_storeu_si128((__m128i *)out,
+                         _mm_xor_si128(b[0],
+                                       _mm_loadu_si128((const __m128i *)in)));
+        in += 16;
+        out += 16;
+    }
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <string.h>
 
 #include "internal/chacha.h"
+#include "internal/cpu_intrin.h"
 
 typedef unsigned int u32;
 typedef unsigned char u8;
@@ -20,6 +21,16 @@ typedef union {
     u8 c[64];
 } chacha_buf;
 
+#if defined(OPENSSL_IA32_INTRIN)
+extern unsigned int OPENSSL_ia32cap_P[];
+size_t ChaCha20_sse2(unsigned char *out, const unsigned char *inp,
+                     size_t len, const unsigned int input[16]);
+size_t ChaCha20_avx2(unsigned char *out, const unsigned char *inp,
+                     size_t len, const unsigned int input[16]);
+# define SSE2_CAPABLE    (OPENSSL_ia32cap_P[0] & (1 << 26))
+# define AVX2_CAPABLE    (OPENSSL_ia32cap_P[2] & (1 << 5))
+#endif
+
 # define ROTATE(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
 
 # define U32TO8_LITTLE(p, v) do { \
@@ -97,6 +108,28 @@ void ChaCha20_ctr32(unsigned char *out, const unsigned char *inp,
     input[14] = counter[2];
     input[15] = counter[3];
 
+#if defined(OPENSSL_IA32_INTRIN)
+    /*
+     * The multi-block code only does whole 4- or 8-block strides, the
+     * rest is left to the loop below. It wraps the 32-bit counter the
+     * same way.
+     */
+    if (AVX2_CAPABLE && len >= 8 * sizeof(buf)) {
+        todo = ChaCha20_avx2(out, inp, len, input);
+        out += todo;
+        inp += todo;
+        len -= todo;
+        input[12] += (u32)(todo / sizeof(buf));
+    }
+    if (SSE2_CAPABLE && len >= 4 * sizeof(buf)) {
+        todo = ChaCha20_sse2(out, inp, len, input);
+        out += todo;
+        inp += todo;
+        len -= todo;
+        input[12] += (u32)(todo / sizeof(buf));
+    }
+#endif
+
     while (len > 0) {
         todo = sizeof(buf);
         if (len < todo)
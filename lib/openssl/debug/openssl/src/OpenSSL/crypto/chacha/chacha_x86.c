@@ -0,0 +1,224 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * Multi-block ChaCha20 for no-asm builds on x86, after the 4x and 8x
+ * code paths of asm/chacha-x86_64.pl. Each vector register holds the
+ * same state word of 4 (SSE2) or 8 (AVX2) consecutive blocks, so the
+ * rounds are the scalar ones applied lane-wise and the keystream is
+ * transposed back into block order only when it is XORed in.
+ *
+ * Both functions take the 16-word input block prepared by
+ * ChaCha20_ctr32, do as many whole 4- or 8-block strides as |len|
+ * allows and return the number of bytes processed. Nothing here may be
+ * called unless the matching bit was found in OPENSSL_ia32cap_P, see
+ * crypto/chacha/chacha_enc.c.
+ */
+
+#include <stddef.h>
+#include "internal/cpu_intrin.h"
+
+#ifdef OPENSSL_IA32_INTRIN
+
+# include <immintrin.h>
+
+# define SSE2_TARGET     INTRIN_TARGET("sse2")
+# define AVX2_TARGET     INTRIN_TARGET("avx2")
+
+# define ROTL_SSE2(v, n) \
+        _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+# define ROTL16_SSE2(v) \
+        _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1)
+
+# define QUARTERROUND_SSE2(a,b,c,d) ( \
+        x[a] = _mm_add_epi32(x[a], x[b]), \
+        x[d] = ROTL16_SSE2(_mm_xor_si128(x[d], x[a])), \
+        x[c] = _mm_add_epi32(x[c], x[d]), \
+        x[b] = ROTL_SSE2(_mm_xor_si128(x[b], x[c]), 12), \
+        x[a] = _mm_add_epi32(x[a], x[b]), \
+        x[d] = ROTL_SSE2(_mm_xor_si128(x[d], x[a]), 8), \
+        x[c] = _mm_add_epi32(x[c], x[d]), \
+        x[b] = ROTL_SSE2(_mm_xor_si128(x[b], x[c]), 7) )
+
+/*
+ * Transposes state words |w|..|w|+3 of the four blocks and XORs them
+ * into bytes 4*|w|..4*|w|+15 of each block.
+ */
+SSE2_TARGET
+static void chacha20_xor4_sse2(unsigned char *out, const unsigned char *inp,
+                               const __m128i *x, int w)
+{
+    __m128i t0, t1, t2, t3, r[4];
+    int i;
+
+    t0 = _mm_unpacklo_epi32(x[w + 0], x[w + 1]);
+    t1 = _mm_unpacklo_epi32(x[w + 2], x[w + 3]);
+    t2 = _mm_unpackhi_epi32(x[w + 0], x[w + 1]);
+    t3 = _mm_unpackhi_epi32(x[w + 2], x[w + 3]);
+    r[0] = _mm_unpacklo_epi64(t0, t1);
+    r[1] = _mm_unpackhi_epi64(t0, t1);
+    r[2] = _mm_unpacklo_epi64(t2, t3);
+    r[3] = _mm_unpackhi_epi64(t2, t3);
+
+    for (i = 0; i < 4; i++) {
+        const __m128i *src = (const __m128i *)(inp + 64 * i + 4 * w);
+
+        _mm_storeu_si128((__m128i *)(out + 64 * i + 4 * w),
+                         _mm_xor_si128(_mm_loadu_si128(src), r[i]));
+    }
+}
+
+SSE2_TARGET
+size_t ChaCha20_sse2(unsigned char *out, const unsigned char *inp,
+                     size_t len, const unsigned int input[16])
+{
+    __m128i x[16], s[16];
+    size_t done = 0;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        s[i] = _mm_set1_epi32((int)input[i]);
+    s[12] = _mm_add_epi32(s[12], _mm_setr_epi32(0, 1, 2, 3));
+
+    while (len - done >= 4 * 64) {
+        for (i = 0; i < 16; i++)
+            x[i] = s[i];
+
+        for (i = 20; i > 0; i -= 2) {
+            QUARTERROUND_SSE2(0, 4, 8, 12);
+            QUARTERROUND_SSE2(1, 5, 9, 13);
+            QUARTERROUND_SSE2(2, 6, 10, 14);
+            QUARTERROUND_SSE2(3, 7, 11, 15);
+            QUARTERROUND_SSE2(0, 5, 10, 15);
+            QUARTERROUND_SSE2(1, 6, 11, 12);
+            QUARTERROUND_SSE2(2, 7, 8, 13);
+            QUARTERROUND_SSE2(3, 4, 9, 14);
+        }
+
+        for (i = 0; i < 16; i++)
+            x[i] = _mm_add_epi32(x[i], s[i]);
+        for (i = 0; i < 16; i += 4)
+            chacha20_xor4_sse2(out + done, inp + done, x, i);
+
+        s[12] = _mm_add_epi32(s[12], _mm_set1_epi32(4));
+        done += 4 * 64;
+    }
+
+    return done;
+}
+
+# define ROTL_AVX2(v, n) \
+        _mm256_or_si256(_mm256_slli_epi32(v, n), \
+                        _mm256_srli_epi32(v, 32 - (n)))
+
+# define QUARTERROUND_AVX2(a,b,c,d) ( \
+        x[a] = _mm256_add_epi32(x[a], x[b]), \
+        x[d] = _mm256_shuffle_epi8(_mm256_xor_si256(x[d], x[a]), rot16), \
+        x[c] = _mm256_add_epi32(x[c], x[d]), \
+        x[b] = ROTL_AVX2(_mm256_xor_si256(x[b], x[c]), 12), \
+        x[a] = _mm256_add_epi32(x[a], x[b]), \
+        x[d] = _mm256_shuffle_epi8(_mm256_xor_si256(x[d], x[a]), rot8), \
+        x[c] = _mm256_add_epi32(x[c], x[d]), \
+        x[b] = ROTL_AVX2(_mm256_xor_si256(x[b], x[c]), 7) )
+
+/*
+ * As chacha20_xor4_sse2, except that the unpacks work within 128-bit
+ * halves: the low half of r[i] ends up holding block i and the high
+ * half block i+4.
+ */
+AVX2_TARGET
+static void chacha20_transpose8_avx2(__m256i r[4], const __m256i *x, int w)
+{
+    __m256i t0, t1, t2, t3;
+
+    t0 = _mm256_unpacklo_epi32(x[w + 0], x[w + 1]);
+    t1 = _mm256_unpacklo_epi32(x[w + 2], x[w + 3]);
+    t2 = _mm256_unpackhi_epi32(x[w + 0], x[w + 1]);
+    t3 = _mm256_unpackhi_epi32(x[w + 2], x[w + 3]);
+    r[0] = _mm256_unpacklo_epi64(t0, t1);
+    r[1] = _mm256_unpackhi_epi64(t0, t1);
+    r[2] = _mm256_unpacklo_epi64(t2, t3);
+    r[3] = _mm256_unpackhi_epi64(t2, t3);
+}
+
+AVX2_TARGET
+static void chacha20_xor32_avx2(unsigned char *out, const unsigned char *inp,
+                                __m256i k)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i *)inp);
+
+    _mm256_storeu_si256((__m256i *)out, _mm256_xor_si256(v, k));
+}
+
+AVX2_TARGET
+size_t ChaCha20_avx2(unsigned char *out, const unsigned char *inp,
+                     size_t len, const unsigned int input[16])
+{
+    const __m256i rot16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5,
+                                           10, 11, 8, 9, 14, 15, 12, 13,
+                                           2, 3, 0, 1, 6, 7, 4, 5,
+                                           10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i rot8 = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6,
+                                          11, 8, 9, 10, 15, 12, 13, 14,
+                                          3, 0, 1, 2, 7, 4, 5, 6,
+                                          11, 8, 9, 10, 15, 12, 13, 14);
+    __m256i x[16], s[16], a[4], b[4], c[4], d[4];
+    size_t done = 0;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        s[i] = _mm256_set1_epi32((int)input[i]);
+    s[12] = _mm256_add_epi32(s[12], _mm256_setr_epi32(0, 1, 2, 3,
+                                                      4, 5, 6, 7));
+
+    while (len - done >= 8 * 64) {
+        unsigned char *o = out + done;
+        const unsigned char *p = inp + done;
+
+        for (i = 0; i < 16; i++)
+            x[i] = s[i];
+
+        for (i = 20; i > 0; i -= 2) {
+            QUARTERROUND_AVX2(0, 4, 8, 12);
+            QUARTERROUND_AVX2(1, 5, 9, 13);
+            QUARTERROUND_AVX2(2, 6, 10, 14);
+            QUARTERROUND_AVX2(3, 7, 11, 15);
+            QUARTERROUND_AVX2(0, 5, 10, 15);
+            QUARTERROUND_AVX2(1, 6, 11, 12);
+            QUARTERROUND_AVX2(2, 7, 8, 13);
+            QUARTERROUND_AVX2(3, 4, 9, 14);
+        }
+
+        for (i = 0; i < 16; i++)
+            x[i] = _mm256_add_epi32(x[i], s[i]);
+        chacha20_transpose8_avx2(a, x, 0);
+        chacha20_transpose8_avx2(b, x, 4);
+        chacha20_transpose8_avx2(c, x, 8);
+        chacha20_transpose8_avx2(d, x, 12);
+
+        /* block i is the low halves of a[i]..d[i], block i+4 the high */
+        for (i = 0; i < 4; i++) {
+            chacha20_xor32_avx2(o + 64 * i, p + 64 * i,
+                                _mm256_permute2x128_si256(a[i], b[i], 0x20));
+            chacha20_xor32_avx2(o + 64 * i + 32, p + 64 * i + 32,
+                                _mm256_permute2x128_si256(c[i], d[i], 0x20));
+            chacha20_xor32_avx2(o + 64 * i + 256, p + 64 * i + 256,
+                                _mm256_permute2x128_si256(a[i], b[i], 0x31));
+            chacha20_xor32_avx2(o + 64 * i + 288, p + 64 * i + 288,
+                                _mm256_permute2x128_si256(c[i], d[i], 0x31));
+        }
+
+        s[12] = _mm256_add_epi32(s[12], _mm256_set1_epi32(8));
+        done += 8 * 64;
+    }
+
+    return done;
+}
+
+#endif
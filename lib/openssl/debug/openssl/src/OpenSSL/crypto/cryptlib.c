@@ -14,6 +14,7 @@
  */
 
 #include "internal/cryptlib_int.h"
+#include "internal/cpu_intrin.h"
 #include <openssl/safestack.h>
 
 #if     defined(__i386)   || defined(__i386__)   || defined(_M_IX86) || \
@@ -22,7 +23,8 @@
 
 extern unsigned int OPENSSL_ia32cap_P[4];
 
-# if defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_ASM) && !defined(I386_ONLY)
+# if (defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_ASM) && \
+      !defined(I386_ONLY)) || defined(OPENSSL_IA32_INTRIN)
 
 /*
  * Purpose of these minimalistic and character-type-agnostic subroutines
@@ -98,6 +100,51 @@ static variant_char *ossl_strchr(const variant_char *str, char srch)
 #  define OPENSSL_CPUID_SETUP
 typedef uint64_t IA32CAP;
 
+#  ifdef OPENSSL_IA32_INTRIN
+#   include <cpuid.h>
+
+unsigned int OPENSSL_ia32cap_P[4];
+
+/*
+ * C version of x86[_64]cpuid.pl's OPENSSL_ia32_cpuid for no-asm builds.
+ * It fills in the same capability vector: CPUID.1:EDX and CPUID.1:ECX are
+ * returned, CPUID.7:EBX and CPUID.7:ECX go to p[2] and p[3]. Extensions
+ * whose register state the OS does not save are masked off.
+ */
+IA32CAP OPENSSL_ia32_cpuid(unsigned int *p)
+{
+    unsigned int eax, ebx, ecx, edx, xcr0 = 0;
+    unsigned int max = __get_cpuid_max(0, NULL);
+
+    p[2] = p[3] = 0;
+    if (max < 1)
+        return 0;
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (max >= 7) {
+        unsigned int ebx7, ecx7, edx7;
+
+        __cpuid_count(7, 0, eax, ebx7, ecx7, edx7);
+        p[2] = ebx7;
+        p[3] = ecx7;
+    }
+
+    if (ecx & (1 << 27))        /* OSXSAVE */
+        __asm__ ("xgetbv" : "=a"(xcr0) : "c"(0) : "%edx");
+    if ((xcr0 & 6) != 6) {
+        /* no YMM state: mask AVX, FMA, AVX2, VAES and VPCLMULQDQ */
+        ecx &= ~(1U << 28 | 1U << 12);
+        p[2] &= ~(1U << 5);
+        p[3] &= ~(1U << 9 | 1U << 10);
+    }
+    if ((xcr0 & 0xe6) != 0xe6)  /* no ZMM state: mask AVX512 */
+        p[2] &= ~(1U << 16 | 1U << 17 | 1U << 21 | 1U << 26 |
+                  1U << 27 | 1U << 28 | 1U << 30 | 1U << 31);
+
+    return (IA32CAP)ecx << 32 | edx;
+}
+#  endif
+
 void OPENSSL_cpuid_setup(void)
 {
     static int trigger = 0;
@@ -15,6 +15,7 @@
 #include <assert.h>
 #include <openssl/aes.h>
 #include "internal/evp_int.h"
+#include "internal/cpu_intrin.h"
 #include "modes_lcl.h"
 #include <openssl/rand.h>
 #include "evp_locl.h"
@@ -160,11 +161,12 @@ void AES_xts_decrypt(const char *inp, char *out, size_t len,
 # define HWAES_xts_decrypt aes_p8_xts_decrypt
 #endif
 
-#if     defined(AES_ASM) && !defined(I386_ONLY) &&      (  \
+#if    (defined(AES_ASM) && !defined(I386_ONLY) &&      (  \
         ((defined(__i386)       || defined(__i386__)    || \
           defined(_M_IX86)) && defined(OPENSSL_IA32_SSE2))|| \
         defined(__x86_64)       || defined(__x86_64__)  || \
-        defined(_M_AMD64)       || defined(_M_X64)      )
+        defined(_M_AMD64)       || defined(_M_X64)      )) || \
+        defined(OPENSSL_IA32_INTRIN)
 
 extern unsigned int OPENSSL_ia32cap_P[];
 
@@ -202,6 +204,18 @@ void aesni_ctr32_encrypt_blocks(const unsigned char *in,
                                 size_t blocks,
                                 const void *key, const unsigned char *ivec);
 
+# ifdef OPENSSL_IA32_INTRIN
+/*
+ * crypto/aes/aes_ni.c has no XTS, CCM and OCB subroutines, these modes
+ * run the generic code over aesni_encrypt and aesni_decrypt.
+ */
+#  define aesni_xts_encrypt NULL
+#  define aesni_xts_decrypt NULL
+#  define aesni_ccm64_encrypt_blocks NULL
+#  define aesni_ccm64_decrypt_blocks NULL
+#  define aesni_ocb_encrypt NULL
+#  define aesni_ocb_decrypt NULL
+# else
 void aesni_xts_encrypt(const unsigned char *in,
                        unsigned char *out,
                        size_t length,
@@ -227,8 +241,10 @@ void aesni_ccm64_decrypt_blocks(const unsigned char *in,
                                 const void *key,
                                 const unsigned char ivec[16],
                                 unsigned char cmac[16]);
+# endif
 
-# if defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
+# if defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || \
+     defined(_M_X64) || defined(OPENSSL_IA32_INTRIN)
 size_t aesni_gcm_encrypt(const unsigned char *in,
                          unsigned char *out,
                          size_t len,
@@ -239,6 +255,10 @@ size_t aesni_gcm_decrypt(const unsigned char *in,
                          size_t len,
                          const void *key, unsigned char ivec[16], u64 *Xi);
 #  define AES_gcm_decrypt aesni_gcm_decrypt
+#  ifdef OPENSSL_IA32_INTRIN
+/* gcm_clmul.c, whose stitched loop works with its own Htable layout */
+#   define gcm_ghash_avx gcm_ghash_clmul
+#  endif
 void gcm_ghash_avx(u64 Xi[2], const u128 Htable[16], const u8 *in,
                    size_t len);
 #  define AES_GCM_ASM(gctx)       (gctx->ctr==aesni_ctr32_encrypt_blocks && \
@@ -430,7 +450,7 @@ static int aesni_ccm_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
 static int aesni_ccm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
                             const unsigned char *in, size_t len);
 
-# ifndef OPENSSL_NO_OCB
+# if !defined(OPENSSL_NO_OCB) && !defined(OPENSSL_IA32_INTRIN)
 void aesni_ocb_encrypt(const unsigned char *in, unsigned char *out,
                        size_t blocks, const void *key,
                        size_t start_block_num,
@@ -443,7 +463,9 @@ void aesni_ocb_decrypt(const unsigned char *in, unsigned char *out,
                        unsigned char offset_i[16],
                        const unsigned char L_[][16],
                        unsigned char checksum[16]);
+# endif
 
+# ifndef OPENSSL_NO_OCB
 static int aesni_ocb_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
                               const unsigned char *iv, int enc)
 {
@@ -13,6 +13,7 @@
 #include "internal/cryptlib.h"
 #include <openssl/hmac.h>
 #include <openssl/opensslconf.h>
+#include "internal/sha.h"
 #include "hmac_lcl.h"
 
 int HMAC_Init_ex(HMAC_CTX *ctx, const void *key, int len,
@@ -238,3 +239,12 @@ const EVP_MD *HMAC_CTX_get_md(const HMAC_CTX *ctx)
 {
     return ctx->md;
 }
+
+int HMAC_SHA256_multi(const unsigned char *const key[], const int key_len[],
+                      const unsigned char *const d[], const size_t n[],
+                      unsigned char *const md[], size_t num)
+{
+    if (key == NULL && num != 0)
+        return 0;
+    return sha256_multi(key, key_len, d, n, md, num);
+}
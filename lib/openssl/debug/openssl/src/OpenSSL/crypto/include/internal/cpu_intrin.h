@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef HEADER_CPU_INTRIN_H
+# define HEADER_CPU_INTRIN_H
+
+# include <openssl/opensslconf.h>
+
+/*
+ * no-asm builds have neither the perlasm modules nor the assembly
+ * OPENSSL_cpuid_setup. With a compiler that can target instruction set
+ * extensions per function, the C intrinsics code paths stand in for them:
+ * OPENSSL_cpuid_setup fills in OPENSSL_ia32cap_P from C and the algorithms
+ * pick the intrinsics code at run time.
+ *
+ * OPENSSL_IA32_INTRIN  x86 and x86_64, gcc 4.9+ or clang 3.8+
+ */
+# if !defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_INTRIN)
+#  if (defined(__i386) || defined(__i386__) || \
+       defined(__x86_64) || defined(__x86_64__)) && !defined(I386_ONLY)
+#   if (defined(__clang__) && (__clang_major__ > 3 || \
+                               (__clang_major__ == 3 && __clang_minor__ >= 8))) || \
+       (!defined(__clang__) && defined(__GNUC__) && \
+        (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#    define OPENSSL_IA32_INTRIN
+#   endif
+#  endif
+# endif
+
+/*
+ * Code that runs only once the matching capability bit was seen is
+ * compiled for that extension with INTRIN_TARGET, the rest of the
+ * library keeps the baseline instruction set.
+ */
+# ifdef OPENSSL_IA32_INTRIN
+#  define INTRIN_TARGET(isa)     __attribute__ ((target(isa)))
+# endif
+
+#endif
@@ -0,0 +1,26 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef HEADER_INTERNAL_SHA_H
+# define HEADER_INTERNAL_SHA_H
+
+# include <stddef.h>
+
+/*
+ * The multi-buffer SHA-256 behind SHA256_multi() and HMAC_SHA256_multi().
+ * With |key| NULL it hashes the |num| messages d[i] of n[i] bytes into
+ * md[i], otherwise it computes their HMACs under key[i] of key_len[i] bytes.
+ * Returns 1 on success, or 0 without writing any digest if an argument is
+ * invalid.
+ */
+int sha256_multi(const unsigned char *const key[], const int key_len[],
+                 const unsigned char *const d[], const size_t n[],
+                 unsigned char *const md[], size_t num);
+
+#endif
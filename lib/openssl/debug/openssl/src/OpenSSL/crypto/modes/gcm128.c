@@ -9,6 +9,7 @@
 
 #include <openssl/crypto.h>
 #include "modes_lcl.h"
+#include "internal/cpu_intrin.h"
 #include <string.h>
 
 #if defined(BSWAP4) && defined(STRICT_ALIGNMENT)
@@ -628,7 +629,8 @@ static void gcm_gmult_1bit(u64 Xi[2], const u64 H[2])
 
 #endif
 
-#if     TABLE_BITS==4 && (defined(GHASH_ASM) || defined(OPENSSL_CPUID_OBJ))
+#if     TABLE_BITS==4 && (defined(GHASH_ASM) || defined(OPENSSL_CPUID_OBJ) || \
+                          defined(OPENSSL_IA32_INTRIN))
 # if    !defined(I386_ONLY) && \
         (defined(__i386)        || defined(__i386__)    || \
          defined(__x86_64)      || defined(__x86_64__)  || \
@@ -642,7 +644,11 @@ void gcm_gmult_clmul(u64 Xi[2], const u128 Htable[16]);
 void gcm_ghash_clmul(u64 Xi[2], const u128 Htable[16], const u8 *inp,
                      size_t len);
 
-#  if defined(__i386) || defined(__i386__) || defined(_M_IX86)
+/*
+ * The intrinsics in gcm_clmul.c have no separate AVX flavour.
+ */
+#  if defined(__i386) || defined(__i386__) || defined(_M_IX86) || \
+      defined(OPENSSL_IA32_INTRIN)
 #   define gcm_init_avx   gcm_init_clmul
 #   define gcm_gmult_avx  gcm_gmult_clmul
 #   define gcm_ghash_avx  gcm_ghash_clmul
@@ -653,7 +659,8 @@ void gcm_ghash_avx(u64 Xi[2], const u128 Htable[16], const u8 *inp,
                    size_t len);
 #  endif
 
-#  if   defined(__i386) || defined(__i386__) || defined(_M_IX86)
+#  if   (defined(__i386) || defined(__i386__) || defined(_M_IX86)) && \
+        !defined(OPENSSL_IA32_INTRIN)
 #   define GHASH_ASM_X86
 void gcm_gmult_4bit_mmx(u64 Xi[2], const u128 Htable[16]);
 void gcm_ghash_4bit_mmx(u64 Xi[2], const u128 Htable[16], const u8 *inp,
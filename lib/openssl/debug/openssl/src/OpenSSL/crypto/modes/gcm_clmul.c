@@ -0,0 +1,353 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * PCLMULQDQ GHASH for no-asm builds, the intrinsics counterpart of the
+ * gcm_*_clmul subroutines in asm/ghash-x86_64.pl, plus the stitched
+ * AES-CTR+GHASH loop of asm/aesni-gcm-x86_64.pl.
+ *
+ * As in the assembly version the hash key is "twisted", H<<1 reduced
+ * modulo the polynomial, so that the product of byte-reversed operands
+ * needs no extra shift. Htable holds
+ *
+ *      Htable[0..3]    H, H^2, H^3, H^4
+ *      Htable[4..7]    hi^lo of each of them, for Karatsuba
+ *
+ * and gcm_ghash_clmul multiplies four blocks by H^4..H before doing a
+ * single reduction.
+ *
+ * Nothing here may be called unless PCLMULQDQ was found in
+ * OPENSSL_ia32cap_P, see CRYPTO_gcm128_init.
+ */
+
+#include <stddef.h>
+#include <openssl/crypto.h>
+#include <openssl/aes.h>
+#include "modes_lcl.h"
+#include "internal/cpu_intrin.h"
+
+#ifdef OPENSSL_IA32_INTRIN
+
+# include <immintrin.h>
+
+# define CLMUL_TARGET    INTRIN_TARGET("pclmul,ssse3")
+# define AESGCM_TARGET   INTRIN_TARGET("aes,pclmul,ssse3")
+
+/* Blocks per iteration of the stitched loop, two GHASH aggregates */
+# define AESGCM_LANES    8
+
+typedef struct {
+    __m128i lo, hi, mid;
+} GCM_ACC;
+
+CLMUL_TARGET
+static __m128i gcm_bswap(__m128i x)
+{
+    return _mm_shuffle_epi8(x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                            8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+/* add x*h to the unreduced 256-bit sum, |hk| is hi^lo of |h| */
+CLMUL_TARGET
+static void gcm_mul_acc(GCM_ACC *acc, __m128i x, __m128i h, __m128i hk)
+{
+    __m128i xk = _mm_xor_si128(x, _mm_shuffle_epi32(x, 0x4e));
+
+    acc->lo = _mm_xor_si128(acc->lo, _mm_clmulepi64_si128(x, h, 0x00));
+    acc->hi = _mm_xor_si128(acc->hi, _mm_clmulepi64_si128(x, h, 0x11));
+    acc->mid = _mm_xor_si128(acc->mid, _mm_clmulepi64_si128(xk, hk, 0x00));
+}
+
+CLMUL_TARGET
+static void gcm_mul_first(GCM_ACC *acc, __m128i x, __m128i h, __m128i hk)
+{
+    __m128i xk = _mm_xor_si128(x, _mm_shuffle_epi32(x, 0x4e));
+
+    acc->lo = _mm_clmulepi64_si128(x, h, 0x00);
+    acc->hi = _mm_clmulepi64_si128(x, h, 0x11);
+    acc->mid = _mm_clmulepi64_si128(xk, hk, 0x00);
+}
+
+/* Karatsuba fix-up and reduction_alg9 of ghash-x86_64.pl */
+CLMUL_TARGET
+static __m128i gcm_reduce(const GCM_ACC *acc)
+{
+    __m128i mid = _mm_xor_si128(acc->mid, _mm_xor_si128(acc->lo, acc->hi));
+    __m128i xi = _mm_xor_si128(acc->lo, _mm_slli_si128(mid, 8));
+    __m128i xhi = _mm_xor_si128(acc->hi, _mm_srli_si128(mid, 8));
+    __m128i t1, t2;
+
+    /* 1st phase */
+    t2 = xi;
+    t1 = _mm_xor_si128(xi, _mm_slli_epi64(xi, 5));
+    xi = _mm_xor_si128(_mm_slli_epi64(xi, 6), t1);
+    xi = _mm_slli_epi64(xi, 57);
+    t1 = _mm_srli_si128(xi, 8);
+    xi = _mm_xor_si128(_mm_slli_si128(xi, 8), t2);
+    xhi = _mm_xor_si128(xhi, t1);
+
+    /* 2nd phase */
+    t2 = xi;
+    xi = _mm_srli_epi64(xi, 1);
+    xhi = _mm_xor_si128(xhi, t2);
+    t2 = _mm_xor_si128(t2, xi);
+    xi = _mm_srli_epi64(xi, 5);
+    xi = _mm_xor_si128(xi, t2);
+    xi = _mm_srli_epi64(xi, 1);
+    return _mm_xor_si128(xi, xhi);
+}
+
+CLMUL_TARGET
+static __m128i gcm_karatsuba_key(__m128i h)
+{
+    return _mm_xor_si128(h, _mm_shuffle_epi32(h, 0x4e));
+}
+
+CLMUL_TARGET
+void gcm_init_clmul(u128 Htable[16], const u64 H[2])
+{
+    __m128i *tbl = (__m128i *)Htable;
+    __m128i h, hk, p, carry;
+    GCM_ACC acc;
+    int i;
+
+    /* H is two host-order halves, most significant first */
+    h = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)H), 0x4e);
+
+    /* H<<=1, folding the carry back in with 0x1c2 polynomial */
+    carry = _mm_cmpgt_epi32(_mm_setzero_si128(),
+                            _mm_shuffle_epi32(h, 0xff));
+    h = _mm_or_si128(_mm_slli_epi64(h, 1),
+                     _mm_slli_si128(_mm_srli_epi64(h, 63), 8));
+    carry = _mm_and_si128(carry, _mm_set_epi32((int)0xc2000000, 0, 0, 1));
+    h = _mm_xor_si128(h, carry);
+
+    hk = gcm_karatsuba_key(h);
+    _mm_storeu_si128(tbl, h);
+    _mm_storeu_si128(tbl + 4, hk);
+    for (p = h, i = 1; i < 4; i++) {
+        gcm_mul_first(&acc, p, h, hk);
+        p = gcm_reduce(&acc);
+        _mm_storeu_si128(tbl + i, p);
+        _mm_storeu_si128(tbl + 4 + i, gcm_karatsuba_key(p));
+    }
+}
+
+CLMUL_TARGET
+void gcm_gmult_clmul(u64 Xi[2], const u128 Htable[16])
+{
+    const __m128i *tbl = (const __m128i *)Htable;
+    __m128i x = gcm_bswap(_mm_loadu_si128((const __m128i *)Xi));
+    GCM_ACC acc;
+
+    gcm_mul_first(&acc, x, _mm_loadu_si128(tbl), _mm_loadu_si128(tbl + 4));
+    _mm_storeu_si128((__m128i *)Xi, gcm_bswap(gcm_reduce(&acc)));
+}
+
+/* Xi = (Xi ^ in[0])*H^4 ^ in[1]*H^3 ^ in[2]*H^2 ^ in[3]*H */
+CLMUL_TARGET
+static __m128i gcm_ghash4(__m128i x, const __m128i *in, const __m128i h[8])
+{
+    GCM_ACC acc;
+    int i;
+
+    x = _mm_xor_si128(x, gcm_bswap(_mm_loadu_si128(in)));
+    gcm_mul_first(&acc, x, h[3], h[7]);
+    for (i = 1; i < 4; i++)
+        gcm_mul_acc(&acc, gcm_bswap(_mm_loadu_si128(in + i)),
+                    h[3 - i], h[7 - i]);
+    return gcm_reduce(&acc);
+}
+
+CLMUL_TARGET
+void gcm_ghash_clmul(u64 Xi[2], const u128 Htable[16], const u8 *inp,
+                     size_t len)
+{
+    __m128i h[8], x = gcm_bswap(_mm_loadu_si128((const __m128i *)Xi));
+    GCM_ACC acc;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        h[i] = _mm_loadu_si128((const __m128i *)Htable + i);
+
+    while (len >= 64) {
+        x = gcm_ghash4(x, (const __m128i *)inp, h);
+        inp += 64;
+        len -= 64;
+    }
+    while (len >= 16) {
+        x = _mm_xor_si128(x, gcm_bswap(_mm_loadu_si128((const __m128i *)inp)));
+        gcm_mul_first(&acc, x, h[0], h[4]);
+        x = gcm_reduce(&acc);
+        inp += 16;
+        len -= 16;
+    }
+    _mm_storeu_si128((__m128i *)Xi, gcm_bswap(x));
+}
+
+/*
+ * Stitched AES-CTR and GHASH, called by e_aes.c ahead of
+ * CRYPTO_gcm128_[en|de]crypt_ctr32, which handles what is left over.
+ * Like the assembly these take Xi and find Htable next to it in the
+ * GCM128_CONTEXT, advance the 32-bit counter in |ivec| and return the
+ * number of bytes processed, a multiple of 16 * AESGCM_LANES.
+ */
+static const __m128i *gcm_htable(const u64 *Xi)
+{
+    return (const __m128i *)((const char *)Xi
+                             - offsetof(GCM128_CONTEXT, Xi)
+                             + offsetof(GCM128_CONTEXT, Htable));
+}
+
+AESGCM_TARGET
+static int aesgcm_load_key(__m128i rk[AES_MAXNR + 1], const AES_KEY *key)
+{
+    int i;
+
+    for (i = 0; i <= key->rounds; i++)
+        rk[i] = _mm_loadu_si128((const __m128i *)key->rd_key + i);
+
+    return key->rounds;
+}
+
+/*
+ * Encrypt the next AESGCM_LANES counter blocks into |b| while folding the
+ * previous AESGCM_LANES blocks of ciphertext |c| into |x|. The two chains
+ * are independent, which lets AESENC and PCLMULQDQ issue side by side.
+ */
+AESGCM_TARGET
+static __m128i aesgcm_round8(__m128i b[AESGCM_LANES], __m128i *ctr,
+                             const __m128i *rk, int rounds,
+                             __m128i x, const __m128i c[AESGCM_LANES],
+                             const __m128i h[8])
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+    GCM_ACC acc;
+    int r, j;
+
+    for (j = 0; j < AESGCM_LANES; j++) {
+        b[j] = _mm_xor_si128(_mm_shuffle_epi8(*ctr, bswap), rk[0]);
+        *ctr = _mm_add_epi32(*ctr, one);
+    }
+
+    gcm_mul_first(&acc, _mm_xor_si128(x, c[0]), h[3], h[7]);
+    for (r = 1; r < rounds; r++) {
+        for (j = 0; j < AESGCM_LANES; j++)
+            b[j] = _mm_aesenc_si128(b[j], rk[r]);
+        /* spread the eight multiplications over the first rounds */
+        if (r < 4) {
+            gcm_mul_acc(&acc, c[r], h[3 - r], h[7 - r]);
+        } else if (r == 4) {
+            x = gcm_reduce(&acc);
+            gcm_mul_first(&acc, _mm_xor_si128(x, c[4]), h[3], h[7]);
+        } else if (r < 8) {
+            gcm_mul_acc(&acc, c[r], h[7 - r], h[11 - r]);
+        }
+    }
+    for (j = 0; j < AESGCM_LANES; j++)
+        b[j] = _mm_aesenclast_si128(b[j], rk[rounds]);
+
+    return gcm_reduce(&acc);
+}
+
+AESGCM_TARGET
+static size_t aesni_gcm_crypt(const unsigned char *in, unsigned char *out,
+                              size_t len, const void *key,
+                              unsigned char ivec[16], u64 *Xi, int enc)
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+    const __m128i *tbl = gcm_htable(Xi);
+    const __m128i *src = (const __m128i *)in;
+    __m128i *dst = (__m128i *)out;
+    __m128i rk[AES_MAXNR + 1], h[8], b[AESGCM_LANES], c[AESGCM_LANES];
+    __m128i x, ctr;
+    size_t blocks = len / 16 / AESGCM_LANES * AESGCM_LANES, n;
+    int rounds, r, j;
+
+    /*
+     * Encryption hashes the ciphertext of the previous iteration, so it
+     * needs two iterations to get going.
+     */
+    if (blocks < AESGCM_LANES * (enc ? 2 : 1))
+        return 0;
+
+    rounds = aesgcm_load_key(rk, key);
+    for (j = 0; j < 8; j++)
+        h[j] = _mm_loadu_si128(tbl + j);
+    x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)Xi), bswap);
+    ctr = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ivec), bswap);
+
+    if (enc) {
+        /* first batch of ciphertext, nothing to hash yet */
+        for (j = 0; j < AESGCM_LANES; j++) {
+            b[j] = _mm_xor_si128(_mm_shuffle_epi8(ctr, bswap), rk[0]);
+            ctr = _mm_add_epi32(ctr, one);
+        }
+        for (r = 1; r < rounds; r++)
+            for (j = 0; j < AESGCM_LANES; j++)
+                b[j] = _mm_aesenc_si128(b[j], rk[r]);
+        for (j = 0; j < AESGCM_LANES; j++) {
+            b[j] = _mm_aesenclast_si128(b[j], rk[rounds]);
+            b[j] = _mm_xor_si128(b[j], _mm_loadu_si128(src + j));
+            _mm_storeu_si128(dst + j, b[j]);
+            c[j] = _mm_shuffle_epi8(b[j], bswap);
+        }
+
+        for (n = AESGCM_LANES; n < blocks; n += AESGCM_LANES) {
+            src += AESGCM_LANES;
+            dst += AESGCM_LANES;
+            x = aesgcm_round8(b, &ctr, rk, rounds, x, c, h);
+            for (j = 0; j < AESGCM_LANES; j++) {
+                b[j] = _mm_xor_si128(b[j], _mm_loadu_si128(src + j));
+                _mm_storeu_si128(dst + j, b[j]);
+                c[j] = _mm_shuffle_epi8(b[j], bswap);
+            }
+        }
+
+        /* hash the last batch */
+        x = gcm_ghash4(x, dst, h);
+        x = gcm_ghash4(x, dst + 4, h);
+    } else {
+        for (n = 0; n < blocks; n += AESGCM_LANES) {
+            for (j = 0; j < AESGCM_LANES; j++)
+                c[j] = _mm_shuffle_epi8(_mm_loadu_si128(src + j), bswap);
+            x = aesgcm_round8(b, &ctr, rk, rounds, x, c, h);
+            for (j = 0; j < AESGCM_LANES; j++)
+                _mm_storeu_si128(dst + j,
+                                 _mm_xor_si128(b[j],
+                                               _mm_loadu_si128(src + j)));
+            src += AESGCM_LANES;
+            dst += AESGCM_LANES;
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)Xi, _mm_shuffle_epi8(x, bswap));
+    _mm_storeu_si128((__m128i *)ivec, _mm_shuffle_epi8(ctr, bswap));
+    return blocks * 16;
+}
+
+size_t aesni_gcm_encrypt(const unsigned char *in, unsigned char *out,
+                         size_t len, const void *key, unsigned char ivec[16],
+                         u64 *Xi)
+{
+    return aesni_gcm_crypt(in, out, len, key, ivec, Xi, 1);
+}
+
+size_t aesni_gcm_decrypt(const unsigned char *in, unsigned char *out,
+                         size_t len, const void *key, unsigned char ivec[16],
+                         u64 *Xi)
+{
+    return aesni_gcm_crypt(in, out, len, key, ivec, Xi, 0);
+}
+
+#endif
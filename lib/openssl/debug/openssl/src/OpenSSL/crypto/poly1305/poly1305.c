@@ -113,11 +113,15 @@ poly1305_blocks(void *ctx, const unsigned char *inp, size_t len, u32 padbit);
          (a ^ ((a ^ b) | ((a - b) ^ b))) >> (sizeof(a) * 8 - 1) \
          )
 
+/*
+ * Base 2^64 is picked wherever the compiler offers __int128, not only
+ * on LP64 targets, so that ILP32 ABIs on 64-bit processors such as x32
+ * and mingw64's LLP64 get it as well.
+ */
 # if !defined(PEDANTIC) && \
-     (defined(__SIZEOF_INT128__) && __SIZEOF_INT128__==16) && \
-     (defined(__SIZEOF_LONG__) && __SIZEOF_LONG__==8)
+     (defined(__SIZEOF_INT128__) && __SIZEOF_INT128__==16)
 
-typedef unsigned long u64;
+typedef unsigned long long u64;
 typedef unsigned __int128 u128;
 
 typedef struct {
@@ -207,7 +211,7 @@ poly1305_blocks(void *ctx, const unsigned char *inp, size_t len, u32 padbit)
         h1 = (u64)(d1 += d0 >> 64);
         h2 += (u64)(d1 >> 64);
         /* b) (h2:h0 += (h2:h0>>130) * 5) %= 2^130 */
-        c = (h2 >> 2) + (h2 & ~3UL);
+        c = (h2 >> 2) + (h2 & ~(u64)3);
         h2 &= 3;
         h0 += c;
         h1 += (c = CONSTANT_TIME_CARRY(h0,c));
@@ -15,6 +15,8 @@
 #include <openssl/crypto.h>
 #include <openssl/sha.h>
 #include <openssl/opensslv.h>
+#include "internal/cpu_intrin.h"
+#include "internal/sha.h"
 
 int SHA224_Init(SHA256_CTX *c)
 {
@@ -131,6 +133,13 @@ void sha256_block_data_order(SHA256_CTX *ctx, const void *in, size_t num);
 #include "internal/md32_common.h"
 
 #ifndef SHA256_ASM
+# if defined(OPENSSL_IA32_INTRIN)
+extern unsigned int OPENSSL_ia32cap_P[];
+void sha256_block_shaext(SHA256_CTX *ctx, const void *in, size_t num);
+#  define SHA256_HW_CAPABLE       (OPENSSL_ia32cap_P[2] & (1 << 29))
+#  define sha256_block_hw         sha256_block_shaext
+# endif
+
 static const SHA_LONG K256[64] = {
     0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
     0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
@@ -173,6 +182,13 @@ static void sha256_block_data_order(SHA256_CTX *ctx, const void *in,
     int i;
     const unsigned char *data = in;
 
+#  ifdef SHA256_HW_CAPABLE
+    if (SHA256_HW_CAPABLE) {
+        sha256_block_hw(ctx, in, num);
+        return;
+    }
+#  endif
+
     while (num--) {
 
         a = ctx->h[0];
@@ -257,6 +273,13 @@ static void sha256_block_data_order(SHA256_CTX *ctx, const void *in,
         1
     };
 
+#  ifdef SHA256_HW_CAPABLE
+    if (SHA256_HW_CAPABLE) {
+        sha256_block_hw(ctx, in, num);
+        return;
+    }
+#  endif
+
     while (num--) {
 
         a = ctx->h[0];
@@ -384,3 +407,243 @@ static void sha256_block_data_order(SHA256_CTX *ctx, const void *in,
 
 # endif
 #endif                         /* SHA256_ASM */
+
+/*
+ * Multi-buffer SHA-256. SHA256_multi and HMAC_SHA256_multi keep up to
+ * SHA256_MB_LANES independent messages in flight and advance all of them
+ * with one call to a block function that works on the lanes in parallel,
+ * with lane j of every state vector belonging to the message in lane j.
+ * Each message is fed to its lane as up to three runs of whole blocks:
+ * the HMAC key block, the whole blocks of the message in place and the
+ * padded tail, and a lane that runs out of blocks is given the next
+ * message. When the CPU does SHA-256 blocks in hardware, one message at
+ * a time is faster than the vector lanes, so they collapse into one that
+ * goes through sha256_block_data_order.
+ */
+#define SHA256_MB_LANES         8
+
+#if defined(OPENSSL_IA32_INTRIN)
+void sha256_mb_block_sse2(SHA_LONG h[8][8], const unsigned char *const in[8],
+                          size_t num);
+void sha256_mb_block_avx2(SHA_LONG h[8][8], const unsigned char *const in[8],
+                          size_t num);
+# define SSE2_CAPABLE            (OPENSSL_ia32cap_P[0] & (1 << 26))
+# define AVX2_CAPABLE            (OPENSSL_ia32cap_P[2] & (1 << 5))
+#endif
+
+typedef void (*sha256_mb_block_f) (SHA_LONG h[8][SHA256_MB_LANES],
+                                   const unsigned char *const
+                                   in[SHA256_MB_LANES], size_t num);
+
+typedef struct {
+    struct {
+        const unsigned char *p;
+        size_t blocks;
+    } run[3];
+    int cur;                    /* run[cur] is the next one with blocks */
+    int outer;                  /* HMAC: the inner hash is done */
+    unsigned char *md;          /* NULL if the lane is idle */
+    unsigned char key[SHA256_CBLOCK];
+    unsigned char tail[2 * SHA256_CBLOCK];
+} SHA256_MB_LANE;
+
+static void sha256_mb_block_serial(SHA_LONG h[8][SHA256_MB_LANES],
+                                   const unsigned char *const
+                                   in[SHA256_MB_LANES], size_t num)
+{
+    SHA256_CTX c;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        c.h[i] = h[i][0];
+    sha256_block_data_order(&c, in[0], num);
+    for (i = 0; i < 8; i++)
+        h[i][0] = c.h[i];
+}
+
+/*
+ * Starts hashing |key|, if not NULL, followed by the |n| bytes at |d| in
+ * lane |j|. The partial last block is copied, so |d| need only stay valid
+ * for the whole blocks.
+ */
+static void sha256_mb_start(SHA256_MB_LANE *lane, SHA_LONG h[8][SHA256_MB_LANES],
+                            int j, const unsigned char *key,
+                            const unsigned char *d, size_t n)
+{
+    static const SHA_LONG iv[8] = {
+        0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+        0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL
+    };
+    size_t whole = n / SHA256_CBLOCK, rest = n % SHA256_CBLOCK;
+    size_t tail = rest + 9 > SHA256_CBLOCK ? 2 : 1;
+    SHA_LONG64 bits = ((SHA_LONG64)n + (key != NULL ? SHA256_CBLOCK : 0)) << 3;
+    unsigned char *p;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        h[i][j] = iv[i];
+
+    lane->run[0].p = key;
+    lane->run[0].blocks = key != NULL ? 1 : 0;
+    lane->run[1].p = d;
+    lane->run[1].blocks = whole;
+
+    if (rest != 0)
+        memcpy(lane->tail, d + whole * SHA256_CBLOCK, rest);
+    lane->tail[rest] = 0x80;
+    memset(lane->tail + rest + 1, 0, tail * SHA256_CBLOCK - rest - 1);
+    p = lane->tail + tail * SHA256_CBLOCK;
+    for (i = 0; i < 8; i++, bits >>= 8)
+        *--p = (unsigned char)bits;
+    lane->run[2].p = lane->tail;
+    lane->run[2].blocks = tail;
+
+    for (lane->cur = 0; lane->run[lane->cur].blocks == 0; lane->cur++)
+        continue;
+}
+
+/*
+ * Puts the |n| bytes at |d| into lane |j|, preceded by |key| XOR ipad if
+ * |key| is not NULL, the digest to go to |md|. A key longer than a block
+ * is hashed first.
+ */
+static void sha256_mb_load(SHA256_MB_LANE *lane,
+                           SHA_LONG h[8][SHA256_MB_LANES], int j,
+                           const unsigned char *key, int key_len,
+                           const unsigned char *d, size_t n,
+                           unsigned char *md)
+{
+    int i;
+
+    if (key != NULL) {
+        memset(lane->key, 0, sizeof(lane->key));
+        if (key_len > SHA256_CBLOCK)
+            SHA256(key, key_len, lane->key);
+        else if (key_len > 0)
+            memcpy(lane->key, key, key_len);
+        for (i = 0; i < SHA256_CBLOCK; i++)
+            lane->key[i] ^= 0x36;
+    }
+    lane->outer = 0;
+    lane->md = md;
+    sha256_mb_start(lane, h, j, key != NULL ? lane->key : NULL, d, n);
+}
+
+int sha256_multi(const unsigned char *const key[], const int key_len[],
+                 const unsigned char *const d[], const size_t n[],
+                 unsigned char *const md[], size_t num)
+{
+    SHA_LONG h[8][SHA256_MB_LANES];
+    const unsigned char *in[SHA256_MB_LANES];
+    SHA256_MB_LANE lane[SHA256_MB_LANES];
+    sha256_mb_block_f block = sha256_mb_block_serial;
+    int lanes = 1, active = 0, j;
+    size_t next;
+
+    if (num == 0)
+        return 1;
+    if (d == NULL || n == NULL || md == NULL
+            || (key != NULL && key_len == NULL))
+        return 0;
+    /* Check every message first so that nothing is written on failure */
+    for (next = 0; next < num; next++) {
+        if (md[next] == NULL || (d[next] == NULL && n[next] != 0))
+            return 0;
+        if (key != NULL && (key_len[next] < 0
+                            || (key[next] == NULL && key_len[next] != 0)))
+            return 0;
+    }
+
+#if defined(OPENSSL_IA32_INTRIN)
+    if (!SHA256_HW_CAPABLE) {
+        if (AVX2_CAPABLE) {
+            block = sha256_mb_block_avx2;
+            lanes = 8;
+        } else if (SSE2_CAPABLE) {
+            block = sha256_mb_block_sse2;
+            lanes = 4;
+        }
+    }
+#endif
+
+    for (j = 0; j < lanes; j++)
+        lane[j].md = NULL;
+    for (next = 0; next < num && active < lanes; next++, active++)
+        sha256_mb_load(&lane[active], h, active,
+                       key != NULL ? key[next] : NULL,
+                       key != NULL ? key_len[next] : 0,
+                       d[next], n[next], md[next]);
+
+    while (active > 0) {
+        size_t step = (size_t)-1;
+        int busy = 0;
+
+        for (j = 0; j < lanes; j++) {
+            SHA256_MB_LANE *l = &lane[j];
+
+            if (l->md == NULL)
+                continue;
+            if (l->run[l->cur].blocks < step)
+                step = l->run[l->cur].blocks;
+            in[j] = l->run[l->cur].p;
+            busy = j;
+        }
+        /* idle lanes shadow a busy one and their results are ignored */
+        for (j = 0; j < lanes; j++)
+            if (lane[j].md == NULL)
+                in[j] = in[busy];
+
+        block(h, in, step);
+
+        for (j = 0; j < lanes; j++) {
+            SHA256_MB_LANE *l = &lane[j];
+            unsigned char dgst[SHA256_DIGEST_LENGTH], *p;
+            int i;
+
+            if (l->md == NULL)
+                continue;
+            l->run[l->cur].p += step * SHA256_CBLOCK;
+            l->run[l->cur].blocks -= step;
+            while (l->cur < 3 && l->run[l->cur].blocks == 0)
+                l->cur++;
+            if (l->cur < 3)
+                continue;
+
+            p = key != NULL && !l->outer ? dgst : l->md;
+            for (i = 0; i < 8; i++) {
+                SHA_LONG ll = h[i][j];
+
+                (void)HOST_l2c(ll, p);
+            }
+
+            if (key != NULL && !l->outer) {
+                /* on to the outer hash, with the key XOR opad */
+                for (i = 0; i < SHA256_CBLOCK; i++)
+                    l->key[i] ^= 0x36 ^ 0x5c;
+                sha256_mb_start(l, h, j, l->key, dgst, sizeof(dgst));
+                OPENSSL_cleanse(dgst, sizeof(dgst));
+                l->outer = 1;
+            } else if (next < num) {
+                sha256_mb_load(l, h, j, key != NULL ? key[next] : NULL,
+                               key != NULL ? key_len[next] : 0,
+                               d[next], n[next], md[next]);
+                next++;
+            } else {
+                l->md = NULL;
+                active--;
+            }
+        }
+    }
+
+    if (key != NULL) {
+        OPENSSL_cleanse(lane, sizeof(lane));
+        OPENSSL_cleanse(h, sizeof(h));
+    }
+    return 1;
+}
+
+int SHA256_multi(const unsigned char *const d[], const size_t n[],
+                 unsigned char *const md[], size_t num)
+{
+    return sha256_multi(NULL, NULL, d, n, md, num);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * Multi-buffer SHA-256 for no-asm builds on x86, after
+ * asm/sha256-mb-x86_64.pl. Each vector register holds the same state or
+ * message word of 4 (SSE2) or 8 (AVX2) independent messages, so the
+ * rounds are the scalar ones applied lane-wise.
+ *
+ * h[i][j] is state word i of lane j and in[j] the next block of lane j.
+ * Every lane is advanced by |num| blocks. Nothing here may be called
+ * unless the matching bit was found in OPENSSL_ia32cap_P, see
+ * SHA256_multi in crypto/sha/sha256.c.
+ */
+
+#include <openssl/sha.h>
+#include "internal/cpu_intrin.h"
+
+#ifdef OPENSSL_IA32_INTRIN
+
+# include <immintrin.h>
+
+# define SSE2_TARGET     INTRIN_TARGET("sse2")
+# define AVX2_TARGET     INTRIN_TARGET("avx2")
+
+static const SHA_LONG K256[64] = {
+    0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+    0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+    0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+    0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+    0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
+    0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+    0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
+    0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+    0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
+    0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+    0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
+    0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+    0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
+    0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+    0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
+    0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+
+/*
+ * The round and schedule functions are written once over a set of
+ * lane-wise primitives, V_ADD and friends, that each instantiation
+ * defines.
+ */
+# define ROR(x, n)       V_OR(V_SRL(x, n), V_SLL(x, 32 - (n)))
+# define Sigma0(x)       V_XOR(V_XOR(ROR(x, 2), ROR(x, 13)), ROR(x, 22))
+# define Sigma1(x)       V_XOR(V_XOR(ROR(x, 6), ROR(x, 11)), ROR(x, 25))
+# define sigma0(x)       V_XOR(V_XOR(ROR(x, 7), ROR(x, 18)), V_SRL(x, 3))
+# define sigma1(x)       V_XOR(V_XOR(ROR(x, 17), ROR(x, 19)), V_SRL(x, 10))
+# define Ch(x, y, z)     V_XOR(V_AND(x, y), V_ANDNOT(x, z))
+# define Maj(x, y, z)    V_XOR(y, V_AND(V_XOR(x, y), V_XOR(y, z)))
+
+/* W[i & 15] holds the message word of round i */
+# define ROUND(i, a, b, c, d, e, f, g, h)       do {            \
+        T1 = V_ADD(V_ADD(h, Sigma1(e)),                         \
+                   V_ADD(Ch(e, f, g), V_ADD(V_SET1(K256[i]),    \
+                                            W[(i) & 15])));     \
+        d = V_ADD(d, T1);                                       \
+        h = V_ADD(V_ADD(T1, Sigma0(a)), Maj(a, b, c));  } while (0)
+
+# define SCHEDULE(i)    (W[(i) & 15] =                          \
+        V_ADD(V_ADD(W[(i) & 15], sigma0(W[((i) + 1) & 15])),   \
+              V_ADD(W[((i) + 9) & 15], sigma1(W[((i) + 14) & 15]))))
+
+# define ROUNDS_8(i)    do {                                    \
+        ROUND((i) + 0, s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7]); \
+        ROUND((i) + 1, s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6]); \
+        ROUND((i) + 2, s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5]); \
+        ROUND((i) + 3, s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4]); \
+        ROUND((i) + 4, s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3]); \
+        ROUND((i) + 5, s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2]); \
+        ROUND((i) + 6, s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1]); \
+        ROUND((i) + 7, s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0]); \
+        } while (0)
+
+# define V_ADD           _mm_add_epi32
+# define V_AND           _mm_and_si128
+# define V_ANDNOT        _mm_andnot_si128
+# define V_OR            _mm_or_si128
+# define V_XOR           _mm_xor_si128
+# define V_SLL           _mm_slli_epi32
+# define V_SRL           _mm_srli_epi32
+# define V_SET1(k)       _mm_set1_epi32((int)(k))
+
+/* big-endian words 4*|q|..4*|q|+3 of lanes 0..3, one word per vector */
+SSE2_TARGET
+static void sha256_mb_load4_sse2(__m128i *W, const unsigned char *const in[8],
+                                 int q)
+{
+    __m128i t0, t1, t2, t3;
+    int i;
+
+    t0 = _mm_loadu_si128((const __m128i *)(in[0] + 16 * q));
+    t1 = _mm_loadu_si128((const __m128i *)(in[1] + 16 * q));
+    t2 = _mm_loadu_si128((const __m128i *)(in[2] + 16 * q));
+    t3 = _mm_loadu_si128((const __m128i *)(in[3] + 16 * q));
+    W[0] = _mm_unpacklo_epi32(t0, t1);
+    W[1] = _mm_unpacklo_epi32(t2, t3);
+    W[2] = _mm_unpackhi_epi32(t0, t1);
+    W[3] = _mm_unpackhi_epi32(t2, t3);
+    t0 = _mm_unpacklo_epi64(W[0], W[1]);
+    t1 = _mm_unpackhi_epi64(W[0], W[1]);
+    t2 = _mm_unpacklo_epi64(W[2], W[3]);
+    t3 = _mm_unpackhi_epi64(W[2], W[3]);
+    W[0] = t0;
+    W[1] = t1;
+    W[2] = t2;
+    W[3] = t3;
+
+    /* no PSHUFB in SSE2: swap the bytes within each 16-bit half first */
+    for (i = 0; i < 4; i++) {
+        t0 = _mm_or_si128(_mm_slli_epi16(W[i], 8), _mm_srli_epi16(W[i], 8));
+        W[i] = _mm_shufflehi_epi16(_mm_shufflelo_epi16(t0, 0xb1), 0xb1);
+    }
+}
+
+SSE2_TARGET
+void sha256_mb_block_sse2(SHA_LONG h[8][8], const unsigned char *const in[8],
+                          size_t num)
+{
+    const unsigned char *p[8];
+    __m128i s[8], save[8], W[16], T1;
+    int i, k;
+
+    for (i = 0; i < 8; i++)
+        s[i] = _mm_loadu_si128((const __m128i *)h[i]);
+    for (i = 0; i < 4; i++)
+        p[i] = in[i];
+
+    while (num--) {
+        for (i = 0; i < 8; i++)
+            save[i] = s[i];
+        for (i = 0; i < 4; i++)
+            sha256_mb_load4_sse2(W + 4 * i, p, i);
+
+        ROUNDS_8(0);
+        ROUNDS_8(8);
+        for (i = 16; i < 64; i += 8) {
+            for (k = 0; k < 8; k++)
+                SCHEDULE(i + k);
+            ROUNDS_8(i);
+        }
+
+        for (i = 0; i < 8; i++)
+            s[i] = _mm_add_epi32(s[i], save[i]);
+        for (i = 0; i < 4; i++)
+            p[i] += SHA256_CBLOCK;
+    }
+
+    for (i = 0; i < 8; i++)
+        _mm_storeu_si128((__m128i *)h[i], s[i]);
+}
+
+# undef V_ADD
+# undef V_AND
+# undef V_ANDNOT
+# undef V_OR
+# undef V_XOR
+# undef V_SLL
+# undef V_SRL
+# undef V_SET1
+
+# define V_ADD           _mm256_add_epi32
+# define V_AND           _mm256_and_si256
+# define V_ANDNOT        _mm256_andnot_si256
+# define V_OR            _mm256_or_si256
+# define V_XOR           _mm256_xor_si256
+# define V_SLL           _mm256_slli_epi32
+# define V_SRL           _mm256_srli_epi32
+# define V_SET1(k)       _mm256_set1_epi32((int)(k))
+
+/*
+ * As sha256_mb_load4_sse2 for eight lanes: lane j and lane j+4 share a
+ * register, so that the unpacks, which work within 128-bit halves, leave
+ * lanes 0..3 in the low and lanes 4..7 in the high half.
+ */
+AVX2_TARGET
+static void sha256_mb_load4_avx2(__m256i *W, const unsigned char *const in[8],
+                                 int q)
+{
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                           11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4,
+                                           11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i t[4], u[4];
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(in[i] + 16 * q));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(in[i + 4] + 16 * q));
+
+        t[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+    u[0] = _mm256_unpacklo_epi32(t[0], t[1]);
+    u[1] = _mm256_unpacklo_epi32(t[2], t[3]);
+    u[2] = _mm256_unpackhi_epi32(t[0], t[1]);
+    u[3] = _mm256_unpackhi_epi32(t[2], t[3]);
+    W[0] = _mm256_shuffle_epi8(_mm256_unpacklo_epi64(u[0], u[1]), bswap);
+    W[1] = _mm256_shuffle_epi8(_mm256_unpackhi_epi64(u[0], u[1]), bswap);
+    W[2] = _mm256_shuffle_epi8(_mm256_unpacklo_epi64(u[2], u[3]), bswap);
+    W[3] = _mm256_shuffle_epi8(_mm256_unpackhi_epi64(u[2], u[3]), bswap);
+}
+
+AVX2_TARGET
+void sha256_mb_block_avx2(SHA_LONG h[8][8], const unsigned char *const in[8],
+                          size_t num)
+{
+    const unsigned char *p[8];
+    __m256i s[8], save[8], W[16], T1;
+    int i, k;
+
+    for (i = 0; i < 8; i++) {
+        s[i] = _mm256_loadu_si256((const __m256i *)h[i]);
+        p[i] = in[i];
+    }
+
+    while (num--) {
+        for (i = 0; i < 8; i++)
+            save[i] = s[i];
+        for (i = 0; i < 4; i++)
+            sha256_mb_load4_avx2(W + 4 * i, p, i);
+
+        ROUNDS_8(0);
+        ROUNDS_8(8);
+        for (i = 16; i < 64; i += 8) {
+            for (k = 0; k < 8; k++)
+                SCHEDULE(i + k);
+            ROUNDS_8(i);
+        }
+
+        for (i = 0; i < 8; i++) {
+            s[i] = _mm256_add_epi32(s[i], save[i]);
+            p[i] += SHA256_CBLOCK;
+        }
+    }
+
+    for (i = 0; i < 8; i++)
+        _mm256_storeu_si256((__m256i *)h[i], s[i]);
+}
+
+#endif
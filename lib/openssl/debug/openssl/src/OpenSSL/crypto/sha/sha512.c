@@ -405,6 +405,24 @@ static SHA_LONG64 __fastcall __pull64be(const void *x)
 #   endif
 #  endif
 # endif
+# if !defined(PULL64) && !defined(B_ENDIAN) && defined(__GNUC__) && \
+     defined(__BYTE_ORDER__) && __BYTE_ORDER__==__ORDER_LITTLE_ENDIAN__
+/*
+ * Without the inline assembler above, e.g. in no-asm builds, let the
+ * compiler emit a single load and byte swap, which is one instruction
+ * on 64-bit hosts. memcpy keeps the load free of alignment and aliasing
+ * assumptions, the input being an arbitrary byte buffer.
+ */
+static ossl_inline SHA_LONG64 pull64be(const void *x)
+{
+    SHA_LONG64 ret;
+
+    memcpy(&ret, x, sizeof(ret));
+    return __builtin_bswap64(ret);
+}
+
+#  define PULL64(x) pull64be(&(x))
+# endif
 # ifndef PULL64
 #  define B(x,j)    (((SHA_LONG64)(*(((const unsigned char *)(&x))+j)))<<((7-j)*8))
 #  define PULL64(x) (B(x,0)|B(x,1)|B(x,2)|B(x,3)|B(x,4)|B(x,5)|B(x,6)|B(x,7))
@@ -557,6 +575,11 @@ static void sha512_block_data_order(SHA512_CTX *ctx, const void *in,
 }
 
 # else
+/*
+ * This is the variant for 64-bit hosts: it keeps the eight working
+ * variables and the 16-word message schedule in 64-bit registers and
+ * fully unrolls the rounds.
+ */
 #  define ROUND_00_15(i,a,b,c,d,e,f,g,h)        do {    \
         T1 += h + Sigma1(e) + Ch(e,f,g) + K512[i];      \
         h = Sigma0(a) + Maj(a,b,c);                     \
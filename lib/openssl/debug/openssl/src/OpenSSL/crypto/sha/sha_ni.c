@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * SHA extensions SHA-256 for no-asm builds, the intrinsics counterpart
+ * of the shaext code path of asm/sha512-x86_64.pl. SHA256RNDS2 keeps
+ * the working variables as ABEF and CDGH, so the state is shuffled
+ * into that order on entry and back on exit.
+ *
+ * Nothing here may be called unless the SHA bit was found in
+ * OPENSSL_ia32cap_P, see crypto/sha/sha256.c.
+ */
+
+#include <openssl/sha.h>
+#include "internal/cpu_intrin.h"
+
+#ifdef OPENSSL_IA32_INTRIN
+
+# include <immintrin.h>
+
+# define SHAEXT_TARGET   INTRIN_TARGET("sha,sse4.1")
+
+static const SHA_LONG K256[64] = {
+    0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+    0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+    0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+    0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+    0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
+    0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+    0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
+    0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+    0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
+    0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+    0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
+    0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+    0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
+    0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+    0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
+    0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+
+SHAEXT_TARGET
+void sha256_block_shaext(SHA256_CTX *ctx, const void *in, size_t num)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    const unsigned char *data = in;
+    __m128i abef, cdgh, abef_save, cdgh_save, m[4], wk, t;
+    int i;
+
+    t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)ctx->h), 0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(ctx->h + 4)),
+                             0x1b);
+    abef = _mm_alignr_epi8(t, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, t, 0xf0);
+
+    while (num--) {
+        abef_save = abef;
+        cdgh_save = cdgh;
+
+        for (i = 0; i < 4; i++)
+            m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)
+                                                    (data + 16 * i)), bswap);
+
+        /* four rounds per iteration, scheduling W[4*i+16..4*i+19] */
+        for (i = 0; i < 16; i++) {
+            wk = _mm_add_epi32(m[i & 3],
+                               _mm_loadu_si128((const __m128i *)
+                                               (K256 + 4 * i)));
+            /* two rounds each, after which ABEF and CDGH trade places */
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh,
+                                         _mm_shuffle_epi32(wk, 0x0e));
+
+            if (i < 12) {
+                t = _mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]);
+                t = _mm_add_epi32(t, _mm_alignr_epi8(m[(i + 3) & 3],
+                                                     m[(i + 2) & 3], 4));
+                m[i & 3] = _mm_sha256msg2_epu32(t, m[(i + 3) & 3]);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+        data += SHA256_CBLOCK;
+    }
+
+    t = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)ctx->h, _mm_blend_epi16(t, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)(ctx->h + 4), _mm_alignr_epi8(cdgh, t, 8));
+}
+
+#endif
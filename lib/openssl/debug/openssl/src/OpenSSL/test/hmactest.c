@@ -77,8 +77,111 @@ static struct test_st {
 };
 # endif
 
+/*
+ * HMAC_SHA256_multi() is given MULTI_NUM messages, more than it has lanes,
+ * taken in turn from test cases 1, 2, 6 and 7 of RFC 4231. The last two
+ * have keys longer than a block.
+ */
+# define MULTI_NUM 11
+
+static unsigned char multi_key_0b[20], multi_key_aa[131];
+
+static struct multi_test_st {
+    unsigned char *key;
+    int key_len;
+    const char *data;
+    const char *digest;
+} multi_test[4] = {
+    {
+        multi_key_0b, 20, "Hi There",
+        "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"
+    },
+    {
+        (unsigned char *)"Jefe", 4, "what do ya want for nothing?",
+        "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"
+    },
+    {
+        multi_key_aa, 131,
+        "Test Using Larger Than Block-Size Key - Hash Key First",
+        "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"
+    },
+    {
+        multi_key_aa, 131,
+        "This is a test using a larger than block-size key and a larger "
+        "than block-size data. The key needs to be hashed before being "
+        "used by the HMAC algorithm.",
+        "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2"
+    }
+};
+
 static char *pt(unsigned char *md, unsigned int len);
 
+/*
+ * Computes the HMACs of the first |num| of the MULTI_NUM messages in one
+ * call and checks that exactly those were written.
+ */
+static int test_multi(size_t num)
+{
+    static const unsigned char zero[SHA256_DIGEST_LENGTH];
+    const unsigned char *key[MULTI_NUM], *d[MULTI_NUM];
+    int key_len[MULTI_NUM];
+    size_t n[MULTI_NUM];
+    unsigned char md[MULTI_NUM][SHA256_DIGEST_LENGTH], *out[MULTI_NUM];
+    size_t i;
+
+    memset(multi_key_0b, 0x0b, sizeof(multi_key_0b));
+    memset(multi_key_aa, 0xaa, sizeof(multi_key_aa));
+    memset(md, 0, sizeof(md));
+    for (i = 0; i < MULTI_NUM; i++) {
+        key[i] = multi_test[i % 4].key;
+        key_len[i] = multi_test[i % 4].key_len;
+        d[i] = (const unsigned char *)multi_test[i % 4].data;
+        n[i] = strlen(multi_test[i % 4].data);
+        out[i] = md[i];
+    }
+    if (!HMAC_SHA256_multi(key, key_len, d, n, out, num))
+        return 0;
+    for (i = 0; i < MULTI_NUM; i++) {
+        if (i < num) {
+            char *p = pt(md[i], SHA256_DIGEST_LENGTH);
+
+            if (strcmp(p, multi_test[i % 4].digest) != 0) {
+                printf("got %s instead of %s\n", p, multi_test[i % 4].digest);
+                return 0;
+            }
+        } else if (memcmp(md[i], zero, sizeof(zero)) != 0) {
+            printf("HMAC written for message %u of %u\n", (unsigned int)i,
+                   (unsigned int)num);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * A missing key array and a negative key length must be refused before
+ * any HMAC is written.
+ */
+static int test_multi_invalid(void)
+{
+    static const unsigned char zero[SHA256_DIGEST_LENGTH];
+    const unsigned char *key[1], *d[1];
+    int key_len[1];
+    size_t n[1];
+    unsigned char md[SHA256_DIGEST_LENGTH], *out[1];
+
+    memset(md, 0, sizeof(md));
+    key[0] = (const unsigned char *)"key";
+    key_len[0] = -1;
+    d[0] = (const unsigned char *)"data";
+    n[0] = 4;
+    out[0] = md;
+    if (HMAC_SHA256_multi(NULL, NULL, d, n, out, 1)
+            || HMAC_SHA256_multi(key, key_len, d, n, out, 1))
+        return 0;
+    return memcmp(md, zero, sizeof(md)) == 0;
+}
+
 int main(int argc, char *argv[])
 {
 # ifndef OPENSSL_NO_MD5
@@ -293,6 +396,15 @@ test6:
     } else {
         printf("test 6 ok\n");
     }
+
+/* test7 */
+    if (!test_multi(0) || !test_multi(1) || !test_multi(MULTI_NUM)
+            || !test_multi_invalid()) {
+        printf("Error calculating HMAC_SHA256_multi (test 7)\n");
+        err++;
+    } else {
+        printf("test 7 ok\n");
+    }
 end:
     HMAC_CTX_free(ctx2);
     HMAC_CTX_free(ctx);
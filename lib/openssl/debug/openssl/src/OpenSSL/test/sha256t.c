@@ -56,6 +56,96 @@ static const unsigned char addenum_3[SHA224_DIGEST_LENGTH] = {
     0x4e, 0xe7, 0xad, 0x67
 };
 
+/*
+ * SHA256_multi() is given MULTI_NUM messages, more than it has lanes, taken
+ * in turn from the FIPS 180-2 messages above, the empty message and the
+ * 896-bit message of FIPS 180-2 appendix C.
+ */
+#define MULTI_NUM 11
+
+static const char *multi_msg[4] = {
+    "abc",
+    "abcdbcde" "cdefdefg" "efghfghi" "ghijhijk"
+    "ijkljklm" "klmnlmno" "mnopnopq",
+    "",
+    "abcdefgh" "bcdefghi" "cdefghij" "defghijk" "efghijkl" "fghijklm"
+    "ghijklmn" "hijklmno" "ijklmnop" "jklmnopq" "klmnopqr" "lmnopqrs"
+    "mnopqrst" "nopqrstu"
+};
+
+static const unsigned char multi_empty[SHA256_DIGEST_LENGTH] = {
+    0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14,
+    0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+    0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+    0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55
+};
+
+static const unsigned char multi_896[SHA256_DIGEST_LENGTH] = {
+    0xcf, 0x5b, 0x16, 0xa7, 0x78, 0xaf, 0x83, 0x80,
+    0x03, 0x6c, 0xe5, 0x9e, 0x7b, 0x04, 0x92, 0x37,
+    0x0b, 0x24, 0x9b, 0x11, 0xe8, 0xf0, 0x7a, 0x51,
+    0xaf, 0xac, 0x45, 0x03, 0x7a, 0xfe, 0xe9, 0xd1
+};
+
+static const unsigned char *multi_md[4] = {
+    app_b1, app_b2, multi_empty, multi_896
+};
+
+/*
+ * Hashes the first |num| of the MULTI_NUM messages in one call and checks
+ * that exactly those digests were written.
+ */
+static int test_multi(size_t num)
+{
+    static const unsigned char zero[SHA256_DIGEST_LENGTH];
+    const unsigned char *d[MULTI_NUM];
+    size_t n[MULTI_NUM];
+    unsigned char md[MULTI_NUM][SHA256_DIGEST_LENGTH], *out[MULTI_NUM];
+    size_t i;
+
+    memset(md, 0, sizeof(md));
+    for (i = 0; i < MULTI_NUM; i++) {
+        d[i] = (const unsigned char *)multi_msg[i % 4];
+        n[i] = strlen(multi_msg[i % 4]);
+        out[i] = md[i];
+    }
+    if (!SHA256_multi(d, n, out, num))
+        return 0;
+    for (i = 0; i < MULTI_NUM; i++) {
+        if (memcmp(md[i], i < num ? multi_md[i % 4] : zero,
+                   SHA256_DIGEST_LENGTH) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * A NULL digest buffer and a NULL message with a length must be refused
+ * before any digest is written.
+ */
+static int test_multi_invalid(void)
+{
+    static const unsigned char zero[SHA256_DIGEST_LENGTH];
+    const unsigned char *d[2];
+    size_t n[2];
+    unsigned char md[SHA256_DIGEST_LENGTH], *out[2];
+
+    memset(md, 0, sizeof(md));
+    d[0] = (const unsigned char *)multi_msg[0];
+    n[0] = strlen(multi_msg[0]);
+    out[0] = md;
+    d[1] = NULL;
+    n[1] = 0;
+    out[1] = NULL;
+    if (SHA256_multi(d, n, out, 2))
+        return 0;
+    out[1] = md;
+    n[1] = 1;
+    if (SHA256_multi(d, n, out, 2))
+        return 0;
+    return memcmp(md, zero, sizeof(md)) == 0;
+}
+
 int main(int argc, char **argv)
 {
     unsigned char md[SHA256_DIGEST_LENGTH];
@@ -169,6 +259,29 @@ int main(int argc, char **argv)
     fprintf(stdout, " passed.\n");
     fflush(stdout);
 
+    fprintf(stdout, "Testing SHA256_multi ");
+
+    for (i = 0; i < 3; i++) {
+        if (!test_multi(i == 0 ? 0 : i == 1 ? 1 : MULTI_NUM)) {
+            fflush(stdout);
+            fprintf(stderr, "\nTEST %d of 4 failed.\n", i + 1);
+            return 1;
+        } else
+            fprintf(stdout, ".");
+        fflush(stdout);
+    }
+
+    if (!test_multi_invalid()) {
+        fflush(stdout);
+        fprintf(stderr, "\nTEST 4 of 4 failed.\n");
+        return 1;
+    } else
+        fprintf(stdout, ".");
+    fflush(stdout);
+
+    fprintf(stdout, " passed.\n");
+    fflush(stdout);
+
     return 0;
 
  err:
@@ -202,12 +202,10 @@ sure both macros are undefined; an emulation function will then be used. */
    or -2 (ANYCRLF). */
 #define NEWLINE 10
 
-/* PCRE uses recursive function calls to handle backtracking while matching.
-   This can sometimes be a problem on systems that have stacks of limited
-   size. Define NO_RECURSE to any value to get a version that doesn't use
-   recursion in the match() function; instead it creates its own stack by
-   steam using pcre_recurse_malloc() to obtain memory from the heap. For more
-   detail, see the comments and other stuff just above the match() function.
+/* Obsolete. PCRE used to use recursive function calls to handle backtracking
+   while matching, unless NO_RECURSE was defined. The match() function now
+   always keeps its frames in a match arena on the heap, and this macro is
+   ignored. For more detail, see the comments just above the match() function.
    */
 /* #undef NO_RECURSE */
 
@@ -294,7 +292,7 @@ sure both macros are undefined; an emulation function will then be used. */
 #define STDC_HEADERS 1
 
 /* Define to any value to enable support for Just-In-Time compiling. */
-/* #undef SUPPORT_JIT */
+#define SUPPORT_JIT /**/
 
 /* Define to any value to allow pcregrep to be linked with libbz2, so that it
    is able to handle .bz2 files. */
@@ -320,7 +318,11 @@ sure both macros are undefined; an emulation function will then be used. */
 #define SUPPORT_PCRE8 /**/
 
 /* Define to any value to enable JIT support in pcregrep. */
-/* #undef SUPPORT_PCREGREP_JIT */
+#define SUPPORT_PCREGREP_JIT /**/
+
+/* Define to any value to keep per-pattern profiling counters that can be
+   retrieved with PCRE_INFO_PROFILE. */
+/* #undef SUPPORT_PROFILE */
 
 /* Define to any value to enable support for Unicode properties. */
 #define SUPPORT_UCP /**/
@@ -0,0 +1,231 @@
+#! /usr/bin/python
+
+# Rearrange the per-character tables of pcre_ucd.c into three stages.
+#
+# maint/MultiStage2.py in the PCRE distribution reads the Unicode data files
+# and writes pcre_ucd.c with the property records, the caseless sets, and a
+# two-stage table that maps each code point to a record number (stage 1 is
+# indexed by the code point divided by 128, and selects a block of 128 record
+# numbers in stage 2). This script reads such a file and replaces the two
+# stages with the layout that the UCD macros in pcre_internal.h expect:
+#
+#   ucd_latin1       the record numbers of U+0000 to U+00FF, looked up
+#                    directly
+#   ucd_latin1_bits  bitmaps of the Latin-1 characters that [:alnum:], \s and
+#                    \w match in UCP mode
+#   ucd_stage1       indexed by the code point >> 8; selects a block of stage 2
+#   ucd_stage2       blocks of 32 entries, indexed by bits 3-7 of the code
+#                    point; each selects a block of stage 3
+#   ucd_stage3       blocks of 8 record numbers, indexed by the low 3 bits
+#
+# Identical blocks are stored once at each level. The records themselves and
+# the caseless sets are copied unchanged. The script also accepts a file that
+# is already in the three-stage form, so running it again changes nothing.
+#
+# Usage: MultiStage3.py [pcre_ucd.c [ucp.h]]
+#
+# It is run from the maint directory by default, and rewrites ../pcre_ucd.c in
+# place. Every code point is checked against the input tables before the file
+# is written.
+
+from __future__ import print_function
+
+import re
+import sys
+
+BLOCK_SHIFT = 3                 # UCD_BLOCK_SHIFT in pcre_internal.h
+STAGE2_SHIFT = 5                # UCD_STAGE2_SHIFT in pcre_internal.h
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+STAGE2_SIZE = 1 << STAGE2_SHIFT
+MAX_CODE_POINT = 0x10ffff
+
+ucd_path = sys.argv[1] if len(sys.argv) > 1 else '../pcre_ucd.c'
+ucp_path = sys.argv[2] if len(sys.argv) > 2 else '../ucp.h'
+
+source = open(ucd_path).read()
+
+# Find the values of a table. The dummy tables for builds without UCP come
+# first, so the last definition is the real one.
+
+def table_text(name):
+  found = list(re.finditer(r'PRIV\(%s\)\[\] = \{ /\*([^\n]*)\*/\n(.*?)\n\};' %
+    name, source, re.S))
+  if not found:
+    return None, None
+  return found[-1].group(1), found[-1]
+
+def table_values(name):
+  comment, match = table_text(name)
+  body = re.sub(r'/\*.*?\*/', '', match.group(2), flags = re.S)
+  return [int(x) for x in body.replace('\n', ' ').split(',') if x.strip()]
+
+# The records, for their general categories.
+
+comment, match = table_text('ucd_records')
+records = [[int(x) for x in m.group(1).split(',') if x.strip()]
+  for m in re.finditer(r'^  \{([^}]*)\},', match.group(2), re.M)]
+
+# Get the record number of every code point from either layout.
+
+stage1 = table_values('ucd_stage1')
+stage2 = table_values('ucd_stage2')
+
+if table_text('ucd_stage3')[0] is not None:
+  stage3 = table_values('ucd_stage3')
+  latin1 = table_values('ucd_latin1')
+  def record_number(c):
+    if c < 256:
+      return latin1[c]
+    block = stage2[(stage1[c >> (BLOCK_SHIFT + STAGE2_SHIFT)] << STAGE2_SHIFT) +
+      ((c >> BLOCK_SHIFT) & (STAGE2_SIZE - 1))]
+    return stage3[(block << BLOCK_SHIFT) + (c & (BLOCK_SIZE - 1))]
+else:
+  old_size = int(re.search(r'block = (\d+)', table_text('ucd_stage2')[0]).group(1))
+  def record_number(c):
+    return stage2[stage1[c // old_size] * old_size + c % old_size]
+
+index = [record_number(c) for c in range(MAX_CODE_POINT + 1)]
+
+# Build the three stages.
+
+blocks3 = {}
+stage2_full = []
+for c in range(0, MAX_CODE_POINT + 1, BLOCK_SIZE):
+  block = tuple(index[c:c + BLOCK_SIZE])
+  stage2_full.append(blocks3.setdefault(block, len(blocks3)))
+
+blocks2 = {}
+new_stage1 = []
+for i in range(0, len(stage2_full), STAGE2_SIZE):
+  block = tuple(stage2_full[i:i + STAGE2_SIZE])
+  new_stage1.append(blocks2.setdefault(block, len(blocks2)))
+
+new_stage2 = sorted(blocks2, key = lambda b: blocks2[b])
+new_stage3 = sorted(blocks3, key = lambda b: blocks3[b])
+
+if len(new_stage2) > 256:
+  sys.exit('** Too many stage 2 blocks for an 8-bit stage 1')
+
+for c in range(MAX_CODE_POINT + 1):
+  if new_stage3[new_stage2[new_stage1[c >> (BLOCK_SHIFT + STAGE2_SHIFT)]]
+      [(c >> BLOCK_SHIFT) & (STAGE2_SIZE - 1)]][c & (BLOCK_SIZE - 1)] != index[c]:
+    sys.exit('** Lookup of U+%04X does not give the same record' % c)
+
+# The Latin-1 bitmaps. The general category numbers come from ucp.h, where
+# they are the second enum.
+
+enums = re.findall(r'enum \{(.*?)\};', open(ucp_path).read(), re.S)
+types = re.findall(r'\b(ucp_\w+)', re.sub(r'/\*.*?\*/', '', enums[1], flags = re.S))
+type_number = dict((name, n) for n, name in enumerate(types))
+
+letters = set(type_number['ucp_' + t] for t in ('Ll', 'Lm', 'Lo', 'Lt', 'Lu'))
+numbers = set(type_number['ucp_' + t] for t in ('Nd', 'Nl', 'No'))
+separators = set(type_number['ucp_' + t] for t in ('Zl', 'Zp', 'Zs'))
+perl_spaces = (0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x20, 0x85, 0xa0)
+
+def chartype(c):
+  return records[index[c]][1]
+
+def bitmap(test):
+  bits = [0] * 32
+  for c in range(256):
+    if test(c):
+      bits[c >> 3] |= 1 << (c & 7)
+  return bits
+
+alnum = bitmap(lambda c: chartype(c) in letters | numbers)
+space = bitmap(lambda c: c in perl_spaces or chartype(c) in separators)
+word = bitmap(lambda c: chartype(c) in letters | numbers or c == 0x5f)
+
+# Write the new tables.
+
+def rows(values, per_line, width, comment = None):
+  lines = []
+  for i in range(0, len(values), per_line):
+    line = ''.join('%*d,' % (width, v) for v in values[i:i + per_line])
+    if comment is not None:
+      line += ' ' + comment(i)
+    lines.append(line)
+  return '\n'.join(lines)
+
+size1 = len(new_stage1)
+size2 = len(new_stage2) * STAGE2_SIZE * 2
+size3 = len(new_stage3) * BLOCK_SIZE * 2
+
+out = []
+out.append('/* The record numbers of the Latin-1 characters, which are looked up '
+  'without\ngoing through the stages. */\n')
+out.append('const pcre_uint16 PRIV(ucd_latin1)[] = { /* 512 bytes */')
+out.append(rows(index[:256], 16, 4, lambda i: '/* U+%04X */' % i))
+out.append('};\n')
+out.append('/* Bitmaps of the Latin-1 characters that are alphanumeric, space, and '
+  'word\ncharacters, which is what [:alnum:], \\s, and \\w match in UCP mode. */\n')
+out.append('const pcre_uint8 PRIV(ucd_latin1_bits)[] = { /* 96 bytes */')
+for name, bits in (('alnum', alnum), ('space', space), ('word', word)):
+  out.append('/* %s */' % name)
+  for i in range(0, 32, 8):
+    out.append('  ' + ','.join('0x%02x' % v for v in bits[i:i + 8]) + ',')
+out.append('};\n')
+out.append('const pcre_uint8 PRIV(ucd_stage1)[] = { /* %d bytes */' % size1)
+out.append(rows(new_stage1, 16, 3,
+  lambda i: '/* U+%04X */' % (i << (BLOCK_SHIFT + STAGE2_SHIFT))))
+out.append('};\n')
+out.append('const pcre_uint16 PRIV(ucd_stage2)[] = { /* %d bytes, block = %d */' %
+  (size2, STAGE2_SIZE))
+for n, block in enumerate(new_stage2):
+  out.append('/* block %d */' % n)
+  out.append(rows(list(block), 16, 4))
+out.append('};\n')
+out.append('const pcre_uint16 PRIV(ucd_stage3)[] = { /* %d bytes, block = %d */' %
+  (size3, BLOCK_SIZE))
+out.append(rows([v for b in new_stage3 for v in b], 16, 4,
+  lambda i: '/* %d */' % (i // BLOCK_SIZE)))
+out.append('};\n')
+out.append('#if UCD_BLOCK_SIZE != %d || UCD_STAGE2_SIZE != %d\n'
+  '#error Please correct UCD_BLOCK_SIZE or UCD_STAGE2_SIZE in pcre_internal.h\n'
+  '#endif' % (BLOCK_SIZE, STAGE2_SIZE))
+tables = '\n'.join(out)
+
+# Replace everything from the first per-character table to the block size
+# check, which is where MultiStage2.py puts them too.
+
+start = re.search(r'(/\* The record numbers of the Latin-1 characters[^\n]*\n[^\n]*\n\n)?'
+  r'const pcre_uint(8|16) PRIV\(ucd_(latin1|stage1)\)\[\] = \{ /\*', source)
+end = re.search(r'#error Please correct UCD_BLOCK_SIZE[^\n]*\n#endif', source)
+source = source[:start.start()] + tables + source[end.end():]
+
+# The dummy tables, the sizes, and the note at the top.
+
+if 'PRIV(ucd_stage3)[] = {0};' not in source:
+  source = re.sub(r'const pcre_uint8 PRIV\(ucd_stage1\)\[\] = \{0\};\n'
+    r'const pcre_uint16 PRIV\(ucd_stage2\)\[\] = \{0\};\n',
+    'const pcre_uint8 PRIV(ucd_stage1)[] = {0};\n'
+    'const pcre_uint16 PRIV(ucd_stage2)[] = {0};\n'
+    'const pcre_uint16 PRIV(ucd_stage3)[] = {0};\n', source)
+if 'PRIV(ucd_latin1)[] = {0};' not in source:
+  source = re.sub(r'const ucd_record PRIV\(ucd_records\)\[\] = \{\{0,0,0,0,0 \}\};\n'
+    r'const pcre_uint8 PRIV\(ucd_stage1\)',
+    'const ucd_record PRIV(ucd_records)[] = {{0,0,0,0,0 }};\n'
+    'const pcre_uint16 PRIV(ucd_latin1)[] = {0};\n'
+    'const pcre_uint8 PRIV(ucd_latin1_bits)[] = {0};\n'
+    'const pcre_uint8 PRIV(ucd_stage1)', source)
+
+total = len(records) * 8 + 512 + 96 + size1 + size2 + size3
+source = re.sub(r'/\* Total size: \d+ bytes, block sizes?: [^*]*\*/',
+  '/* Total size: %d bytes, block sizes: %d and %d. */' %
+  (total, STAGE2_SIZE, BLOCK_SIZE), source)
+
+source = re.sub(r'^/\* This module is generated by .*?\n\n',
+  '/* This module is generated by the maint/MultiStage2.py script in the PCRE\n'
+  'distribution, and its per-character tables are then rearranged into three\n'
+  'stages by maint/MultiStage3.py. Do not modify it by hand. Instead modify the\n'
+  'scripts and run them, in that order, to regenerate this code.\n\n',
+  source, count = 1, flags = re.S)
+source = source.replace('/* This file was autogenerated by the MultiStage2.py script. */',
+  '/* This file was autogenerated by the MultiStage2.py and MultiStage3.py scripts. */')
+
+open(ucd_path, 'w').write(source)
+print('Total size: %d bytes (stage 1 %d, stage 2 %d, stage 3 %d)' %
+  (total, size1, size2, size3))
+
+# End
@@ -210,6 +210,8 @@ with J. */
 #define PCRE_ERROR_JIT_BADOPTION   (-31)
 #define PCRE_ERROR_BADLENGTH       (-32)
 #define PCRE_ERROR_UNSET           (-33)
+#define PCRE_ERROR_CACHEIO         (-34)
+#define PCRE_ERROR_STREAMEND       (-35)
 
 /* Specific error codes for UTF-8 validity checks */
 
@@ -281,6 +283,16 @@ with J. */
 #define PCRE_INFO_MATCHLIMIT        23
 #define PCRE_INFO_RECURSIONLIMIT    24
 #define PCRE_INFO_MATCH_EMPTY       25
+#define PCRE_INFO_SUPERLINEAR       26
+#define PCRE_INFO_PROFILE           27
+
+/* Request types for pcre_lru_cache_info() */
+
+#define PCRE_LRUINFO_HITS            0
+#define PCRE_LRUINFO_MISSES          1
+#define PCRE_LRUINFO_EVICTIONS       2
+#define PCRE_LRUINFO_ENTRIES         3
+#define PCRE_LRUINFO_CAPACITY        4
 
 /* Request types for pcre_config(). Do not re-arrange, in order to remain
 compatible. */
@@ -299,6 +311,9 @@ compatible. */
 #define PCRE_CONFIG_JITTARGET              11
 #define PCRE_CONFIG_UTF32                  12
 #define PCRE_CONFIG_PARENS_LIMIT           13
+#define PCRE_CONFIG_JITUSABLE              14
+#define PCRE_CONFIG_SIMDSCAN               15
+#define PCRE_CONFIG_PROFILE                16
 
 /* Request types for pcre_study(). Do not re-arrange, in order to remain
 compatible. */
@@ -307,6 +322,8 @@ compatible. */
 #define PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE   0x0002
 #define PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE   0x0004
 #define PCRE_STUDY_EXTRA_NEEDED               0x0008
+#define PCRE_STUDY_LAZY_DFA                   0x0010
+#define PCRE_STUDY_NO_SPECIAL                 0x0020
 
 /* Bit flags for the pcre[16|32]_extra structure. Do not re-arrange or redefine
 these bits, just add new ones on the end, in order to remain compatible. */
@@ -318,6 +335,10 @@ these bits, just add new ones on the end, in order to remain compatible. */
 #define PCRE_EXTRA_MATCH_LIMIT_RECURSION  0x0010
 #define PCRE_EXTRA_MARK                   0x0020
 #define PCRE_EXTRA_EXECUTABLE_JIT         0x0040
+#define PCRE_EXTRA_MATCH_ARENA            0x0080
+#define PCRE_EXTRA_LAZY_DFA               0x0100
+#define PCRE_EXTRA_SPECIAL                0x0200
+#define PCRE_EXTRA_ARENA                  0x0400
 
 /* Types */
 
@@ -339,6 +360,60 @@ typedef struct real_pcre16_jit_stack pcre16_jit_stack;
 struct real_pcre32_jit_stack;     /* declaration; the definition is private  */
 typedef struct real_pcre32_jit_stack pcre32_jit_stack;
 
+struct real_pcre_cache;           /* declaration; the definition is private  */
+typedef struct real_pcre_cache pcre_cache;
+
+struct real_pcre16_cache;         /* declaration; the definition is private  */
+typedef struct real_pcre16_cache pcre16_cache;
+
+struct real_pcre32_cache;         /* declaration; the definition is private  */
+typedef struct real_pcre32_cache pcre32_cache;
+
+struct real_pcre_match_arena;     /* declaration; the definition is private  */
+typedef struct real_pcre_match_arena pcre_match_arena;
+
+struct real_pcre16_match_arena;   /* declaration; the definition is private  */
+typedef struct real_pcre16_match_arena pcre16_match_arena;
+
+struct real_pcre32_match_arena;   /* declaration; the definition is private  */
+typedef struct real_pcre32_match_arena pcre32_match_arena;
+
+struct real_pcre_arena;           /* declaration; the definition is private  */
+typedef struct real_pcre_arena pcre_arena;
+
+struct real_pcre16_arena;         /* declaration; the definition is private  */
+typedef struct real_pcre16_arena pcre16_arena;
+
+struct real_pcre32_arena;         /* declaration; the definition is private  */
+typedef struct real_pcre32_arena pcre32_arena;
+
+struct real_pcre_set;             /* declaration; the definition is private  */
+typedef struct real_pcre_set pcre_set;
+
+struct real_pcre16_set;           /* declaration; the definition is private  */
+typedef struct real_pcre16_set pcre16_set;
+
+struct real_pcre32_set;           /* declaration; the definition is private  */
+typedef struct real_pcre32_set pcre32_set;
+
+struct real_pcre_lru_cache;       /* declaration; the definition is private  */
+typedef struct real_pcre_lru_cache pcre_lru_cache;
+
+struct real_pcre16_lru_cache;     /* declaration; the definition is private  */
+typedef struct real_pcre16_lru_cache pcre16_lru_cache;
+
+struct real_pcre32_lru_cache;     /* declaration; the definition is private  */
+typedef struct real_pcre32_lru_cache pcre32_lru_cache;
+
+struct real_pcre_stream;          /* declaration; the definition is private  */
+typedef struct real_pcre_stream pcre_stream;
+
+struct real_pcre16_stream;        /* declaration; the definition is private  */
+typedef struct real_pcre16_stream pcre16_stream;
+
+struct real_pcre32_stream;        /* declaration; the definition is private  */
+typedef struct real_pcre32_stream pcre32_stream;
+
 /* If PCRE is compiled with 16 bit character support, PCRE_UCHAR16 must contain
 a 16 bit wide signed data type. Otherwise it can be a dummy data type since
 pcre16 functions are not implemented. There is a check for this in pcre_internal.h. */
@@ -410,6 +485,17 @@ typedef struct pcre32_extra {
   void *executable_jit;           /* Contains a pointer to a compiled jit code */
 } pcre32_extra;
 
+/* The counters returned by pcre_fullinfo() with PCRE_INFO_PROFILE. The same
+structure is used by all three libraries. */
+
+typedef struct pcre_profile {
+  unsigned long int calls;        /* Calls of pcre_exec() and pcre_dfa_exec() */
+  unsigned long int match_calls;  /* Calls of match() inside pcre_exec() */
+  unsigned long int dfa_states;   /* States processed by pcre_dfa_exec() */
+  unsigned long int units;        /* Subject code units scanned */
+  double seconds;                 /* Time spent in the calls */
+} pcre_profile;
+
 /* The structure for passing out data via the pcre_callout_function. We use a
 structure so that new fields can be added on the end in future versions,
 without changing the API of the function, thereby allowing old clients to work
@@ -652,6 +738,11 @@ PCRE_EXP_DECL int  pcre16_utf16_to_host_byte_order(PCRE_UCHAR16 *,
 PCRE_EXP_DECL int  pcre32_utf32_to_host_byte_order(PCRE_UCHAR32 *,
                   PCRE_SPTR32, int, int *, int);
 
+/* Functions for checking a subject once before matching it several times. */
+PCRE_EXP_DECL int  pcre_valid_utf8(const char *, int, int *);
+PCRE_EXP_DECL int  pcre16_valid_utf16(PCRE_SPTR16, int, int *);
+PCRE_EXP_DECL int  pcre32_valid_utf32(PCRE_SPTR32, int, int *);
+
 /* JIT compiler related functions. */
 
 PCRE_EXP_DECL pcre_jit_stack *pcre_jit_stack_alloc(int, int);
@@ -669,6 +760,140 @@ PCRE_EXP_DECL void pcre32_assign_jit_stack(pcre32_extra *,
 PCRE_EXP_DECL void pcre_jit_free_unused_memory(void);
 PCRE_EXP_DECL void pcre16_jit_free_unused_memory(void);
 PCRE_EXP_DECL void pcre32_jit_free_unused_memory(void);
+PCRE_EXP_DECL pcre_jit_stack *pcre_jit_thread_stack(void *);
+PCRE_EXP_DECL pcre16_jit_stack *pcre16_jit_thread_stack(void *);
+PCRE_EXP_DECL pcre32_jit_stack *pcre32_jit_thread_stack(void *);
+
+/* Functions for the memory used by pcre_exec(). */
+
+PCRE_EXP_DECL pcre_match_arena *pcre_match_arena_alloc(int, int);
+PCRE_EXP_DECL pcre16_match_arena *pcre16_match_arena_alloc(int, int);
+PCRE_EXP_DECL pcre32_match_arena *pcre32_match_arena_alloc(int, int);
+PCRE_EXP_DECL void pcre_match_arena_free(pcre_match_arena *);
+PCRE_EXP_DECL void pcre16_match_arena_free(pcre16_match_arena *);
+PCRE_EXP_DECL void pcre32_match_arena_free(pcre32_match_arena *);
+PCRE_EXP_DECL void pcre_assign_match_arena(pcre_extra *, pcre_match_arena *);
+PCRE_EXP_DECL void pcre16_assign_match_arena(pcre16_extra *,
+                  pcre16_match_arena *);
+PCRE_EXP_DECL void pcre32_assign_match_arena(pcre32_extra *,
+                  pcre32_match_arena *);
+PCRE_EXP_DECL size_t pcre_match_arena_highwater(pcre_match_arena *, int);
+PCRE_EXP_DECL size_t pcre16_match_arena_highwater(pcre16_match_arena *, int);
+PCRE_EXP_DECL size_t pcre32_match_arena_highwater(pcre32_match_arena *, int);
+
+/* Functions for compiling and studying patterns into one region of memory. */
+
+PCRE_EXP_DECL pcre_arena *pcre_arena_create(void *, size_t);
+PCRE_EXP_DECL pcre16_arena *pcre16_arena_create(void *, size_t);
+PCRE_EXP_DECL pcre32_arena *pcre32_arena_create(void *, size_t);
+PCRE_EXP_DECL pcre *pcre_compile_arena(pcre_arena *, const char *, int, int *,
+                  const char **, int *, const unsigned char *);
+PCRE_EXP_DECL pcre16 *pcre16_compile_arena(pcre16_arena *, PCRE_SPTR16, int,
+                  int *, const char **, int *, const unsigned char *);
+PCRE_EXP_DECL pcre32 *pcre32_compile_arena(pcre32_arena *, PCRE_SPTR32, int,
+                  int *, const char **, int *, const unsigned char *);
+PCRE_EXP_DECL pcre_extra *pcre_study_arena(pcre_arena *, const pcre *, int,
+                  const char **);
+PCRE_EXP_DECL pcre16_extra *pcre16_study_arena(pcre16_arena *,
+                  const pcre16 *, int, const char **);
+PCRE_EXP_DECL pcre32_extra *pcre32_study_arena(pcre32_arena *,
+                  const pcre32 *, int, const char **);
+PCRE_EXP_DECL size_t pcre_arena_used(const pcre_arena *);
+PCRE_EXP_DECL size_t pcre16_arena_used(const pcre16_arena *);
+PCRE_EXP_DECL size_t pcre32_arena_used(const pcre32_arena *);
+PCRE_EXP_DECL void pcre_arena_free(pcre_arena *);
+PCRE_EXP_DECL void pcre16_arena_free(pcre16_arena *);
+PCRE_EXP_DECL void pcre32_arena_free(pcre32_arena *);
+
+/* Functions for a file of precompiled patterns. */
+
+PCRE_EXP_DECL pcre_cache *pcre_cache_open(const char *, const char **);
+PCRE_EXP_DECL pcre16_cache *pcre16_cache_open(const char *, const char **);
+PCRE_EXP_DECL pcre32_cache *pcre32_cache_open(const char *, const char **);
+PCRE_EXP_DECL pcre *pcre_cache_compile(pcre_cache *, const char *, int, int,
+                  pcre_extra **, const char **, int *);
+PCRE_EXP_DECL pcre16 *pcre16_cache_compile(pcre16_cache *, PCRE_SPTR16, int,
+                  int, pcre16_extra **, const char **, int *);
+PCRE_EXP_DECL pcre32 *pcre32_cache_compile(pcre32_cache *, PCRE_SPTR32, int,
+                  int, pcre32_extra **, const char **, int *);
+PCRE_EXP_DECL int  pcre_cache_save(pcre_cache *);
+PCRE_EXP_DECL int  pcre16_cache_save(pcre16_cache *);
+PCRE_EXP_DECL int  pcre32_cache_save(pcre32_cache *);
+PCRE_EXP_DECL void pcre_cache_close(pcre_cache *);
+PCRE_EXP_DECL void pcre16_cache_close(pcre16_cache *);
+PCRE_EXP_DECL void pcre32_cache_close(pcre32_cache *);
+
+/* Functions for matching a subject against several patterns at once. */
+
+PCRE_EXP_DECL pcre_set *pcre_set_compile(const char *const *, int, int, int,
+                  const char **, int *, int *);
+PCRE_EXP_DECL pcre16_set *pcre16_set_compile(PCRE_SPTR16 const *, int, int, int,
+                  const char **, int *, int *);
+PCRE_EXP_DECL pcre32_set *pcre32_set_compile(PCRE_SPTR32 const *, int, int, int,
+                  const char **, int *, int *);
+PCRE_EXP_DECL int  pcre_set_exec(const pcre_set *, const char *, int, int,
+                  unsigned char *);
+PCRE_EXP_DECL int  pcre16_set_exec(const pcre16_set *, PCRE_SPTR16, int, int,
+                  unsigned char *);
+PCRE_EXP_DECL int  pcre32_set_exec(const pcre32_set *, PCRE_SPTR32, int, int,
+                  unsigned char *);
+PCRE_EXP_DECL void pcre_set_free(pcre_set *);
+PCRE_EXP_DECL void pcre16_set_free(pcre16_set *);
+PCRE_EXP_DECL void pcre32_set_free(pcre32_set *);
+
+/* Functions for matching one pattern against many subjects. */
+
+PCRE_EXP_DECL int  pcre_exec_batch(const pcre *, const pcre_extra *,
+                  const char *const *, const int *, int, int, int, int *);
+PCRE_EXP_DECL int  pcre16_exec_batch(const pcre16 *, const pcre16_extra *,
+                  PCRE_SPTR16 const *, const int *, int, int, int, int *);
+PCRE_EXP_DECL int  pcre32_exec_batch(const pcre32 *, const pcre32_extra *,
+                  PCRE_SPTR32 const *, const int *, int, int, int, int *);
+
+/* Functions for a shared cache of compiled patterns. */
+
+PCRE_EXP_DECL pcre_lru_cache *pcre_lru_cache_create(int, int);
+PCRE_EXP_DECL pcre16_lru_cache *pcre16_lru_cache_create(int, int);
+PCRE_EXP_DECL pcre32_lru_cache *pcre32_lru_cache_create(int, int);
+PCRE_EXP_DECL const pcre *pcre_compile_cached(pcre_lru_cache *, const char *,
+                  int, const char **, int *, const unsigned char *,
+                  const pcre_extra **);
+PCRE_EXP_DECL const pcre16 *pcre16_compile_cached(pcre16_lru_cache *,
+                  PCRE_SPTR16, int, const char **, int *,
+                  const unsigned char *, const pcre16_extra **);
+PCRE_EXP_DECL const pcre32 *pcre32_compile_cached(pcre32_lru_cache *,
+                  PCRE_SPTR32, int, const char **, int *,
+                  const unsigned char *, const pcre32_extra **);
+PCRE_EXP_DECL int  pcre_release_cached(const pcre *);
+PCRE_EXP_DECL int  pcre16_release_cached(const pcre16 *);
+PCRE_EXP_DECL int  pcre32_release_cached(const pcre32 *);
+PCRE_EXP_DECL int  pcre_lru_cache_info(pcre_lru_cache *, int, void *);
+PCRE_EXP_DECL int  pcre16_lru_cache_info(pcre16_lru_cache *, int, void *);
+PCRE_EXP_DECL int  pcre32_lru_cache_info(pcre32_lru_cache *, int, void *);
+PCRE_EXP_DECL void pcre_lru_cache_free(pcre_lru_cache *);
+PCRE_EXP_DECL void pcre16_lru_cache_free(pcre16_lru_cache *);
+PCRE_EXP_DECL void pcre32_lru_cache_free(pcre32_lru_cache *);
+
+/* Functions for matching data that arrives in pieces. */
+
+PCRE_EXP_DECL pcre_stream *pcre_stream_create(const pcre *,
+                  const pcre_extra *, int, int *);
+PCRE_EXP_DECL pcre16_stream *pcre16_stream_create(const pcre16 *,
+                  const pcre16_extra *, int, int *);
+PCRE_EXP_DECL pcre32_stream *pcre32_stream_create(const pcre32 *,
+                  const pcre32_extra *, int, int *);
+PCRE_EXP_DECL int  pcre_stream_feed(pcre_stream *, const char *, int, int);
+PCRE_EXP_DECL int  pcre16_stream_feed(pcre16_stream *, PCRE_SPTR16, int, int);
+PCRE_EXP_DECL int  pcre32_stream_feed(pcre32_stream *, PCRE_SPTR32, int, int);
+PCRE_EXP_DECL int  pcre_stream_exec(pcre_stream *, int *, int, const char **,
+                  size_t *);
+PCRE_EXP_DECL int  pcre16_stream_exec(pcre16_stream *, int *, int,
+                  PCRE_SPTR16 *, size_t *);
+PCRE_EXP_DECL int  pcre32_stream_exec(pcre32_stream *, int *, int,
+                  PCRE_SPTR32 *, size_t *);
+PCRE_EXP_DECL void pcre_stream_free(pcre_stream *);
+PCRE_EXP_DECL void pcre16_stream_free(pcre16_stream *);
+PCRE_EXP_DECL void pcre32_stream_free(pcre32_stream *);
 
 #ifdef __cplusplus
 }  /* extern "C" */
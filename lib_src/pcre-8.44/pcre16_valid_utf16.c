@@ -39,7 +39,8 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 /* This module contains an internal function for validating UTF-16 character
-strings. */
+strings, and the external function that lets an application check a subject
+once before matching it against several patterns. */
 
 
 #ifdef HAVE_CONFIG_H
@@ -134,4 +135,39 @@ for (p = string; length-- > 0; p++)
 return PCRE_UTF16_ERR0;   /* This indicates success */
 }
 
+
+
+/*************************************************
+*    Validate a UTF-16 string for the caller     *
+*************************************************/
+
+/* This lets an application that matches the same subject against several
+patterns check it once, and then pass PCRE_NO_UTF16_CHECK to each match.
+
+Arguments:
+  string       points to the string
+  length       length of string, or -1 if the string is zero-terminated
+  erroroffset  where to put the offset of the bad character, or NULL
+
+Returns:       0 if the string is valid, PCRE_UTF16_ERR1 to PCRE_UTF16_ERR3
+               if it is not, or PCRE_ERROR_BADOPTION if UTF support was not
+               compiled
+*/
+
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_valid_utf16(PCRE_SPTR16 string, int length, int *erroroffset)
+{
+#ifdef SUPPORT_UTF
+int offset = 0;
+int rc = PRIV(valid_utf)((PCRE_PUCHAR)string, length, &offset);
+if (erroroffset != NULL) *erroroffset = (rc == PCRE_UTF16_ERR0)? -1 : offset;
+return rc;
+#else
+(void)(string);
+(void)(length);
+if (erroroffset != NULL) *erroroffset = -1;
+return PCRE_ERROR_BADOPTION;
+#endif
+}
+
 /* End of pcre16_valid_utf16.c */
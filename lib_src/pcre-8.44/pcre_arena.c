@@ -0,0 +1,307 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+/* This module contains the external functions pcre_arena_create(),
+pcre_arena_used() and pcre_arena_free(), and internal functions that
+pcre_compile_arena() and pcre_study_arena() use to place compiled patterns and
+study data in an arena. An arena is a single contiguous region, either supplied
+by the caller (for example, a mapping that is later written to a file) or
+obtained from pcre_malloc() when the arena is created. Blocks are handed out
+from the front of the region and are never freed individually; the whole arena
+is released by pcre_arena_free(). This avoids the fragmentation and per-block
+overhead of many small allocations when an application compiles a large set of
+patterns that live for the same length of time.
+
+JIT code, lazy DFAs and specialized matchers that pcre_study_arena() attaches
+to study data are not placed in the arena, because they are executable or are
+modified while matching. The arena keeps a list of the study data it holds so
+that pcre_arena_free() can release them.
+
+An arena is not thread-safe; each thread must use its own, or serialize calls
+that allocate from a shared one. Patterns that have been compiled into an arena
+can be used by any number of threads at once, as usual. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcre_internal.h"
+
+
+/* Every block starts on a multiple of 8 bytes, which is enough for the
+compiled pattern and pcre_extra structures. */
+
+#define ARENA_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/* Study data in an arena is preceded by one of these, linking it into the
+arena's list. */
+
+typedef struct arena_extra {
+  struct arena_extra *next;
+  void *dummy;                    /* To ensure size is a multiple of 8 */
+} arena_extra;
+
+#if defined COMPILE_PCRE8
+#define ARENA_BLOCK real_pcre_arena
+#elif defined COMPILE_PCRE16
+#define ARENA_BLOCK real_pcre16_arena
+#elif defined COMPILE_PCRE32
+#define ARENA_BLOCK real_pcre32_arena
+#endif
+
+struct ARENA_BLOCK {
+  pcre_uint8 *base;               /* Start of the region, aligned */
+  size_t size;                    /* Usable size of the region */
+  size_t used;                    /* Bytes handed out so far */
+  size_t last;                    /* Offset of the most recent block */
+  arena_extra *extras;            /* Study data, most recent first */
+  BOOL owned;                     /* Region is part of this block */
+};
+
+
+
+/*************************************************
+*           Create an arena                      *
+*************************************************/
+
+/* If memory is NULL, the region is obtained from pcre_malloc() together with
+the control block; otherwise the caller's memory is used and must remain valid
+until the arena is freed. Either way the arena never grows.
+
+Arguments:
+  memory       the region to use, or NULL
+  size         the size of the region in bytes
+
+Returns:       the arena, or NULL if size is too small or there is no memory
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_arena * PCRE_CALL_CONVENTION
+pcre_arena_create(void *memory, size_t size)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_arena * PCRE_CALL_CONVENTION
+pcre16_arena_create(void *memory, size_t size)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_arena * PCRE_CALL_CONVENTION
+pcre32_arena_create(void *memory, size_t size)
+#endif
+{
+struct ARENA_BLOCK *arena;
+size_t header = ARENA_ALIGN(sizeof(struct ARENA_BLOCK));
+size_t skip;
+
+if (memory == NULL)
+  {
+  if (size == 0 || size > ~(size_t)0 - header) return NULL;
+  arena = (struct ARENA_BLOCK *)(PUBL(malloc))(header + size);
+  if (arena == NULL) return NULL;
+  arena->base = (pcre_uint8 *)arena + header;
+  arena->owned = TRUE;
+  }
+else
+  {
+  skip = ARENA_ALIGN((size_t)memory) - (size_t)memory;
+  if (size <= skip) return NULL;
+  arena = (struct ARENA_BLOCK *)(PUBL(malloc))(sizeof(struct ARENA_BLOCK));
+  if (arena == NULL) return NULL;
+  arena->base = (pcre_uint8 *)memory + skip;
+  arena->owned = FALSE;
+  size -= skip;
+  }
+
+arena->size = size & ~(size_t)7;
+arena->used = arena->last = 0;
+arena->extras = NULL;
+
+#if defined COMPILE_PCRE8
+return (pcre_arena *)arena;
+#elif defined COMPILE_PCRE16
+return (pcre16_arena *)arena;
+#elif defined COMPILE_PCRE32
+return (pcre32_arena *)arena;
+#endif
+}
+
+
+
+/*************************************************
+*           Allocate from an arena               *
+*************************************************/
+
+/* The space that is left is always a multiple of 8, so a request that fits
+still fits after it is rounded up.
+
+Arguments:
+  external_arena  the arena
+  size            the number of bytes wanted
+
+Returns:          the block, or NULL if the arena is full
+*/
+
+void *
+PRIV(arena_alloc)(void *external_arena, size_t size)
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+if (size > arena->size - arena->used) return NULL;
+arena->last = arena->used;
+arena->used += ARENA_ALIGN(size);
+return arena->base + arena->last;
+}
+
+
+/* This is used for a pcre_extra block and the study data that follows it. The
+block is linked into the arena's list so that pcre_arena_free() can release
+what pcre_study() attaches to it.
+
+Arguments:
+  external_arena  the arena
+  size            the number of bytes wanted
+
+Returns:          the block, or NULL if the arena is full
+*/
+
+void *
+PRIV(arena_alloc_extra)(void *external_arena, size_t size)
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+arena_extra *link;
+
+if (size > arena->size - arena->used ||
+    arena->size - arena->used - size < sizeof(arena_extra))
+  return NULL;
+link = (arena_extra *)PRIV(arena_alloc)(arena, sizeof(arena_extra) + size);
+link->next = arena->extras;
+arena->extras = link;
+return (pcre_uint8 *)link + sizeof(arena_extra);
+}
+
+
+/* A block can be given back only if it is the most recent one. This is used
+when compiling or studying fails after the memory has been obtained; any other
+block is simply left in place.
+
+Arguments:
+  external_arena  the arena
+  block           a block from PRIV(arena_alloc)() or PRIV(arena_alloc_extra)()
+
+Returns:          nothing
+*/
+
+void
+PRIV(arena_free)(void *external_arena, void *block)
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+pcre_uint8 *last = arena->base + arena->last;
+
+if (arena->extras != NULL &&
+    (pcre_uint8 *)block == (pcre_uint8 *)arena->extras + sizeof(arena_extra))
+  {
+  if ((pcre_uint8 *)arena->extras != last) return;
+  arena->extras = arena->extras->next;
+  }
+else if ((pcre_uint8 *)block != last) return;
+
+arena->used = arena->last;
+}
+
+
+
+/*************************************************
+*           Report the space used                *
+*************************************************/
+
+/* The region from its start up to this many bytes holds everything that has
+been allocated, so an application can tell how large to make an arena, or how
+much of a region to keep.
+
+Argument:   the arena
+Returns:    the number of bytes used
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre_arena_used(const pcre_arena *external_arena)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre16_arena_used(const pcre16_arena *external_arena)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre32_arena_used(const pcre32_arena *external_arena)
+#endif
+{
+const struct ARENA_BLOCK *arena = (const struct ARENA_BLOCK *)external_arena;
+return (arena == NULL)? 0 : arena->used;
+}
+
+
+
+/*************************************************
+*           Free an arena                        *
+*************************************************/
+
+/* The JIT code, lazy DFAs and specialized matchers of the study data in the
+arena are released first; pcre_free_study() does nothing more for study data
+that is in an arena. After this, every pattern compiled into the arena is
+invalid. If the region was supplied by the caller, it is not freed.
+
+Argument:   the arena
+Returns:    nothing
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_arena_free(pcre_arena *external_arena)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_arena_free(pcre16_arena *external_arena)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_arena_free(pcre32_arena *external_arena)
+#endif
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+arena_extra *link;
+
+if (arena == NULL) return;
+for (link = arena->extras; link != NULL; link = link->next)
+  PUBL(free_study)((PUBL(extra) *)((pcre_uint8 *)link + sizeof(arena_extra)));
+(PUBL(free))(arena);
+}
+
+/* End of pcre_arena.c */
@@ -0,0 +1,392 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+
+/* This module contains the external function pcre_exec_batch(), which matches
+one pattern against many subjects, as when every entry of a long YANG leaf-list
+is validated against the same type. The checks of the pattern and the options,
+and the choice among JIT code, a specialized matcher, a lazy DFA, and the
+interpreter, are made once for the whole batch instead of once per subject; the
+first three are then called directly, without the set-up that pcre_exec() does.
+Each subject's UTF validity is checked once, before it is matched. A large
+batch can be divided among several threads. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "pcre_internal.h"
+
+#if defined COMPILE_PCRE8
+#define BATCH_SPTR PCRE_SPTR
+#elif defined COMPILE_PCRE16
+#define BATCH_SPTR PCRE_SPTR16
+#elif defined COMPILE_PCRE32
+#define BATCH_SPTR PCRE_SPTR32
+#endif
+
+/* A batch is divided among threads only if each gets at least BATCH_THREAD_MIN
+subjects, and never among more than BATCH_THREAD_MAX threads. */
+
+#define BATCH_THREAD_MIN 1024
+#define BATCH_THREAD_MAX 64
+
+/* The ways of matching a subject, one of which is chosen for a whole batch. */
+
+#define BATCH_EXEC      0         /* Call pcre_exec() */
+#define BATCH_JIT       1         /* Run the JIT code */
+#define BATCH_SPECIAL   2         /* Run the specialized matcher */
+#define BATCH_LAZY_DFA  3         /* Run the lazy DFA */
+
+/* The part of a batch that one thread matches. */
+
+typedef struct batch_job {
+  const REAL_PCRE *re;
+  const PUBL(extra) *extra;       /* Study data without PCRE_EXTRA_MARK */
+  BATCH_SPTR const *subjects;
+  const int *lengths;             /* Or NULL for zero-terminated subjects */
+  int *results;
+  int options;                    /* Options for pcre_exec() */
+  int engine;                     /* One of the BATCH_xxx values */
+  BOOL check_utf;                 /* Check each subject's UTF validity */
+  int first;                      /* First subject of the job */
+  int last;                       /* One past the last subject of the job */
+  int matched;                    /* Number of subjects that matched */
+} batch_job;
+
+
+
+/*************************************************
+*        Choose how to match the subjects        *
+*************************************************/
+
+/* The matchers are tried in the order in which pcre_exec() tries them. A
+profiled pattern is always passed to pcre_exec(), which times it.
+
+Arguments:
+  re          the compiled pattern
+  extra       the study data
+  options     the options for pcre_exec()
+
+Returns:      one of the BATCH_xxx values
+*/
+
+static int
+choose_engine(const REAL_PCRE *re, const PUBL(extra) *extra, int options)
+{
+#ifdef SUPPORT_PROFILE
+if ((re->flags & PCRE_PROFILED) != 0) return BATCH_EXEC;
+#else
+(void)re;
+#endif
+
+#ifdef SUPPORT_JIT
+if ((extra->flags & (PCRE_EXTRA_EXECUTABLE_JIT | PCRE_EXTRA_TABLES)) ==
+      PCRE_EXTRA_EXECUTABLE_JIT && extra->executable_jit != NULL &&
+    (options & ~PUBLIC_JIT_EXEC_OPTIONS) == 0)
+  return BATCH_JIT;
+#endif
+
+if ((extra->flags & (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE |
+      PCRE_EXTRA_TABLES)) == (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE) &&
+    STUDY_PRIVATE(extra)->special != NULL &&
+    (options & ~SPECIAL_EXEC_OPTIONS) == 0)
+  return BATCH_SPECIAL;
+
+if ((extra->flags & (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE |
+      PCRE_EXTRA_TABLES)) == (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE) &&
+    STUDY_PRIVATE(extra)->lazy_dfa != NULL &&
+    (options & ~LAZY_DFA_EXEC_OPTIONS) == 0)
+  return BATCH_LAZY_DFA;
+
+return BATCH_EXEC;
+}
+
+
+
+/*************************************************
+*           Match one subject of a batch         *
+*************************************************/
+
+/* The subject has already been checked. When the chosen matcher cannot decide
+a subject it is passed to pcre_exec(), as pcre_exec() itself would do.
+
+Arguments:
+  job         the job, which holds the pattern, study data, and options
+  subject     the subject
+  length      its length
+
+Returns:      0 for a match, or a negative error code as for pcre_exec()
+*/
+
+static int
+match_one(const batch_job *job, PCRE_PUCHAR subject, int length)
+{
+int rc;
+
+switch (job->engine)
+  {
+#ifdef SUPPORT_JIT
+  case BATCH_JIT:
+  rc = PRIV(jit_exec)(job->extra, subject, length, 0, job->options, NULL, 0);
+  if (rc != PCRE_ERROR_JIT_BADOPTION) return rc;
+  break;
+#endif
+
+  case BATCH_SPECIAL:
+    {
+    int match[2];
+    rc = PRIV(special_exec)(job->re, STUDY_PRIVATE(job->extra)->special,
+      subject, length, 0, (job->options & PCRE_ANCHORED) != 0, match);
+    if (rc != SPECIAL_FAILED)
+      return (rc == SPECIAL_NOMATCH)? PCRE_ERROR_NOMATCH : 0;
+    }
+  break;
+
+  case BATCH_LAZY_DFA:
+  rc = PRIV(lazy_dfa_exec)(job->re, STUDY_PRIVATE(job->extra)->lazy_dfa,
+    subject, length);
+  if (rc != LAZY_DFA_FAILED)
+    return (rc == LAZY_DFA_NOMATCH)? PCRE_ERROR_NOMATCH : 0;
+  break;
+
+  default:
+  break;
+  }
+
+return PUBL(exec)((const void *)job->re, job->extra, (BATCH_SPTR)subject,
+  length, 0, job->options, NULL, 0);
+}
+
+
+
+/*************************************************
+*         Match the subjects of one job          *
+*************************************************/
+
+/* An invalid UTF subject is passed to pcre_exec() without
+PCRE_NO_UTF8_CHECK, so that it returns the same error code as it would for a
+single call.
+
+Arguments:
+  job         the job
+
+Returns:      nothing; the results and the number of matches are in the job
+*/
+
+static void
+batch_run(batch_job *job)
+{
+int i;
+
+for (i = job->first; i < job->last; i++)
+  {
+  PCRE_PUCHAR subject = (PCRE_PUCHAR)job->subjects[i];
+  int length, rc;
+
+  if (subject == NULL)
+    {
+    job->results[i] = PCRE_ERROR_NULL;
+    continue;
+    }
+  length = (job->lengths != NULL)? job->lengths[i] : (int)STRLEN_UC(subject);
+
+  if (length < 0) rc = PCRE_ERROR_BADLENGTH;
+#ifdef SUPPORT_UTF
+  else if (job->check_utf)
+    {
+    int erroroffset;
+    if (PRIV(valid_utf)(subject, length, &erroroffset) != 0)
+      rc = PUBL(exec)((const void *)job->re, job->extra, (BATCH_SPTR)subject,
+        length, 0, job->options & ~PCRE_NO_UTF8_CHECK, NULL, 0);
+    else rc = match_one(job, subject, length);
+    }
+#endif
+  else rc = match_one(job, subject, length);
+
+  job->results[i] = rc;
+  if (rc >= 0) job->matched++;
+  }
+}
+
+
+#ifndef _WIN32
+static void *
+batch_thread(void *job)
+{
+batch_run((batch_job *)job);
+return NULL;
+}
+#endif
+
+
+
+/*************************************************
+*     Match one pattern against many subjects    *
+*************************************************/
+
+/* Each subject is matched from its start, as by pcre_exec() with a starting
+offset of zero and no offset vector. Threads other than the calling one are
+used only if "threads" is greater than one and the batch is large enough; they
+are not used if the study data has a match arena, which only one thread may
+use at a time.
+
+Arguments:
+  argument_re     points to the compiled expression
+  extra_data      points to extra data or is NULL
+  subjects        a vector of subjects
+  lengths         a vector of their lengths, or NULL if they are
+                    zero-terminated
+  count           the number of subjects
+  options         option bits, as for pcre_exec()
+  threads         the largest number of threads to use
+  results         a vector that receives, for each subject, what
+                    pcre_exec() would return: 0 for a match, or a negative
+                    error code
+
+Returns:          the number of subjects that matched, or a negative error
+                  code if the arguments are unusable
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_exec_batch(const pcre *argument_re, const pcre_extra *extra_data,
+  const char *const *subjects, const int *lengths, int count, int options,
+  int threads, int *results)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_exec_batch(const pcre16 *argument_re, const pcre16_extra *extra_data,
+  PCRE_SPTR16 const *subjects, const int *lengths, int count, int options,
+  int threads, int *results)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_exec_batch(const pcre32 *argument_re, const pcre32_extra *extra_data,
+  PCRE_SPTR32 const *subjects, const int *lengths, int count, int options,
+  int threads, int *results)
+#endif
+{
+const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
+PUBL(extra) extra;
+batch_job jobs[BATCH_THREAD_MAX];
+#ifndef _WIN32
+pthread_t tids[BATCH_THREAD_MAX];
+BOOL started[BATCH_THREAD_MAX];
+#endif
+batch_job *job = jobs;
+int njobs = 1;
+int matched = 0;
+int i;
+
+if (re == NULL || subjects == NULL || results == NULL) return PCRE_ERROR_NULL;
+if (count < 0) return PCRE_ERROR_BADCOUNT;
+if ((options & ~PUBLIC_EXEC_OPTIONS) != 0) return PCRE_ERROR_BADOPTION;
+if (re->magic_number != MAGIC_NUMBER)
+  return re->magic_number == REVERSED_MAGIC_NUMBER?
+    PCRE_ERROR_BADENDIANNESS:PCRE_ERROR_BADMAGIC;
+if ((re->flags & PCRE_MODE) == 0) return PCRE_ERROR_BADMODE;
+
+/* A mark cannot be returned for every subject, so none is returned, and the
+caller's extra block is left unchanged. */
+
+if (extra_data != NULL) extra = *extra_data;
+  else memset(&extra, 0, sizeof(extra));
+extra.flags &= ~PCRE_EXTRA_MARK;
+
+job->re = re;
+job->extra = &extra;
+job->subjects = subjects;
+job->lengths = lengths;
+job->results = results;
+job->options = options;
+job->check_utf = (re->options & PCRE_UTF8) != 0 &&
+  (options & PCRE_NO_UTF8_CHECK) == 0;
+if (job->check_utf) job->options |= PCRE_NO_UTF8_CHECK;
+job->matched = 0;
+
+job->engine = choose_engine(re, &extra, job->options);
+
+/* Divide the batch into jobs of nearly equal size. */
+
+#ifndef _WIN32
+if (threads > 1 && (extra.flags & PCRE_EXTRA_MATCH_ARENA) == 0)
+  {
+  njobs = count / BATCH_THREAD_MIN;
+  if (njobs > threads) njobs = threads;
+  if (njobs > BATCH_THREAD_MAX) njobs = BATCH_THREAD_MAX;
+  if (njobs < 1) njobs = 1;
+  }
+#else
+(void)threads;
+#endif
+
+for (i = 0; i < njobs; i++)
+  {
+  if (i > 0) jobs[i] = jobs[0];
+  jobs[i].first = (int)(((long)count * i) / njobs);
+  jobs[i].last = (int)(((long)count * (i + 1)) / njobs);
+  }
+
+/* The calling thread matches the first job. A job whose thread cannot be
+started is matched by the calling thread afterwards. */
+
+#ifndef _WIN32
+for (i = 1; i < njobs; i++)
+  started[i] = pthread_create(tids + i, NULL, batch_thread, jobs + i) == 0;
+#endif
+
+batch_run(jobs);
+matched = jobs[0].matched;
+
+#ifndef _WIN32
+for (i = 1; i < njobs; i++)
+  {
+  if (started[i]) pthread_join(tids[i], NULL); else batch_run(jobs + i);
+  matched += jobs[i].matched;
+  }
+#endif
+
+return matched;
+}
+
+/* End of pcre_batch.c */
@@ -0,0 +1,177 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* This is a private header for pcrebench, the benchmark program. It is not
+part of the PCRE library and is not installed.
+
+It provides a monotonic clock and a corpus of the regular expressions that
+libyang builds from the "pattern" statements of the ietf-inet-types and
+ietf-yang-types modules (RFC 6991), together with sample leaf values that do
+and do not match. libyang anchors each XML Schema pattern with ^ and $ and
+compiles it with PCRE_UTF8, PCRE_ANCHORED, PCRE_DOLLAR_ENDONLY and
+PCRE_NO_AUTO_CAPTURE; the patterns below are already in that form. */
+
+#ifndef PCRE_BENCH_H
+#define PCRE_BENCH_H
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/* The options libyang uses for YANG patterns. PCRE_UTF8 is dropped at run
+time when the library has no UTF support (see bench_yang_options()). */
+
+#define BENCH_YANG_OPTIONS (PCRE_ANCHORED | PCRE_DOLLAR_ENDONLY | \
+  PCRE_NO_AUTO_CAPTURE)
+
+typedef struct bench_pattern {
+  const char *module;             /* Module that defines the typedef */
+  const char *type;               /* Typedef name */
+  const char *pattern;            /* Perl form of the pattern */
+  const char *valid[4];           /* Values that match (NULL terminated) */
+  const char *invalid[4];         /* Values that do not match */
+} bench_pattern;
+
+static const bench_pattern bench_yang_patterns[] = {
+  { "ietf-inet-types", "ipv4-address",
+    "^(([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])\\.){3}"
+    "([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])(%[\\p{N}\\p{L}]+)?$",
+    { "192.0.2.1", "10.255.255.254", "172.16.0.1%eth0", NULL },
+    { "256.1.1.1", "192.0.2", "1.2.3.4.5", NULL } },
+
+  { "ietf-inet-types", "ipv6-address",
+    "^((:|[0-9a-fA-F]{0,4}):)([0-9a-fA-F]{0,4}:){0,5}"
+    "((([0-9a-fA-F]{0,4}:)?(:|[0-9a-fA-F]{0,4}))|"
+    "(((25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])\\.){3}"
+    "(25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])))(%[\\p{N}\\p{L}]+)?$",
+    { "2001:db8::1", "fe80::1%eth0", "::ffff:192.0.2.128", NULL },
+    { "2001:db8::g", "12345::", "1:2:3:4:5:6:7:8:9", NULL } },
+
+  { "ietf-inet-types", "ipv6-address",
+    "^(?:(([^:]+:){6}(([^:]+:[^:]+)|(.*\\..*)))|"
+    "((([^:]+:)*[^:]+)?::(([^:]+:)*[^:]+)?)(%.+)?)$",
+    { "2001:db8:0:0:0:0:0:1", "2001:db8::1", "::1", NULL },
+    { "2001:db8:1", "1:2:3:4:5:6:7", ":", NULL } },
+
+  { "ietf-inet-types", "ipv4-prefix",
+    "^(([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])\\.){3}"
+    "([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])"
+    "/(([0-9])|([1-2][0-9])|(3[0-2]))$",
+    { "192.0.2.0/24", "10.0.0.0/8", "0.0.0.0/0", NULL },
+    { "192.0.2.0/33", "192.0.2.0", "192.0.2/24", NULL } },
+
+  { "ietf-inet-types", "ipv6-prefix",
+    "^((:|[0-9a-fA-F]{0,4}):)([0-9a-fA-F]{0,4}:){0,5}"
+    "((([0-9a-fA-F]{0,4}:)?(:|[0-9a-fA-F]{0,4}))|"
+    "(((25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])\\.){3}"
+    "(25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])))"
+    "(/(([0-9])|([0-9]{2})|(1[0-1][0-9])|(12[0-8])))$",
+    { "2001:db8::/32", "fe80::/10", "::/0", NULL },
+    { "2001:db8::/129", "2001:db8::", "/64", NULL } },
+
+  { "ietf-inet-types", "domain-name",
+    "^(?:((([a-zA-Z0-9_]([a-zA-Z0-9\\-_]){0,61})?[a-zA-Z0-9]\\.)*"
+    "([a-zA-Z0-9_]([a-zA-Z0-9\\-_]){0,61})?[a-zA-Z0-9]\\.?)|\\.)$",
+    { "example.com", "netconf.example.org.", "a-b.c_d.e", NULL },
+    { "-example.com", "exa mple.com", "example..com", NULL } },
+
+  { "ietf-yang-types", "object-identifier",
+    "^(([0-1](\\.[1-3]?[0-9]))|(2\\.(0|([1-9]\\d*))))"
+    "(\\.(0|([1-9]\\d*)))*$",
+    { "1.3.6.1.2.1.1", "2.999.1", "0.39", NULL },
+    { "3.1", "1.3.06", "1.", NULL } },
+
+  { "ietf-yang-types", "date-and-time",
+    "^\\d{4}-\\d{2}-\\d{2}T\\d{2}:\\d{2}:\\d{2}(\\.\\d+)?"
+    "(Z|[\\+\\-]\\d{2}:\\d{2})$",
+    { "2020-02-12T10:20:30Z", "2019-07-02T23:59:60.123+02:00",
+      "1985-04-12T23:20:50.52-08:00", NULL },
+    { "2020-02-12 10:20:30Z", "2020-02-12T10:20:30", "20-02-12T10:20:30Z",
+      NULL } },
+
+  { "ietf-yang-types", "phys-address",
+    "^([0-9a-fA-F]{2}(:[0-9a-fA-F]{2})*)?$",
+    { "00:1b:21:3c:4d:5e", "", "ab:CD:ef:01:23:45:67:89", NULL },
+    { "00:1b:21:3c:4d:5", "001b213c4d5e", "00-1b-21-3c-4d-5e", NULL } },
+
+  { "ietf-yang-types", "mac-address",
+    "^[0-9a-fA-F]{2}(:[0-9a-fA-F]{2}){5}$",
+    { "00:1b:21:3c:4d:5e", "FF:FF:FF:FF:FF:FF", "02:00:5e:10:00:01", NULL },
+    { "00:1b:21:3c:4d", "00:1b:21:3c:4d:5e:6f", "0g:1b:21:3c:4d:5e", NULL } },
+
+  { "ietf-yang-types", "hex-string",
+    "^([0-9a-fA-F]{2}(:[0-9a-fA-F]{2})*)?$",
+    { "0a:0b:0c", "de:ad:be:ef:ca:fe:ba:be", "", NULL },
+    { "0a:0b:0", "deadbeef", ":0a", NULL } },
+
+  { "ietf-yang-types", "uuid",
+    "^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}"
+    "-[0-9a-fA-F]{12}$",
+    { "f81d4fae-7dec-11d0-a765-00a0c91e6bf6",
+      "00000000-0000-0000-0000-000000000000",
+      "F81D4FAE-7DEC-11D0-A765-00A0C91E6BF6", NULL },
+    { "f81d4fae-7dec-11d0-a765-00a0c91e6bf",
+      "f81d4fae7dec11d0a76500a0c91e6bf6",
+      "g81d4fae-7dec-11d0-a765-00a0c91e6bf6", NULL } },
+
+  { "ietf-yang-types", "dotted-quad",
+    "^(([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])\\.){3}"
+    "([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])$",
+    { "0.0.0.1", "255.255.255.255", "10.20.30.40", NULL },
+    { "0.0.0.256", "1.2.3", "01.2.3.4.", NULL } },
+
+  { "ietf-yang-types", "yang-identifier",
+    "^[a-zA-Z_][a-zA-Z0-9\\-_.]*$",
+    { "interface", "ietf-netconf", "_x.y-z", NULL },
+    { "1st", "has space", "", NULL } },
+
+  { "ietf-yang-types", "yang-identifier",
+    "^(?:.|..|[^xX].*|.[^mM].*|..[^lL].*)$",
+    { "interface", "xmp", "ab", NULL },
+    { "xml", "XMLthing", "xMl-prefixed", NULL } }
+};
+
+#define BENCH_YANG_PATTERN_COUNT \
+  (int)(sizeof(bench_yang_patterns) / sizeof(bench_pattern))
+
+/* Return the compile options to use for the YANG corpus. Patterns use \p, so
+PCRE_UTF8 is added when the library supports it; without Unicode property
+support the few patterns that use \p fail to compile and are skipped. */
+
+static int
+bench_yang_options(void)
+{
+int utf = 0;
+(void)pcre_config(PCRE_CONFIG_UTF8, &utf);
+return BENCH_YANG_OPTIONS | (utf? PCRE_UTF8 : 0);
+}
+
+/* Monotonic time in nanoseconds. */
+
+static double
+bench_now_ns(void)
+{
+#ifdef _WIN32
+LARGE_INTEGER freq, now;
+QueryPerformanceFrequency(&freq);
+QueryPerformanceCounter(&now);
+return (double)now.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+/* Keep the optimizer from discarding results. */
+
+static volatile long bench_sink;
+
+#endif  /* PCRE_BENCH_H */
+
+/* End of pcre_bench.h */
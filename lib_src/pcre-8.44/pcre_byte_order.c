@@ -152,6 +152,16 @@ re->name_count = swap_uint16(re->name_count);
 re->ref_count = swap_uint16(re->ref_count);
 re->tables = tables;
 
+/* Profiling counters from another host are of no use, so they are reset. */
+
+if ((re->flags & PCRE_PROFILED) != 0)
+  {
+  profile_data *pd = PROFILE_DATA(re);
+  pcre_uint32 code_size = swap_uint32(pd->code_size);
+  memset(pd, 0, PROFILE_BLOCK_SIZE);
+  pd->code_size = code_size;
+  }
+
 if (extra_data != NULL && (extra_data->flags & PCRE_EXTRA_STUDY_DATA) != 0)
   {
   study = (pcre_study_data *)extra_data->study_data;
@@ -0,0 +1,994 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains the external functions pcre_cache_open(),
+pcre_cache_compile(), pcre_cache_save() and pcre_cache_close(), which maintain
+a file of compiled and studied patterns. A program that compiles the same
+patterns every time it starts can load them from the file instead of compiling
+them again.
+
+The file is mapped into memory when it is opened. It starts with a header that
+records the format, the library version and build options, and a checksum of
+the default character tables; if any of these do not match the running library
+the whole file is ignored and is rewritten by the next pcre_cache_save(). A
+file written on a host with the other byte order is accepted; its patterns are
+converted by pcre_pattern_to_host_byte_order() as they are copied out. Each
+entry is keyed by the pattern text and the compile options, and holds the
+compiled pattern followed by its study data. Only patterns compiled with the
+default character tables are cached, because the tables pointer cannot be saved.
+
+A cache is not thread-safe; each thread must use its own, or serialize access
+to a shared one. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "pcre_internal.h"
+
+
+#define CACHE_MAGIC          0x50435243UL   /* 'PCRC' */
+#define REVERSED_CACHE_MAGIC 0x43524350UL   /* 'CRCP' */
+#define CACHE_FORMAT         1
+
+/* Sizes in the file are rounded up to a multiple of 8 so that every header
+and compiled pattern starts on an aligned boundary. */
+
+#define CACHE_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/* The file header. All fields are in the byte order of the host that wrote
+the file; the magic number tells which. */
+
+typedef struct cache_file_header {
+  pcre_uint32 magic_number;
+  pcre_uint32 format;             /* CACHE_FORMAT */
+  pcre_uint32 code_unit_size;     /* 1, 2 or 4 */
+  pcre_uint32 build_hash;         /* Version and build options */
+  pcre_uint32 tables_hash;        /* Checksum of the default tables */
+  pcre_uint32 entry_count;
+  pcre_uint32 dummy1;             /* To ensure size is a multiple of 8 */
+  pcre_uint32 dummy2;             /* To ensure size is a multiple of 8 */
+} cache_file_header;
+
+/* Each entry header is followed by the pattern (pattern_length code units
+plus a binary zero), the compiled pattern and the study data, each padded to a
+multiple of 8 bytes. */
+
+typedef struct cache_file_entry {
+  pcre_uint32 pattern_length;     /* In code units */
+  pcre_uint32 options;            /* Compile options */
+  pcre_uint32 re_size;            /* Size of the compiled pattern */
+  pcre_uint32 study_size;         /* Size of the study data */
+} cache_file_entry;
+
+/* The in-memory index. Entries that came from the file point into the
+mapping; entries added since the file was opened own a single block that holds
+the entry, the pattern, the compiled pattern and the study data. */
+
+typedef struct cache_entry {
+  struct cache_entry *next;       /* Next in hash chain */
+  struct cache_entry *added;      /* Next added entry, in order of addition */
+  PCRE_PUCHAR pattern;
+  const pcre_uint8 *re;
+  const pcre_uint8 *study;
+  pcre_uint32 hash;
+  pcre_uint32 pattern_length;
+  pcre_uint32 options;
+  pcre_uint32 re_size;
+  pcre_uint32 study_size;
+  BOOL swapped;                   /* Stored in the other byte order */
+} cache_entry;
+
+#if defined COMPILE_PCRE8
+#define CACHE_BLOCK real_pcre_cache
+#elif defined COMPILE_PCRE16
+#define CACHE_BLOCK real_pcre16_cache
+#elif defined COMPILE_PCRE32
+#define CACHE_BLOCK real_pcre32_cache
+#endif
+
+struct CACHE_BLOCK {
+  char *path;                     /* File name */
+  void *map;                      /* Contents of the file, or NULL */
+  size_t map_size;
+  BOOL swapped;                   /* File has the other byte order */
+  BOOL dirty;                     /* File needs to be rewritten */
+  cache_entry *file_entries;      /* Vector of entries read from the file */
+  pcre_uint32 file_count;
+  cache_entry *added_first;       /* Entries added since opening */
+  cache_entry *added_last;
+  cache_entry **buckets;
+  pcre_uint32 bucket_count;       /* Always a power of 2 */
+  pcre_uint32 entry_count;
+};
+
+#define INITIAL_BUCKETS 64
+
+
+/*************************************************
+*          Swap byte functions                   *
+*************************************************/
+
+/* These are used for the fields of a file that was written on a host with the
+other byte order.
+
+Arguments:
+  value        any number
+
+Returns:       the byte swapped value
+*/
+
+static pcre_uint32
+swap_uint32(pcre_uint32 value)
+{
+return ((value & 0x000000ff) << 24) |
+       ((value & 0x0000ff00) <<  8) |
+       ((value & 0x00ff0000) >>  8) |
+       (value >> 24);
+}
+
+static pcre_uint32
+file_uint32(const struct CACHE_BLOCK *cache, pcre_uint32 value)
+{
+return cache->swapped? swap_uint32(value) : value;
+}
+
+#if defined COMPILE_PCRE8
+#define SWAP_UNIT(c) (c)
+#elif defined COMPILE_PCRE16
+#define SWAP_UNIT(c) ((pcre_uchar)(((c) >> 8) | ((c) << 8)))
+#elif defined COMPILE_PCRE32
+#define SWAP_UNIT(c) swap_uint32(c)
+#endif
+
+
+/*************************************************
+*          Hash and compare keys                 *
+*************************************************/
+
+/* The hash is FNV-1a over the code units of the pattern and the options. A
+pattern that was read from a file with the other byte order is hashed with its
+code units swapped, so that it gets the same hash as the host form.
+
+Arguments:
+  pattern      the pattern
+  length       its length in code units
+  options      the compile options
+  swapped      TRUE if the code units must be swapped
+
+Returns:       the hash value
+*/
+
+static pcre_uint32
+hash_key(PCRE_PUCHAR pattern, pcre_uint32 length, pcre_uint32 options,
+  BOOL swapped)
+{
+pcre_uint32 hash = 2166136261UL;
+pcre_uint32 i;
+
+for (i = 0; i < length; i++)
+  {
+  pcre_uint32 c = swapped? SWAP_UNIT(pattern[i]) : pattern[i];
+  hash = (hash ^ c) * 16777619UL;
+  }
+return (hash ^ options) * 16777619UL;
+}
+
+/* Hash a block of bytes, for the tables and the version string. */
+
+static pcre_uint32
+hash_bytes(pcre_uint32 hash, const pcre_uint8 *p, size_t length)
+{
+while (length-- > 0) hash = (hash ^ *p++) * 16777619UL;
+return hash;
+}
+
+/* The build hash covers everything that affects the layout of a compiled
+pattern: the library version, the code unit size, the link size, the sizes of
+the data blocks and the options that change what is compiled. */
+
+static pcre_uint32
+build_hash(void)
+{
+const char *version = PUBL(version)();
+pcre_uint32 config[8];
+
+config[0] = PCRE_MAJOR;
+config[1] = PCRE_MINOR;
+config[2] = LINK_SIZE;
+config[3] = sizeof(REAL_PCRE);
+config[4] = sizeof(pcre_study_data);
+config[5] = NEWLINE;
+config[6] = 0;
+#ifdef SUPPORT_UTF
+config[6] |= 0x01;
+#endif
+#ifdef SUPPORT_UCP
+config[6] |= 0x02;
+#endif
+#ifdef BSR_ANYCRLF
+config[6] |= 0x04;
+#endif
+#ifdef EBCDIC
+config[6] |= 0x08;
+#endif
+config[7] = 0;
+
+return hash_bytes(hash_bytes(2166136261UL, (const pcre_uint8 *)version,
+  strlen(version)), (const pcre_uint8 *)config, sizeof(config));
+}
+
+/* Compare the key of an entry with a pattern. */
+
+static BOOL
+key_equal(const cache_entry *entry,
+  PCRE_PUCHAR pattern, pcre_uint32 length, pcre_uint32 options)
+{
+pcre_uint32 i;
+
+if (entry->pattern_length != length || entry->options != options)
+  return FALSE;
+if (!entry->swapped)
+  return memcmp(entry->pattern, pattern, IN_UCHARS(length)) == 0;
+for (i = 0; i < length; i++)
+  if (SWAP_UNIT(entry->pattern[i]) != pattern[i]) return FALSE;
+return TRUE;
+}
+
+
+/*************************************************
+*          Maintain the hash table               *
+*************************************************/
+
+/* Insert an entry, doubling the number of buckets when the table is full.
+
+Returns:       TRUE on success, FALSE if out of memory
+*/
+
+static BOOL
+insert_entry(struct CACHE_BLOCK *cache, cache_entry *entry)
+{
+if (cache->entry_count >= cache->bucket_count)
+  {
+  pcre_uint32 new_count = (cache->bucket_count == 0)? INITIAL_BUCKETS :
+    cache->bucket_count * 2;
+  cache_entry **new_buckets = (cache_entry **)(PUBL(malloc))
+    (new_count * sizeof(cache_entry *));
+  pcre_uint32 i;
+
+  if (new_buckets == NULL) return FALSE;
+  memset(new_buckets, 0, new_count * sizeof(cache_entry *));
+  for (i = 0; i < cache->bucket_count; i++)
+    {
+    cache_entry *e = cache->buckets[i];
+    while (e != NULL)
+      {
+      cache_entry *next = e->next;
+      e->next = new_buckets[e->hash & (new_count - 1)];
+      new_buckets[e->hash & (new_count - 1)] = e;
+      e = next;
+      }
+    }
+  if (cache->buckets != NULL) (PUBL(free))(cache->buckets);
+  cache->buckets = new_buckets;
+  cache->bucket_count = new_count;
+  }
+
+entry->next = cache->buckets[entry->hash & (cache->bucket_count - 1)];
+cache->buckets[entry->hash & (cache->bucket_count - 1)] = entry;
+cache->entry_count++;
+return TRUE;
+}
+
+
+/*************************************************
+*          Read the file                         *
+*************************************************/
+
+/* Map or read the whole file. A missing or unreadable file is not an error;
+the cache just starts empty.
+
+Returns:       TRUE if the file contents are available
+*/
+
+static BOOL
+load_file(struct CACHE_BLOCK *cache)
+{
+#ifndef _WIN32
+struct stat statbuf;
+void *map;
+int fd = open(cache->path, O_RDONLY);
+
+if (fd < 0) return FALSE;
+if (fstat(fd, &statbuf) != 0 || !S_ISREG(statbuf.st_mode) ||
+    statbuf.st_size < (off_t)sizeof(cache_file_header))
+  {
+  close(fd);
+  return FALSE;
+  }
+map = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+close(fd);
+if (map == MAP_FAILED) return FALSE;
+cache->map = map;
+cache->map_size = (size_t)statbuf.st_size;
+return TRUE;
+
+#else
+FILE *f = fopen(cache->path, "rb");
+long size;
+void *buffer;
+
+if (f == NULL) return FALSE;
+if (fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) <
+    (long)sizeof(cache_file_header) || fseek(f, 0, SEEK_SET) != 0 ||
+    (buffer = (PUBL(malloc))((size_t)size)) == NULL)
+  {
+  fclose(f);
+  return FALSE;
+  }
+if (fread(buffer, 1, (size_t)size, f) != (size_t)size)
+  {
+  (PUBL(free))(buffer);
+  fclose(f);
+  return FALSE;
+  }
+fclose(f);
+cache->map = buffer;
+cache->map_size = (size_t)size;
+return TRUE;
+#endif
+}
+
+static void
+unload_file(struct CACHE_BLOCK *cache)
+{
+if (cache->map == NULL) return;
+#ifndef _WIN32
+(void)munmap(cache->map, cache->map_size);
+#else
+(PUBL(free))(cache->map);
+#endif
+cache->map = NULL;
+cache->map_size = 0;
+}
+
+/* Check the header and index the entries. If anything is wrong, the mapping
+is dropped and the file is marked for rewriting.
+
+Returns:       TRUE if the entries are usable
+*/
+
+static BOOL
+index_file(struct CACHE_BLOCK *cache)
+{
+const cache_file_header *header = (const cache_file_header *)cache->map;
+const pcre_uint8 *start = (const pcre_uint8 *)cache->map;
+const pcre_uint8 *p = start + sizeof(cache_file_header);
+const pcre_uint8 *end = start + cache->map_size;
+pcre_uint32 count, i;
+
+if (header->magic_number == CACHE_MAGIC) cache->swapped = FALSE;
+  else if (header->magic_number == REVERSED_CACHE_MAGIC) cache->swapped = TRUE;
+  else return FALSE;
+
+if (file_uint32(cache, header->format) != CACHE_FORMAT ||
+    file_uint32(cache, header->code_unit_size) != sizeof(pcre_uchar) ||
+    file_uint32(cache, header->build_hash) != build_hash() ||
+    file_uint32(cache, header->tables_hash) !=
+      hash_bytes(2166136261UL, PRIV(default_tables), tables_length))
+  return FALSE;
+
+count = file_uint32(cache, header->entry_count);
+if (count > (cache->map_size - sizeof(cache_file_header)) /
+    sizeof(cache_file_entry))
+  return FALSE;
+if (count == 0) return TRUE;
+
+cache->file_entries = (cache_entry *)(PUBL(malloc))
+  (count * sizeof(cache_entry));
+if (cache->file_entries == NULL) return FALSE;
+
+for (i = 0; i < count; i++)
+  {
+  const cache_file_entry *fe = (const cache_file_entry *)p;
+  cache_entry *entry = cache->file_entries + i;
+  size_t pattern_bytes, re_bytes, study_bytes;
+
+  if ((size_t)(end - p) < sizeof(cache_file_entry)) return FALSE;
+  entry->pattern_length = file_uint32(cache, fe->pattern_length);
+  entry->options = file_uint32(cache, fe->options);
+  entry->re_size = file_uint32(cache, fe->re_size);
+  entry->study_size = file_uint32(cache, fe->study_size);
+  p += sizeof(cache_file_entry);
+
+  pattern_bytes = CACHE_ALIGN(IN_UCHARS((size_t)entry->pattern_length + 1));
+  re_bytes = CACHE_ALIGN((size_t)entry->re_size);
+  study_bytes = CACHE_ALIGN((size_t)entry->study_size);
+
+  if (entry->pattern_length > (size_t)(end - p) ||
+      entry->re_size < sizeof(REAL_PCRE) ||
+      (entry->study_size != 0 &&
+        entry->study_size != sizeof(pcre_study_data)) ||
+      (size_t)(end - p) < pattern_bytes + re_bytes + study_bytes)
+    return FALSE;
+
+  entry->pattern = (PCRE_PUCHAR)p;
+  entry->re = p + pattern_bytes;
+  entry->study = (entry->study_size == 0)? NULL : entry->re + re_bytes;
+  entry->added = NULL;
+  entry->swapped = cache->swapped;
+  p += pattern_bytes + re_bytes + study_bytes;
+
+  if (entry->pattern[entry->pattern_length] != 0 ||
+      file_uint32(cache, ((const REAL_PCRE *)entry->re)->magic_number) !=
+        MAGIC_NUMBER ||
+      file_uint32(cache, ((const REAL_PCRE *)entry->re)->size) !=
+        entry->re_size)
+    return FALSE;
+
+  entry->hash = hash_key(entry->pattern, entry->pattern_length,
+    entry->options, cache->swapped);
+  if (!insert_entry(cache, entry)) return FALSE;
+  cache->file_count++;
+  }
+
+return TRUE;
+}
+
+
+/*************************************************
+*          Copy out a cached pattern             *
+*************************************************/
+
+/* Make a private copy of a compiled pattern and its study data. The copies are
+in the host byte order and are in the form returned by pcre_compile() and
+pcre_study(), so they can be freed with pcre_free() and pcre_free_study(). An
+extra block is always made, with no JIT code.
+
+Arguments:
+  entry        the entry to copy
+  re_ptr       where to put the compiled pattern
+  extra_ptr    where to put the extra block
+
+Returns:       TRUE on success, FALSE if out of memory or the data is bad
+*/
+
+static BOOL
+copy_entry(const cache_entry *entry,
+  REAL_PCRE **re_ptr, PUBL(extra) **extra_ptr)
+{
+REAL_PCRE *re;
+PUBL(extra) *extra;
+pcre_study_data *study;
+
+re = (REAL_PCRE *)(PUBL(malloc))(entry->re_size);
+extra = PRIV(study_alloc)(NULL);
+if (re == NULL || extra == NULL)
+  {
+  if (re != NULL) (PUBL(free))(re);
+  if (extra != NULL) (PUBL(free))(extra);
+  return FALSE;
+  }
+
+memcpy(re, entry->re, entry->re_size);
+study = (pcre_study_data *)extra->study_data;
+
+if (entry->study != NULL)
+  memcpy(study, entry->study, sizeof(pcre_study_data));
+else if (entry->swapped) study->size = swap_uint32(study->size);
+
+/* The byte order function also resets the tables pointer, which was NULL
+when the pattern was compiled. */
+
+if (!entry->swapped) re->tables = NULL;
+else if (PUBL(pattern_to_host_byte_order)((void *)re, extra, NULL) != 0)
+  {
+  (PUBL(free))(re);
+  (PUBL(free))(extra);
+  return FALSE;
+  }
+
+re->ref_count = 0;
+*re_ptr = re;
+*extra_ptr = extra;
+return TRUE;
+}
+
+
+/*************************************************
+*          Open a pattern cache                  *
+*************************************************/
+
+/* This function creates a cache for the given file. If the file exists and
+was written by a compatible library, its patterns are available at once.
+
+Arguments:
+  path         the file name
+  errorptr     where to put an error message
+
+Returns:       the cache, or NULL if out of memory
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_cache * PCRE_CALL_CONVENTION
+pcre_cache_open(const char *path, const char **errorptr)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_cache * PCRE_CALL_CONVENTION
+pcre16_cache_open(const char *path, const char **errorptr)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_cache * PCRE_CALL_CONVENTION
+pcre32_cache_open(const char *path, const char **errorptr)
+#endif
+{
+struct CACHE_BLOCK *cache;
+size_t length;
+
+*errorptr = NULL;
+if (path == NULL)
+  {
+  *errorptr = "no cache file name";
+  return NULL;
+  }
+
+length = strlen(path);
+cache = (struct CACHE_BLOCK *)(PUBL(malloc))(sizeof(struct CACHE_BLOCK));
+if (cache == NULL)
+  {
+  *errorptr = "failed to get memory";
+  return NULL;
+  }
+memset(cache, 0, sizeof(struct CACHE_BLOCK));
+
+cache->path = (char *)(PUBL(malloc))(length + 1);
+if (cache->path == NULL)
+  {
+  (PUBL(free))(cache);
+  *errorptr = "failed to get memory";
+  return NULL;
+  }
+memcpy(cache->path, path, length + 1);
+
+/* If the file is absent, or its header does not match this library, or its
+contents are damaged, start with an empty cache that will replace it. */
+
+if (!load_file(cache))
+  cache->dirty = TRUE;
+else if (!index_file(cache))
+  {
+  if (cache->buckets != NULL) (PUBL(free))(cache->buckets);
+  if (cache->file_entries != NULL) (PUBL(free))(cache->file_entries);
+  cache->buckets = NULL;
+  cache->bucket_count = cache->entry_count = cache->file_count = 0;
+  cache->file_entries = NULL;
+  cache->swapped = FALSE;
+  unload_file(cache);
+  cache->dirty = TRUE;
+  }
+
+#if defined COMPILE_PCRE8
+return (pcre_cache *)cache;
+#elif defined COMPILE_PCRE16
+return (pcre16_cache *)cache;
+#elif defined COMPILE_PCRE32
+return (pcre32_cache *)cache;
+#endif
+}
+
+
+/*************************************************
+*     Compile a pattern, using the cache         *
+*************************************************/
+
+/* This function returns a compiled pattern and, if extra_ptr is not NULL, its
+study data, exactly as pcre_compile() followed by pcre_study() would. If the
+pattern and options are in the cache, the stored copy is used; otherwise the
+pattern is compiled, studied and added to the cache. Only the default character
+tables are supported. JIT compilation is not cached; if it is requested it is
+done on the copy that is returned.
+
+Arguments:
+  external_cache  the cache, or NULL to compile without caching
+  pattern         the regular expression
+  options         compile options
+  study_options   study options, used if extra_ptr is not NULL
+  extra_ptr       where to put the study data, or NULL
+  errorptr        where to put an error message
+  erroroffset     where to put the error offset
+
+Returns:          the compiled pattern, or NULL on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
+pcre_cache_compile(pcre_cache *external_cache, const char *pattern,
+  int options, int study_options, pcre_extra **extra_ptr,
+  const char **errorptr, int *erroroffset)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
+pcre16_cache_compile(pcre16_cache *external_cache, PCRE_SPTR16 pattern,
+  int options, int study_options, pcre16_extra **extra_ptr,
+  const char **errorptr, int *erroroffset)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
+pcre32_cache_compile(pcre32_cache *external_cache, PCRE_SPTR32 pattern,
+  int options, int study_options, pcre32_extra **extra_ptr,
+  const char **errorptr, int *erroroffset)
+#endif
+{
+struct CACHE_BLOCK *cache = (struct CACHE_BLOCK *)external_cache;
+PCRE_PUCHAR upattern = (PCRE_PUCHAR)pattern;
+REAL_PCRE *re = NULL;
+PUBL(extra) *extra = NULL;
+pcre_study_data *study;
+cache_entry *entry = NULL;
+pcre_uint32 length = 0;
+pcre_uint32 hash = 0;
+
+*errorptr = NULL;
+if (extra_ptr != NULL) *extra_ptr = NULL;
+
+if ((study_options & ~PUBLIC_STUDY_OPTIONS) != 0)
+  {
+  *errorptr = "unknown or incorrect option bit(s) set";
+  return NULL;
+  }
+
+if (cache != NULL && pattern != NULL)
+  {
+  length = STRLEN_UC(upattern);
+  hash = hash_key(upattern, length, (pcre_uint32)options, FALSE);
+  if (cache->bucket_count > 0)
+    {
+    entry = cache->buckets[hash & (cache->bucket_count - 1)];
+    while (entry != NULL && (entry->hash != hash ||
+           !key_equal(entry, upattern, length, (pcre_uint32)options)))
+      entry = entry->next;
+    }
+  }
+
+if (entry != NULL)
+  {
+  if (!copy_entry(entry, &re, &extra))
+    {
+    *errorptr = "failed to get memory";
+    return NULL;
+    }
+  }
+
+/* Not cached: compile and study in the normal way. The study is always done so
+that the cached entry can satisfy later callers that want study data. */
+
+else
+  {
+  re = (REAL_PCRE *)PUBL(compile)(pattern, options, errorptr, erroroffset,
+    NULL);
+  if (re == NULL) return NULL;
+  extra = PUBL(study)((void *)re, PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_NO_SPECIAL,
+    errorptr);
+  if (extra == NULL)
+    {
+    (PUBL(free))(re);
+    return NULL;
+    }
+
+  /* Failure to add an entry is not an error; the pattern is just not
+  cached. */
+
+  if (cache != NULL && pattern != NULL)
+    {
+    size_t pattern_bytes = CACHE_ALIGN(IN_UCHARS((size_t)length + 1));
+    size_t entry_bytes = CACHE_ALIGN(sizeof(cache_entry));
+    pcre_uint8 *block = (pcre_uint8 *)(PUBL(malloc))(entry_bytes +
+      pattern_bytes + CACHE_ALIGN(re->size) + sizeof(pcre_study_data));
+
+    if (block != NULL)
+      {
+      entry = (cache_entry *)block;
+      entry->pattern = (PCRE_PUCHAR)(block + entry_bytes);
+      entry->re = block + entry_bytes + pattern_bytes;
+      entry->study = entry->re + CACHE_ALIGN(re->size);
+      entry->hash = hash;
+      entry->pattern_length = length;
+      entry->options = (pcre_uint32)options;
+      entry->re_size = re->size;
+      entry->study_size = sizeof(pcre_study_data);
+      entry->added = NULL;
+      entry->swapped = FALSE;
+      memcpy((pcre_uchar *)entry->pattern, upattern, IN_UCHARS(length + 1));
+      memcpy((pcre_uint8 *)entry->re, re, re->size);
+      memcpy((pcre_uint8 *)entry->study, extra->study_data,
+        sizeof(pcre_study_data));
+
+      if (!insert_entry(cache, entry)) (PUBL(free))(block); else
+        {
+        if (cache->added_last != NULL) cache->added_last->added = entry;
+          else cache->added_first = entry;
+        cache->added_last = entry;
+        cache->dirty = TRUE;
+        }
+      }
+    }
+  }
+
+if (extra_ptr == NULL)
+  {
+  (PUBL(free))(extra);
+  goto RETURN_RE;
+  }
+
+/* Apply the study options in the same way as pcre_study(). */
+
+study = (pcre_study_data *)extra->study_data;
+
+#ifdef SUPPORT_JIT
+extra->executable_jit = NULL;
+if ((study_options & (PCRE_STUDY_JIT_COMPILE |
+    PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE |
+    PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE)) != 0 && PRIV(jit_usable)())
+  {
+  if ((study_options & PCRE_STUDY_JIT_COMPILE) != 0)
+    PRIV(jit_compile)(re, extra, JIT_COMPILE);
+  if ((study_options & PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE) != 0)
+    PRIV(jit_compile)(re, extra, JIT_PARTIAL_SOFT_COMPILE);
+  if ((study_options & PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE) != 0)
+    PRIV(jit_compile)(re, extra, JIT_PARTIAL_HARD_COMPILE);
+  }
+#endif
+
+if (study->flags == 0 && (extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0 &&
+    (study_options & PCRE_STUDY_EXTRA_NEEDED) == 0)
+  (PUBL(free))(extra);
+else
+  {
+  if ((study_options & PCRE_STUDY_LAZY_DFA) != 0 &&
+      (extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0)
+    {
+    pcre_study_private *priv = STUDY_PRIVATE(extra);
+    priv->lazy_dfa = PRIV(lazy_dfa_compile)(re);
+    if (priv->lazy_dfa != NULL) extra->flags |= PCRE_EXTRA_LAZY_DFA;
+    }
+  if ((study_options & PCRE_STUDY_NO_SPECIAL) == 0 &&
+      (extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0)
+    {
+    pcre_study_private *priv = STUDY_PRIVATE(extra);
+    priv->special = PRIV(special_compile)(re);
+    if (priv->special != NULL) extra->flags |= PCRE_EXTRA_SPECIAL;
+    }
+  *extra_ptr = extra;
+  }
+
+RETURN_RE:
+#if defined COMPILE_PCRE8
+return (pcre *)re;
+#elif defined COMPILE_PCRE16
+return (pcre16 *)re;
+#elif defined COMPILE_PCRE32
+return (pcre32 *)re;
+#endif
+}
+
+
+/*************************************************
+*          Write the cache file                  *
+*************************************************/
+
+/* This function writes all the entries to the cache file, in the host byte
+order, if any have been added since it was opened or the existing file was
+unusable. The new contents are written to a temporary file that is then
+renamed, so that a process that is reading the old file is not disturbed.
+
+Argument:   the cache
+Returns:    0 on success, or a negative error code
+*/
+
+static BOOL
+write_padded(FILE *f, const void *data, size_t length)
+{
+static const pcre_uint8 zeros[8] = { 0 };
+size_t pad = CACHE_ALIGN(length) - length;
+return fwrite(data, 1, length, f) == length &&
+  (pad == 0 || fwrite(zeros, 1, pad, f) == pad);
+}
+
+/* Write one entry. It is copied out in host order first, which converts
+entries from a file with the other byte order.
+
+Returns:    0 on success, or a negative error code
+*/
+
+static int
+write_entry(FILE *f, const cache_entry *entry)
+{
+cache_file_entry fe;
+REAL_PCRE *re;
+PUBL(extra) *extra;
+pcre_uchar *pattern;
+pcre_uint32 i;
+BOOL ok;
+
+if (!copy_entry(entry, &re, &extra)) return PCRE_ERROR_NOMEMORY;
+
+pattern = (pcre_uchar *)(PUBL(malloc))
+  (IN_UCHARS((size_t)entry->pattern_length + 1));
+if (pattern == NULL)
+  {
+  (PUBL(free))(re);
+  (PUBL(free))(extra);
+  return PCRE_ERROR_NOMEMORY;
+  }
+for (i = 0; i <= entry->pattern_length; i++)
+  pattern[i] = entry->swapped? SWAP_UNIT(entry->pattern[i]) :
+    entry->pattern[i];
+
+fe.pattern_length = entry->pattern_length;
+fe.options = entry->options;
+fe.re_size = re->size;
+fe.study_size = sizeof(pcre_study_data);
+
+ok = write_padded(f, &fe, sizeof(fe)) &&
+  write_padded(f, pattern, IN_UCHARS((size_t)entry->pattern_length + 1)) &&
+  write_padded(f, re, re->size) &&
+  write_padded(f, extra->study_data, sizeof(pcre_study_data));
+
+(PUBL(free))(pattern);
+(PUBL(free))(re);
+(PUBL(free))(extra);
+return ok? 0 : PCRE_ERROR_CACHEIO;
+}
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_cache_save(pcre_cache *external_cache)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_cache_save(pcre16_cache *external_cache)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_cache_save(pcre32_cache *external_cache)
+#endif
+{
+struct CACHE_BLOCK *cache = (struct CACHE_BLOCK *)external_cache;
+cache_file_header header;
+cache_entry *entry;
+char *tmp_path;
+FILE *f;
+pcre_uint32 i;
+int rc;
+
+if (cache == NULL) return PCRE_ERROR_NULL;
+if (!cache->dirty) return 0;
+
+tmp_path = (char *)(PUBL(malloc))(strlen(cache->path) + 5);
+if (tmp_path == NULL) return PCRE_ERROR_NOMEMORY;
+strcpy(tmp_path, cache->path);
+strcat(tmp_path, ".tmp");
+
+f = fopen(tmp_path, "wb");
+if (f == NULL)
+  {
+  (PUBL(free))(tmp_path);
+  return PCRE_ERROR_CACHEIO;
+  }
+
+memset(&header, 0, sizeof(header));
+header.magic_number = CACHE_MAGIC;
+header.format = CACHE_FORMAT;
+header.code_unit_size = sizeof(pcre_uchar);
+header.build_hash = build_hash();
+header.tables_hash = hash_bytes(2166136261UL, PRIV(default_tables),
+  tables_length);
+header.entry_count = cache->entry_count;
+rc = write_padded(f, &header, sizeof(header))? 0 : PCRE_ERROR_CACHEIO;
+
+/* Entries from the file come first, then the added ones. */
+
+for (i = 0; rc == 0 && i < cache->file_count; i++)
+  rc = write_entry(f, cache->file_entries + i);
+for (entry = cache->added_first; rc == 0 && entry != NULL;
+     entry = entry->added)
+  rc = write_entry(f, entry);
+
+if (fclose(f) != 0 && rc == 0) rc = PCRE_ERROR_CACHEIO;
+
+#ifdef _WIN32
+if (rc == 0) (void)remove(cache->path);
+#endif
+if (rc == 0 && rename(tmp_path, cache->path) != 0) rc = PCRE_ERROR_CACHEIO;
+if (rc != 0) (void)remove(tmp_path);
+  else cache->dirty = FALSE;
+
+(PUBL(free))(tmp_path);
+return rc;
+}
+
+
+/*************************************************
+*          Close a pattern cache                 *
+*************************************************/
+
+/* This function frees a cache without writing it. Patterns that were returned
+by pcre_cache_compile() are private copies and remain valid.
+
+Argument:   the cache
+Returns:    nothing
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_cache_close(pcre_cache *external_cache)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_cache_close(pcre16_cache *external_cache)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_cache_close(pcre32_cache *external_cache)
+#endif
+{
+struct CACHE_BLOCK *cache = (struct CACHE_BLOCK *)external_cache;
+cache_entry *entry;
+
+if (cache == NULL) return;
+
+entry = cache->added_first;
+while (entry != NULL)
+  {
+  cache_entry *next = entry->added;
+  (PUBL(free))(entry);
+  entry = next;
+  }
+
+if (cache->buckets != NULL) (PUBL(free))(cache->buckets);
+if (cache->file_entries != NULL) (PUBL(free))(cache->file_entries);
+unload_file(cache);
+(PUBL(free))(cache->path);
+(PUBL(free))(cache);
+}
+
+/* End of pcre_cache.c */
@@ -3146,8 +3146,8 @@ matches to an empty string (also represented by a non-zero value). */
 
 for(;;)
   {
-  /* All operations move the code pointer forward.
-  Therefore infinite recursions are not possible. */
+  /* All operations except the end of a repeated group move the code pointer
+  forward. That one recurses, so rec_limit stops any infinite recursion. */
 
   c = *code;
 
@@ -3175,6 +3175,24 @@ for(;;)
 
     return base_list[1] != 0;
 
+    case OP_KETRMAX:
+    case OP_KETRMIN:
+    /* The end of a group that repeats without limit can be followed either
+    by another iteration or by whatever follows the group, so both must be
+    checked. Atomic groups are treated as for OP_KET. */
+
+    if (base_list[1] == 0) return FALSE;
+
+    next_code = code - GET(code, 1);
+    if (*next_code == OP_ONCE || *next_code == OP_ONCE_NC)
+      return !entered_a_group;
+
+    if (!compare_opcodes(next_code, utf, cd, base_list, base_end, rec_limit))
+      return FALSE;
+
+    code += PRIV(OP_lengths)[c];
+    continue;
+
     case OP_KET:
     /* If the bracket is capturing, and referenced by an OP_RECURSE, or
     it is an atomic sub-pattern (assert, once, etc.) the non-greedy case
@@ -3204,6 +3222,8 @@ for(;;)
     case OP_ONCE_NC:
     case OP_BRA:
     case OP_CBRA:
+    case OP_SBRA:
+    case OP_SCBRA:
     next_code = code + GET(code, 1);
     code += PRIV(OP_lengths)[c];
 
@@ -3223,6 +3243,7 @@ for(;;)
 
     next_code = code + 1;
     if (*next_code != OP_BRA && *next_code != OP_CBRA
+        && *next_code != OP_SBRA && *next_code != OP_SCBRA
         && *next_code != OP_ONCE && *next_code != OP_ONCE_NC) return FALSE;
 
     do next_code += GET(next_code, 1); while (*next_code == OP_ALT);
@@ -3641,12 +3662,460 @@ but some compilers complain about an unreachable statement. */
 
 
 
+/*************************************************
+*        Classify a single character repeat      *
+*************************************************/
+
+/* Used when looking at groups and at the risk of heavy backtracking. Items
+that are not repeated, or are repeated a fixed number of times, are neither.
+
+Arguments:
+  code        points to a single character item
+
+Returns:      REPEAT_BACKTRACKS if the repeat is variable and not possessive,
+              plus REPEAT_UNLIMITED if it has no upper bound
+*/
+
+#define REPEAT_BACKTRACKS  1
+#define REPEAT_UNLIMITED   2
+
+static int
+repeat_kind(const pcre_uchar *code)
+{
+pcre_uchar c = *code;
+const pcre_uchar *repeat_opcode;
+
+if (c >= OP_STAR && c <= OP_TYPEPOSUPTO)
+  {
+  c -= get_repeat_base(c) - OP_STAR;
+  switch(c)
+    {
+    case OP_STAR:
+    case OP_MINSTAR:
+    case OP_PLUS:
+    case OP_MINPLUS:
+    return REPEAT_BACKTRACKS | REPEAT_UNLIMITED;
+
+    case OP_QUERY:
+    case OP_MINQUERY:
+    case OP_UPTO:
+    case OP_MINUPTO:
+    return REPEAT_BACKTRACKS;
+
+    case OP_POSSTAR:
+    case OP_POSPLUS:
+    return REPEAT_UNLIMITED;
+    }
+  return 0;
+  }
+
+if (c != OP_CLASS && c != OP_NCLASS && c != OP_XCLASS) return 0;
+
+#if defined SUPPORT_UTF || !defined COMPILE_PCRE8
+if (c == OP_XCLASS)
+  repeat_opcode = code + GET(code, 1);
+else
+#endif
+  repeat_opcode = code + 1 + (32 / sizeof(pcre_uchar));
+
+switch(*repeat_opcode)
+  {
+  case OP_CRSTAR:
+  case OP_CRMINSTAR:
+  case OP_CRPLUS:
+  case OP_CRMINPLUS:
+  return REPEAT_BACKTRACKS | REPEAT_UNLIMITED;
+
+  case OP_CRQUERY:
+  case OP_CRMINQUERY:
+  return REPEAT_BACKTRACKS;
+
+  case OP_CRRANGE:
+  case OP_CRMINRANGE:
+  if (GET2(repeat_opcode, 1 + IMM2_SIZE) == 0)
+    return REPEAT_BACKTRACKS | REPEAT_UNLIMITED;
+  return (GET2(repeat_opcode, 1) != GET2(repeat_opcode, 1 + IMM2_SIZE))?
+    REPEAT_BACKTRACKS : 0;
+
+  case OP_CRPOSSTAR:
+  case OP_CRPOSPLUS:
+  return REPEAT_UNLIMITED;
+
+  case OP_CRPOSRANGE:
+  return (GET2(repeat_opcode, 1 + IMM2_SIZE) == 0)? REPEAT_UNLIMITED : 0;
+  }
+return 0;
+}
+
+
+
+/*************************************************
+*      Check a repeated group for possession     *
+*************************************************/
+
+/* A group that repeats without limit behaves as if it were possessive when it
+has a single branch, nothing in that branch can backtrack, and the first item
+of the branch cannot match the first character of what follows the group. An
+iteration, once matched, can then never be given up to let the rest of the
+pattern match. Single character repeats that auto_possessify() is going to
+make possessive (it has not yet reached them) count as not backtracking.
+
+Arguments:
+  code        points to the OP_BRA
+  utf         TRUE in UTF-8 / UTF-16 / UTF-32 mode
+  cd          static compile data
+
+Returns:      TRUE if the group can be made possessive
+*/
+
+static BOOL
+possessive_group(const pcre_uchar *code, BOOL utf, const compile_data *cd)
+{
+const pcre_uchar *ket = code + GET(code, 1);
+const pcre_uchar *first_end, *end;
+pcre_uint32 first[8];
+pcre_uint32 list[8];
+int rec_limit;
+
+if (*ket != OP_KETRMAX) return FALSE;
+code += PRIV(OP_lengths)[*code];
+
+/* The first item must match at least one character. */
+
+first_end = get_chr_property_list(code, utf, cd->fcc, first);
+if (first_end == NULL || first[1] != 0 ||
+    (first[0] >= OP_EODN && first[0] <= OP_DOLLM))
+  return FALSE;
+
+while (code < ket)
+  {
+  pcre_uchar c = *code;
+  int kind;
+
+  switch(c)
+    {
+    case OP_SOD:
+    case OP_SOM:
+    case OP_NOT_WORD_BOUNDARY:
+    case OP_WORD_BOUNDARY:
+    case OP_CIRC:
+    case OP_CIRCM:
+    case OP_BRAPOSZERO:
+    case OP_KET:
+    code += PRIV(OP_lengths)[c];
+    continue;
+
+    /* A group that is not repeated and has one branch is checked item by
+    item. */
+
+    case OP_BRA:
+    case OP_CBRA:
+    if (code[GET(code, 1)] != OP_KET) return FALSE;
+    code += PRIV(OP_lengths)[c];
+    continue;
+
+    /* Atomic and possessive groups, and assertions, never backtrack once
+    they have matched. */
+
+    case OP_ASSERT:
+    case OP_ASSERT_NOT:
+    case OP_ASSERTBACK:
+    case OP_ASSERTBACK_NOT:
+    case OP_ONCE:
+    case OP_ONCE_NC:
+    case OP_BRAPOS:
+    case OP_CBRAPOS:
+    end = code;
+    do end += GET(end, 1); while (*end == OP_ALT);
+    if (*end != OP_KET && *end != OP_KETRPOS) return FALSE;
+    code = end + 1 + LINK_SIZE;
+    continue;
+    }
+
+  end = get_chr_property_list(code, utf, cd->fcc, list);
+  if (end == NULL) return FALSE;
+
+  kind = repeat_kind(code);
+  if ((kind & REPEAT_BACKTRACKS) != 0)
+    {
+    /* The same test as in auto_possessify(). */
+
+    if (c >= OP_STAR && c <= OP_TYPEPOSUPTO)
+      {
+      c -= get_repeat_base(c) - OP_STAR;
+      list[1] = c == OP_STAR || c == OP_PLUS || c == OP_QUERY || c == OP_UPTO;
+      }
+    else
+      {
+#if defined SUPPORT_UTF || !defined COMPILE_PCRE8
+      if (c == OP_XCLASS)
+        c = code[GET(code, 1)];
+      else
+#endif
+        c = code[1 + (32 / sizeof(pcre_uchar))];
+      list[1] = (c & 1) == 0;
+      }
+
+    rec_limit = 1000;
+    if (!compare_opcodes(end, utf, cd, list, end, &rec_limit)) return FALSE;
+    }
+  code = end;
+  }
+
+first[1] = TRUE;
+rec_limit = 1000;
+return compare_opcodes(ket + 1 + LINK_SIZE, utf, cd, first, first_end,
+  &rec_limit);
+}
+
+
+
+/*************************************************
+*       Check two items for a common character   *
+*************************************************/
+
+/* Copies the second item, followed by OP_END, so that compare_opcodes() looks
+at nothing else.
+
+Arguments:
+  base_list   the data list of the first item
+  base_end    the end of the first item
+  code        points to the second item
+  end         the end of the second item
+  utf         TRUE in UTF-8 / UTF-16 / UTF-32 mode
+  cd          static compile data
+
+Returns:      TRUE if the items may match the same character
+*/
+
+static BOOL
+items_overlap(pcre_uint32 *base_list, const pcre_uchar *base_end,
+  const pcre_uchar *code, const pcre_uchar *end, BOOL utf,
+  const compile_data *cd)
+{
+pcre_uchar buffer[64];
+int rec_limit = 10;
+
+if (end - code >= (int)(sizeof(buffer) / sizeof(pcre_uchar))) return TRUE;
+memcpy(buffer, code, IN_UCHARS(end - code));
+buffer[end - code] = OP_END;
+base_list[1] = TRUE;
+return !compare_opcodes(buffer, utf, cd, base_list, base_end, &rec_limit);
+}
+
+
+
+/*************************************************
+*       Check the branches of a group            *
+*************************************************/
+
+/* Two branches whose first items may match the same character make a group
+ambiguous: when a repeat of the group fails, each way of dividing the subject
+between iterations may be tried.
+
+Arguments:
+  code        points to the bracket opcode
+  utf         TRUE in UTF-8 / UTF-16 / UTF-32 mode
+  cd          static compile data
+
+Returns:      TRUE if two branches may start with the same character
+*/
+
+static BOOL
+branches_overlap(const pcre_uchar *code, BOOL utf, const compile_data *cd)
+{
+const pcre_uchar *branch[32];
+const pcre_uchar *p = code;
+pcre_uint32 list[8];
+int count = 0;
+int i, j;
+
+branch[count++] = p + PRIV(OP_lengths)[*p];
+for (p += GET(p, 1); *p == OP_ALT; p += GET(p, 1))
+  {
+  if (count >= (int)(sizeof(branch) / sizeof(const pcre_uchar *)))
+    return TRUE;
+  branch[count++] = p + 1 + LINK_SIZE;
+  }
+
+for (i = 0; i < count; i++)
+  {
+  const pcre_uchar *end = get_chr_property_list(branch[i], utf, cd->fcc,
+    list);
+
+  /* If the first item may not match a character, give up. */
+
+  if (end == NULL || list[1] != 0 ||
+      (list[0] >= OP_EODN && list[0] <= OP_DOLLM))
+    return TRUE;
+
+  for (j = i + 1; j < count; j++)
+    {
+    int rec_limit = 10;
+    list[1] = TRUE;
+    if (!compare_opcodes(branch[j], utf, cd, list, end, &rec_limit))
+      return TRUE;
+    }
+  }
+return FALSE;
+}
+
+
+
+/*************************************************
+*      Look for super-linear backtracking        *
+*************************************************/
+
+/* Looks for the shapes that make backtracking take more than linear time at a
+starting position when a match fails:
+
+  . A group that repeats without limit (and is not atomic or possessive) that
+    contains a repeat that can backtrack, a group with branches that may start
+    with the same character, or another such repeated group, as in (a+)+ or
+    (a|ab)*.
+
+  . A repeat without limit that can backtrack followed immediately by another
+    repeat without limit of a character that both match, as in \d+\d+.
+
+The check is conservative, so a pattern that is reported may still match in
+linear time, but each of these shapes has been the cause of patterns that
+take exponential or polynomial time. Atomic groups and possessive repeats,
+including those made possessive by auto_possessify(), are not counted.
+
+Arguments:
+  code        points to start of the byte code
+  utf         TRUE in UTF-8 / UTF-16 / UTF-32 mode
+  cd          static compile data
+
+Returns:      TRUE if the pattern may backtrack in super-linear time
+*/
+
+static BOOL
+superlinear_risk(const pcre_uchar *code, BOOL utf, const compile_data *cd)
+{
+BOOL ambiguous[64];
+int depth = 0;
+pcre_uint32 list[8];
+pcre_uint32 next_list[8];
+
+for (;;)
+  {
+  register pcre_uchar c = *code;
+  const pcre_uchar *end;
+
+  if (c >= OP_TABLE_LENGTH) return FALSE;
+
+  if (c >= OP_ASSERT && c <= OP_SCOND)
+    {
+    /* A nesting too deep to follow is reported. */
+
+    if (depth >= (int)(sizeof(ambiguous) / sizeof(BOOL))) return TRUE;
+    ambiguous[depth++] = (c == OP_BRA || c == OP_CBRA || c == OP_SBRA ||
+      c == OP_SCBRA) && code[GET(code, 1)] == OP_ALT &&
+      branches_overlap(code, utf, cd);
+    code += PRIV(OP_lengths)[c];
+    continue;
+    }
+
+  if (c >= OP_KET && c <= OP_KETRPOS)
+    {
+    const pcre_uchar *bra = code - GET(code, 1);
+    BOOL inner = ambiguous[--depth];
+
+    /* An atomic group or assertion hides what is inside it, but its repeat
+    can still backtrack. */
+
+    if (c == OP_KETRMAX || c == OP_KETRMIN)
+      {
+      if (inner && *bra != OP_ONCE && *bra != OP_ONCE_NC) return TRUE;
+      inner = TRUE;
+      }
+    else if (c == OP_KETRPOS || *bra < OP_BRA) inner = FALSE;
+
+    if (inner && depth > 0) ambiguous[depth - 1] = TRUE;
+    code += PRIV(OP_lengths)[c];
+    continue;
+    }
+
+  /* Single character items */
+
+  end = get_chr_property_list(code, utf, cd->fcc, list);
+  if (end != NULL)
+    {
+    int kind = repeat_kind(code);
+    if ((kind & REPEAT_BACKTRACKS) != 0)
+      {
+      const pcre_uchar *next_end;
+
+      if (depth > 0) ambiguous[depth - 1] = TRUE;
+      if ((kind & REPEAT_UNLIMITED) != 0 &&
+          (repeat_kind(end) & REPEAT_UNLIMITED) != 0 &&
+          (next_end = get_chr_property_list(end, utf, cd->fcc, next_list))
+            != NULL &&
+          items_overlap(list, end, end, next_end, utf, cd))
+        return TRUE;
+      }
+    code = end;
+    continue;
+    }
+
+  /* Everything else is skipped. */
+
+  switch(c)
+    {
+    case OP_END:
+    return FALSE;
+
+    case OP_TYPESTAR:
+    case OP_TYPEMINSTAR:
+    case OP_TYPEPLUS:
+    case OP_TYPEMINPLUS:
+    case OP_TYPEQUERY:
+    case OP_TYPEMINQUERY:
+    case OP_TYPEPOSSTAR:
+    case OP_TYPEPOSPLUS:
+    case OP_TYPEPOSQUERY:
+    if (code[1] == OP_PROP || code[1] == OP_NOTPROP) code += 2;
+    break;
+
+    case OP_TYPEUPTO:
+    case OP_TYPEMINUPTO:
+    case OP_TYPEEXACT:
+    case OP_TYPEPOSUPTO:
+    if (code[1 + IMM2_SIZE] == OP_PROP || code[1 + IMM2_SIZE] == OP_NOTPROP)
+      code += 2;
+    break;
+
+#if defined SUPPORT_UTF || !defined COMPILE_PCRE8
+    case OP_XCLASS:
+    code += GET(code, 1);
+    break;
+#endif
+
+    case OP_MARK:
+    case OP_PRUNE_ARG:
+    case OP_SKIP_ARG:
+    case OP_THEN_ARG:
+    code += code[1];
+    break;
+    }
+
+  code += PRIV(OP_lengths)[c];
+  }
+}
+
+
+
 /*************************************************
 *    Scan compiled regex for auto-possession     *
 *************************************************/
 
 /* Replaces single character iterations with their possessive alternatives
-if appropriate. This function modifies the compiled opcode!
+if appropriate, and likewise groups that repeat without limit (see
+possessive_group() above). Only non-capturing groups are changed, because the
+JIT compiler does not always reset the captures of a possessive group when it
+backtracks past it, and groups are left alone in patterns that contain
+recursions or subroutine calls. This function modifies the compiled opcode!
 
 Arguments:
   code        points to start of the byte code
@@ -3664,6 +4133,7 @@ const pcre_uchar *end;
 pcre_uchar *repeat_opcode;
 pcre_uint32 list[8];
 int rec_limit;
+BOOL groups = find_recurse(code, utf) == NULL;
 
 for (;;)
   {
@@ -3770,6 +4240,17 @@ for (;;)
       }
     c = *code;
     }
+  else if (groups && (c == OP_BRA || (c == OP_BRAZERO && code[1] == OP_BRA)))
+    {
+    pcre_uchar *bra = (c == OP_BRAZERO)? code + 1 : code;
+    if (possessive_group(bra, utf, cd))
+      {
+      bra[GET(bra, 1)] = OP_KETRPOS;
+      *bra += OP_BRAPOS - OP_BRA;
+      if (c == OP_BRAZERO) *code = OP_BRAPOSZERO;
+      }
+    c = *code;
+    }
 
   switch(c)
     {
@@ -9009,63 +9490,40 @@ cd->names_found++;
 
 
 /*************************************************
-*        Compile a Regular Expression            *
+*        Compile a pattern into memory           *
 *************************************************/
 
-/* This function takes a string and returns a pointer to a block of store
-holding a compiled version of the expression. The original API for this
-function had no error code return variable; it is retained for backwards
-compatibility. The new function is given a new name.
+/* This does the work for pcre_compile(), pcre_compile2() and
+pcre_compile_arena(), which follow.
 
 Arguments:
   pattern       the regular expression
   options       various option bits
-  errorcodeptr  pointer to error code variable (pcre_compile2() only)
-                  can be NULL if you don't want a code value
+  errorcodeptr  pointer to error code variable, or NULL
   errorptr      pointer to pointer to error text
   erroroffset   ptr offset in pattern where error was detected
   tables        pointer to character tables or NULL
+  arena         arena for the compiled pattern, or NULL to use malloc()
 
 Returns:        pointer to compiled data block, or NULL on error,
                 with errorptr and erroroffset set
 */
 
 #if defined COMPILE_PCRE8
-PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
-pcre_compile(const char *pattern, int options, const char **errorptr,
-  int *erroroffset, const unsigned char *tables)
+static pcre *
+compile_pattern(const char *pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables,
+  void *arena)
 #elif defined COMPILE_PCRE16
-PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
-pcre16_compile(PCRE_SPTR16 pattern, int options, const char **errorptr,
-  int *erroroffset, const unsigned char *tables)
+static pcre16 *
+compile_pattern(PCRE_SPTR16 pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables,
+  void *arena)
 #elif defined COMPILE_PCRE32
-PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
-pcre32_compile(PCRE_SPTR32 pattern, int options, const char **errorptr,
-  int *erroroffset, const unsigned char *tables)
-#endif
-{
-#if defined COMPILE_PCRE8
-return pcre_compile2(pattern, options, NULL, errorptr, erroroffset, tables);
-#elif defined COMPILE_PCRE16
-return pcre16_compile2(pattern, options, NULL, errorptr, erroroffset, tables);
-#elif defined COMPILE_PCRE32
-return pcre32_compile2(pattern, options, NULL, errorptr, erroroffset, tables);
-#endif
-}
-
-
-#if defined COMPILE_PCRE8
-PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
-pcre_compile2(const char *pattern, int options, int *errorcodeptr,
-  const char **errorptr, int *erroroffset, const unsigned char *tables)
-#elif defined COMPILE_PCRE16
-PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
-pcre16_compile2(PCRE_SPTR16 pattern, int options, int *errorcodeptr,
-  const char **errorptr, int *erroroffset, const unsigned char *tables)
-#elif defined COMPILE_PCRE32
-PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
-pcre32_compile2(PCRE_SPTR32 pattern, int options, int *errorcodeptr,
-  const char **errorptr, int *erroroffset, const unsigned char *tables)
+static pcre32 *
+compile_pattern(PCRE_SPTR32 pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables,
+  void *arena)
 #endif
 {
 REAL_PCRE *re;
@@ -9080,6 +9538,9 @@ int skipatstart = 0;
 BOOL utf;
 BOOL never_utf = FALSE;
 size_t size;
+#ifdef SUPPORT_PROFILE
+size_t profile_offset;
+#endif
 pcre_uchar *code;
 const pcre_uchar *codestart;
 const pcre_uchar *ptr;
@@ -9414,9 +9875,18 @@ value of cd->names_found and cd->name_entry_size. */
 size = sizeof(REAL_PCRE) +
   (length + cd->names_found * cd->name_entry_size) * sizeof(pcre_uchar);
 
+/* When profiling is supported, the counters follow the code on an 8-byte
+boundary. */
+
+#ifdef SUPPORT_PROFILE
+profile_offset = size;
+size = ((size + 7) & ~(size_t)7) + PROFILE_BLOCK_SIZE;
+#endif
+
 /* Get the memory. */
 
-re = (REAL_PCRE *)(PUBL(malloc))(size);
+if (arena == NULL) re = (REAL_PCRE *)(PUBL(malloc))(size);
+  else re = (REAL_PCRE *)PRIV(arena_alloc)(arena, size);
 if (re == NULL)
   {
   errorcode = ERR21;
@@ -9449,6 +9919,11 @@ re->dummy = 0;
 re->dummy1 = re->dummy2 = re->dummy3 = 0;
 #endif
 
+#ifdef SUPPORT_PROFILE
+memset(PROFILE_DATA(re), 0, PROFILE_BLOCK_SIZE);
+PROFILE_DATA(re)->code_size = (pcre_uint32)profile_offset;
+#endif
+
 /* The starting points of the name/number translation table and of the code are
 passed around in the compile data block. The start/end pattern and initial
 options are already set from the pre-compile phase, as is the name_entry_size
@@ -9632,7 +10107,8 @@ if (errorcode == 0 && cd->check_lookbehind)
 
 if (errorcode != 0)
   {
-  (PUBL(free))(re);
+  if (arena == NULL) (PUBL(free))(re);
+    else PRIV(arena_free)(arena, re);
   PCRE_EARLY_ERROR_RETURN:
   *erroroffset = (int)(ptr - (const pcre_uchar *)pattern);
   PCRE_EARLY_ERROR_RETURN2:
@@ -9773,7 +10249,8 @@ was compiled can be seen. */
 
 if (code - codestart > length)
   {
-  (PUBL(free))(re);
+  if (arena == NULL) (PUBL(free))(re);
+    else PRIV(arena_free)(arena, re);
   *errorptr = find_error_text(ERR23);
   *erroroffset = ptr - (pcre_uchar *)pattern;
   if (errorcodeptr != NULL) *errorcodeptr = ERR23;
@@ -9781,6 +10258,16 @@ if (code - codestart > length)
   }
 #endif   /* PCRE_DEBUG */
 
+/* Check for shapes that may backtrack in super-linear time, so that
+applications can choose another matcher. This is done after auto-possession,
+which removes many of them. */
+
+if (superlinear_risk(codestart, utf, cd)) re->flags |= PCRE_SUPERLINEAR;
+
+#ifdef SUPPORT_PROFILE
+re->flags |= PCRE_PROFILED;
+#endif
+
 /* Check for a pattern than can match an empty string, so that this information
 can be provided to applications. */
 
@@ -9804,4 +10291,99 @@ return (pcre32 *)re;
 #endif
 }
 
+
+
+/*************************************************
+*        Compile a Regular Expression            *
+*************************************************/
+
+/* This function takes a string and returns a pointer to a block of store
+holding a compiled version of the expression. The original API for this
+function had no error code return variable; it is retained for backwards
+compatibility. The new function is given a new name.
+
+Arguments:
+  pattern       the regular expression
+  options       various option bits
+  errorcodeptr  pointer to error code variable (pcre_compile2() only)
+                  can be NULL if you don't want a code value
+  errorptr      pointer to pointer to error text
+  erroroffset   ptr offset in pattern where error was detected
+  tables        pointer to character tables or NULL
+
+Returns:        pointer to compiled data block, or NULL on error,
+                with errorptr and erroroffset set
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
+pcre_compile(const char *pattern, int options, const char **errorptr,
+  int *erroroffset, const unsigned char *tables)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
+pcre16_compile(PCRE_SPTR16 pattern, int options, const char **errorptr,
+  int *erroroffset, const unsigned char *tables)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
+pcre32_compile(PCRE_SPTR32 pattern, int options, const char **errorptr,
+  int *erroroffset, const unsigned char *tables)
+#endif
+{
+return compile_pattern(pattern, options, NULL, errorptr, erroroffset, tables,
+  NULL);
+}
+
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
+pcre_compile2(const char *pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
+pcre16_compile2(PCRE_SPTR16 pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
+pcre32_compile2(PCRE_SPTR32 pattern, int options, int *errorcodeptr,
+  const char **errorptr, int *erroroffset, const unsigned char *tables)
+#endif
+{
+return compile_pattern(pattern, options, errorcodeptr, errorptr, erroroffset,
+  tables, NULL);
+}
+
+
+/* This is the same as pcre_compile2(), except that the compiled pattern is
+placed in an arena. It must not be freed by the caller; it is released when
+the arena is freed. If the arena is full, the error is "failed to get memory".
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre * PCRE_CALL_CONVENTION
+pcre_compile_arena(pcre_arena *arena, const char *pattern, int options,
+  int *errorcodeptr, const char **errorptr, int *erroroffset,
+  const unsigned char *tables)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16 * PCRE_CALL_CONVENTION
+pcre16_compile_arena(pcre16_arena *arena, PCRE_SPTR16 pattern, int options,
+  int *errorcodeptr, const char **errorptr, int *erroroffset,
+  const unsigned char *tables)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32 * PCRE_CALL_CONVENTION
+pcre32_compile_arena(pcre32_arena *arena, PCRE_SPTR32 pattern, int options,
+  int *errorcodeptr, const char **errorptr, int *erroroffset,
+  const unsigned char *tables)
+#endif
+{
+if (arena == NULL)
+  {
+  if (errorcodeptr != NULL) *errorcodeptr = 99;
+  if (errorptr != NULL) *errorptr = "no arena";
+  if (erroroffset != NULL) *erroroffset = 0;
+  return NULL;
+  }
+return compile_pattern(pattern, options, errorcodeptr, errorptr, erroroffset,
+  tables, arena);
+}
+
 /* End of pcre_compile.c */
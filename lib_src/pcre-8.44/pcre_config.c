@@ -133,6 +133,14 @@ switch (what)
 #endif
   break;
 
+  case PCRE_CONFIG_JITUSABLE:
+#ifdef SUPPORT_JIT
+  *((int *)where) = PRIV(jit_usable)()? 1 : 0;
+#else
+  *((int *)where) = 0;
+#endif
+  break;
+
   case PCRE_CONFIG_JITTARGET:
 #ifdef SUPPORT_JIT
   *((const char **)where) = PRIV(jit_get_target)();
@@ -173,14 +181,24 @@ switch (what)
   *((unsigned long int *)where) = MATCH_LIMIT_RECURSION;
   break;
 
-  case PCRE_CONFIG_STACKRECURSE:
-#ifdef NO_RECURSE
-  *((int *)where) = 0;
-#else
+  case PCRE_CONFIG_SIMDSCAN:
+  *((const char **)where) = PRIV(scan_get_target)();
+  break;
+
+  case PCRE_CONFIG_PROFILE:
+#ifdef SUPPORT_PROFILE
   *((int *)where) = 1;
+#else
+  *((int *)where) = 0;
 #endif
   break;
 
+  /* match() no longer recurses on the stack; see pcre_exec.c. */
+
+  case PCRE_CONFIG_STACKRECURSE:
+  *((int *)where) = 0;
+  break;
+
   default: return PCRE_ERROR_BADOPTION;
   }
 
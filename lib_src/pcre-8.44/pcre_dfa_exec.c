@@ -594,6 +594,9 @@ for (;;)
 
   workspace[0] ^= 1;              /* Remember for the restarting feature */
   workspace[1] = active_count;
+#ifdef SUPPORT_PROFILE
+  *md->profile_states += active_count;
+#endif
 
 #ifdef PCRE_DEBUG
   printf("%.*sNext character: rest of subject = \"", rlevel*2-2, SP);
@@ -2934,12 +2937,21 @@ for (;;)
           next_state_offset =
             (int)(end_subpattern - start_code + LINK_SIZE + 1);
 
+          /* If nothing has been matched, which can happen only when the
+          repeat may be zero, the next state is added at the current character
+          pointer, as for OP_ONCE. */
+
+          if (local_ptr == ptr)
+            {
+            ADD_ACTIVE(next_state_offset, 0);
+            }
+
           /* Optimization: if there are no more active states, and there
           are no new states yet set up, then skip over the subject string
           right here, to save looping. Otherwise, set up the new state to swing
           into action when the end of the matched substring is reached. */
 
-          if (i + 1 >= active_count && new_count == 0)
+          else if (i + 1 >= active_count && new_count == 0)
             {
             ptr = local_ptr;
             clen = 0;
@@ -3149,12 +3161,12 @@ return match_count;
 
 
 /*************************************************
-*    Execute a Regular Expression - DFA engine   *
+*    Match a pattern with the DFA engine         *
 *************************************************/
 
-/* This external function applies a compiled re to a subject string using a DFA
-engine. This function calls the internal function multiple times if the pattern
-is not anchored.
+/* This function does the work of pcre_dfa_exec(), which is below. It calls the
+internal function multiple times if the pattern is not anchored. It is separate
+so that pcre_dfa_exec() can time it when profiling is supported.
 
 Arguments:
   argument_re     points to the compiled expression
@@ -3167,28 +3179,26 @@ Arguments:
   offsetcount     size of same
   workspace       workspace vector
   wscount         size of same
+  dfa_states      where to add the number of states processed, or NULL
 
-Returns:          > 0 => number of match offset pairs placed in offsets
-                  = 0 => offsets overflowed; longest matches are present
-                   -1 => failed to match
-                 < -1 => some kind of unexpected problem
+Returns:          as for pcre_dfa_exec()
 */
 
 #if defined COMPILE_PCRE8
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre_dfa_exec(const pcre *argument_re, const pcre_extra *extra_data,
+static int
+dfa_exec_pattern(const pcre *argument_re, const pcre_extra *extra_data,
   const char *subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount, int *workspace, int wscount)
+  int offsetcount, int *workspace, int wscount, profile_count *dfa_states)
 #elif defined COMPILE_PCRE16
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre16_dfa_exec(const pcre16 *argument_re, const pcre16_extra *extra_data,
+static int
+dfa_exec_pattern(const pcre16 *argument_re, const pcre16_extra *extra_data,
   PCRE_SPTR16 subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount, int *workspace, int wscount)
+  int offsetcount, int *workspace, int wscount, profile_count *dfa_states)
 #elif defined COMPILE_PCRE32
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre32_dfa_exec(const pcre32 *argument_re, const pcre32_extra *extra_data,
+static int
+dfa_exec_pattern(const pcre32 *argument_re, const pcre32_extra *extra_data,
   PCRE_SPTR32 subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount, int *workspace, int wscount)
+  int offsetcount, int *workspace, int wscount, profile_count *dfa_states)
 #endif
 {
 REAL_PCRE *re = (REAL_PCRE *)argument_re;
@@ -3200,6 +3210,7 @@ const pcre_study_data *study = NULL;
 
 const pcre_uchar *req_char_ptr;
 const pcre_uint8 *start_bits = NULL;
+scan_bits_tables start_tables;
 BOOL has_first_char = FALSE;
 BOOL has_req_char = FALSE;
 pcre_uchar first_char = 0;
@@ -3207,6 +3218,11 @@ pcre_uchar first_char2 = 0;
 pcre_uchar req_char = 0;
 pcre_uchar req_char2 = 0;
 int newline;
+#ifdef SUPPORT_PROFILE
+profile_count unused_states = 0;
+#else
+(void)dfa_states;
+#endif
 
 /* Plausibility checks */
 
@@ -3242,6 +3258,9 @@ if ((options & PCRE_DFA_RESTART) != 0)
 
 md->tables = re->tables;
 md->callout_data = NULL;
+#ifdef SUPPORT_PROFILE
+md->profile_states = (dfa_states != NULL)? dfa_states : &unused_states;
+#endif
 
 if (extra_data != NULL)
   {
@@ -3409,6 +3428,11 @@ if (!anchored)
     }
   }
 
+/* The start bitmap is searched with the help of some tables that are derived
+from it. */
+
+if (start_bits != NULL) PRIV(scan_bits_init)(&start_tables, start_bits);
+
 /* For anchored or unanchored matches, there may be a "last known required
 character" set. */
 
@@ -3472,19 +3496,8 @@ for (;;)
       /* Advance to a known first pcre_uchar (i.e. data item) */
 
       if (has_first_char)
-        {
-        if (first_char != first_char2)
-          {
-          pcre_uchar csc;
-          while (current_subject < end_subject &&
-                 (csc = UCHAR21TEST(current_subject)) != first_char && csc != first_char2)
-            current_subject++;
-          }
-        else
-          while (current_subject < end_subject &&
-                 UCHAR21TEST(current_subject) != first_char)
-            current_subject++;
-        }
+        current_subject = PRIV(scan_chars)(current_subject, end_subject,
+          first_char, first_char2);
 
       /* Or to just after a linebreak for a multiline match if possible */
 
@@ -3523,17 +3536,8 @@ for (;;)
       /* Advance to a non-unique first pcre_uchar after study */
 
       else if (start_bits != NULL)
-        {
-        while (current_subject < end_subject)
-          {
-          register pcre_uint32 c = UCHAR21TEST(current_subject);
-#ifndef COMPILE_PCRE8
-          if (c > 255) c = 255;
-#endif
-          if ((start_bits[c/8] & (1 << (c&7))) != 0) break;
-          current_subject++;
-          }
-        }
+        current_subject = PRIV(scan_bits)(&start_tables, current_subject,
+          end_subject);
       }
 
     /* Restore fudged end_subject */
@@ -3579,21 +3583,7 @@ for (;;)
 
         if (p > req_char_ptr)
           {
-          if (req_char != req_char2)
-            {
-            while (p < end_subject)
-              {
-              register pcre_uint32 pp = UCHAR21INCTEST(p);
-              if (pp == req_char || pp == req_char2) { p--; break; }
-              }
-            }
-          else
-            {
-            while (p < end_subject)
-              {
-              if (UCHAR21INCTEST(p) == req_char) { p--; break; }
-              }
-            }
+          p = PRIV(scan_chars)(p, end_subject, req_char, req_char2);
 
           /* If we can't find the required pcre_uchar, break the matching loop,
           which will cause a return or PCRE_ERROR_NOMATCH. */
@@ -3673,4 +3663,79 @@ for (;;)
 return PCRE_ERROR_NOMATCH;
 }
 
+
+
+/*************************************************
+*    Execute a Regular Expression - DFA engine   *
+*************************************************/
+
+/* This external function applies a compiled re to a subject string using a DFA
+engine. This function calls the internal function multiple times if the pattern
+is not anchored. When profiling is supported and the pattern has a profile, the
+call is timed and counted.
+
+Arguments:
+  argument_re     points to the compiled expression
+  extra_data      points to extra data or is NULL
+  subject         points to the subject string
+  length          length of subject string (may contain binary zeros)
+  start_offset    where to start in the subject string
+  options         option bits
+  offsets         vector of match offsets
+  offsetcount     size of same
+  workspace       workspace vector
+  wscount         size of same
+
+Returns:          > 0 => number of match offset pairs placed in offsets
+                  = 0 => offsets overflowed; longest matches are present
+                   -1 => failed to match
+                 < -1 => some kind of unexpected problem
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_dfa_exec(const pcre *argument_re, const pcre_extra *extra_data,
+  const char *subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount, int *workspace, int wscount)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_dfa_exec(const pcre16 *argument_re, const pcre16_extra *extra_data,
+  PCRE_SPTR16 subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount, int *workspace, int wscount)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_dfa_exec(const pcre32 *argument_re, const pcre32_extra *extra_data,
+  PCRE_SPTR32 subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount, int *workspace, int wscount)
+#endif
+{
+#ifdef SUPPORT_PROFILE
+const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
+
+if (re != NULL && re->magic_number == MAGIC_NUMBER &&
+    (re->flags & PCRE_PROFILED) != 0 &&
+    start_offset >= 0 && start_offset <= length)
+  {
+  profile_count dfa_states = 0;
+  profile_count start_time = PRIV(profile_clock)();
+  int end_offset = length;
+  int rc = dfa_exec_pattern(argument_re, extra_data, subject, length,
+    start_offset, options, offsets, offsetcount, workspace, wscount,
+    &dfa_states);
+
+  /* As for pcre_exec(), the units scanned are those up to the end of the
+  longest match, or the rest of the subject when there is none. */
+
+  if (rc >= 0 && offsetcount >= 2 && offsets[1] >= start_offset)
+    end_offset = offsets[1];
+  PRIV(profile_record)(re, start_time, end_offset - start_offset, 0,
+    dfa_states);
+  return rc;
+  }
+#endif
+
+return dfa_exec_pattern(argument_re, extra_data, subject, length,
+  start_offset, options, offsets, offsetcount, workspace, wscount, NULL);
+}
+
 /* End of pcre_dfa_exec.c */
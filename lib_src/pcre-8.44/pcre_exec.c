@@ -298,6 +298,13 @@ tests. Furthermore, not using longjmp() means that local dynamic variables
 don't have indeterminate values; this has meant that the frame size can be
 reduced because the result can be "passed back" by straight setting of the
 variable instead of being passed in the frame.
+
+The C-stack version has now been removed as well; it was impossible to bound
+its stack use on threads with small stacks. The heap-frame version is always
+used, and its frames are no longer obtained from malloc() one at a time.
+Instead, they are carved out of a "match arena" (see below), which is kept
+between calls of pcre_exec(), so that once an arena has grown to the depth that
+an application's patterns need, matching does no memory allocation at all.
 ****************************************************************************
 ***************************************************************************/
 
@@ -312,37 +319,11 @@ enum { RM1=1, RM2,  RM3,  RM4,  RM5,  RM6,  RM7,  RM8,  RM9,  RM10,
        RM51,  RM52, RM53, RM54, RM55, RM56, RM57, RM58, RM59, RM60,
        RM61,  RM62, RM63, RM64, RM65, RM66, RM67 };
 
-/* These versions of the macros use the stack, as normal. There are debugging
-versions and production versions. Note that the "rw" argument of RMATCH isn't
-actually used in this definition. */
-
-#ifndef NO_RECURSE
-#define REGISTER register
-
-#ifdef PCRE_DEBUG
-#define RMATCH(ra,rb,rc,rd,re,rw) \
-  { \
-  printf("match() called in line %d\n", __LINE__); \
-  rrc = match(ra,rb,mstart,rc,rd,re,rdepth+1); \
-  printf("to line %d\n", __LINE__); \
-  }
-#define RRETURN(ra) \
-  { \
-  printf("match() returned %d from line %d\n", ra, __LINE__); \
-  return ra; \
-  }
-#else
-#define RMATCH(ra,rb,rc,rd,re,rw) \
-  rrc = match(ra,rb,mstart,rc,rd,re,rdepth+1)
-#define RRETURN(ra) return ra
-#endif
-
-#else
-
-
-/* These versions of the macros manage a private stack on the heap. Note that
+/* These macros manage a private stack of frames in the match arena. Note that
 the "rd" argument of RMATCH isn't actually used in this definition. It's the md
-argument of match(), which never changes. */
+argument of match(), which never changes. A frame that cannot be obtained
+because the arena has reached its size limit gives PCRE_ERROR_RECURSIONLIMIT;
+if memory runs out the error is PCRE_ERROR_NOMEMORY. */
 
 #define REGISTER
 
@@ -351,8 +332,10 @@ argument of match(), which never changes. */
   heapframe *newframe = frame->Xnextframe;\
   if (newframe == NULL)\
     {\
-    newframe = (heapframe *)(PUBL(stack_malloc))(sizeof(heapframe));\
-    if (newframe == NULL) RRETURN(PCRE_ERROR_NOMEMORY);\
+    struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)md->match_arena;\
+    newframe = (heapframe *)arena_get(arena, sizeof(heapframe));\
+    if (newframe == NULL) RRETURN(arena->limited?\
+      PCRE_ERROR_RECURSIONLIMIT : PCRE_ERROR_NOMEMORY);\
     newframe->Xnextframe = NULL;\
     frame->Xnextframe = newframe;\
     }\
@@ -447,8 +430,257 @@ typedef struct heapframe {
 
 } heapframe;
 
+
+/*************************************************
+*              Match arenas                      *
+*************************************************/
+
+/* A match arena is a chain of chunks of memory obtained from
+pcre_stack_malloc(), out of which the frames above are carved. Frames are
+handed out in order from the first chunk; when it is full the next chunk is
+used, or a new one, twice the size of the last, is added to the chain. Frames
+never move, because pointers to them, and to fields within them, are kept in
+other frames. Within one pcre_exec() call each frame is obtained only once:
+after a "return" it stays linked from the frame below by Xnextframe and is
+re-used by the next "recursion" at that level. At the start of the next call
+the whole arena is free again.
+
+By default each thread has its own arena, created the first time it calls
+pcre_exec() and freed when it exits. So that one unusually deep match does not
+leave a thread holding a large arena for the rest of its life, the chunks of a
+default arena beyond the first MATCH_ARENA_KEEP bytes are freed at the end of
+each match. An application can also create arenas and
+pass them in a pcre_extra block. An arena that is already in use (because a
+callout has called pcre_exec() again) is not used; a temporary arena that is
+freed at the end of the match is used instead. */
+
+#ifndef MATCH_ARENA_START
+#define MATCH_ARENA_START (32 * 1024)
+#endif
+
+#ifndef MATCH_ARENA_KEEP
+#define MATCH_ARENA_KEEP (256 * 1024)
+#endif
+
+typedef struct arena_chunk {
+  struct arena_chunk *next;       /* Next chunk in the chain */
+  size_t size;                    /* Usable size, after this header */
+} arena_chunk;
+
+#if defined COMPILE_PCRE8
+#define ARENA_BLOCK real_pcre_match_arena
+#elif defined COMPILE_PCRE16
+#define ARENA_BLOCK real_pcre16_match_arena
+#elif defined COMPILE_PCRE32
+#define ARENA_BLOCK real_pcre32_match_arena
 #endif
 
+struct ARENA_BLOCK {
+  arena_chunk *first;             /* The chain of chunks */
+  arena_chunk *current;           /* The chunk that frames come from */
+  size_t used;                    /* Bytes used in the current chunk */
+  size_t in_use;                  /* Bytes handed out in this match */
+  size_t allocated;               /* Total size of all the chunks */
+  size_t start_size;              /* Size of the first chunk */
+  size_t max_size;                /* Limit on "allocated", or 0 */
+  size_t keep_size;               /* Bytes kept after a match, or 0 for all */
+  size_t highwater;               /* Largest "in_use" of any match */
+  BOOL busy;                      /* A match is using the arena */
+  BOOL limited;                   /* Last failure was caused by max_size */
+};
+
+/* Get a block of memory from an arena. The size must be a multiple of the
+alignment of a frame.
+
+Arguments:
+  arena       the arena
+  size        the size of the block
+
+Returns:      the block, or NULL if it could not be obtained
+*/
+
+static void *
+arena_get(struct ARENA_BLOCK *arena, size_t size)
+{
+arena_chunk *chunk = arena->current;
+size_t chunk_size;
+void *block;
+
+while (chunk != NULL && arena->used + size > chunk->size)
+  {
+  chunk = arena->current = chunk->next;
+  arena->used = 0;
+  }
+
+if (chunk == NULL)
+  {
+  arena_chunk *last = arena->first;
+  if (last != NULL) while (last->next != NULL) last = last->next;
+
+  chunk_size = (last == NULL)? arena->start_size : 2 * last->size;
+  if (chunk_size < size) chunk_size = size;
+  if (arena->max_size != 0 && arena->allocated + chunk_size > arena->max_size)
+    {
+    chunk_size = arena->max_size - arena->allocated;
+    if (arena->allocated >= arena->max_size || chunk_size < size)
+      {
+      arena->limited = TRUE;
+      return NULL;
+      }
+    }
+
+  chunk = (arena_chunk *)(PUBL(stack_malloc))(sizeof(arena_chunk) + chunk_size);
+  if (chunk == NULL)
+    {
+    arena->limited = FALSE;
+    return NULL;
+    }
+  chunk->next = NULL;
+  chunk->size = chunk_size;
+  if (last == NULL) arena->first = chunk; else last->next = chunk;
+  arena->current = chunk;
+  arena->used = 0;
+  arena->allocated += chunk_size;
+  }
+
+block = (char *)(chunk + 1) + arena->used;
+arena->used += size;
+arena->in_use += size;
+return block;
+}
+
+/* Free all the chunks of an arena. */
+
+static void
+arena_free_chunks(struct ARENA_BLOCK *arena)
+{
+arena_chunk *chunk = arena->first;
+while (chunk != NULL)
+  {
+  arena_chunk *next = chunk->next;
+  (PUBL(stack_free))(chunk);
+  chunk = next;
+  }
+arena->first = arena->current = NULL;
+arena->allocated = arena->used = 0;
+}
+
+/* Set up an arena at the start of a match, and finish with it at the end. */
+
+static void
+arena_start(struct ARENA_BLOCK *arena)
+{
+arena->current = arena->first;
+arena->used = 0;
+arena->in_use = 0;
+arena->limited = FALSE;
+arena->busy = TRUE;
+}
+
+static void
+arena_end(struct ARENA_BLOCK *arena)
+{
+if (arena->in_use > arena->highwater) arena->highwater = arena->in_use;
+arena->busy = FALSE;
+
+/* Keep the leading chunks that fit in keep_size, and at least the first one,
+and free the rest. */
+
+if (arena->keep_size != 0 && arena->allocated > arena->keep_size)
+  {
+  arena_chunk *chunk = arena->first;
+  size_t kept = chunk->size;
+  while (chunk->next != NULL && kept + chunk->next->size <= arena->keep_size)
+    {
+    chunk = chunk->next;
+    kept += chunk->size;
+    }
+  while (chunk->next != NULL)
+    {
+    arena_chunk *next = chunk->next->next;
+    (PUBL(stack_free))(chunk->next);
+    chunk->next = next;
+    }
+  arena->allocated = kept;
+  arena->current = arena->first;
+  arena->used = 0;
+  }
+}
+
+/* Finish with the arena at the end of pcre_exec(). A temporary arena is freed
+at once. */
+
+static void
+release_match_arena(struct ARENA_BLOCK *arena, struct ARENA_BLOCK *temporary)
+{
+arena_end(arena);
+if (arena == temporary) arena_free_chunks(arena);
+}
+
+
+/* Each thread's default arena is found through a key whose destructor frees it
+when the thread exits. Without POSIX threads there is no default arena, and
+every match uses a temporary one. */
+
+#ifndef _WIN32
+#include <pthread.h>
+
+static pthread_once_t thread_arena_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_arena_key;
+static BOOL thread_arena_key_valid = FALSE;
+
+static void
+thread_arena_release(void *arena)
+{
+arena_free_chunks((struct ARENA_BLOCK *)arena);
+(PUBL(free))(arena);
+}
+
+static void
+thread_arena_init(void)
+{
+thread_arena_key_valid =
+  pthread_key_create(&thread_arena_key, thread_arena_release) == 0;
+}
+#endif
+
+/* Get the calling thread's arena, creating it if necessary.
+
+Arguments:
+  create      TRUE to create the arena if the thread has none
+
+Returns:      the arena, or NULL
+*/
+
+static struct ARENA_BLOCK *
+thread_arena(BOOL create)
+{
+#ifndef _WIN32
+struct ARENA_BLOCK *arena;
+
+pthread_once(&thread_arena_once, thread_arena_init);
+if (!thread_arena_key_valid) return NULL;
+
+arena = (struct ARENA_BLOCK *)pthread_getspecific(thread_arena_key);
+if (arena != NULL || !create) return arena;
+
+arena = (struct ARENA_BLOCK *)(PUBL(malloc))(sizeof(struct ARENA_BLOCK));
+if (arena == NULL) return NULL;
+memset(arena, 0, sizeof(struct ARENA_BLOCK));
+arena->start_size = MATCH_ARENA_START;
+arena->keep_size = MATCH_ARENA_KEEP;
+if (pthread_setspecific(thread_arena_key, arena) != 0)
+  {
+  (PUBL(free))(arena);
+  return NULL;
+  }
+return arena;
+#else
+(void)create;
+return NULL;
+#endif
+}
+
 
 /***************************************************************************
 ***************************************************************************/
@@ -527,14 +759,11 @@ BOOL minimize, possessive; /* Quantifier options */
 BOOL caseless;
 int condcode;
 
-/* When recursion is not being used, all "local" variables that have to be
-preserved over calls to RMATCH() are part of a "frame". We set up the top-level
-frame on the stack here; subsequent instantiations are obtained from the heap
-whenever RMATCH() does a "recursion". See the macro definitions above. Putting
-the top-level on the stack rather than malloc-ing them all gives a performance
-boost in many cases where there is not much "recursion". */
+/* All "local" variables that have to be preserved over calls to RMATCH() are
+part of a "frame". The top-level frame is on the stack of pcre_exec();
+subsequent instantiations are obtained from the match arena whenever RMATCH()
+does a "recursion". See the macro definitions above. */
 
-#ifdef NO_RECURSE
 heapframe *frame = (heapframe *)md->match_frames_base;
 
 /* Copy in the original argument variables */
@@ -603,78 +832,6 @@ HEAP_RECURSE:
 
 #define newptrb            frame->Xnewptrb
 
-/* When recursion is being used, local variables are allocated on the stack and
-get preserved during recursion in the normal way. In this environment, fi and
-i, and fc and c, can be the same variables. */
-
-#else         /* NO_RECURSE not defined */
-#define fi i
-#define fc c
-
-/* Many of the following variables are used only in small blocks of the code.
-My normal style of coding would have declared them within each of those blocks.
-However, in order to accommodate the version of this code that uses an external
-"stack" implemented on the heap, it is easier to declare them all here, so the
-declarations can be cut out in a block. The only declarations within blocks
-below are for variables that do not have to be preserved over a recursive call
-to RMATCH(). */
-
-#ifdef SUPPORT_UTF
-const pcre_uchar *charptr;
-#endif
-const pcre_uchar *callpat;
-const pcre_uchar *data;
-const pcre_uchar *next;
-PCRE_PUCHAR       pp;
-const pcre_uchar *prev;
-PCRE_PUCHAR       saved_eptr;
-
-recursion_info new_recursive;
-
-BOOL cur_is_word;
-BOOL condition;
-BOOL prev_is_word;
-
-#ifdef SUPPORT_UCP
-int prop_type;
-unsigned int prop_value;
-int prop_fail_result;
-int oclength;
-pcre_uchar occhars[6];
-#endif
-
-int codelink;
-int ctype;
-int length;
-int max;
-int min;
-unsigned int number;
-int offset;
-unsigned int op;
-pcre_int32 save_capture_last;
-int save_offset1, save_offset2, save_offset3;
-int stacksave[REC_STACK_SAVE_MAX];
-
-eptrblock newptrb;
-
-/* There is a special fudge for calling match() in a way that causes it to
-measure the size of its basic stack frame when the stack is being used for
-recursion. The second argument (ecode) being NULL triggers this behaviour. It
-cannot normally ever be NULL. The return is the negated value of the frame
-size. */
-
-if (ecode == NULL)
-  {
-  if (rdepth == 0)
-    return match((PCRE_PUCHAR)&rdepth, NULL, NULL, 0, NULL, NULL, 1);
-  else
-    {
-    int len = (int)((char *)&rdepth - (char *)eptr);
-    return (len > 0)? -len : len;
-    }
-  }
-#endif     /* NO_RECURSE */
-
 /* To save space on the stack and in the heap frame, I have doubled up on some
 of the local variables that are used only in localised parts of the code, but
 still need to be preserved over recursive calls of match(). These macros define
@@ -697,20 +854,16 @@ prop_fail_result = 0;
 #endif
 
 
-/* This label is used for tail recursion, which is used in a few cases even
-when NO_RECURSE is not defined, in order to reduce the amount of stack that is
-used. Thanks to Ian Taylor for noticing this possibility and sending the
-original patch. */
+/* This label is used for tail recursion, which is used in a few cases in order
+to reduce the number of frames that are used. Thanks to Ian Taylor for noticing
+this possibility and sending the original patch. */
 
 TAIL_RECURSE:
 
 /* OK, now we can get on with the real code of the function. Recursive calls
-are specified by the macro RMATCH and RRETURN is used to return. When
-NO_RECURSE is *not* defined, these just turn into a recursive call to match()
-and a "return", respectively (possibly with some debugging if PCRE_DEBUG is
-defined). However, RMATCH isn't like a function call because it's quite a
-complicated macro. It has to be used in one particular way. This shouldn't,
-however, impact performance when true recursion is being used. */
+are specified by the macro RMATCH and RRETURN is used to return. RMATCH isn't
+like a function call because it's quite a complicated macro. It has to be used
+in one particular way. */
 
 #ifdef SUPPORT_UTF
 utf = md->utf;       /* Local copy of the flag */
@@ -4238,15 +4391,13 @@ for (;;)
           case PT_ALNUM:
           for (i = 1; i <= min; i++)
             {
-            int category;
             if (eptr >= md->end_subject)
               {
               SCHECK_PARTIAL();
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L || category == ucp_N) == prop_fail_result)
+            if (UCD_IS_ALNUM(c) == prop_fail_result)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -4265,34 +4416,21 @@ for (;;)
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            switch(c)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (prop_fail_result) RRETURN(MATCH_NOMATCH);
-              break;
-
-              default:
-              if ((UCD_CATEGORY(c) == ucp_Z) == prop_fail_result)
-                RRETURN(MATCH_NOMATCH);
-              break;
-              }
+            if (UCD_IS_SPACE(c) == prop_fail_result)
+              RRETURN(MATCH_NOMATCH);
             }
           break;
 
           case PT_WORD:
           for (i = 1; i <= min; i++)
             {
-            int category;
             if (eptr >= md->end_subject)
               {
               SCHECK_PARTIAL();
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L || category == ucp_N || c == CHAR_UNDERSCORE)
-                   == prop_fail_result)
+            if (UCD_IS_WORD(c) == prop_fail_result)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -4980,7 +5118,6 @@ for (;;)
           case PT_ALNUM:
           for (fi = min;; fi++)
             {
-            int category;
             RMATCH(eptr, ecode, offset_top, md, eptrb, RM59);
             if (rrc != MATCH_NOMATCH) RRETURN(rrc);
             if (fi >= max) RRETURN(MATCH_NOMATCH);
@@ -4990,8 +5127,7 @@ for (;;)
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L || category == ucp_N) == prop_fail_result)
+            if (UCD_IS_ALNUM(c) == prop_fail_result)
               RRETURN(MATCH_NOMATCH);
             }
           /* Control never gets here */
@@ -5013,25 +5149,14 @@ for (;;)
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            switch(c)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (prop_fail_result) RRETURN(MATCH_NOMATCH);
-              break;
-
-              default:
-              if ((UCD_CATEGORY(c) == ucp_Z) == prop_fail_result)
-                RRETURN(MATCH_NOMATCH);
-              break;
-              }
+            if (UCD_IS_SPACE(c) == prop_fail_result)
+              RRETURN(MATCH_NOMATCH);
             }
           /* Control never gets here */
 
           case PT_WORD:
           for (fi = min;; fi++)
             {
-            int category;
             RMATCH(eptr, ecode, offset_top, md, eptrb, RM62);
             if (rrc != MATCH_NOMATCH) RRETURN(rrc);
             if (fi >= max) RRETURN(MATCH_NOMATCH);
@@ -5041,11 +5166,7 @@ for (;;)
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(c, eptr);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L ||
-                 category == ucp_N ||
-                 c == CHAR_UNDERSCORE)
-                   == prop_fail_result)
+            if (UCD_IS_WORD(c) == prop_fail_result)
               RRETURN(MATCH_NOMATCH);
             }
           /* Control never gets here */
@@ -5493,7 +5614,6 @@ for (;;)
           case PT_ALNUM:
           for (i = min; i < max; i++)
             {
-            int category;
             int len = 1;
             if (eptr >= md->end_subject)
               {
@@ -5501,8 +5621,7 @@ for (;;)
               break;
               }
             GETCHARLENTEST(c, eptr, len);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L || category == ucp_N) == prop_fail_result)
+            if (UCD_IS_ALNUM(c) == prop_fail_result)
               break;
             eptr+= len;
             }
@@ -5523,27 +5642,14 @@ for (;;)
               break;
               }
             GETCHARLENTEST(c, eptr, len);
-            switch(c)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (prop_fail_result) goto ENDLOOP99;  /* Break the loop */
-              break;
-
-              default:
-              if ((UCD_CATEGORY(c) == ucp_Z) == prop_fail_result)
-                goto ENDLOOP99;   /* Break the loop */
-              break;
-              }
+            if (UCD_IS_SPACE(c) == prop_fail_result) break;
             eptr+= len;
             }
-          ENDLOOP99:
           break;
 
           case PT_WORD:
           for (i = min; i < max; i++)
             {
-            int category;
             int len = 1;
             if (eptr >= md->end_subject)
               {
@@ -5551,9 +5657,7 @@ for (;;)
               break;
               }
             GETCHARLENTEST(c, eptr, len);
-            category = UCD_CATEGORY(c);
-            if ((category == ucp_L || category == ucp_N ||
-                 c == CHAR_UNDERSCORE) == prop_fail_result)
+            if (UCD_IS_WORD(c) == prop_fail_result)
               break;
             eptr+= len;
             }
@@ -6202,11 +6306,9 @@ for (;;)
 /* Control never reaches here */
 
 
-/* When compiling to use the heap rather than the stack for recursive calls to
-match(), the RRETURN() macro jumps here. The number that is saved in
-frame->Xwhere indicates which label we actually want to return to. */
+/* The RRETURN() macro jumps here. The number that is saved in frame->Xwhere
+indicates which label we actually want to return to. */
 
-#ifdef NO_RECURSE
 #define LBL(val) case val: goto L_RM##val;
 HEAP_RETURN:
 switch (frame->Xwhere)
@@ -6234,7 +6336,6 @@ switch (frame->Xwhere)
   return PCRE_ERROR_INTERNAL;
   }
 #undef LBL
-#endif  /* NO_RECURSE */
 }
 
 
@@ -6244,7 +6345,6 @@ switch (frame->Xwhere)
 
 Undefine all the macros that were defined above to handle this. */
 
-#ifdef NO_RECURSE
 #undef eptr
 #undef ecode
 #undef mstart
@@ -6281,10 +6381,6 @@ Undefine all the macros that were defined above to handle this. */
 
 #undef newptrb
 
-#endif
-
-/* These two are defined as macros in both cases */
-
 #undef fc
 #undef fi
 
@@ -6292,39 +6388,43 @@ Undefine all the macros that were defined above to handle this. */
 ***************************************************************************/
 
 
-#ifdef NO_RECURSE
 /*************************************************
-*          Release allocated heap frames         *
+*    Set the offsets after an early failure      *
 *************************************************/
 
-/* This function releases all the allocated frames. The base frame is on the
-machine stack, and so must not be freed.
+/* When a lazy DFA or a specialized matcher finds that there is no match, the
+offsets are left as the interpreter would leave them.
 
-Argument: the address of the base frame
-Returns:  nothing
+Arguments:
+  re            the compiled pattern
+  offsets       the offset vector, or NULL
+  offsetcount   its size
+
+Returns:        nothing
 */
 
 static void
-release_match_heapframes (heapframe *frame_base)
+set_nomatch_offsets(const REAL_PCRE *re, int *offsets, int offsetcount)
 {
-heapframe *nextframe = frame_base->Xnextframe;
-while (nextframe != NULL)
-  {
-  heapframe *oldframe = nextframe;
-  nextframe = nextframe->Xnextframe;
-  (PUBL(stack_free))(oldframe);
-  }
+register int *iptr, *iend;
+
+if (offsets == NULL) return;
+iptr = offsets + offsetcount - (offsetcount % 3);
+iend = iptr - re->top_bracket;
+if (iend < offsets + 2) iend = offsets + 2;
+while (--iptr >= iend) *iptr = -1;
+if (offsetcount > 0) offsets[0] = -1;
+if (offsetcount > 1) offsets[1] = -1;
 }
-#endif
+
 
 
 /*************************************************
-*         Execute a Regular Expression           *
+*      Match a pattern against a subject         *
 *************************************************/
 
-/* This function applies a compiled re to a subject string and picks out
-portions of the string if it matches. Two elements in the vector are set for
-each substring: the offsets to the start and end of the substring.
+/* This function does the work of pcre_exec(), which is below. It is separate
+so that pcre_exec() can time it when profiling is supported.
 
 Arguments:
   argument_re     points to the compiled expression
@@ -6335,28 +6435,26 @@ Arguments:
   options         option bits
   offsets         points to a vector of ints to be filled in with offsets
   offsetcount     the number of elements in the vector
+  match_calls     where to add the number of calls of match(), or NULL
 
-Returns:          > 0 => success; value is the number of elements filled in
-                  = 0 => success, but offsets is not big enough
-                   -1 => failed to match
-                 < -1 => some kind of unexpected problem
+Returns:          as for pcre_exec()
 */
 
 #if defined COMPILE_PCRE8
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre_exec(const pcre *argument_re, const pcre_extra *extra_data,
+static int
+exec_pattern(const pcre *argument_re, const pcre_extra *extra_data,
   PCRE_SPTR subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount)
+  int offsetcount, profile_count *match_calls)
 #elif defined COMPILE_PCRE16
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre16_exec(const pcre16 *argument_re, const pcre16_extra *extra_data,
+static int
+exec_pattern(const pcre16 *argument_re, const pcre16_extra *extra_data,
   PCRE_SPTR16 subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount)
+  int offsetcount, profile_count *match_calls)
 #elif defined COMPILE_PCRE32
-PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
-pcre32_exec(const pcre32 *argument_re, const pcre32_extra *extra_data,
+static int
+exec_pattern(const pcre32 *argument_re, const pcre32_extra *extra_data,
   PCRE_SPTR32 subject, int length, int start_offset, int options, int *offsets,
-  int offsetcount)
+  int offsetcount, profile_count *match_calls)
 #endif
 {
 int rc, ocount, arg_offset_max;
@@ -6376,6 +6474,7 @@ match_data match_block;
 match_data *md = &match_block;
 const pcre_uint8 *tables;
 const pcre_uint8 *start_bits = NULL;
+scan_bits_tables start_tables;
 PCRE_PUCHAR start_match = (PCRE_PUCHAR)subject + start_offset;
 PCRE_PUCHAR end_subject;
 PCRE_PUCHAR start_partial = NULL;
@@ -6385,11 +6484,15 @@ PCRE_PUCHAR req_char_ptr = start_match - 1;
 const pcre_study_data *study;
 const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
 
-#ifdef NO_RECURSE
+struct ARENA_BLOCK *arena;
+struct ARENA_BLOCK temporary_arena;
 heapframe frame_zero;
 frame_zero.Xprevframe = NULL;            /* Marks the top level */
 frame_zero.Xnextframe = NULL;            /* None are allocated yet */
 md->match_frames_base = &frame_zero;
+
+#ifndef SUPPORT_PROFILE
+(void)match_calls;
 #endif
 
 /* Check for the special magic call that measures the size of the stack used
@@ -6399,11 +6502,7 @@ result still unsigned". Hopefully the cast fixes that. */
 
 if (re == NULL && extra_data == NULL && subject == NULL && length == -999 &&
     start_offset == -999)
-#ifdef NO_RECURSE
   return -((int)sizeof(heapframe));
-#else
-  return match(NULL, NULL, NULL, 0, NULL, NULL, 0);
-#endif
 
 /* Plausibility checks */
 
@@ -6490,6 +6589,73 @@ if (extra_data != NULL
   }
 #endif
 
+/* If pcre_study() found that the pattern is a literal, a list of literals, or
+a simple sequence of character runs, it attached a matcher that finds the whole
+match in a single pass. It gives no captured substrings, so it is used only if
+there are none or the caller wants no offsets. There are no verbs, so no
+mark. */
+
+if (extra_data != NULL
+    && (extra_data->flags & (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE |
+                             PCRE_EXTRA_TABLES)) ==
+         (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE)
+    && STUDY_PRIVATE(extra_data)->special != NULL
+    && (options & ~SPECIAL_EXEC_OPTIONS) == 0
+    && (offsetcount < 2 || re->top_bracket == 0))
+  {
+  int match[2];
+  rc = PRIV(special_exec)(re, STUDY_PRIVATE(extra_data)->special,
+    (PCRE_PUCHAR)subject, length, start_offset, (options & PCRE_ANCHORED) != 0,
+    match);
+  if (rc != SPECIAL_FAILED)
+    {
+    if ((extra_data->flags & PCRE_EXTRA_MARK) != 0)
+      *(extra_data->mark) = NULL;
+    if (rc == SPECIAL_NOMATCH)
+      {
+      set_nomatch_offsets(re, offsets, offsetcount);
+      return PCRE_ERROR_NOMATCH;
+      }
+    if (offsetcount < 2) return 0;
+    offsets[0] = match[0];
+    offsets[1] = match[1];
+    return 1;
+    }
+  }
+
+/* If pcre_study() built a lazy DFA, use it to find out without backtracking
+whether there is a match. That is the whole answer if there is none, if the
+caller wants no offsets, or if the pattern has no capturing groups and every
+match ends at the end of the subject; otherwise the interpreter is still
+needed to find the captured substrings. There are no verbs, so no mark. */
+
+if (extra_data != NULL
+    && (extra_data->flags & (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE |
+                             PCRE_EXTRA_TABLES)) ==
+         (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE)
+    && STUDY_PRIVATE(extra_data)->lazy_dfa != NULL
+    && start_offset == 0
+    && (options & ~LAZY_DFA_EXEC_OPTIONS) == 0)
+  {
+  rc = PRIV(lazy_dfa_exec)(re, STUDY_PRIVATE(extra_data)->lazy_dfa,
+    (PCRE_PUCHAR)subject, length);
+  if (rc == LAZY_DFA_NOMATCH || (rc != LAZY_DFA_FAILED && (offsetcount < 2 ||
+      (rc == LAZY_DFA_MATCH_END && re->top_bracket == 0))))
+    {
+    if ((extra_data->flags & PCRE_EXTRA_MARK) != 0)
+      *(extra_data->mark) = NULL;
+    if (rc == LAZY_DFA_NOMATCH)
+      {
+      set_nomatch_offsets(re, offsets, offsetcount);
+      return PCRE_ERROR_NOMATCH;
+      }
+    if (offsetcount < 2) return 0;
+    offsets[0] = 0;
+    offsets[1] = length;
+    return 1;
+    }
+  }
+
 /* Carry on with non-JIT matching. This information is for finding all the
 numbers associated with a given name, for condition testing. */
 
@@ -6504,6 +6670,7 @@ study = NULL;
 md->match_limit = MATCH_LIMIT;
 md->match_limit_recursion = MATCH_LIMIT_RECURSION;
 md->callout_data = NULL;
+arena = NULL;
 
 /* The table pointer is always in native byte order. */
 
@@ -6523,6 +6690,9 @@ if (extra_data != NULL)
   if ((flags & PCRE_EXTRA_CALLOUT_DATA) != 0)
     md->callout_data = extra_data->callout_data;
   if ((flags & PCRE_EXTRA_TABLES) != 0) tables = extra_data->tables;
+  if ((flags & (PCRE_EXTRA_MATCH_ARENA|PCRE_EXTRA_PRIVATE)) ==
+      (PCRE_EXTRA_MATCH_ARENA|PCRE_EXTRA_PRIVATE))
+    arena = (struct ARENA_BLOCK *)STUDY_PRIVATE(extra_data)->match_arena;
   }
 
 /* Limits in the regex override only if they are smaller. */
@@ -6716,6 +6886,11 @@ if (!anchored)
         start_bits = study->start_bits;
   }
 
+/* The start bitmap is searched with the help of some tables that are derived
+from it. */
+
+if (start_bits != NULL) PRIV(scan_bits_init)(&start_tables, start_bits);
+
 /* For anchored or unanchored matches, there may be a "last known required
 character" set. */
 
@@ -6733,6 +6908,25 @@ if ((re->flags & PCRE_REQCHSET) != 0)
     }
   }
 
+/* Get the arena from which frames for match() are taken. If no arena was
+passed in the extra block the calling thread's default arena is used. An arena
+that is already in use by an outer call from which a callout has called
+pcre_exec() again is left alone, and a temporary arena is used instead. */
+
+if (arena == NULL) arena = thread_arena(TRUE);
+if (arena == NULL || arena->busy)
+  {
+  memset(&temporary_arena, 0, sizeof(struct ARENA_BLOCK));
+  temporary_arena.start_size = MATCH_ARENA_START;
+  if (arena != NULL) temporary_arena.max_size = arena->max_size;
+  if (temporary_arena.max_size != 0 &&
+      temporary_arena.start_size > temporary_arena.max_size)
+    temporary_arena.start_size = temporary_arena.max_size;
+  arena = &temporary_arena;
+  }
+arena_start(arena);
+md->match_arena = arena;
+
 
 /* ==========================================================================*/
 
@@ -6780,15 +6974,8 @@ for(;;)
 
     if (has_first_char)
       {
-      pcre_uchar smc;
-
-      if (first_char != first_char2)
-        while (start_match < end_subject &&
-          (smc = UCHAR21TEST(start_match)) != first_char && smc != first_char2)
-          start_match++;
-      else
-        while (start_match < end_subject && UCHAR21TEST(start_match) != first_char)
-          start_match++;
+      start_match = PRIV(scan_chars)(start_match, end_subject, first_char,
+        first_char2);
       }
 
     /* Or to just after a linebreak for a multiline match */
@@ -6827,17 +7014,7 @@ for(;;)
     /* Or to a non-unique first byte after study */
 
     else if (start_bits != NULL)
-      {
-      while (start_match < end_subject)
-        {
-        register pcre_uint32 c = UCHAR21TEST(start_match);
-#ifndef COMPILE_PCRE8
-        if (c > 255) c = 255;
-#endif
-        if ((start_bits[c/8] & (1 << (c&7))) != 0) break;
-        start_match++;
-        }
-      }
+      start_match = PRIV(scan_bits)(&start_tables, start_match, end_subject);
     }   /* Starting optimizations */
 
   /* Restore fudged end_subject */
@@ -6884,21 +7061,7 @@ for(;;)
 
       if (p > req_char_ptr)
         {
-        if (req_char != req_char2)
-          {
-          while (p < end_subject)
-            {
-            register pcre_uint32 pp = UCHAR21INCTEST(p);
-            if (pp == req_char || pp == req_char2) { p--; break; }
-            }
-          }
-        else
-          {
-          while (p < end_subject)
-            {
-            if (UCHAR21INCTEST(p) == req_char) { p--; break; }
-            }
-          }
+        p = PRIV(scan_chars)(p, end_subject, req_char, req_char2);
 
         /* If we can't find the required character, break the matching loop,
         forcing a match failure. */
@@ -6934,6 +7097,9 @@ for(;;)
   md->end_offset_top = 0;
   md->skip_arg_count = 0;
   rc = match(start_match, md->start_code, start_match, 2, md, NULL, 0);
+#ifdef SUPPORT_PROFILE
+  if (match_calls != NULL) *match_calls += md->match_call_count;
+#endif
   if (md->hitend && start_partial == NULL)
     {
     start_partial = md->start_used_ptr;
@@ -7110,9 +7276,7 @@ if (rc == MATCH_MATCH || rc == MATCH_ACCEPT)
   if (extra_data != NULL && (extra_data->flags & PCRE_EXTRA_MARK) != 0)
     *(extra_data->mark) = (pcre_uchar *)md->mark;
   DPRINTF((">>>> returning %d\n", rc));
-#ifdef NO_RECURSE
-  release_match_heapframes(&frame_zero);
-#endif
+  release_match_arena(arena, &temporary_arena);
   return rc;
   }
 
@@ -7130,9 +7294,7 @@ if (using_temporary_offsets)
 if (rc != MATCH_NOMATCH && rc != PCRE_ERROR_PARTIAL)
   {
   DPRINTF((">>>> error: returning %d\n", rc));
-#ifdef NO_RECURSE
-  release_match_heapframes(&frame_zero);
-#endif
+  release_match_arena(arena, &temporary_arena);
   return rc;
   }
 
@@ -7164,10 +7326,216 @@ else
 
 if (extra_data != NULL && (extra_data->flags & PCRE_EXTRA_MARK) != 0)
   *(extra_data->mark) = (pcre_uchar *)md->nomatch_mark;
-#ifdef NO_RECURSE
-  release_match_heapframes(&frame_zero);
-#endif
+release_match_arena(arena, &temporary_arena);
 return rc;
 }
 
+
+
+/*************************************************
+*         Execute a Regular Expression           *
+*************************************************/
+
+/* This function applies a compiled re to a subject string and picks out
+portions of the string if it matches. Two elements in the vector are set for
+each substring: the offsets to the start and end of the substring. When
+profiling is supported and the pattern has a profile, the call is timed and
+counted.
+
+Arguments:
+  argument_re     points to the compiled expression
+  extra_data      points to extra data or is NULL
+  subject         points to the subject string
+  length          length of subject string (may contain binary zeros)
+  start_offset    where to start in the subject string
+  options         option bits
+  offsets         points to a vector of ints to be filled in with offsets
+  offsetcount     the number of elements in the vector
+
+Returns:          > 0 => success; value is the number of elements filled in
+                  = 0 => success, but offsets is not big enough
+                   -1 => failed to match
+                 < -1 => some kind of unexpected problem
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_exec(const pcre *argument_re, const pcre_extra *extra_data,
+  PCRE_SPTR subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_exec(const pcre16 *argument_re, const pcre16_extra *extra_data,
+  PCRE_SPTR16 subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_exec(const pcre32 *argument_re, const pcre32_extra *extra_data,
+  PCRE_SPTR32 subject, int length, int start_offset, int options, int *offsets,
+  int offsetcount)
+#endif
+{
+#ifdef SUPPORT_PROFILE
+const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
+
+if (re != NULL && re->magic_number == MAGIC_NUMBER &&
+    (re->flags & PCRE_PROFILED) != 0 &&
+    start_offset >= 0 && start_offset <= length)
+  {
+  profile_count match_calls = 0;
+  profile_count start_time = PRIV(profile_clock)();
+  int end_offset = length;
+  int rc = exec_pattern(argument_re, extra_data, subject, length,
+    start_offset, options, offsets, offsetcount, &match_calls);
+
+  /* The units scanned are those up to the end of a match, or the whole of the
+  rest of the subject when there is none. */
+
+  if (rc >= 0 && offsetcount >= 2 && offsets[1] >= start_offset)
+    end_offset = offsets[1];
+  PRIV(profile_record)(re, start_time, end_offset - start_offset,
+    match_calls, 0);
+  return rc;
+  }
+#endif
+
+return exec_pattern(argument_re, extra_data, subject, length, start_offset,
+  options, offsets, offsetcount, NULL);
+}
+
+
+/*************************************************
+*          Create and free a match arena         *
+*************************************************/
+
+/* An application can create its own arenas instead of using the one that each
+thread gets by default, for example to limit the memory that matching may use.
+An arena must not be used by more than one thread at a time.
+
+Arguments:
+  startsize   size of the first chunk, or 0 for the default
+  maxsize     limit on the total size of the arena, or 0 for no limit
+
+Returns:      the arena, or NULL on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_match_arena * PCRE_CALL_CONVENTION
+pcre_match_arena_alloc(int startsize, int maxsize)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_match_arena * PCRE_CALL_CONVENTION
+pcre16_match_arena_alloc(int startsize, int maxsize)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_match_arena * PCRE_CALL_CONVENTION
+pcre32_match_arena_alloc(int startsize, int maxsize)
+#endif
+{
+struct ARENA_BLOCK *arena;
+
+if (startsize < 0 || maxsize < 0 || (maxsize > 0 && startsize > maxsize))
+  return NULL;
+arena = (struct ARENA_BLOCK *)(PUBL(malloc))(sizeof(struct ARENA_BLOCK));
+if (arena == NULL) return NULL;
+memset(arena, 0, sizeof(struct ARENA_BLOCK));
+arena->start_size = (startsize > 0)? (size_t)startsize : MATCH_ARENA_START;
+arena->max_size = (size_t)maxsize;
+if (arena->max_size != 0 && arena->start_size > arena->max_size)
+  arena->start_size = arena->max_size;
+#if defined COMPILE_PCRE8
+return (pcre_match_arena *)arena;
+#elif defined COMPILE_PCRE16
+return (pcre16_match_arena *)arena;
+#elif defined COMPILE_PCRE32
+return (pcre32_match_arena *)arena;
+#endif
+}
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_match_arena_free(pcre_match_arena *external_arena)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_match_arena_free(pcre16_match_arena *external_arena)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_match_arena_free(pcre32_match_arena *external_arena)
+#endif
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+if (arena == NULL) return;
+arena_free_chunks(arena);
+(PUBL(free))(arena);
+}
+
+
+/*************************************************
+*        Assign a match arena to a pattern       *
+*************************************************/
+
+/* The arena is used by pcre_exec() calls that are passed this extra block, or
+a copy of it. A NULL arena restores the default. The arena is remembered in the
+library's private study data, so the block must have come from pcre_study();
+for any other block this function does nothing.
+
+Arguments:
+  extra       the pcre_extra block from pcre_study()
+  arena       the arena, or NULL
+
+Returns:      nothing
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_assign_match_arena(pcre_extra *extra, pcre_match_arena *arena)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_assign_match_arena(pcre16_extra *extra, pcre16_match_arena *arena)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_assign_match_arena(pcre32_extra *extra, pcre32_match_arena *arena)
+#endif
+{
+if (extra == NULL || (extra->flags & PCRE_EXTRA_PRIVATE) == 0) return;
+STUDY_PRIVATE(extra)->match_arena = arena;
+if (arena != NULL) extra->flags |= PCRE_EXTRA_MATCH_ARENA;
+  else extra->flags &= ~PCRE_EXTRA_MATCH_ARENA;
+}
+
+
+/*************************************************
+*       Return the high-water mark of an arena   *
+*************************************************/
+
+/* This is the largest number of bytes of frames that any single match has
+used in the arena. The total size of the arena can be a little larger, because
+the end of a chunk is left unused when a frame does not fit.
+
+Arguments:
+  arena       the arena, or NULL for the calling thread's default arena
+  reset       if non-zero, reset the mark after reading it
+
+Returns:      the high-water mark in bytes
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre_match_arena_highwater(pcre_match_arena *external_arena, int reset)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre16_match_arena_highwater(pcre16_match_arena *external_arena, int reset)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN size_t PCRE_CALL_CONVENTION
+pcre32_match_arena_highwater(pcre32_match_arena *external_arena, int reset)
+#endif
+{
+struct ARENA_BLOCK *arena = (struct ARENA_BLOCK *)external_arena;
+size_t highwater;
+
+if (arena == NULL) arena = thread_arena(FALSE);
+if (arena == NULL) return 0;
+highwater = arena->highwater;
+if (reset != 0) arena->highwater = 0;
+return highwater;
+}
+
 /* End of pcre_exec.c */
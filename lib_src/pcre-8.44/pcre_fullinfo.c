@@ -236,6 +236,13 @@ switch (what)
   *((int *)where) = (re->flags & PCRE_MATCH_EMPTY) != 0;
   break;
 
+  case PCRE_INFO_SUPERLINEAR:
+  *((int *)where) = (re->flags & PCRE_SUPERLINEAR) != 0;
+  break;
+
+  case PCRE_INFO_PROFILE:
+  return PRIV(profile_get)(re, (pcre_profile *)where);
+
   default: return PCRE_ERROR_BADOPTION;
   }
 
@@ -1090,6 +1090,8 @@ compatibility. */
 #define PCRE_MLSET         0x00002000  /* match limit set by regex */
 #define PCRE_RLSET         0x00004000  /* recursion limit set by regex */
 #define PCRE_MATCH_EMPTY   0x00008000  /* pattern can match empty string */
+#define PCRE_SUPERLINEAR   0x00010000  /* may backtrack in super-linear time */
+#define PCRE_PROFILED      0x00020000  /* has a trailing profile_data block */
 
 #if defined COMPILE_PCRE8
 #define PCRE_MODE          PCRE_MODE8
@@ -1132,12 +1134,39 @@ time, run time, or study time, respectively. */
 
 #define PUBLIC_STUDY_OPTIONS \
    (PCRE_STUDY_JIT_COMPILE|PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE| \
-    PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE|PCRE_STUDY_EXTRA_NEEDED)
+    PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE|PCRE_STUDY_EXTRA_NEEDED| \
+    PCRE_STUDY_LAZY_DFA|PCRE_STUDY_NO_SPECIAL)
+
+/* A flag bit in a pcre_extra block that is set only by the library, to say
+that the study data is followed by a pcre_study_private block. */
+
+#define PCRE_EXTRA_PRIVATE 0x8000
 
 #define PUBLIC_JIT_EXEC_OPTIONS \
    (PCRE_NO_UTF8_CHECK|PCRE_NOTBOL|PCRE_NOTEOL|PCRE_NOTEMPTY|\
     PCRE_NOTEMPTY_ATSTART|PCRE_PARTIAL_SOFT|PCRE_PARTIAL_HARD)
 
+/* The pcre_exec() options with which a lazy DFA can be used, and the results
+of PRIV(lazy_dfa_exec)(); see pcre_lazydfa.c. */
+
+#define LAZY_DFA_EXEC_OPTIONS \
+   (PCRE_NO_UTF8_CHECK|PCRE_ANCHORED|PCRE_NO_START_OPTIMIZE)
+
+#define LAZY_DFA_FAILED     (-1)  /* Use the interpreter */
+#define LAZY_DFA_NOMATCH      0
+#define LAZY_DFA_MATCH        1   /* Matched; the end is not known */
+#define LAZY_DFA_MATCH_END    2   /* Matched up to the end of the subject */
+
+/* The pcre_exec() options with which a specialized matcher can be used, and
+the results of PRIV(special_exec)(); see pcre_special.c. */
+
+#define SPECIAL_EXEC_OPTIONS \
+   (PCRE_NO_UTF8_CHECK|PCRE_ANCHORED|PCRE_NO_START_OPTIMIZE)
+
+#define SPECIAL_FAILED      (-1)  /* Use the interpreter */
+#define SPECIAL_NOMATCH       0
+#define SPECIAL_MATCH         1
+
 /* Magic number to provide a small check against being handed junk. */
 
 #define MAGIC_NUMBER  0x50435245UL   /* 'PCRE' */
@@ -2399,6 +2428,28 @@ typedef struct pcre_study_data {
   pcre_uint32 minlength;          /* Minimum subject length */
 } pcre_study_data;
 
+/* pcre_study() places this block straight after the study data, in the same
+piece of memory, and sets PCRE_EXTRA_PRIVATE in the flags of the pcre_extra
+block. It holds what the library attaches to a studied pattern that is not in
+the public pcre_extra structure. It is not counted in the size of the study
+data, so it is never saved or reloaded with it, and because it is found through
+the study_data pointer it is still reached from a copy of the pcre_extra
+block. */
+
+typedef struct pcre_study_private {
+  void *match_arena;              /* From pcre_assign_match_arena() */
+  void *lazy_dfa;                 /* Lazy DFA built by pcre_study() */
+  void *special;                  /* Specialized matcher from pcre_study() */
+} pcre_study_private;
+
+typedef struct pcre_study_block {
+  pcre_study_data data;
+  pcre_study_private priv;
+} pcre_study_block;
+
+#define STUDY_PRIVATE(extra) \
+  (&((pcre_study_block *)((extra)->study_data))->priv)
+
 /* Structure for building a chain of open capturing subpatterns during
 compiling, so that instructions to close them can be compiled when (*ACCEPT) is
 encountered. This is also used to identify subpatterns that contain recursive
@@ -2507,6 +2558,33 @@ typedef struct eptrblock {
 } eptrblock;
 
 
+/* When SUPPORT_PROFILE is defined, pcre_compile() adds this block to the end
+of each compiled pattern and sets PCRE_PROFILED. The matching functions add to
+the counters, which are read by pcre_fullinfo(PCRE_INFO_PROFILE). The block is
+aligned on an 8-byte boundary, and code_size is the size of the pattern without
+it. Where there is no 64-bit type, the counters are longs. */
+
+#if defined INT64_MAX || defined int64_t
+typedef int64_t profile_count;
+#else
+typedef long int profile_count;
+#endif
+
+typedef struct profile_data {
+  profile_count calls;              /* Calls of the matching functions */
+  profile_count match_calls;        /* Calls of match() */
+  profile_count dfa_states;         /* States processed by the DFA matcher */
+  profile_count units;              /* Subject code units scanned */
+  profile_count nanoseconds;        /* Time spent in the calls */
+  pcre_uint32 code_size;            /* Size of the pattern before the block */
+  pcre_uint32 dummy;                /* To ensure size is a multiple of 8 */
+} profile_data;
+
+#define PROFILE_BLOCK_SIZE ((sizeof(profile_data) + 7) & ~(size_t)7)
+#define PROFILE_DATA(re) \
+  ((profile_data *)((char *)(re) + (re)->size - PROFILE_BLOCK_SIZE))
+
+
 /* Structure for passing "static" information around between the functions
 doing traditional NFA matching, so that they are thread-safe. */
 
@@ -2557,9 +2635,8 @@ typedef struct match_data {
   const  pcre_uchar *mark;        /* Mark pointer to pass back on success */
   const  pcre_uchar *nomatch_mark;/* Mark pointer to pass back on failure */
   const  pcre_uchar *once_target; /* Where to back up to for atomic groups */
-#ifdef NO_RECURSE
-  void  *match_frames_base;       /* For remembering malloc'd frames */
-#endif
+  void  *match_frames_base;       /* The top-level frame */
+  void  *match_arena;             /* Where the other frames come from */
 } match_data;
 
 /* A similar structure is used for the same purpose by the DFA matching
@@ -2579,8 +2656,21 @@ typedef struct dfa_match_data {
   pcre_uchar nl[4];                 /* Newline string when fixed */
   void *callout_data;               /* To pass back to callouts */
   dfa_recursion_info *recursive;    /* Linked list of recursion data */
+#ifdef SUPPORT_PROFILE
+  profile_count *profile_states;    /* Where to count states processed */
+#endif
 } dfa_match_data;
 
+/* Tables for finding code units that are in a starting bitmap; see
+pcre_scan.c. */
+
+typedef struct scan_bits_tables {
+  pcre_uint8 lo[16];                /* Buckets for each low nibble */
+  pcre_uint8 hi[16];                /* Buckets for each high nibble */
+  const pcre_uint8 *start_bits;     /* The bitmap itself */
+  BOOL exact;                       /* FALSE if candidates must be checked */
+} scan_bits_tables;
+
 /* Bit definitions for entries in the pcre_ctypes table. */
 
 #define ctype_space   0x01
@@ -2746,6 +2836,37 @@ extern BOOL              PRIV(was_newline)(PCRE_PUCHAR, int, PCRE_PUCHAR,
                            int *, BOOL);
 extern BOOL              PRIV(xclass)(pcre_uint32, const pcre_uchar *, BOOL);
 
+extern PCRE_PUCHAR       PRIV(scan_chars)(PCRE_PUCHAR, PCRE_PUCHAR,
+                           pcre_uint32, pcre_uint32);
+extern PCRE_PUCHAR       PRIV(scan_bits)(const scan_bits_tables *,
+                           PCRE_PUCHAR, PCRE_PUCHAR);
+extern void              PRIV(scan_bits_init)(scan_bits_tables *,
+                           const pcre_uint8 *);
+extern const char       *PRIV(scan_get_target)(void);
+
+extern PUBL(extra)      *PRIV(study_alloc)(void *);
+
+extern void             *PRIV(arena_alloc)(void *, size_t);
+extern void             *PRIV(arena_alloc_extra)(void *, size_t);
+extern void              PRIV(arena_free)(void *, void *);
+
+#ifdef SUPPORT_PROFILE
+extern profile_count     PRIV(profile_clock)(void);
+extern void              PRIV(profile_record)(const REAL_PCRE *, profile_count,
+                           profile_count, profile_count, profile_count);
+#endif
+extern int               PRIV(profile_get)(const REAL_PCRE *, pcre_profile *);
+
+extern void             *PRIV(lazy_dfa_compile)(const REAL_PCRE *);
+extern int               PRIV(lazy_dfa_exec)(const REAL_PCRE *, void *,
+                           PCRE_PUCHAR, int);
+extern void              PRIV(lazy_dfa_free)(void *);
+
+extern void             *PRIV(special_compile)(const REAL_PCRE *);
+extern int               PRIV(special_exec)(const REAL_PCRE *, void *,
+                           PCRE_PUCHAR, int, int, BOOL, int *);
+extern void              PRIV(special_free)(void *);
+
 #ifdef SUPPORT_JIT
 extern void              PRIV(jit_compile)(const REAL_PCRE *,
                            PUBL(extra) *, int);
@@ -2754,6 +2875,7 @@ extern int               PRIV(jit_exec)(const PUBL(extra) *,
 extern void              PRIV(jit_free)(void *);
 extern int               PRIV(jit_get_size)(void *);
 extern const char*       PRIV(jit_get_target)(void);
+extern BOOL              PRIV(jit_usable)(void);
 #endif
 
 /* Unicode character database (UCD) */
@@ -2768,8 +2890,11 @@ typedef struct {
 
 extern const pcre_uint32 PRIV(ucd_caseless_sets)[];
 extern const ucd_record  PRIV(ucd_records)[];
+extern const pcre_uint16 PRIV(ucd_latin1)[];
+extern const pcre_uint8  PRIV(ucd_latin1_bits)[];
 extern const pcre_uint8  PRIV(ucd_stage1)[];
 extern const pcre_uint16 PRIV(ucd_stage2)[];
+extern const pcre_uint16 PRIV(ucd_stage3)[];
 extern const pcre_uint32 PRIV(ucp_gentype)[];
 extern const pcre_uint32 PRIV(ucp_gbtable)[];
 #ifdef COMPILE_PCRE32
@@ -2780,12 +2905,27 @@ extern const int         PRIV(ucp_typerange)[];
 #endif
 
 #ifdef SUPPORT_UCP
-/* UCD access macros */
+/* UCD access macros. The record number of a character is found in three
+stages: the top bits select a block of stage 2, whose entry for the middle bits
+selects a block of stage 3, whose entry for the low bits is the record number.
+Latin-1 characters are looked up directly. */
+
+#define UCD_BLOCK_SHIFT  3
+#define UCD_STAGE2_SHIFT 5
+#define UCD_BLOCK_SIZE   (1 << UCD_BLOCK_SHIFT)
+#define UCD_STAGE2_SIZE  (1 << UCD_STAGE2_SHIFT)
+
+#define UCD_RECORD_NUMBER(ch) PRIV(ucd_stage3)[ \
+        (PRIV(ucd_stage2)[ \
+          (PRIV(ucd_stage1)[(ch) >> (UCD_BLOCK_SHIFT + UCD_STAGE2_SHIFT)] << \
+            UCD_STAGE2_SHIFT) + \
+          (((ch) >> UCD_BLOCK_SHIFT) & (UCD_STAGE2_SIZE - 1))] << \
+          UCD_BLOCK_SHIFT) + \
+        ((ch) & (UCD_BLOCK_SIZE - 1))]
 
-#define UCD_BLOCK_SIZE 128
 #define REAL_GET_UCD(ch) (PRIV(ucd_records) + \
-        PRIV(ucd_stage2)[PRIV(ucd_stage1)[(int)(ch) / UCD_BLOCK_SIZE] * \
-        UCD_BLOCK_SIZE + (int)(ch) % UCD_BLOCK_SIZE])
+        (((pcre_uint32)(ch) < 256)? PRIV(ucd_latin1)[(pcre_uint32)(ch)] : \
+        UCD_RECORD_NUMBER((pcre_uint32)(ch))))
 
 #ifdef COMPILE_PCRE32
 #define GET_UCD(ch) ((ch > 0x10ffff)? PRIV(dummy_ucd_record) : REAL_GET_UCD(ch))
@@ -2800,6 +2940,32 @@ extern const int         PRIV(ucp_typerange)[];
 #define UCD_CASESET(ch)     GET_UCD(ch)->caseset
 #define UCD_OTHERCASE(ch)   ((pcre_uint32)((int)ch + (int)(GET_UCD(ch)->other_case)))
 
+/* In UCP mode [:alnum:], \s, and \w are property tests. Latin-1 characters
+are looked up in bitmaps; above that, a word character is alphanumeric, and the
+only space that is not a separator is U+180E. The results are 0 or 1. */
+
+#define UCD_LATIN1_ALNUM  0
+#define UCD_LATIN1_SPACE  32
+#define UCD_LATIN1_WORD   64
+
+#define UCD_LATIN1_BIT(ch, map) \
+  ((PRIV(ucd_latin1_bits)[(map) + ((ch) >> 3)] >> ((ch) & 7)) & 1)
+
+#define UCD_ALNUM_TYPES \
+  ((1u << ucp_Ll) | (1u << ucp_Lm) | (1u << ucp_Lo) | (1u << ucp_Lt) | \
+   (1u << ucp_Lu) | (1u << ucp_Nd) | (1u << ucp_Nl) | (1u << ucp_No))
+#define UCD_SPACE_TYPES ((1u << ucp_Zl) | (1u << ucp_Zp) | (1u << ucp_Zs))
+
+#define UCD_IS_ALNUM(ch) (((ch) < 256)? \
+  (int)UCD_LATIN1_BIT(ch, UCD_LATIN1_ALNUM) : \
+  (int)((UCD_ALNUM_TYPES >> UCD_CHARTYPE(ch)) & 1))
+#define UCD_IS_SPACE(ch) (((ch) < 256)? \
+  (int)UCD_LATIN1_BIT(ch, UCD_LATIN1_SPACE) : \
+  (int)((ch) == 0x180e || ((UCD_SPACE_TYPES >> UCD_CHARTYPE(ch)) & 1)))
+#define UCD_IS_WORD(ch) (((ch) < 256)? \
+  (int)UCD_LATIN1_BIT(ch, UCD_LATIN1_WORD) : \
+  (int)((UCD_ALNUM_TYPES >> UCD_CHARTYPE(ch)) & 1))
+
 #endif /* SUPPORT_UCP */
 
 #endif
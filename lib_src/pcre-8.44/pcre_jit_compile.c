@@ -82,6 +82,19 @@ Fast, but limited size. */
 of page size. */
 #define STACK_GROWTH_RATE 8192
 
+/* Initial and maximum size of the stacks handed out by the per-thread stack
+pool (see pcre_jit_thread_stack()), and the number of idle stacks that are
+kept for reuse when threads exit. */
+#ifndef JIT_THREAD_STACK_START
+#define JIT_THREAD_STACK_START (32 * 1024)
+#endif
+#ifndef JIT_THREAD_STACK_MAX
+#define JIT_THREAD_STACK_MAX (1024 * 1024)
+#endif
+#ifndef JIT_STACK_POOL_SIZE
+#define JIT_STACK_POOL_SIZE 16
+#endif
+
 /* Enable to check that the allocation could destroy temporaries. */
 #if defined SLJIT_DEBUG && SLJIT_DEBUG
 #define DESTROY_REGISTERS 1
@@ -3336,9 +3349,36 @@ sljit_emit_fast_return(compiler, RETURN_ADDR, 0);
 
 #ifdef SUPPORT_UCP
 
-/* UCD_BLOCK_SIZE must be 128 (see the assert below). */
-#define UCD_BLOCK_MASK 127
-#define UCD_BLOCK_SHIFT 7
+static void read_ucd_record(compiler_common *common)
+{
+/* Looks up the UCD record number of the character in TMP1, directly for
+Latin-1 characters and otherwise through the three stages of tables (see
+GET_UCD). Returns the record number in TMP2; TMP1 is overwritten. */
+DEFINE_COMPILER;
+struct sljit_jump *jump;
+struct sljit_jump *done;
+
+jump = CMP(SLJIT_GREATER_EQUAL, TMP1, 0, SLJIT_IMM, 256);
+OP1(SLJIT_MOV, TMP2, 0, SLJIT_IMM, (sljit_sw)PRIV(ucd_latin1));
+OP1(SLJIT_MOV_U16, TMP2, 0, SLJIT_MEM2(TMP2, TMP1), 1);
+done = JUMP(SLJIT_JUMP);
+JUMPHERE(jump);
+
+OP2(SLJIT_LSHR, TMP2, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_SHIFT + UCD_STAGE2_SHIFT);
+OP1(SLJIT_MOV_U8, TMP2, 0, SLJIT_MEM1(TMP2), (sljit_sw)PRIV(ucd_stage1));
+OP2(SLJIT_SHL, TMP2, 0, TMP2, 0, SLJIT_IMM, UCD_BLOCK_SHIFT + UCD_STAGE2_SHIFT);
+OP2(SLJIT_AND, TMP1, 0, TMP1, 0, SLJIT_IMM, (1 << (UCD_BLOCK_SHIFT + UCD_STAGE2_SHIFT)) - 1);
+OP2(SLJIT_ADD, TMP2, 0, TMP2, 0, TMP1, 0);
+OP2(SLJIT_LSHR, TMP2, 0, TMP2, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
+OP2(SLJIT_AND, TMP1, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_SIZE - 1);
+OP2(SLJIT_SHL, TMP2, 0, TMP2, 0, SLJIT_IMM, 1);
+OP1(SLJIT_MOV_U16, TMP2, 0, SLJIT_MEM1(TMP2), (sljit_sw)PRIV(ucd_stage2));
+OP2(SLJIT_SHL, TMP2, 0, TMP2, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
+OP2(SLJIT_ADD, TMP1, 0, TMP1, 0, TMP2, 0);
+OP1(SLJIT_MOV, TMP2, 0, SLJIT_IMM, (sljit_sw)PRIV(ucd_stage3));
+OP1(SLJIT_MOV_U16, TMP2, 0, SLJIT_MEM2(TMP2, TMP1), 1);
+JUMPHERE(done);
+}
 
 static void do_getucd(compiler_common *common)
 {
@@ -3356,7 +3396,7 @@ SLJIT_ASSERT(record->script == ucp_Common && record->chartype == ucp_Cn && recor
 SLJIT_ASSERT(record->caseset == 0 && record->other_case == 0);
 #endif
 
-SLJIT_ASSERT(UCD_BLOCK_SIZE == 128 && sizeof(ucd_record) == 8);
+SLJIT_ASSERT(sizeof(ucd_record) == 8);
 
 sljit_emit_fast_enter(compiler, RETURN_ADDR, 0);
 
@@ -3369,13 +3409,7 @@ if (!common->utf)
   }
 #endif
 
-OP2(SLJIT_LSHR, TMP2, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
-OP1(SLJIT_MOV_U8, TMP2, 0, SLJIT_MEM1(TMP2), (sljit_sw)PRIV(ucd_stage1));
-OP2(SLJIT_AND, TMP1, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_MASK);
-OP2(SLJIT_SHL, TMP2, 0, TMP2, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
-OP2(SLJIT_ADD, TMP1, 0, TMP1, 0, TMP2, 0);
-OP1(SLJIT_MOV, TMP2, 0, SLJIT_IMM, (sljit_sw)PRIV(ucd_stage2));
-OP1(SLJIT_MOV_U16, TMP2, 0, SLJIT_MEM2(TMP2, TMP1), 1);
+read_ucd_record(common);
 OP1(SLJIT_MOV, TMP1, 0, SLJIT_IMM, (sljit_sw)PRIV(ucd_records) + SLJIT_OFFSETOF(ucd_record, chartype));
 OP1(SLJIT_MOV_U8, TMP1, 0, SLJIT_MEM2(TMP1, TMP2), 3);
 sljit_emit_fast_return(compiler, RETURN_ADDR, 0);
@@ -5820,13 +5854,7 @@ if (needstype || needsscript)
     }
 #endif
 
-  OP2(SLJIT_LSHR, TMP2, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
-  OP1(SLJIT_MOV_U8, TMP2, 0, SLJIT_MEM1(TMP2), (sljit_sw)PRIV(ucd_stage1));
-  OP2(SLJIT_AND, TMP1, 0, TMP1, 0, SLJIT_IMM, UCD_BLOCK_MASK);
-  OP2(SLJIT_SHL, TMP2, 0, TMP2, 0, SLJIT_IMM, UCD_BLOCK_SHIFT);
-  OP2(SLJIT_ADD, TMP1, 0, TMP1, 0, TMP2, 0);
-  OP1(SLJIT_MOV, TMP2, 0, SLJIT_IMM, (sljit_sw)PRIV(ucd_stage2));
-  OP1(SLJIT_MOV_U16, TMP2, 0, SLJIT_MEM2(TMP2, TMP1), 1);
+  read_ucd_record(common);
 
   /* Before anything else, we deal with scripts. */
   if (needsscript)
@@ -11774,6 +11802,276 @@ PRIV(jit_get_target)(void)
 return sljit_get_platform_name();
 }
 
+
+/*************************************************
+*       Check that JIT code can be executed      *
+*************************************************/
+
+/* The JIT compiler needs memory that is both writable and executable. On
+hardened systems (SELinux execmem denial, PaX MPROTECT, noexec mappings) the
+allocation fails, and on the ARM Thumb-2 backend a mismatched toolchain or a
+kernel that does not flush the instruction cache correctly can produce code
+that runs but gives wrong answers. Before the first JIT compilation we
+therefore compile a handful of representative patterns, run them with both the
+JIT code and the interpreter, and compare the results. If anything fails, JIT
+compilation is switched off for the lifetime of the process and pcre_study()
+quietly returns interpreter-only data, so callers need not care.
+
+The patterns are plain ASCII so that they can be widened for the 16-bit and
+32-bit libraries. */
+
+typedef struct jit_self_test_case {
+  const char *pattern;
+  int options;
+  const char *subject;
+} jit_self_test_case;
+
+static const jit_self_test_case jit_self_tests[] = {
+  { "^(?:[0-9a-fA-F]{2}:){5}[0-9a-fA-F]{2}$", 0, "00:1b:21:3c:4d:5e" },
+  { "^(?:[0-9a-fA-F]{2}:){5}[0-9a-fA-F]{2}$", 0, "00:1b:21:3c:4d:5" },
+  { "^(\\d{1,3})\\.(\\d{1,3})\\.(\\d{1,3})\\.(\\d{1,3})$", 0, "192.168.1.254" },
+  { "(a|ab)(c|bcd)(d*)", 0, "xxabcd" },
+  { "net(conf|opeer)\\d*", PCRE_CASELESS, "libNETOPEER2" },
+  { "(?:[a-z]+\\.)*[a-z]+\\.?", 0, "---www.example.com." },
+  { "^\\s*(\\w+)\\s*=\\s*(\\S*?)\\s*$", 0, "  name =  value  " },
+  { "(x+x+)+y", 0, "xxxxxxxxxxz" },
+  { "[^:]+:[^:]+$", 0, "a:b:c" }
+};
+
+#if defined COMPILE_PCRE8
+#define JIT_SELF_TEST_SPTR PCRE_SPTR
+#elif defined COMPILE_PCRE16
+#define JIT_SELF_TEST_SPTR PCRE_SPTR16
+#elif defined COMPILE_PCRE32
+#define JIT_SELF_TEST_SPTR PCRE_SPTR32
+#endif
+
+/* Widen an ASCII string into a zero-terminated code unit buffer. */
+
+static void
+jit_self_test_widen(pcre_uchar *buffer, const char *text)
+{
+while ((*buffer++ = (pcre_uchar)(unsigned char)*text++) != 0) {}
+}
+
+static BOOL
+jit_self_test(void)
+{
+pcre_uchar pattern[64];
+pcre_uchar subject[64];
+int jit_ovector[30];
+int int_ovector[30];
+unsigned int i;
+int j;
+
+for (i = 0; i < sizeof(jit_self_tests) / sizeof(jit_self_test_case); i++)
+  {
+  const jit_self_test_case *test = jit_self_tests + i;
+  REAL_PCRE *re;
+  PUBL(extra) *extra;
+  PUBL(extra) interpreter_extra;
+  const char *error;
+  int erroroffset;
+  int length;
+  int jit_rc, int_rc;
+
+  jit_self_test_widen(pattern, test->pattern);
+  jit_self_test_widen(subject, test->subject);
+  length = (int)strlen(test->subject);
+
+  re = (REAL_PCRE *)PUBL(compile)((JIT_SELF_TEST_SPTR)pattern, test->options,
+    &error, &erroroffset, NULL);
+  if (re == NULL) return FALSE;
+
+  /* Study without JIT, then JIT compile directly. Going through pcre_study()
+  would recurse back into the availability check. */
+
+  extra = PUBL(study)(re, PCRE_STUDY_EXTRA_NEEDED, &error);
+  if (extra == NULL)
+    {
+    (PUBL(free))(re);
+    return FALSE;
+    }
+  extra->executable_jit = NULL;
+  PRIV(jit_compile)(re, extra, JIT_COMPILE);
+
+  if (extra->executable_jit == NULL)
+    {
+    PUBL(free_study)(extra);
+    (PUBL(free))(re);
+    return FALSE;
+    }
+
+  interpreter_extra = *extra;
+  interpreter_extra.flags &= ~PCRE_EXTRA_EXECUTABLE_JIT;
+
+  for (j = 0; j < 30; j++) jit_ovector[j] = int_ovector[j] = -2;
+  jit_rc = PRIV(jit_exec)(extra, subject, length, 0, 0, jit_ovector, 30);
+  int_rc = PUBL(exec)(re, &interpreter_extra, (JIT_SELF_TEST_SPTR)subject,
+    length, 0, 0, int_ovector, 30);
+
+  PUBL(free_study)(extra);
+  (PUBL(free))(re);
+
+  if (jit_rc != int_rc) return FALSE;
+  for (j = 0; j < 2 * jit_rc; j++)
+    if (jit_ovector[j] != int_ovector[j]) return FALSE;
+  }
+
+return TRUE;
+}
+
+/* Returns TRUE if JIT compiled code can be used in this process. The check
+is done once; later calls return the cached answer. With pthreads the test is
+run by pthread_once(); on Windows the answer is read and published with
+interlocked operations, which are full barriers, and the test itself runs under
+the sljit lock. */
+
+#ifndef _WIN32
+
+#include <pthread.h>
+
+static pthread_once_t jit_usable_once = PTHREAD_ONCE_INIT;
+static BOOL jit_usable = FALSE;
+
+static void
+jit_usable_init(void)
+{
+jit_usable = jit_self_test();
+}
+
+BOOL
+PRIV(jit_usable)(void)
+{
+pthread_once(&jit_usable_once, jit_usable_init);
+return jit_usable;
+}
+
+#else  /* _WIN32 */
+
+static volatile LONG jit_usable = -1;
+
+BOOL
+PRIV(jit_usable)(void)
+{
+LONG usable = InterlockedCompareExchange(&jit_usable, -1, -1);
+if (usable < 0)
+  {
+  sljit_grab_lock();
+  usable = InterlockedCompareExchange(&jit_usable, -1, -1);
+  if (usable < 0)
+    {
+    usable = jit_self_test()? 1 : 0;
+    InterlockedExchange(&jit_usable, usable);
+    }
+  sljit_release_lock();
+  }
+return usable != 0;
+}
+
+#endif  /* _WIN32 */
+
+
+/*************************************************
+*          Per-thread JIT stack pool             *
+*************************************************/
+
+/* pcre_jit_thread_stack() is a ready-made callback for pcre_assign_jit_stack()
+that gives each calling thread its own JIT stack, created on first use. When a
+thread exits its stack goes back to a small pool instead of being unmapped, so
+that worker threads that come and go do not keep paying for mmap() and munmap().
+Without pthreads the callback returns NULL, which makes the JIT code use a
+32K block on the machine stack, as it does when no callback is set. */
+
+#ifndef _WIN32
+
+static pthread_once_t jit_stack_pool_once = PTHREAD_ONCE_INIT;
+static pthread_key_t jit_stack_pool_key;
+static BOOL jit_stack_pool_failed = FALSE;
+static pthread_mutex_t jit_stack_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct sljit_stack *jit_stack_pool[JIT_STACK_POOL_SIZE];
+static int jit_stack_pool_count = 0;
+
+static void
+jit_stack_pool_release(void *stack)
+{
+pthread_mutex_lock(&jit_stack_pool_mutex);
+if (jit_stack_pool_count < JIT_STACK_POOL_SIZE)
+  {
+  jit_stack_pool[jit_stack_pool_count++] = (struct sljit_stack *)stack;
+  stack = NULL;
+  }
+pthread_mutex_unlock(&jit_stack_pool_mutex);
+if (stack != NULL)
+  sljit_free_stack((struct sljit_stack *)stack, NULL);
+}
+
+static void
+jit_stack_pool_init(void)
+{
+if (pthread_key_create(&jit_stack_pool_key, jit_stack_pool_release) != 0)
+  jit_stack_pool_failed = TRUE;
+}
+
+static void
+jit_stack_pool_drain(void)
+{
+int count;
+struct sljit_stack *idle[JIT_STACK_POOL_SIZE];
+
+pthread_mutex_lock(&jit_stack_pool_mutex);
+count = jit_stack_pool_count;
+memcpy(idle, jit_stack_pool, count * sizeof(struct sljit_stack *));
+jit_stack_pool_count = 0;
+pthread_mutex_unlock(&jit_stack_pool_mutex);
+
+while (count > 0)
+  sljit_free_stack(idle[--count], NULL);
+}
+
+#endif  /* _WIN32 */
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DECL pcre_jit_stack *
+pcre_jit_thread_stack(void *userdata)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DECL pcre16_jit_stack *
+pcre16_jit_thread_stack(void *userdata)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DECL pcre32_jit_stack *
+pcre32_jit_thread_stack(void *userdata)
+#endif
+{
+#ifndef _WIN32
+struct sljit_stack *stack;
+
+(void)userdata;
+pthread_once(&jit_stack_pool_once, jit_stack_pool_init);
+if (jit_stack_pool_failed) return NULL;
+
+stack = (struct sljit_stack *)pthread_getspecific(jit_stack_pool_key);
+if (stack != NULL) return (PUBL(jit_stack) *)stack;
+
+pthread_mutex_lock(&jit_stack_pool_mutex);
+if (jit_stack_pool_count > 0)
+  stack = jit_stack_pool[--jit_stack_pool_count];
+pthread_mutex_unlock(&jit_stack_pool_mutex);
+
+if (stack == NULL)
+  stack = sljit_allocate_stack(JIT_THREAD_STACK_START, JIT_THREAD_STACK_MAX,
+    NULL);
+if (stack != NULL && pthread_setspecific(jit_stack_pool_key, stack) != 0)
+  {
+  sljit_free_stack(stack, NULL);
+  stack = NULL;
+  }
+return (PUBL(jit_stack) *)stack;
+#else
+(void)userdata;
+return NULL;
+#endif
+}
+
 #if defined COMPILE_PCRE8
 PCRE_EXP_DECL pcre_jit_stack *
 pcre_jit_stack_alloc(int startsize, int maxsize)
@@ -11842,6 +12140,9 @@ pcre32_jit_free_unused_memory(void)
 #endif
 {
 sljit_free_unused_memory_exec();
+#ifndef _WIN32
+jit_stack_pool_drain();
+#endif
 }
 
 #else  /* SUPPORT_JIT */
@@ -11908,6 +12209,21 @@ pcre32_jit_free_unused_memory(void)
 {
 }
 
+#if defined COMPILE_PCRE8
+PCRE_EXP_DECL pcre_jit_stack *
+pcre_jit_thread_stack(void *userdata)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DECL pcre16_jit_stack *
+pcre16_jit_thread_stack(void *userdata)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DECL pcre32_jit_stack *
+pcre32_jit_thread_stack(void *userdata)
+#endif
+{
+(void)userdata;
+return NULL;
+}
+
 #endif
 
 /* End of pcre_jit_compile.c */
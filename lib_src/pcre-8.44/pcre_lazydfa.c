@@ -0,0 +1,1944 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains the internal functions that build and run a lazy DFA
+for an anchored pattern. pcre_study() calls PRIV(lazy_dfa_compile)(), which
+turns the compiled pattern into a Thompson NFA, provided that it contains
+nothing that needs backtracking to get right: no back references, recursion,
+subroutine calls, callouts, assertions other than ^ and $, atomic groups,
+conditional groups or backtracking verbs. Bounded repeats of single items are
+written out in full. Possessive repeats of single items, and possessive groups
+with one branch in which every item matches in only one way, are accepted when
+nothing that can follow them could match their first character, which is the
+case for those that are made possessive automatically.
+
+DFA states (sets of NFA nodes) are made only when a subject first needs them,
+and the transitions between them are cached per equivalence class of character
+values below 256. The cache is bounded; once it is full, matching carries on by
+stepping through the NFA without caching, which is slower but still takes time
+proportional to the length of the subject. A DFA can only say whether there is
+a match and, when the pattern must match up to the end of the subject, where it
+ends, so pcre_exec() uses it only when that is all the caller wants, or to find
+out quickly that there is no match.
+
+The cache is shared by all the threads that use the study data, and is
+protected by a read-write lock. Lazy DFAs are not built on Windows. */
+
+
+/* Read-write locks are not declared by a strict C compiler without this. */
+
+#if !defined _WIN32 && !defined _XOPEN_SOURCE
+#define _XOPEN_SOURCE 600
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "pcre_internal.h"
+
+
+/* Limits on the size of a lazy DFA. Patterns whose NFA would need more nodes
+do not get one. */
+
+#define MAX_NODES        4000       /* NFA nodes */
+#define MAX_DEPTH        250        /* Nesting of groups */
+#define MAX_STATES       2000       /* Cached DFA states */
+#define MAX_CACHE_SIZE   (1024*1024)  /* Bytes of cached DFA states */
+#define HASH_SIZE        1024       /* Must be a power of 2 */
+
+/* Values for unknown transitions and for a full cache. */
+
+#define UNKNOWN          (-1)
+#define CACHE_FULL       (-2)
+
+/* The private structure name depends on the code unit width. */
+
+#if defined COMPILE_PCRE8
+#define LAZY_DFA_BLOCK real_pcre_lazy_dfa
+#elif defined COMPILE_PCRE16
+#define LAZY_DFA_BLOCK real_pcre16_lazy_dfa
+#elif defined COMPILE_PCRE32
+#define LAZY_DFA_BLOCK real_pcre32_lazy_dfa
+#endif
+
+/* Kinds of NFA node. The match node is always node 0. */
+
+enum { NODE_MATCH, NODE_ITEM, NODE_SPLIT, NODE_CIRC, NODE_EOD, NODE_EODN };
+
+#define MATCH_NODE 0
+
+/* Kinds of single character item. */
+
+enum { ITEM_CHAR, ITEM_CHAR2, ITEM_LCC, ITEM_NOT, ITEM_CTYPE, ITEM_NOT_CTYPE,
+  ITEM_ANY, ITEM_ALLANY, ITEM_HSPACE, ITEM_NOT_HSPACE, ITEM_VSPACE,
+  ITEM_NOT_VSPACE, ITEM_PROP, ITEM_NOTPROP, ITEM_CLASS, ITEM_NCLASS,
+  ITEM_XCLASS };
+
+/* Kinds of opcode that a single character item comes from. */
+
+enum { FROM_CHAR, FROM_CHARI, FROM_CHARI_REPEAT, FROM_NOT, FROM_NOTI,
+  FROM_TYPE };
+
+/* Bits for closure(), saying which assertions hold. */
+
+#define FOLLOW_CIRC      0x01
+#define FOLLOW_EOD       0x02
+#define FOLLOW_EODN      0x04
+
+/* Bits for the flags of a DFA state. */
+
+#define STATE_MATCH      0x01       /* Matched already */
+#define STATE_END_MATCH  0x02       /* Matches if at the end */
+#define STATE_NL_MATCH   0x04       /* Matches if only a newline is left */
+
+/* A single character item. The bitmap records which characters below 256 it
+matches, so that only larger characters need the full test. */
+
+typedef struct ldfa_item {
+  int type;                   /* ITEM_xxx */
+  pcre_uint32 c1;             /* Character, ctype bit or property type */
+  pcre_uint32 c2;             /* Other case or property value */
+  const pcre_uchar *data;     /* Class data in the compiled pattern */
+  pcre_uint8 bits[32];        /* Characters below 256 that match */
+} ldfa_item;
+
+typedef struct ldfa_node {
+  int type;                   /* NODE_xxx */
+  int item;                   /* Item for NODE_ITEM */
+  int out;                    /* Next node */
+  int out1;                   /* Alternative next node for NODE_SPLIT */
+} ldfa_node;
+
+/* A DFA state is a sorted set of the nodes that are not followed by closure()
+(items, the match node and end assertions). It is followed by its transitions,
+one per character class, and then by the set. */
+
+typedef struct ldfa_state {
+  int *next;                  /* Transitions, or UNKNOWN */
+  int *nodes;                 /* The set of NFA nodes */
+  int count;                  /* Number of nodes in the set */
+  int flags;                  /* STATE_xxx */
+  unsigned int hash;          /* Hash of the set */
+  int chain;                  /* Next state with the same hash bucket */
+} ldfa_state;
+
+/* Working space for closure() and step(). Each vector has room for every NFA
+node. */
+
+typedef struct ldfa_work {
+  unsigned int *marks;        /* Node visited if equal to stamp */
+  unsigned int stamp;
+  int *stack;
+  int *list;                  /* Nodes after a character */
+  int *set;                   /* Result of a step */
+  int *a, *b, *c;             /* Used by state_flags() */
+  int *cur, *nxt;             /* Used when matching without the cache */
+} ldfa_work;
+
+/* What the items need to know about the pattern. */
+
+typedef struct ldfa_context {
+  const pcre_uint8 *lcc;      /* Lower casing table */
+  const pcre_uint8 *fcc;      /* Flip casing table */
+  const pcre_uint8 *ctypes;   /* Character types table */
+  pcre_uint32 nl;             /* The newline character */
+  BOOL nl_ok;                 /* TRUE if newline is a single character */
+  BOOL utf;
+} ldfa_context;
+
+struct LAZY_DFA_BLOCK {
+  const REAL_PCRE *re;        /* The pattern it was built for */
+  ldfa_context cx;
+  ldfa_item *items;
+  ldfa_node *nodes;
+  int item_count;
+  int node_count;
+  int class_count;
+  BOOL has_eodn;              /* TRUE if there is a \Z or $ node */
+  BOOL end_forced;            /* TRUE if every match ends at the end */
+  int start;                  /* The initial state */
+  pcre_uint8 classmap[256];   /* Character class of each value below 256 */
+  ldfa_state **states;
+  int state_count;
+  int state_size;             /* Size of the states vector */
+  size_t cache_size;          /* Bytes used by states */
+  int *hash_heads;
+  ldfa_work work;             /* Used with the write lock held */
+#ifndef _WIN32
+  pthread_rwlock_t lock;
+#endif
+};
+
+/* The state of NFA construction. */
+
+typedef struct ldfa_build {
+  ldfa_context cx;
+  ldfa_item *items;
+  ldfa_node *nodes;
+  int item_count;
+  int node_count;
+  int item_size;              /* Sizes of the vectors */
+  int node_size;
+  int *possessive;            /* Pairs of (item, node after the repeat) */
+  int possessive_count;
+  int possessive_size;
+  const pcre_uchar **stack;   /* Items of the branches being compiled */
+  int stack_top;
+  int depth;
+  BOOL endonly;               /* PCRE_DOLLAR_ENDONLY */
+  BOOL has_eodn;
+} ldfa_build;
+
+/* Minimum and maximum for the first six repeat opcodes of each kind; -1 is
+unlimited. */
+
+static const int rep_min[] = { 0, 0, 1, 1, 0, 0 };
+static const int rep_max[] = { -1, -1, -1, -1, 1, 1 };
+
+
+
+#ifdef SUPPORT_UCP
+/*************************************************
+*          Test a Unicode property               *
+*************************************************/
+
+/* This mirrors the OP_PROP code in pcre_exec().
+
+Arguments:
+  c          the character
+  ptype      the property type
+  pvalue     the property value
+
+Returns:     TRUE if the character has the property
+*/
+
+static BOOL
+has_property(pcre_uint32 c, pcre_uint32 ptype, pcre_uint32 pvalue)
+{
+const ucd_record *prop = GET_UCD(c);
+const pcre_uint32 *cp;
+
+switch(ptype)
+  {
+  case PT_ANY:
+  return TRUE;
+
+  case PT_LAMP:
+  return prop->chartype == ucp_Lu || prop->chartype == ucp_Ll ||
+    prop->chartype == ucp_Lt;
+
+  case PT_GC:
+  return pvalue == PRIV(ucp_gentype)[prop->chartype];
+
+  case PT_PC:
+  return pvalue == prop->chartype;
+
+  case PT_SC:
+  return pvalue == prop->script;
+
+  case PT_ALNUM:
+  return PRIV(ucp_gentype)[prop->chartype] == ucp_L ||
+    PRIV(ucp_gentype)[prop->chartype] == ucp_N;
+
+  case PT_SPACE:    /* Perl space */
+  case PT_PXSPACE:  /* POSIX space */
+  switch(c)
+    {
+    HSPACE_CASES:
+    VSPACE_CASES:
+    return TRUE;
+
+    default:
+    return PRIV(ucp_gentype)[prop->chartype] == ucp_Z;
+    }
+
+  case PT_WORD:
+  return PRIV(ucp_gentype)[prop->chartype] == ucp_L ||
+    PRIV(ucp_gentype)[prop->chartype] == ucp_N || c == CHAR_UNDERSCORE;
+
+  case PT_CLIST:
+  cp = PRIV(ucd_caseless_sets) + pvalue;
+  for (;;)
+    {
+    if (c < *cp) return FALSE;
+    if (c == *cp++) return TRUE;
+    }
+
+  case PT_UCNC:
+  return c == CHAR_DOLLAR_SIGN || c == CHAR_COMMERCIAL_AT ||
+    c == CHAR_GRAVE_ACCENT || (c >= 0xa0 && c <= 0xd7ff) || c >= 0xe000;
+  }
+
+return FALSE;
+}
+#endif  /* SUPPORT_UCP */
+
+
+
+/*************************************************
+*        Test a character against an item        *
+*************************************************/
+
+/* Each case gives the same answer as pcre_exec() for the opcode that the item
+came from.
+
+Arguments:
+  cx         the pattern's context
+  item       the item
+  c          the character
+
+Returns:     TRUE if the character matches
+*/
+
+static BOOL
+item_match(const ldfa_context *cx, const ldfa_item *item, pcre_uint32 c)
+{
+switch(item->type)
+  {
+  case ITEM_CHAR:
+  return c == item->c1;
+
+  case ITEM_CHAR2:
+  return c == item->c1 || c == item->c2;
+
+  case ITEM_LCC:
+  if (cx->utf && c > 127) return FALSE;
+  return TABLE_GET(c, cx->lcc, c) == item->c1;
+
+  case ITEM_NOT:
+  return c != item->c1 && c != item->c2;
+
+  case ITEM_CTYPE:
+  return c < 256 && (cx->ctypes[c] & item->c1) != 0;
+
+  case ITEM_NOT_CTYPE:
+  return c > 255 || (cx->ctypes[c] & item->c1) == 0;
+
+  case ITEM_ANY:
+  return c != cx->nl;
+
+  case ITEM_ALLANY:
+  return TRUE;
+
+  case ITEM_HSPACE:
+  case ITEM_NOT_HSPACE:
+  switch(c)
+    {
+    HSPACE_CASES: return item->type == ITEM_HSPACE;
+    default: return item->type != ITEM_HSPACE;
+    }
+
+  case ITEM_VSPACE:
+  case ITEM_NOT_VSPACE:
+  switch(c)
+    {
+    VSPACE_CASES: return item->type == ITEM_VSPACE;
+    default: return item->type != ITEM_VSPACE;
+    }
+
+#ifdef SUPPORT_UCP
+  case ITEM_PROP:
+  case ITEM_NOTPROP:
+  return has_property(c, item->c1, item->c2) == (item->type == ITEM_PROP);
+#endif
+
+  case ITEM_CLASS:
+  case ITEM_NCLASS:
+  if (c > 255) return item->type == ITEM_NCLASS;
+  return (((const pcre_uint8 *)item->data)[c/8] & (1 << (c&7))) != 0;
+
+#if defined SUPPORT_UTF || !defined COMPILE_PCRE8
+  case ITEM_XCLASS:
+  return PRIV(xclass)(c, item->data, cx->utf);
+#endif
+  }
+
+return FALSE;
+}
+
+
+
+/*************************************************
+*     Check whether an item matches large chars  *
+*************************************************/
+
+/* This is used when checking possessive repeats. Character values above 255
+cannot occur in 8-bit non-UTF mode.
+
+Arguments:
+  cx         the pattern's context
+  item       the item
+  c          where to return the only large character it matches, if any
+
+Returns:     0 if it matches no character above 255, 1 if it matches at most
+             the one in *c, 2 if it may match more
+*/
+
+static int
+item_large(const ldfa_context *cx, const ldfa_item *item, pcre_uint32 *c)
+{
+#ifdef COMPILE_PCRE8
+if (!cx->utf) return 0;
+#else
+(void)cx;
+#endif
+switch(item->type)
+  {
+  case ITEM_CHAR:
+  case ITEM_LCC:
+  *c = item->c1;
+  return (item->c1 > 255)? 1 : 0;
+
+  case ITEM_CHAR2:
+  if (item->c1 > 255 && item->c2 > 255 && item->c1 != item->c2) return 2;
+  *c = (item->c1 > 255)? item->c1 : item->c2;
+  return (*c > 255)? 1 : 0;
+
+  case ITEM_CTYPE:
+  case ITEM_CLASS:
+  return 0;
+  }
+return 2;
+}
+
+
+
+/*************************************************
+*      Check whether two items can overlap       *
+*************************************************/
+
+static BOOL
+items_overlap(const ldfa_context *cx, const ldfa_item *a, const ldfa_item *b)
+{
+pcre_uint32 ca, cb;
+int la, lb, i;
+
+for (i = 0; i < 32; i++)
+  if ((a->bits[i] & b->bits[i]) != 0) return TRUE;
+la = item_large(cx, a, &ca);
+lb = item_large(cx, b, &cb);
+if (la == 0 || lb == 0) return FALSE;
+return la == 2 || lb == 2 || ca == cb;
+}
+
+
+
+/*************************************************
+*           Add a node or an item                *
+*************************************************/
+
+/*
+Arguments:
+  b          the build state
+  type       the node type
+  out        the next node
+  out1       the alternative next node
+
+Returns:     the node number, or -1 if there are too many nodes
+*/
+
+/* The vectors of the build state start small and are doubled when they fill
+up, so that a short pattern does not pay for the largest NFA that is allowed.
+
+Arguments:
+  vector     the vector
+  size       points to its size in entries, updated on success
+  unit       the size of an entry
+
+Returns:     the new vector, or NULL if it would exceed MAX_NODES entries or
+               there is no memory, in which case the old one is unchanged
+*/
+
+static void *
+grow_vector(void *vector, int *size, size_t unit)
+{
+void *yield;
+int newsize;
+
+if (*size >= MAX_NODES) return NULL;
+newsize = (*size > MAX_NODES / 2)? MAX_NODES : 2 * *size;
+yield = (PUBL(malloc))(newsize * unit);
+if (yield == NULL) return NULL;
+memcpy(yield, vector, *size * unit);
+(PUBL(free))(vector);
+*size = newsize;
+return yield;
+}
+
+/* Get room for one more item. Returns FALSE if there is none. */
+
+static BOOL
+room_for_item(ldfa_build *b)
+{
+ldfa_item *items;
+if (b->item_count < b->item_size) return TRUE;
+items = (ldfa_item *)grow_vector(b->items, &b->item_size, sizeof(ldfa_item));
+if (items == NULL) return FALSE;
+b->items = items;
+return TRUE;
+}
+
+/* Record a possessive repeat, to be checked when the NFA is complete. */
+
+static BOOL
+add_possessive(ldfa_build *b, int item, int next)
+{
+if (b->possessive_count >= b->possessive_size)
+  {
+  int *possessive = (int *)grow_vector(b->possessive, &b->possessive_size,
+    2 * sizeof(int));
+  if (possessive == NULL) return FALSE;
+  b->possessive = possessive;
+  }
+b->possessive[2 * b->possessive_count] = item;
+b->possessive[2 * b->possessive_count + 1] = next;
+b->possessive_count++;
+return TRUE;
+}
+
+static int
+new_node(ldfa_build *b, int type, int out, int out1)
+{
+ldfa_node *node;
+if (b->node_count >= b->node_size)
+  {
+  ldfa_node *nodes = (ldfa_node *)grow_vector(b->nodes, &b->node_size,
+    sizeof(ldfa_node));
+  if (nodes == NULL) return -1;
+  b->nodes = nodes;
+  }
+node = b->nodes + b->node_count;
+node->type = type;
+node->item = -1;
+node->out = out;
+node->out1 = out1;
+return b->node_count++;
+}
+
+static int
+new_item_node(ldfa_build *b, int item, int out)
+{
+int n = new_node(b, NODE_ITEM, out, -1);
+if (n >= 0) b->nodes[n].item = item;
+return n;
+}
+
+/* Set up an item from an opcode, and compute its bitmap.
+
+Arguments:
+  b          the build state
+  from       FROM_xxx, the kind of opcode
+  p          points to the character or to the type opcode
+
+Returns:     the item number, or -1 if the item is not supported
+*/
+
+static int
+new_item(ldfa_build *b, int from, const pcre_uchar *p)
+{
+ldfa_item *item;
+pcre_uint32 c, fc;
+#ifdef SUPPORT_UTF
+BOOL utf = b->cx.utf;
+#endif
+
+if (!room_for_item(b)) return -1;
+item = b->items + b->item_count;
+item->data = NULL;
+item->c2 = 0;
+
+switch(from)
+  {
+  case FROM_CHAR:
+  GETCHARTEST(fc, p);
+  item->type = ITEM_CHAR;
+  item->c1 = fc;
+  break;
+
+  /* A single caseless character is compared through the lower casing table,
+  except for UTF characters above 127. In UTF mode, pcre_exec() looks up the
+  first code unit of the subject character in the table, so give up if the
+  table could make that match. */
+
+  case FROM_CHARI:
+  GETCHARTEST(fc, p);
+#ifdef SUPPORT_UTF
+  if (utf && fc > 127)
+    {
+    item->type = ITEM_CHAR2;
+    item->c1 = fc;
+#ifdef SUPPORT_UCP
+    item->c2 = UCD_OTHERCASE(fc);
+#else
+    item->c2 = fc;
+#endif
+    break;
+    }
+  if (utf)
+    {
+    for (c = 128; c < 256; c++)
+      if (b->cx.lcc[c] == b->cx.lcc[fc]) return -1;
+    }
+#endif
+  item->type = ITEM_LCC;
+  item->c1 = TABLE_GET(fc, b->cx.lcc, fc);
+  break;
+
+  /* A repeated caseless character is compared with itself and its other
+  case. In 8-bit UTF mode the comparison is of code units, so give up if the
+  other case of an ASCII character is not ASCII. */
+
+  case FROM_CHARI_REPEAT:
+  GETCHARTEST(fc, p);
+  item->type = ITEM_CHAR2;
+  item->c1 = fc;
+#ifdef SUPPORT_UTF
+  if (utf && fc > 127)
+#ifdef SUPPORT_UCP
+    item->c2 = UCD_OTHERCASE(fc);
+#else
+    item->c2 = fc;
+#endif
+  else
+#endif
+    item->c2 = TABLE_GET(fc, b->cx.fcc, fc);
+#if defined COMPILE_PCRE8 && defined SUPPORT_UTF
+  if (utf && fc < 128 && item->c2 > 127) return -1;
+#endif
+  break;
+
+  case FROM_NOT:
+  case FROM_NOTI:
+  GETCHARTEST(fc, p);
+  item->type = ITEM_NOT;
+  item->c1 = item->c2 = fc;
+  if (from == FROM_NOTI)
+    {
+#ifdef SUPPORT_UTF
+    if (utf && fc > 127)
+#ifdef SUPPORT_UCP
+      item->c2 = UCD_OTHERCASE(fc);
+#else
+      item->c2 = fc;
+#endif
+    else
+#endif
+      item->c2 = TABLE_GET(fc, b->cx.fcc, fc);
+    }
+  break;
+
+  case FROM_TYPE:
+  switch(*p)
+    {
+    case OP_NOT_DIGIT: item->type = ITEM_NOT_CTYPE; item->c1 = ctype_digit;
+    break;
+    case OP_DIGIT: item->type = ITEM_CTYPE; item->c1 = ctype_digit; break;
+    case OP_NOT_WHITESPACE: item->type = ITEM_NOT_CTYPE;
+    item->c1 = ctype_space; break;
+    case OP_WHITESPACE: item->type = ITEM_CTYPE; item->c1 = ctype_space;
+    break;
+    case OP_NOT_WORDCHAR: item->type = ITEM_NOT_CTYPE;
+    item->c1 = ctype_word; break;
+    case OP_WORDCHAR: item->type = ITEM_CTYPE; item->c1 = ctype_word; break;
+    case OP_NOT_HSPACE: item->type = ITEM_NOT_HSPACE; break;
+    case OP_HSPACE: item->type = ITEM_HSPACE; break;
+    case OP_NOT_VSPACE: item->type = ITEM_NOT_VSPACE; break;
+    case OP_VSPACE: item->type = ITEM_VSPACE; break;
+    case OP_ALLANY: item->type = ITEM_ALLANY; break;
+
+    case OP_ANY:
+    if (!b->cx.nl_ok) return -1;
+    item->type = ITEM_ANY;
+    break;
+
+    /* \C is a single code unit, which is only a character in non-UTF
+    mode. */
+
+    case OP_ANYBYTE:
+#ifdef SUPPORT_UTF
+    if (utf) return -1;
+#endif
+    item->type = ITEM_ALLANY;
+    break;
+
+#ifdef SUPPORT_UCP
+    case OP_PROP:
+    case OP_NOTPROP:
+    switch(p[1])
+      {
+      case PT_ANY: case PT_LAMP: case PT_GC: case PT_PC: case PT_SC:
+      case PT_ALNUM: case PT_SPACE: case PT_PXSPACE: case PT_WORD:
+      case PT_CLIST: case PT_UCNC:
+      break;
+
+      default:
+      return -1;
+      }
+    item->type = (*p == OP_PROP)? ITEM_PROP : ITEM_NOTPROP;
+    item->c1 = p[1];
+    item->c2 = p[2];
+    break;
+#endif
+
+    default:
+    return -1;
+    }
+  break;
+
+  default:
+  return -1;
+  }
+
+for (c = 0; c < 256; c++)
+  {
+  if (item_match(&b->cx, item, c)) item->bits[c/8] |= (1 << (c&7));
+    else item->bits[c/8] &= ~(1 << (c&7));
+  }
+return b->item_count++;
+}
+
+/* Set up an item for a class. */
+
+static int
+new_class_item(ldfa_build *b, const pcre_uchar *code)
+{
+ldfa_item *item;
+pcre_uint32 c;
+
+if (!room_for_item(b)) return -1;
+item = b->items + b->item_count;
+item->c1 = item->c2 = 0;
+switch(*code)
+  {
+  case OP_CLASS:
+  item->type = ITEM_CLASS;
+  item->data = code + 1;
+  break;
+
+  case OP_NCLASS:
+  item->type = ITEM_NCLASS;
+  item->data = code + 1;
+  break;
+
+#if defined SUPPORT_UTF || !defined COMPILE_PCRE8
+  case OP_XCLASS:
+  item->type = ITEM_XCLASS;
+  item->data = code + 1 + LINK_SIZE;
+  break;
+#endif
+
+  default:
+  return -1;
+  }
+
+for (c = 0; c < 256; c++)
+  {
+  if (item_match(&b->cx, item, c)) item->bits[c/8] |= (1 << (c&7));
+    else item->bits[c/8] &= ~(1 << (c&7));
+  }
+return b->item_count++;
+}
+
+
+
+/*************************************************
+*          Find the end of an item               *
+*************************************************/
+
+/* An item is a group with any BRAZERO in front of it, an assertion, or a
+single character item with any repeat.
+
+Arguments:
+  code       points to the item
+  utf        TRUE in UTF mode
+
+Returns:     pointer to the next item, or NULL if the item is not supported
+*/
+
+static const pcre_uchar *
+item_end(const pcre_uchar *code, BOOL utf)
+{
+pcre_uchar op = *code;
+
+(void)utf;
+switch(op)
+  {
+  case OP_BRA:
+  case OP_BRAPOS:
+  case OP_CBRA:
+  case OP_CBRAPOS:
+  case OP_SBRA:
+  case OP_SCBRA:
+  do code += GET(code, 1); while (*code == OP_ALT);
+  return code + 1 + LINK_SIZE;
+
+  case OP_BRAZERO:
+  case OP_BRAMINZERO:
+  case OP_BRAPOSZERO:
+  case OP_SKIPZERO:
+  return item_end(code + 1, utf);
+
+  case OP_CIRC:
+  case OP_SOD:
+  case OP_DOLL:
+  case OP_EOD:
+  case OP_EODN:
+  case OP_NOT_DIGIT:
+  case OP_DIGIT:
+  case OP_NOT_WHITESPACE:
+  case OP_WHITESPACE:
+  case OP_NOT_WORDCHAR:
+  case OP_WORDCHAR:
+  case OP_ANY:
+  case OP_ALLANY:
+  case OP_ANYBYTE:
+  case OP_NOT_HSPACE:
+  case OP_HSPACE:
+  case OP_NOT_VSPACE:
+  case OP_VSPACE:
+  return code + 1;
+
+  case OP_PROP:
+  case OP_NOTPROP:
+  return code + 3;
+
+  case OP_CLASS:
+  case OP_NCLASS:
+  case OP_XCLASS:
+  code += (op == OP_XCLASS)? GET(code, 1) : PRIV(OP_lengths)[op];
+  if (*code >= OP_CRSTAR && *code <= OP_CRPOSRANGE)
+    code += PRIV(OP_lengths)[*code];
+  return code;
+  }
+
+if (op >= OP_CHAR && op <= OP_NOTPOSUPTOI)
+  {
+  code += PRIV(OP_lengths)[op];
+#ifdef SUPPORT_UTF
+  if (utf && HAS_EXTRALEN(code[-1])) code += GET_EXTRALEN(code[-1]);
+#endif
+  return code;
+  }
+
+if (op >= OP_TYPESTAR && op <= OP_TYPEPOSUPTO)
+  {
+  code += PRIV(OP_lengths)[op];
+  if (code[-1] == OP_PROP || code[-1] == OP_NOTPROP) code += 2;
+  return code;
+  }
+
+return NULL;
+}
+
+
+
+/*************************************************
+*     Compile a single character item            *
+*************************************************/
+
+/* The NFA is built backwards: each function is given the node that follows
+what it compiles, and returns the node at which it starts.
+
+Arguments:
+  b          the build state
+  code       points to the item
+  next       the node that follows
+
+Returns:     the first node of the item, or -1 on failure
+*/
+
+static int
+compile_repeat(ldfa_build *b, const pcre_uchar *code, int next)
+{
+pcre_uchar op = *code;
+const pcre_uchar *p = code + 1;
+int min = 1, max = 1, item, from, r, i;
+BOOL possessive = FALSE;
+
+if (op == OP_CLASS || op == OP_NCLASS || op == OP_XCLASS)
+  {
+  item = new_class_item(b, code);
+  p = code + ((op == OP_XCLASS)? GET(code, 1) : PRIV(OP_lengths)[op]);
+  if (*p >= OP_CRSTAR && *p <= OP_CRPOSRANGE)
+    {
+    r = *p - OP_CRSTAR;
+    if (r >= OP_CRPOSSTAR - OP_CRSTAR)
+      {
+      possessive = TRUE;
+      r -= OP_CRPOSSTAR - OP_CRSTAR;
+      if (r == 3) r = OP_CRRANGE - OP_CRSTAR; else r *= 2;
+      }
+    if (r < 6)
+      {
+      min = rep_min[r];
+      max = rep_max[r];
+      }
+    else
+      {
+      min = GET2(p, 1);
+      max = GET2(p, 1 + IMM2_SIZE);
+      if (max == 0) max = -1;
+      }
+    }
+  }
+
+else
+  {
+  if (op >= OP_STAR && op <= OP_TYPEPOSUPTO)
+    {
+    if (op < OP_STARI) { from = FROM_CHAR; r = op - OP_STAR; }
+    else if (op < OP_NOTSTAR) { from = FROM_CHARI_REPEAT; r = op - OP_STARI; }
+    else if (op < OP_NOTSTARI) { from = FROM_NOT; r = op - OP_NOTSTAR; }
+    else if (op < OP_TYPESTAR) { from = FROM_NOTI; r = op - OP_NOTSTARI; }
+    else { from = FROM_TYPE; r = op - OP_TYPESTAR; }
+
+    if (r < 6)
+      {
+      min = rep_min[r];
+      max = rep_max[r];
+      }
+    else if (r < OP_POSSTAR - OP_STAR)
+      {
+      max = GET2(p, 0);
+      min = (r == OP_EXACT - OP_STAR)? max : 0;
+      p += IMM2_SIZE;
+      }
+    else
+      {
+      possessive = TRUE;
+      if (r == OP_POSUPTO - OP_STAR)
+        {
+        min = 0;
+        max = GET2(p, 0);
+        p += IMM2_SIZE;
+        }
+      else
+        {
+        min = rep_min[(r - (OP_POSSTAR - OP_STAR)) * 2];
+        max = rep_max[(r - (OP_POSSTAR - OP_STAR)) * 2];
+        }
+      }
+    }
+
+  else switch(op)
+    {
+    case OP_CHAR: from = FROM_CHAR; break;
+    case OP_CHARI: from = FROM_CHARI; break;
+    case OP_NOT: from = FROM_NOT; break;
+    case OP_NOTI: from = FROM_NOTI; break;
+    default: from = FROM_TYPE; p = code; break;
+    }
+
+  item = new_item(b, from, p);
+  }
+
+if (item < 0) return -1;
+
+/* A possessive repeat is treated as greedy, which is correct if the item
+cannot match the first character of what follows it. This is checked when the
+NFA is complete. */
+
+if (possessive && (max < 0 || max > min) && !add_possessive(b, item, next))
+  return -1;
+
+/* The optional part: a loop for an unlimited repeat, or a chain of optional
+items. */
+
+if (max < 0)
+  {
+  int loop = new_node(b, NODE_SPLIT, -1, next);
+  int n = (loop < 0)? -1 : new_item_node(b, item, loop);
+  if (n < 0) return -1;
+  b->nodes[loop].out = n;
+  next = loop;
+  }
+else
+  {
+  int exit = next;
+  for (i = min; i < max; i++)
+    {
+    int n = new_item_node(b, item, next);
+    if (n < 0 || (next = new_node(b, NODE_SPLIT, n, exit)) < 0) return -1;
+    }
+  }
+
+/* The required part. */
+
+for (i = 0; i < min; i++)
+  if ((next = new_item_node(b, item, next)) < 0) return -1;
+
+return next;
+}
+
+
+
+/*************************************************
+*     Check that an item matches one way         *
+*************************************************/
+
+/* Used for the items of a possessive group. Possessive repeats count, because
+they are checked separately.
+
+Arguments:
+  code       points to the item
+
+Returns:     TRUE if the item is not a group and has no variable repeat
+*/
+
+static BOOL
+item_is_fixed(const pcre_uchar *code)
+{
+pcre_uchar op = *code;
+int r;
+
+if (op == OP_CLASS || op == OP_NCLASS || op == OP_XCLASS)
+  {
+  code += (op == OP_XCLASS)? GET(code, 1) : PRIV(OP_lengths)[op];
+  if (*code == OP_CRRANGE || *code == OP_CRMINRANGE)
+    return GET2(code, 1) == GET2(code, 1 + IMM2_SIZE);
+  return *code < OP_CRSTAR || *code > OP_CRMINQUERY;
+  }
+
+if (op >= OP_STAR && op <= OP_TYPEPOSUPTO)
+  {
+  if (op < OP_STARI) r = op - OP_STAR;
+  else if (op < OP_NOTSTAR) r = op - OP_STARI;
+  else if (op < OP_NOTSTARI) r = op - OP_NOTSTAR;
+  else if (op < OP_TYPESTAR) r = op - OP_NOTSTARI;
+  else r = op - OP_TYPESTAR;
+  return r >= OP_EXACT - OP_STAR;
+  }
+
+return op < OP_ASSERT || op > OP_BRAPOSZERO;
+}
+
+
+
+/*************************************************
+*            Compile a group                     *
+*************************************************/
+
+/* A group repeated without limit ends with KETRMAX or KETRMIN; limited repeats
+have already been written out by pcre_compile(), using BRAZERO for the optional
+copies. Minimizing repeats are treated as maximizing, which makes no difference
+to whether there is a match. A possessive group is treated as greedy, which is
+correct if each iteration can match in only one way and the first item cannot
+match the first character of what follows the group; the second part is
+checked when the NFA is complete, as for possessive single items.
+
+Arguments:
+  b          the build state
+  code       points to the bracket opcode
+  next       the node that follows
+
+Returns:     the first node of the group, or -1 on failure
+*/
+
+static int compile_branch(ldfa_build *, const pcre_uchar *, const pcre_uchar *,
+  int);
+
+static int
+compile_group(ldfa_build *b, const pcre_uchar *code, int next)
+{
+const pcre_uchar *ket = code;
+const pcre_uchar *start;
+pcre_uchar op = *code;
+int loop = -1, entry = -1;
+
+if (op != OP_BRA && op != OP_CBRA && op != OP_SBRA && op != OP_SCBRA &&
+    op != OP_BRAPOS && op != OP_CBRAPOS)
+  return -1;
+if (++b->depth > MAX_DEPTH) return -1;
+
+do ket += GET(ket, 1); while (*ket == OP_ALT);
+if (*ket == OP_KETRMAX || *ket == OP_KETRMIN || *ket == OP_KETRPOS)
+  {
+  if ((loop = new_node(b, NODE_SPLIT, -1, next)) < 0) return -1;
+  }
+else if (*ket != OP_KET) return -1;
+
+start = code + 1 + LINK_SIZE;
+if (op == OP_CBRA || op == OP_SCBRA || op == OP_CBRAPOS) start += IMM2_SIZE;
+
+if (*ket == OP_KETRPOS)
+  {
+  const pcre_uchar *p;
+  if (code + GET(code, 1) != ket) return -1;
+  for (p = start; p < ket;)
+    if (!item_is_fixed(p) || (p = item_end(p, b->cx.utf)) == NULL) return -1;
+  }
+
+for (;;)
+  {
+  const pcre_uchar *end = code + GET(code, 1);
+  int n = compile_branch(b, start, end, (loop >= 0)? loop : next);
+  if (n < 0) return -1;
+  if (entry < 0) entry = n;
+    else if ((entry = new_node(b, NODE_SPLIT, n, entry)) < 0) return -1;
+  if (*end != OP_ALT) break;
+  code = end;
+  start = end + 1 + LINK_SIZE;
+  }
+
+if (*ket == OP_KETRPOS)
+  {
+  if (b->nodes[entry].type != NODE_ITEM ||
+      !add_possessive(b, b->nodes[entry].item, next)) return -1;
+  }
+
+if (loop >= 0) b->nodes[loop].out = entry;
+b->depth--;
+return entry;
+}
+
+
+
+/*************************************************
+*            Compile an item                     *
+*************************************************/
+
+static int
+compile_item(ldfa_build *b, const pcre_uchar *code, int next)
+{
+int n;
+
+switch(*code)
+  {
+  case OP_BRA:
+  case OP_BRAPOS:
+  case OP_CBRA:
+  case OP_CBRAPOS:
+  case OP_SBRA:
+  case OP_SCBRA:
+  return compile_group(b, code, next);
+
+  case OP_BRAZERO:
+  case OP_BRAMINZERO:
+  case OP_BRAPOSZERO:
+  n = compile_group(b, code + 1, next);
+  return (n < 0)? -1 : new_node(b, NODE_SPLIT, n, next);
+
+  case OP_SKIPZERO:
+  return next;
+
+  case OP_CIRC:
+  case OP_SOD:
+  return new_node(b, NODE_CIRC, next, -1);
+
+  case OP_DOLL:
+  if (b->endonly) return new_node(b, NODE_EOD, next, -1);
+  /* Fall through */
+
+  case OP_EODN:
+  if (!b->cx.nl_ok) return -1;
+  b->has_eodn = TRUE;
+  return new_node(b, NODE_EODN, next, -1);
+
+  case OP_EOD:
+  return new_node(b, NODE_EOD, next, -1);
+  }
+
+return compile_repeat(b, code, next);
+}
+
+
+
+/*************************************************
+*            Compile a branch                    *
+*************************************************/
+
+/*
+Arguments:
+  b          the build state
+  code       the start of the branch
+  end        the OP_ALT or OP_KET... that ends it
+  next       the node that follows
+
+Returns:     the first node of the branch, or -1 on failure
+*/
+
+static int
+compile_branch(ldfa_build *b, const pcre_uchar *code, const pcre_uchar *end,
+  int next)
+{
+int base = b->stack_top;
+int i;
+
+while (code < end)
+  {
+  b->stack[b->stack_top++] = code;
+  code = item_end(code, b->cx.utf);
+  if (code == NULL || code > end)
+    {
+    b->stack_top = base;
+    return -1;
+    }
+  }
+
+for (i = b->stack_top - 1; i >= base && next >= 0; i--)
+  next = compile_item(b, b->stack[i], next);
+b->stack_top = base;
+return next;
+}
+
+
+
+/*************************************************
+*           Follow empty transitions             *
+*************************************************/
+
+/* Adds to a set every node that can be reached from the given nodes without
+reading a character. Items, the match node and end assertions are kept; split
+nodes and ^ are not. The assertions that hold are followed.
+
+Arguments:
+  nodes      the NFA
+  count      number of NFA nodes
+  w          working space
+  from       the starting nodes
+  n          number of starting nodes
+  out        where to put the set
+  mode       FOLLOW_xxx bits
+
+Returns:     the size of the set
+*/
+
+static void
+new_stamp(ldfa_work *w, int count)
+{
+if (++w->stamp == 0)
+  {
+  memset(w->marks, 0, count * sizeof(unsigned int));
+  w->stamp = 1;
+  }
+}
+
+static int
+closure(const ldfa_node *nodes, int count, ldfa_work *w, const int *from,
+  int n, int *out, int mode)
+{
+int i, size = 0, sp = 0;
+
+new_stamp(w, count);
+for (i = 0; i < n; i++)
+  {
+  if (from[i] < 0 || w->marks[from[i]] == w->stamp) continue;
+  w->marks[from[i]] = w->stamp;
+  w->stack[sp++] = from[i];
+
+  while (sp > 0)
+    {
+    int k = w->stack[--sp];
+    const ldfa_node *node = nodes + k;
+    int follow = -1;
+
+    switch(node->type)
+      {
+      case NODE_SPLIT:
+      if (node->out1 >= 0 && w->marks[node->out1] != w->stamp)
+        {
+        w->marks[node->out1] = w->stamp;
+        w->stack[sp++] = node->out1;
+        }
+      follow = node->out;
+      break;
+
+      case NODE_CIRC:
+      if ((mode & FOLLOW_CIRC) != 0) follow = node->out;
+      break;
+
+      case NODE_EOD:
+      out[size++] = k;
+      if ((mode & FOLLOW_EOD) != 0) follow = node->out;
+      break;
+
+      case NODE_EODN:
+      out[size++] = k;
+      if ((mode & FOLLOW_EODN) != 0) follow = node->out;
+      break;
+
+      default:   /* NODE_ITEM and NODE_MATCH */
+      out[size++] = k;
+      break;
+      }
+
+    if (follow >= 0 && w->marks[follow] != w->stamp)
+      {
+      w->marks[follow] = w->stamp;
+      w->stack[sp++] = follow;
+      }
+    }
+  }
+
+return size;
+}
+
+
+
+/*************************************************
+*    Check whether every match ends at the end   *
+*************************************************/
+
+/* This is so if the match node cannot be reached without passing \z or an
+"end only" $.
+
+Arguments:
+  nodes      the NFA
+  count      number of NFA nodes
+  w          working space
+  start      the first node
+
+Returns:     TRUE if every match ends at the end of the subject
+*/
+
+static BOOL
+end_forced(const ldfa_node *nodes, int count, ldfa_work *w, int start)
+{
+int sp = 0;
+
+new_stamp(w, count);
+w->marks[start] = w->stamp;
+w->stack[sp++] = start;
+
+while (sp > 0)
+  {
+  const ldfa_node *node = nodes + w->stack[--sp];
+  if (node->type == NODE_MATCH) return FALSE;
+  if (node->type == NODE_EOD) continue;
+  if (node->type == NODE_SPLIT && w->marks[node->out1] != w->stamp)
+    {
+    w->marks[node->out1] = w->stamp;
+    w->stack[sp++] = node->out1;
+    }
+  if (w->marks[node->out] != w->stamp)
+    {
+    w->marks[node->out] = w->stamp;
+    w->stack[sp++] = node->out;
+    }
+  }
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*       Move a set of nodes past a character     *
+*************************************************/
+
+static int
+step(const struct LAZY_DFA_BLOCK *dfa, ldfa_work *w, const int *set, int n,
+  pcre_uint32 c, int *out)
+{
+int i, m = 0;
+
+for (i = 0; i < n; i++)
+  {
+  const ldfa_node *node = dfa->nodes + set[i];
+  const ldfa_item *item;
+  if (node->type != NODE_ITEM) continue;
+  item = dfa->items + node->item;
+  if ((c < 256)? (item->bits[c/8] & (1 << (c&7))) != 0 :
+      item_match(&dfa->cx, item, c))
+    w->list[m++] = node->out;
+  }
+
+return closure(dfa->nodes, dfa->node_count, w, w->list, m, out, 0);
+}
+
+
+
+/*************************************************
+*           Compute the flags of a state         *
+*************************************************/
+
+static BOOL
+has_match(const int *set, int n)
+{
+int i;
+for (i = 0; i < n; i++) if (set[i] == MATCH_NODE) return TRUE;
+return FALSE;
+}
+
+/* The set must not be in any of the vectors of the working space.
+
+Arguments:
+  dfa        the DFA
+  w          working space
+  set        the set of nodes
+  n          the size of the set
+
+Returns:     STATE_xxx bits
+*/
+
+static int
+state_flags(const struct LAZY_DFA_BLOCK *dfa, ldfa_work *w, const int *set,
+  int n)
+{
+int flags = 0, m;
+
+if (has_match(set, n)) flags |= STATE_MATCH;
+
+m = closure(dfa->nodes, dfa->node_count, w, set, n, w->a,
+  FOLLOW_EOD|FOLLOW_EODN);
+if (has_match(w->a, m)) flags |= STATE_END_MATCH;
+
+/* If the only character left is a newline, \Z and $ hold before it as well
+as after it. */
+
+if (dfa->has_eodn)
+  {
+  m = closure(dfa->nodes, dfa->node_count, w, set, n, w->a, FOLLOW_EODN);
+  if (has_match(w->a, m)) flags |= STATE_NL_MATCH; else
+    {
+    m = step(dfa, w, w->a, m, dfa->cx.nl, w->b);
+    m = closure(dfa->nodes, dfa->node_count, w, w->b, m, w->c,
+      FOLLOW_EOD|FOLLOW_EODN);
+    if (has_match(w->c, m)) flags |= STATE_NL_MATCH;
+    }
+  }
+
+return flags;
+}
+
+
+
+/*************************************************
+*        Find or add a state in the cache        *
+*************************************************/
+
+static int
+compare_nodes(const void *a, const void *b)
+{
+return *(const int *)a - *(const int *)b;
+}
+
+/* This is called with the write lock held.
+
+Arguments:
+  dfa        the DFA
+  set        the set of nodes, which is sorted in place
+  n          the size of the set
+
+Returns:     the state number, or CACHE_FULL
+*/
+
+static int
+find_state(struct LAZY_DFA_BLOCK *dfa, int *set, int n)
+{
+unsigned int hash = 2166136261u;
+ldfa_state *st;
+size_t size;
+int i, k;
+
+qsort(set, n, sizeof(int), compare_nodes);
+for (i = 0; i < n; i++) hash = (hash ^ (unsigned int)set[i]) * 16777619u;
+
+for (k = dfa->hash_heads[hash & (HASH_SIZE - 1)]; k >= 0; k = st->chain)
+  {
+  st = dfa->states[k];
+  if (st->hash == hash && st->count == n &&
+      memcmp(st->nodes, set, n * sizeof(int)) == 0)
+    return k;
+  }
+
+size = sizeof(ldfa_state) + (dfa->class_count + n) * sizeof(int);
+if (dfa->state_count >= MAX_STATES || dfa->cache_size + size > MAX_CACHE_SIZE)
+  return CACHE_FULL;
+
+if (dfa->state_count >= dfa->state_size)
+  {
+  ldfa_state **states = (ldfa_state **)(PUBL(malloc))
+    (2 * dfa->state_size * sizeof(ldfa_state *));
+  if (states == NULL) return CACHE_FULL;
+  memcpy(states, dfa->states, dfa->state_count * sizeof(ldfa_state *));
+  (PUBL(free))(dfa->states);
+  dfa->states = states;
+  dfa->state_size *= 2;
+  }
+
+st = (ldfa_state *)(PUBL(malloc))(size);
+if (st == NULL) return CACHE_FULL;
+st->next = (int *)(st + 1);
+st->nodes = st->next + dfa->class_count;
+for (i = 0; i < dfa->class_count; i++) st->next[i] = UNKNOWN;
+memcpy(st->nodes, set, n * sizeof(int));
+st->count = n;
+st->hash = hash;
+st->flags = state_flags(dfa, &dfa->work, st->nodes, n);
+
+k = dfa->state_count++;
+st->chain = dfa->hash_heads[hash & (HASH_SIZE - 1)];
+dfa->hash_heads[hash & (HASH_SIZE - 1)] = k;
+dfa->states[k] = st;
+dfa->cache_size += size;
+return k;
+}
+
+
+
+/*************************************************
+*        Compute a transition                    *
+*************************************************/
+
+/* This is called with the write lock held. Another thread may have filled in
+the transition since this one looked. If the cache is full, the set of nodes
+for the next state is left in dfa->work.set.
+
+Arguments:
+  dfa        the DFA
+  s          the current state
+  c          the character
+
+Returns:     the next state, or CACHE_FULL
+*/
+
+static int
+next_state(struct LAZY_DFA_BLOCK *dfa, int s, pcre_uint32 c)
+{
+ldfa_state *st = dfa->states[s];
+int t, n;
+
+if (c < 256 && (t = st->next[dfa->classmap[c]]) != UNKNOWN) return t;
+n = step(dfa, &dfa->work, st->nodes, st->count, c, dfa->work.set);
+t = find_state(dfa, dfa->work.set, n);
+if (t >= 0 && c < 256) st->next[dfa->classmap[c]] = t;
+return t;
+}
+
+
+
+/*************************************************
+*        Get working space                       *
+*************************************************/
+
+/*
+Arguments:
+  count      number of NFA nodes
+  uncached   TRUE to include the vectors for matching without the cache
+
+Returns:     the working space, which is freed with one call of PUBL(free),
+             or NULL
+*/
+
+static ldfa_work *
+get_work(int count, BOOL uncached)
+{
+int vectors = uncached? 8 : 6;
+ldfa_work *w = (ldfa_work *)(PUBL(malloc))(sizeof(ldfa_work) +
+  (vectors + 1) * count * sizeof(int));
+int *v;
+
+if (w == NULL) return NULL;
+w->marks = (unsigned int *)(w + 1);
+memset(w->marks, 0, count * sizeof(unsigned int));
+w->stamp = 0;
+v = (int *)(w->marks + count);
+w->stack = v;
+w->list = v + count;
+w->set = v + 2 * count;
+w->a = v + 3 * count;
+w->b = v + 4 * count;
+w->c = v + 5 * count;
+w->cur = uncached? v + 6 * count : NULL;
+w->nxt = uncached? v + 7 * count : NULL;
+return w;
+}
+
+
+
+/*************************************************
+*         Match without the cache                *
+*************************************************/
+
+/* This carries on from a set of nodes, stepping through the NFA for each
+character. It needs no lock.
+
+Arguments:
+  dfa        the DFA
+  w          working space, with the current set in w->cur
+  n          the size of the set
+  p          the current position
+  end        the end of the subject
+
+Returns:     LAZY_DFA_MATCH or LAZY_DFA_NOMATCH
+*/
+
+static int
+match_uncached(const struct LAZY_DFA_BLOCK *dfa, ldfa_work *w, int n,
+  PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+#if defined SUPPORT_UTF && !defined COMPILE_PCRE32
+BOOL utf = dfa->cx.utf;
+#endif
+
+for (;;)
+  {
+  pcre_uint32 c;
+  int *swap;
+
+  if (has_match(w->cur, n)) return LAZY_DFA_MATCH;
+  if (n == 0) return LAZY_DFA_NOMATCH;
+  if (p >= end)
+    return ((state_flags(dfa, w, w->cur, n) & STATE_END_MATCH) != 0)?
+      LAZY_DFA_MATCH : LAZY_DFA_NOMATCH;
+  if (dfa->has_eodn && p == end - 1 && *p == dfa->cx.nl)
+    return ((state_flags(dfa, w, w->cur, n) & STATE_NL_MATCH) != 0)?
+      LAZY_DFA_MATCH : LAZY_DFA_NOMATCH;
+
+  GETCHARINCTEST(c, p);
+  n = step(dfa, w, w->cur, n, c, w->nxt);
+  swap = w->cur;
+  w->cur = w->nxt;
+  w->nxt = swap;
+  }
+}
+
+
+
+/*************************************************
+*       Build the NFA and the first states       *
+*************************************************/
+
+/* Called by pcre_study() for an anchored pattern.
+
+Argument:   the compiled pattern
+Returns:    a lazy DFA, or NULL if the pattern does not qualify
+*/
+
+void *
+PRIV(lazy_dfa_compile)(const REAL_PCRE *re)
+{
+#ifdef _WIN32
+(void)re;
+return NULL;
+#else
+ldfa_build b;
+struct LAZY_DFA_BLOCK *dfa = NULL;
+const pcre_uchar *code;
+const pcre_uint8 *tables;
+ldfa_work *w = NULL;
+size_t size;
+int newline, start, n, i;
+
+if ((re->options & PCRE_ANCHORED) == 0 || (re->options & PCRE_FIRSTLINE) != 0)
+  return NULL;
+
+code = (const pcre_uchar *)re + re->name_table_offset +
+  re->name_count * re->name_entry_size;
+
+tables = re->tables;
+if (tables == NULL) tables = PRIV(default_tables);
+
+switch(re->options & PCRE_NEWLINE_BITS)
+  {
+  case 0: newline = NEWLINE; break;
+  case PCRE_NEWLINE_CR: newline = CHAR_CR; break;
+  case PCRE_NEWLINE_LF: newline = CHAR_NL; break;
+  default: newline = -1; break;
+  }
+
+memset(&b, 0, sizeof(b));
+b.cx.lcc = tables + lcc_offset;
+b.cx.fcc = tables + fcc_offset;
+b.cx.ctypes = tables + ctypes_offset;
+b.cx.nl_ok = newline == CHAR_CR || newline == CHAR_NL;
+b.cx.nl = b.cx.nl_ok? (pcre_uint32)newline : 0;
+b.cx.utf = (re->options & PCRE_UTF8) != 0;
+b.endonly = (re->options & PCRE_DOLLAR_ENDONLY) != 0;
+
+/* Start with room for about one node and one item per code unit of the
+pattern, which is enough unless there are bounded repeats to write out. */
+
+n = (int)(re->size / sizeof(pcre_uchar)) + 16;
+if (n > MAX_NODES) n = MAX_NODES;
+b.node_size = b.item_size = n;
+b.possessive_size = 16;
+b.nodes = (ldfa_node *)(PUBL(malloc))(b.node_size * sizeof(ldfa_node));
+b.items = (ldfa_item *)(PUBL(malloc))(b.item_size * sizeof(ldfa_item));
+b.possessive = (int *)(PUBL(malloc))(2 * b.possessive_size * sizeof(int));
+b.stack = (const pcre_uchar **)(PUBL(malloc))
+  ((re->size / sizeof(pcre_uchar) + 1) * sizeof(pcre_uchar *));
+if (b.nodes == NULL || b.items == NULL || b.possessive == NULL ||
+    b.stack == NULL)
+  goto FAILED;
+
+/* Node 0 is the match node. The pattern is a group followed by OP_END. */
+
+(void)new_node(&b, NODE_MATCH, -1, -1);
+if (item_end(code, b.cx.utf) == NULL ||
+    *item_end(code, b.cx.utf) != OP_END ||
+    (start = compile_group(&b, code, MATCH_NODE)) < 0)
+  goto FAILED;
+
+w = get_work(b.node_count, FALSE);
+if (w == NULL) goto FAILED;
+
+/* Check that no possessive repeat can match the first character of what
+follows it. */
+
+for (i = 0; i < b.possessive_count; i++)
+  {
+  const ldfa_item *item = b.items + b.possessive[2*i];
+  int k;
+  n = closure(b.nodes, b.node_count, w, b.possessive + 2*i + 1, 1, w->a,
+    FOLLOW_CIRC|FOLLOW_EOD|FOLLOW_EODN);
+  for (k = 0; k < n; k++)
+    {
+    const ldfa_node *node = b.nodes + w->a[k];
+    if (node->type == NODE_ITEM &&
+        items_overlap(&b.cx, item, b.items + node->item))
+      goto FAILED;
+    }
+  }
+
+/* Get the DFA block, with the NFA, the hash table and working space after
+the structure. */
+
+size = sizeof(struct LAZY_DFA_BLOCK) + b.item_count * sizeof(ldfa_item) +
+  b.node_count * sizeof(ldfa_node) + HASH_SIZE * sizeof(int);
+dfa = (struct LAZY_DFA_BLOCK *)(PUBL(malloc))(size);
+if (dfa == NULL) goto FAILED;
+memset(dfa, 0, sizeof(struct LAZY_DFA_BLOCK));
+
+dfa->re = re;
+dfa->cx = b.cx;
+dfa->items = (ldfa_item *)(dfa + 1);
+dfa->nodes = (ldfa_node *)(dfa->items + b.item_count);
+dfa->hash_heads = (int *)(dfa->nodes + b.node_count);
+dfa->item_count = b.item_count;
+dfa->node_count = b.node_count;
+dfa->has_eodn = b.has_eodn;
+memcpy(dfa->items, b.items, b.item_count * sizeof(ldfa_item));
+memcpy(dfa->nodes, b.nodes, b.node_count * sizeof(ldfa_node));
+for (i = 0; i < HASH_SIZE; i++) dfa->hash_heads[i] = -1;
+
+dfa->end_forced = end_forced(dfa->nodes, dfa->node_count, w, start);
+
+/* Divide the character values below 256 into classes that every item treats
+in the same way. */
+
+dfa->class_count = 1;
+for (i = 0; i < dfa->item_count; i++)
+  {
+  int remap[512];
+  int count = 0, c;
+  for (c = 0; c < 2 * dfa->class_count; c++) remap[c] = -1;
+  for (c = 0; c < 256; c++)
+    {
+    int key = dfa->classmap[c] * 2 +
+      ((dfa->items[i].bits[c/8] & (1 << (c&7))) != 0);
+    if (remap[key] < 0) remap[key] = count++;
+    dfa->classmap[c] = (pcre_uint8)remap[key];
+    }
+  dfa->class_count = count;
+  }
+
+/* Set up the cache, with the dead state as state 0, and the initial state,
+in which ^ holds. */
+
+dfa->state_size = 16;
+dfa->states = (ldfa_state **)(PUBL(malloc))
+  (dfa->state_size * sizeof(ldfa_state *));
+if (dfa->states == NULL) goto FAILED;
+dfa->work = *w;
+if (find_state(dfa, dfa->work.set, 0) != 0) goto FAILED;
+n = closure(dfa->nodes, dfa->node_count, &dfa->work, &start, 1,
+  dfa->work.set, FOLLOW_CIRC);
+if ((dfa->start = find_state(dfa, dfa->work.set, n)) < 0) goto FAILED;
+
+if (pthread_rwlock_init(&dfa->lock, NULL) != 0) goto FAILED;
+
+(PUBL(free))(b.nodes);
+(PUBL(free))(b.items);
+(PUBL(free))(b.possessive);
+(PUBL(free))(b.stack);
+return dfa;
+
+FAILED:
+if (dfa != NULL)
+  {
+  if (dfa->states != NULL)
+    {
+    for (i = 0; i < dfa->state_count; i++) (PUBL(free))(dfa->states[i]);
+    (PUBL(free))(dfa->states);
+    }
+  (PUBL(free))(dfa);
+  }
+if (w != NULL) (PUBL(free))(w);
+if (b.nodes != NULL) (PUBL(free))(b.nodes);
+if (b.items != NULL) (PUBL(free))(b.items);
+if (b.possessive != NULL) (PUBL(free))(b.possessive);
+if (b.stack != NULL) (PUBL(free))(b.stack);
+return NULL;
+#endif  /* _WIN32 */
+}
+
+
+
+/*************************************************
+*          Match with a lazy DFA                 *
+*************************************************/
+
+/* Called by pcre_exec() for a match at the start of the subject, with none of
+the options that the DFA does not handle.
+
+Arguments:
+  re         the compiled pattern
+  lazy_dfa   the DFA
+  subject    the subject string
+  length     its length
+
+Returns:     LAZY_DFA_NOMATCH, LAZY_DFA_MATCH, LAZY_DFA_MATCH_END if every
+             match ends at the end of the subject, or LAZY_DFA_FAILED if the
+             DFA cannot be used
+*/
+
+int
+PRIV(lazy_dfa_exec)(const REAL_PCRE *re, void *lazy_dfa, PCRE_PUCHAR subject,
+  int length)
+{
+#ifdef _WIN32
+(void)re;
+(void)lazy_dfa;
+(void)subject;
+(void)length;
+return LAZY_DFA_FAILED;
+#else
+struct LAZY_DFA_BLOCK *dfa = (struct LAZY_DFA_BLOCK *)lazy_dfa;
+PCRE_PUCHAR p = subject;
+PCRE_PUCHAR end = subject + length;
+#if defined SUPPORT_UTF && !defined COMPILE_PCRE32
+BOOL utf = dfa->cx.utf;
+#endif
+int s = dfa->start;
+int rc;
+
+if (dfa->re != re) return LAZY_DFA_FAILED;
+
+pthread_rwlock_rdlock(&dfa->lock);
+for (;;)
+  {
+  const ldfa_state *st = dfa->states[s];
+  pcre_uint32 c;
+  int t;
+
+  if ((st->flags & STATE_MATCH) != 0) { rc = LAZY_DFA_MATCH; break; }
+  if (st->count == 0) { rc = LAZY_DFA_NOMATCH; break; }
+  if (p >= end)
+    {
+    rc = ((st->flags & STATE_END_MATCH) != 0)?
+      LAZY_DFA_MATCH : LAZY_DFA_NOMATCH;
+    break;
+    }
+  if (dfa->has_eodn && p == end - 1 && *p == dfa->cx.nl)
+    {
+    rc = ((st->flags & STATE_NL_MATCH) != 0)?
+      LAZY_DFA_MATCH : LAZY_DFA_NOMATCH;
+    break;
+    }
+
+  GETCHARINCTEST(c, p);
+  if (c < 256 && (t = st->next[dfa->classmap[c]]) >= 0)
+    {
+    s = t;
+    continue;
+    }
+
+  /* The transition is not in the cache. */
+
+  pthread_rwlock_unlock(&dfa->lock);
+  pthread_rwlock_wrlock(&dfa->lock);
+  t = next_state(dfa, s, c);
+  if (t == CACHE_FULL)
+    {
+    int n = step(dfa, &dfa->work, dfa->states[s]->nodes,
+      dfa->states[s]->count, c, dfa->work.set);
+    ldfa_work *w = get_work(dfa->node_count, TRUE);
+    if (w != NULL) memcpy(w->cur, dfa->work.set, n * sizeof(int));
+    pthread_rwlock_unlock(&dfa->lock);
+    if (w == NULL) return LAZY_DFA_FAILED;
+    rc = match_uncached(dfa, w, n, p, end);
+    (PUBL(free))(w);
+    return (rc == LAZY_DFA_MATCH && dfa->end_forced)?
+      LAZY_DFA_MATCH_END : rc;
+    }
+  pthread_rwlock_unlock(&dfa->lock);
+  pthread_rwlock_rdlock(&dfa->lock);
+  s = t;
+  }
+pthread_rwlock_unlock(&dfa->lock);
+
+return (rc == LAZY_DFA_MATCH && dfa->end_forced)? LAZY_DFA_MATCH_END : rc;
+#endif  /* _WIN32 */
+}
+
+
+
+/*************************************************
+*          Free a lazy DFA                       *
+*************************************************/
+
+void
+PRIV(lazy_dfa_free)(void *lazy_dfa)
+{
+#ifdef _WIN32
+(void)lazy_dfa;
+#else
+struct LAZY_DFA_BLOCK *dfa = (struct LAZY_DFA_BLOCK *)lazy_dfa;
+int i;
+
+pthread_rwlock_destroy(&dfa->lock);
+for (i = 0; i < dfa->state_count; i++) (PUBL(free))(dfa->states[i]);
+(PUBL(free))(dfa->states);
+
+/* The working space was the block from get_work(); the first vector follows
+the ldfa_work structure. */
+
+(PUBL(free))((ldfa_work *)dfa->work.marks - 1);
+(PUBL(free))(dfa);
+#endif
+}
+
+/* End of pcre_lazydfa.c */
@@ -0,0 +1,774 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains the external functions pcre_compile_cached(),
+pcre_release_cached(), pcre_lru_cache_create(), pcre_lru_cache_info() and
+pcre_lru_cache_free(), which maintain an in-memory cache of compiled and
+studied patterns that can be shared by several threads. It is intended for
+programs that compile the same pattern strings again and again, for example
+in functions that build a pcrecpp::RE object each time they are called.
+
+Entries are keyed by the pattern text, the compile options and the character
+tables pointer. The cache is divided into shards, chosen by the hash of the
+key, each with its own lock, hash chains and least-recently-used list, so that
+threads looking up different patterns rarely wait for each other. Each entry
+is a single block that holds the entry, a copy of the compiled pattern and the
+pattern text; the study data (and JIT code, if requested) is made from the
+copy when the entry is created.
+
+An entry carries a count of the callers that are using it. It is not freed
+while the count is non-zero, even if it has been evicted from the cache to
+make room for another; it is then freed by the last pcre_release_cached().
+The count is kept in the entry rather than by pcre_refcount(), because the
+field that function maintains saturates at 65535.
+
+A miss compiles the pattern without holding the shard's lock. If two threads
+miss on the same key at the same time, the entry of the first to finish is
+kept and the other thread's copy is discarded.
+
+Without POSIX threads (on Windows) there are no locks, so a cache must not be
+used by more than one thread at a time. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "pcre_internal.h"
+
+
+#define LRU_MAGIC 0x4c525543UL      /* 'LRUC' */
+
+/* The cache used when no cache is given has this many entries. A cache is
+split into at most LRU_MAX_SHARDS shards, each holding at least
+LRU_SHARD_MIN entries. */
+
+#define LRU_DEFAULT_CAPACITY 256
+#define LRU_MAX_SHARDS       16
+#define LRU_SHARD_MIN        8
+
+/* Sizes within an entry block are rounded up to a multiple of 8, so that the
+compiled pattern that follows the entry is aligned. Shards are rounded up to a
+multiple of 64 so that two shards' locks do not share a cache line. */
+
+#define LRU_ALIGN(n)       (((n) + 7) & ~(size_t)7)
+#define LRU_SHARD_ALIGN(n) (((n) + 63) & ~(size_t)63)
+
+typedef struct lru_entry {
+  struct lru_entry *chain;        /* Next in hash chain */
+  struct lru_entry *newer;        /* Towards the most recently used */
+  struct lru_entry *older;        /* Towards the least recently used */
+  struct lru_shard *shard;        /* The shard that holds it */
+  PUBL(extra) *extra;             /* Study data, or NULL */
+  const unsigned char *tables;    /* Character tables, or NULL */
+  PCRE_PUCHAR pattern;            /* Follows the compiled pattern */
+  unsigned long int refs;         /* Number of callers using the entry */
+  pcre_uint32 magic;              /* LRU_MAGIC */
+  pcre_uint32 hash;
+  pcre_uint32 pattern_length;     /* In code units */
+  pcre_uint32 options;            /* Compile options */
+  BOOL evicted;                   /* No longer in the cache */
+} lru_entry;
+
+#define ENTRY_SIZE LRU_ALIGN(sizeof(lru_entry))
+#define ENTRY_RE(entry) ((REAL_PCRE *)((pcre_uint8 *)(entry) + ENTRY_SIZE))
+#define RE_ENTRY(re) ((lru_entry *)((pcre_uint8 *)(re) - ENTRY_SIZE))
+
+typedef struct lru_shard {
+#ifndef _WIN32
+  pthread_mutex_t mutex;
+#endif
+  lru_entry **buckets;
+  lru_entry *newest;
+  lru_entry *oldest;
+  pcre_uint32 bucket_count;       /* Always a power of 2 */
+  int count;                      /* Entries in the shard */
+  int capacity;                   /* Most entries allowed */
+  unsigned long int hits;
+  unsigned long int misses;
+  unsigned long int evictions;
+} lru_shard;
+
+#ifndef _WIN32
+#define LOCK_SHARD(shard) pthread_mutex_lock(&(shard)->mutex)
+#define UNLOCK_SHARD(shard) pthread_mutex_unlock(&(shard)->mutex)
+#else
+#define LOCK_SHARD(shard)
+#define UNLOCK_SHARD(shard)
+#endif
+
+#if defined COMPILE_PCRE8
+#define LRU_BLOCK real_pcre_lru_cache
+#define LRU_SPTR PCRE_SPTR
+#define LRU_PCRE pcre
+#elif defined COMPILE_PCRE16
+#define LRU_BLOCK real_pcre16_lru_cache
+#define LRU_SPTR PCRE_SPTR16
+#define LRU_PCRE pcre16
+#elif defined COMPILE_PCRE32
+#define LRU_BLOCK real_pcre32_lru_cache
+#define LRU_SPTR PCRE_SPTR32
+#define LRU_PCRE pcre32
+#endif
+
+struct LRU_BLOCK {
+  pcre_uint8 *memory;             /* The block that holds the shards */
+  pcre_uint8 *shards;             /* The first shard, aligned */
+  int shard_count;                /* Always a power of 2 */
+  int capacity;
+  int study_options;
+};
+
+#define SHARD(cache, i) ((lru_shard *)((cache)->shards + \
+  (size_t)(i) * LRU_SHARD_ALIGN(sizeof(lru_shard))))
+
+/* The cache used when none is given. It is created when first needed and is
+never freed. */
+
+static struct LRU_BLOCK *default_cache = NULL;
+
+#ifndef _WIN32
+static pthread_once_t default_cache_once = PTHREAD_ONCE_INIT;
+#endif
+
+
+
+/*************************************************
+*             Hash and compare keys              *
+*************************************************/
+
+/* This is the same FNV-1a hash as is used for the file cache, with the tables
+pointer mixed in as well as the options.
+
+Arguments:
+  pattern     the pattern
+  length      its length in code units
+  options     the compile options
+  tables      the character tables pointer
+
+Returns:      the hash value
+*/
+
+static pcre_uint32
+hash_key(PCRE_PUCHAR pattern, pcre_uint32 length, pcre_uint32 options,
+  const unsigned char *tables)
+{
+pcre_uint32 hash = 2166136261UL;
+size_t t = (size_t)tables;
+pcre_uint32 i;
+
+for (i = 0; i < length; i++) hash = (hash ^ pattern[i]) * 16777619UL;
+hash = (hash ^ options) * 16777619UL;
+for (i = 0; i < sizeof(size_t); i++, t >>= 8)
+  hash = (hash ^ (pcre_uint32)(t & 0xff)) * 16777619UL;
+return hash;
+}
+
+
+/* Find an entry in a shard. The shard must be locked.
+
+Arguments:
+  shard       the shard
+  hash        the hash of the key
+  pattern     the pattern
+  length      its length in code units
+  options     the compile options
+  tables      the character tables pointer
+
+Returns:      the entry, or NULL if the key is not in the shard
+*/
+
+static lru_entry *
+find_entry(lru_shard *shard, pcre_uint32 hash, PCRE_PUCHAR pattern,
+  pcre_uint32 length, pcre_uint32 options, const unsigned char *tables)
+{
+lru_entry *entry = shard->buckets[hash & (shard->bucket_count - 1)];
+for (; entry != NULL; entry = entry->chain)
+  {
+  if (entry->hash == hash && entry->pattern_length == length &&
+      entry->options == options && entry->tables == tables &&
+      memcmp(entry->pattern, pattern, IN_UCHARS(length)) == 0)
+    return entry;
+  }
+return NULL;
+}
+
+
+
+/*************************************************
+*          Maintain the LRU list of a shard      *
+*************************************************/
+
+/* Take an entry out of the list. The shard must be locked.
+
+Arguments:
+  shard       the shard
+  entry       the entry
+
+Returns:      nothing
+*/
+
+static void
+unlink_entry(lru_shard *shard, lru_entry *entry)
+{
+if (entry->newer != NULL) entry->newer->older = entry->older;
+  else shard->newest = entry->older;
+if (entry->older != NULL) entry->older->newer = entry->newer;
+  else shard->oldest = entry->newer;
+}
+
+
+/* Put an entry at the most recently used end of the list. The shard must be
+locked.
+
+Arguments:
+  shard       the shard
+  entry       the entry, which is not in the list
+
+Returns:      nothing
+*/
+
+static void
+push_entry(lru_shard *shard, lru_entry *entry)
+{
+entry->newer = NULL;
+entry->older = shard->newest;
+if (shard->newest != NULL) shard->newest->newer = entry;
+  else shard->oldest = entry;
+shard->newest = entry;
+}
+
+
+/* Remove the least recently used entry from the shard, which must be locked
+and not empty. The entry is not freed here, because that is best done after the
+lock is released.
+
+Arguments:
+  shard       the shard
+
+Returns:      the entry if it should now be freed, or NULL if it is in use
+*/
+
+static lru_entry *
+evict_oldest(lru_shard *shard)
+{
+lru_entry *entry = shard->oldest;
+lru_entry **chain = shard->buckets + (entry->hash & (shard->bucket_count - 1));
+
+while (*chain != entry) chain = &(*chain)->chain;
+*chain = entry->chain;
+unlink_entry(shard, entry);
+shard->count--;
+shard->evictions++;
+entry->evicted = TRUE;
+return (entry->refs == 0)? entry : NULL;
+}
+
+
+/* Free an entry and its study data.
+
+Argument:   the entry
+Returns:    nothing
+*/
+
+static void
+free_entry(lru_entry *entry)
+{
+if (entry->extra != NULL) PUBL(free_study)(entry->extra);
+entry->magic = 0;
+(PUBL(free))(entry);
+}
+
+
+
+/*************************************************
+*       Make a new entry for a pattern           *
+*************************************************/
+
+/* The pattern is compiled and then copied into the entry block, and the copy
+is studied.
+
+Arguments:
+  cache          the cache
+  pattern        the pattern
+  length         its length in code units
+  options        compile options
+  tables         character tables, or NULL
+  hash           the hash of the key
+  errorptr       where to put an error message
+  erroroffset    where to put the error offset
+
+Returns:         the entry, or NULL on error
+*/
+
+static lru_entry *
+new_entry(struct LRU_BLOCK *cache, PCRE_PUCHAR pattern, pcre_uint32 length,
+  int options, const unsigned char *tables, pcre_uint32 hash,
+  const char **errorptr, int *erroroffset)
+{
+REAL_PCRE *re = (REAL_PCRE *)PUBL(compile)((LRU_SPTR)pattern, options,
+  errorptr, erroroffset, tables);
+lru_entry *entry;
+size_t re_size;
+
+if (re == NULL) return NULL;
+re_size = LRU_ALIGN(re->size);
+entry = (lru_entry *)(PUBL(malloc))(ENTRY_SIZE + re_size +
+  IN_UCHARS((size_t)length + 1));
+if (entry == NULL)
+  {
+  (PUBL(free))(re);
+  *errorptr = "failed to get memory";
+  return NULL;
+  }
+
+memcpy(ENTRY_RE(entry), re, re->size);
+(PUBL(free))(re);
+re = ENTRY_RE(entry);
+
+entry->chain = entry->newer = entry->older = NULL;
+entry->shard = NULL;
+entry->tables = tables;
+entry->pattern = (PCRE_PUCHAR)((pcre_uint8 *)re + re_size);
+entry->refs = 1;
+entry->magic = LRU_MAGIC;
+entry->hash = hash;
+entry->pattern_length = length;
+entry->options = (pcre_uint32)options;
+entry->evicted = FALSE;
+memcpy((pcre_uchar *)entry->pattern, pattern, IN_UCHARS((size_t)length + 1));
+
+entry->extra = PUBL(study)((void *)re, cache->study_options, errorptr);
+if (*errorptr != NULL)
+  {
+  (PUBL(free))(entry);
+  return NULL;
+  }
+return entry;
+}
+
+
+
+/*************************************************
+*            Create a pattern cache              *
+*************************************************/
+
+/* Every entry is studied with the same options when it is created. The study
+options may request JIT compilation; they are checked here rather than when a
+pattern is first looked up.
+
+Arguments:
+  capacity       the most entries to keep; 0 for the default
+  study_options  options for pcre_study()
+
+Returns:         the cache, or NULL if there is no memory or an option is bad
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_lru_cache * PCRE_CALL_CONVENTION
+pcre_lru_cache_create(int capacity, int study_options)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_lru_cache * PCRE_CALL_CONVENTION
+pcre16_lru_cache_create(int capacity, int study_options)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_lru_cache * PCRE_CALL_CONVENTION
+pcre32_lru_cache_create(int capacity, int study_options)
+#endif
+{
+struct LRU_BLOCK *cache;
+size_t shard_size = LRU_SHARD_ALIGN(sizeof(lru_shard));
+int shard_count = 1;
+int i;
+
+if (capacity < 0 || (study_options & ~PUBLIC_STUDY_OPTIONS) != 0)
+  return NULL;
+if (capacity == 0) capacity = LRU_DEFAULT_CAPACITY;
+while (shard_count < LRU_MAX_SHARDS &&
+       capacity / (shard_count * 2) >= LRU_SHARD_MIN)
+  shard_count *= 2;
+
+cache = (struct LRU_BLOCK *)(PUBL(malloc))(sizeof(struct LRU_BLOCK));
+if (cache == NULL) return NULL;
+
+/* The shards are allocated with room to align the first one. */
+
+cache->memory = (pcre_uint8 *)(PUBL(malloc))(shard_size * shard_count + 63);
+if (cache->memory == NULL)
+  {
+  (PUBL(free))(cache);
+  return NULL;
+  }
+cache->shards = cache->memory +
+  (LRU_SHARD_ALIGN((size_t)cache->memory) - (size_t)cache->memory);
+cache->shard_count = shard_count;
+cache->capacity = capacity;
+cache->study_options = study_options;
+
+for (i = 0; i < shard_count; i++)
+  {
+  lru_shard *shard = SHARD(cache, i);
+  memset(shard, 0, sizeof(lru_shard));
+  shard->capacity = capacity / shard_count + ((i < capacity % shard_count)?
+    1 : 0);
+  shard->bucket_count = 1;
+  while (shard->bucket_count < (pcre_uint32)shard->capacity)
+    shard->bucket_count *= 2;
+  shard->buckets = (lru_entry **)(PUBL(malloc))(shard->bucket_count *
+    sizeof(lru_entry *));
+  if (shard->buckets == NULL)
+    {
+    while (--i >= 0) (PUBL(free))(SHARD(cache, i)->buckets);
+    (PUBL(free))(cache->memory);
+    (PUBL(free))(cache);
+    return NULL;
+    }
+  memset(shard->buckets, 0, shard->bucket_count * sizeof(lru_entry *));
+#ifndef _WIN32
+  pthread_mutex_init(&shard->mutex, NULL);
+#endif
+  }
+
+return (PUBL(lru_cache) *)cache;
+}
+
+
+
+/*************************************************
+*             Free a pattern cache               *
+*************************************************/
+
+/* Every pattern obtained from the cache must have been released first.
+
+Argument:   the cache
+Returns:    nothing
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_lru_cache_free(pcre_lru_cache *external_cache)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_lru_cache_free(pcre16_lru_cache *external_cache)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_lru_cache_free(pcre32_lru_cache *external_cache)
+#endif
+{
+struct LRU_BLOCK *cache = (struct LRU_BLOCK *)external_cache;
+int i;
+
+if (cache == NULL || cache == default_cache) return;
+for (i = 0; i < cache->shard_count; i++)
+  {
+  lru_shard *shard = SHARD(cache, i);
+  while (shard->newest != NULL)
+    {
+    lru_entry *entry = shard->newest;
+    shard->newest = entry->older;
+    free_entry(entry);
+    }
+  (PUBL(free))(shard->buckets);
+#ifndef _WIN32
+  pthread_mutex_destroy(&shard->mutex);
+#endif
+  }
+(PUBL(free))(cache->memory);
+(PUBL(free))(cache);
+}
+
+
+
+/*************************************************
+*          Get the default pattern cache         *
+*************************************************/
+
+static void
+create_default_cache(void)
+{
+default_cache = (struct LRU_BLOCK *)PUBL(lru_cache_create)(0, 0);
+}
+
+static struct LRU_BLOCK *
+get_default_cache(void)
+{
+#ifndef _WIN32
+pthread_once(&default_cache_once, create_default_cache);
+#else
+if (default_cache == NULL) create_default_cache();
+#endif
+return default_cache;
+}
+
+
+
+/*************************************************
+*       Compile a pattern through the cache      *
+*************************************************/
+
+/* This function has the same arguments as pcre_compile(), with the cache in
+front and a place for the study data at the end. If the key is in the cache,
+the stored pattern is returned; otherwise the pattern is compiled, studied and
+added to the cache, evicting the least recently used entry of its shard if the
+shard is full. Either way the pattern is shared, so neither it nor its study
+data may be modified or freed; it must be given back by pcre_release_cached()
+when the caller has finished with it.
+
+The character tables pointer is part of the key, so tables that are built with
+pcre_maketables() must not be freed while the cache may hold patterns that
+were compiled with them. A pattern that fails to compile is not cached.
+
+Arguments:
+  external_cache  the cache, or NULL for a default cache
+  pattern         the regular expression
+  options         compile options
+  errorptr        where to put an error message
+  erroroffset     where to put the error offset
+  tables          character tables, or NULL for the defaults
+  extra_ptr       where to put the study data, or NULL
+
+Returns:          the compiled pattern, or NULL on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN const pcre * PCRE_CALL_CONVENTION
+pcre_compile_cached(pcre_lru_cache *external_cache, const char *pattern,
+  int options, const char **errorptr, int *erroroffset,
+  const unsigned char *tables, const pcre_extra **extra_ptr)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN const pcre16 * PCRE_CALL_CONVENTION
+pcre16_compile_cached(pcre16_lru_cache *external_cache, PCRE_SPTR16 pattern,
+  int options, const char **errorptr, int *erroroffset,
+  const unsigned char *tables, const pcre16_extra **extra_ptr)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN const pcre32 * PCRE_CALL_CONVENTION
+pcre32_compile_cached(pcre32_lru_cache *external_cache, PCRE_SPTR32 pattern,
+  int options, const char **errorptr, int *erroroffset,
+  const unsigned char *tables, const pcre32_extra **extra_ptr)
+#endif
+{
+struct LRU_BLOCK *cache = (struct LRU_BLOCK *)external_cache;
+PCRE_PUCHAR upattern = (PCRE_PUCHAR)pattern;
+lru_entry *entry;
+lru_entry *made;
+lru_entry *discard = NULL;
+lru_shard *shard;
+pcre_uint32 length, hash;
+
+*errorptr = NULL;
+if (extra_ptr != NULL) *extra_ptr = NULL;
+
+if (cache == NULL && (cache = get_default_cache()) == NULL)
+  {
+  *errorptr = "failed to get memory";
+  return NULL;
+  }
+if (pattern == NULL)
+  {
+  *errorptr = "NULL pattern";
+  if (erroroffset != NULL) *erroroffset = 0;
+  return NULL;
+  }
+
+length = STRLEN_UC(upattern);
+hash = hash_key(upattern, length, (pcre_uint32)options, tables);
+shard = SHARD(cache, (hash >> 24) & (cache->shard_count - 1));
+
+LOCK_SHARD(shard);
+entry = find_entry(shard, hash, upattern, length, (pcre_uint32)options,
+  tables);
+if (entry != NULL)
+  {
+  shard->hits++;
+  entry->refs++;
+  unlink_entry(shard, entry);
+  push_entry(shard, entry);
+  }
+else shard->misses++;
+UNLOCK_SHARD(shard);
+
+if (entry != NULL) goto RETURN_ENTRY;
+
+/* A miss: compile without holding the lock, then check again in case another
+thread has added the same key in the meantime. */
+
+made = new_entry(cache, upattern, length, options, tables, hash, errorptr,
+  erroroffset);
+if (made == NULL) return NULL;
+made->shard = shard;
+
+LOCK_SHARD(shard);
+entry = find_entry(shard, hash, upattern, length, (pcre_uint32)options,
+  tables);
+if (entry != NULL)
+  {
+  entry->refs++;
+  unlink_entry(shard, entry);
+  push_entry(shard, entry);
+  discard = made;
+  }
+else
+  {
+  lru_entry **chain = shard->buckets + (hash & (shard->bucket_count - 1));
+  if (shard->count >= shard->capacity) discard = evict_oldest(shard);
+  made->chain = *chain;
+  *chain = made;
+  push_entry(shard, made);
+  shard->count++;
+  entry = made;
+  }
+UNLOCK_SHARD(shard);
+
+if (discard != NULL) free_entry(discard);
+
+RETURN_ENTRY:
+if (extra_ptr != NULL) *extra_ptr = entry->extra;
+return (const LRU_PCRE *)ENTRY_RE(entry);
+}
+
+
+
+/*************************************************
+*      Release a pattern obtained from a cache   *
+*************************************************/
+
+/* If the pattern has been evicted from the cache and this was its last user,
+it is freed.
+
+Argument:   a pattern returned by pcre_compile_cached()
+Returns:    0 on success, or a negative error code
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_release_cached(const pcre *argument_re)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_release_cached(const pcre16 *argument_re)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_release_cached(const pcre32 *argument_re)
+#endif
+{
+const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
+lru_entry *entry;
+lru_shard *shard;
+BOOL free_it;
+
+if (re == NULL) return PCRE_ERROR_NULL;
+if (re->magic_number != MAGIC_NUMBER) return PCRE_ERROR_BADMAGIC;
+if ((re->flags & PCRE_MODE) == 0) return PCRE_ERROR_BADMODE;
+entry = RE_ENTRY(re);
+if (entry->magic != LRU_MAGIC) return PCRE_ERROR_BADMAGIC;
+
+shard = entry->shard;
+LOCK_SHARD(shard);
+free_it = --entry->refs == 0 && entry->evicted;
+UNLOCK_SHARD(shard);
+
+if (free_it) free_entry(entry);
+return 0;
+}
+
+
+
+/*************************************************
+*       Return information about a cache         *
+*************************************************/
+
+/* The counts are totals over the shards, each of which is locked in turn, so
+they are not a snapshot of a single moment if other threads are using the
+cache.
+
+Arguments:
+  external_cache  the cache, or NULL for the default cache
+  what            what information is required
+  where           where to put the information (an unsigned long int)
+
+Returns:          0 if data returned, negative on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_lru_cache_info(pcre_lru_cache *external_cache, int what, void *where)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_lru_cache_info(pcre16_lru_cache *external_cache, int what, void *where)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_lru_cache_info(pcre32_lru_cache *external_cache, int what, void *where)
+#endif
+{
+struct LRU_BLOCK *cache = (struct LRU_BLOCK *)external_cache;
+unsigned long int total = 0;
+int i;
+
+if (where == NULL) return PCRE_ERROR_NULL;
+if (cache == NULL && (cache = get_default_cache()) == NULL)
+  return PCRE_ERROR_NOMEMORY;
+
+if (what == PCRE_LRUINFO_CAPACITY)
+  {
+  *((unsigned long int *)where) = (unsigned long int)cache->capacity;
+  return 0;
+  }
+
+for (i = 0; i < cache->shard_count; i++)
+  {
+  lru_shard *shard = SHARD(cache, i);
+  LOCK_SHARD(shard);
+  switch(what)
+    {
+    case PCRE_LRUINFO_HITS: total += shard->hits; break;
+    case PCRE_LRUINFO_MISSES: total += shard->misses; break;
+    case PCRE_LRUINFO_EVICTIONS: total += shard->evictions; break;
+    case PCRE_LRUINFO_ENTRIES: total += (unsigned long int)shard->count; break;
+    default: UNLOCK_SHARD(shard); return PCRE_ERROR_BADOPTION;
+    }
+  UNLOCK_SHARD(shard);
+  }
+
+*((unsigned long int *)where) = total;
+return 0;
+}
+
+/* End of pcre_lru_cache.c */
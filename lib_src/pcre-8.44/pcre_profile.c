@@ -0,0 +1,178 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains internal functions that keep the per-pattern profiling
+counters. When PCRE is built with SUPPORT_PROFILE, pcre_compile() adds a
+profile_data block to the end of each compiled pattern, pcre_exec() and
+pcre_dfa_exec() add to its counters on every call, and pcre_fullinfo() copies
+them out with PCRE_INFO_PROFILE. Without SUPPORT_PROFILE none of this code is
+compiled and the matching functions are unchanged.
+
+Compiled patterns are shared between threads, so the counters are updated with
+relaxed atomic additions where the compiler provides them. Elsewhere a plain
+addition is used, and counts may be lost when threads use the same pattern at
+once. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef SUPPORT_PROFILE
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+#include "pcre_internal.h"
+
+
+#ifdef SUPPORT_PROFILE
+
+#if defined __GNUC__ && defined __ATOMIC_RELAXED
+#define PROFILE_ADD(p, n) (void)__atomic_fetch_add((p), (n), __ATOMIC_RELAXED)
+#define PROFILE_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#else
+#define PROFILE_ADD(p, n) (*(p) += (n))
+#define PROFILE_LOAD(p) (*(p))
+#endif
+
+
+/*************************************************
+*         Read a monotonic clock                 *
+*************************************************/
+
+/* The value is in nanoseconds from some arbitrary starting point; only
+differences between two readings are meaningful.
+
+Returns:    the current time in nanoseconds
+*/
+
+profile_count
+PRIV(profile_clock)(void)
+{
+#ifdef _WIN32
+static LARGE_INTEGER frequency;
+LARGE_INTEGER now;
+if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+QueryPerformanceCounter(&now);
+return (profile_count)((double)now.QuadPart * 1e9 /
+  (double)frequency.QuadPart);
+#else
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return (profile_count)ts.tv_sec * 1000000000 + (profile_count)ts.tv_nsec;
+#endif
+}
+
+
+
+/*************************************************
+*        Add one call to a pattern's profile     *
+*************************************************/
+
+/* This is called by pcre_exec() and pcre_dfa_exec() as they return, for
+patterns that have PCRE_PROFILED set.
+
+Arguments:
+  re            points to the compiled pattern
+  start_time    the value of PRIV(profile_clock)() when the call started
+  units         number of subject code units scanned
+  match_calls   number of calls of match(), or 0
+  dfa_states    number of DFA states processed, or 0
+
+Returns:        nothing
+*/
+
+void
+PRIV(profile_record)(const REAL_PCRE *re, profile_count start_time,
+  profile_count units, profile_count match_calls, profile_count dfa_states)
+{
+profile_data *pd = PROFILE_DATA(re);
+profile_count elapsed = PRIV(profile_clock)() - start_time;
+
+PROFILE_ADD(&pd->calls, 1);
+if (units > 0) PROFILE_ADD(&pd->units, units);
+if (match_calls > 0) PROFILE_ADD(&pd->match_calls, match_calls);
+if (dfa_states > 0) PROFILE_ADD(&pd->dfa_states, dfa_states);
+if (elapsed > 0) PROFILE_ADD(&pd->nanoseconds, elapsed);
+}
+
+#endif  /* SUPPORT_PROFILE */
+
+
+
+/*************************************************
+*        Copy out a pattern's profile            *
+*************************************************/
+
+/* This is called by pcre_fullinfo() for PCRE_INFO_PROFILE.
+
+Arguments:
+  re            points to the compiled pattern
+  profile       where to put the counters
+
+Returns:        0 on success
+                PCRE_ERROR_UNSET if profiling is not supported, or the
+                  pattern was compiled without it
+*/
+
+int
+PRIV(profile_get)(const REAL_PCRE *re, pcre_profile *profile)
+{
+#ifdef SUPPORT_PROFILE
+profile_data *pd;
+if ((re->flags & PCRE_PROFILED) == 0) return PCRE_ERROR_UNSET;
+pd = PROFILE_DATA(re);
+profile->calls = (unsigned long int)PROFILE_LOAD(&pd->calls);
+profile->match_calls = (unsigned long int)PROFILE_LOAD(&pd->match_calls);
+profile->dfa_states = (unsigned long int)PROFILE_LOAD(&pd->dfa_states);
+profile->units = (unsigned long int)PROFILE_LOAD(&pd->units);
+profile->seconds = (double)PROFILE_LOAD(&pd->nanoseconds) / 1e9;
+return 0;
+#else
+(void)re;
+(void)profile;
+return PCRE_ERROR_UNSET;
+#endif
+}
+
+/* End of pcre_profile.c */
@@ -0,0 +1,382 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains internal functions that are used by pcre_exec() and
+pcre_dfa_exec() to skip quickly to the places in a subject where a match might
+start: the next occurrence of either of two code units (a first or required
+character and its other case), or the next code unit that is in the starting
+bitmap of a studied pattern.
+
+In the 8-bit library these use vector instructions when they are available.
+On x86 the SSE2 versions are always compiled (SSE2 is part of x86-64), and
+SSSE3 and AVX2 versions are compiled with function attributes and chosen at
+run time according to what the processor supports. Other processors use the
+scalar loops. Define PCRE_NO_SIMD_SCAN to build the scalar loops only. The
+16-bit and 32-bit libraries always use the scalar loops. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcre_internal.h"
+
+#if defined COMPILE_PCRE8 && !defined PCRE_NO_SIMD_SCAN
+#if defined __GNUC__ && (defined __x86_64__ || \
+    (defined __i386__ && defined __SSE2__))
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+#endif
+
+/* Levels of vector support, in increasing order. */
+
+enum { SCAN_SCALAR, SCAN_SSE2, SCAN_SSSE3, SCAN_AVX2 };
+
+#ifdef SCAN_X86
+static int scan_level = -1;       /* Not yet known */
+
+/* Find out what the processor supports. Several threads may do this at the
+same time, but they all store the same value. */
+
+static int
+get_scan_level(void)
+{
+int level = scan_level;
+if (level < 0)
+  {
+  __builtin_cpu_init();
+  level = __builtin_cpu_supports("avx2")? SCAN_AVX2 :
+    __builtin_cpu_supports("ssse3")? SCAN_SSSE3 : SCAN_SSE2;
+  scan_level = level;
+  }
+return level;
+}
+#endif
+
+
+
+/*************************************************
+*         Name the scanner that is in use        *
+*************************************************/
+
+/* This is used by pcre_config().
+
+Returns:    the name of the instruction set, or NULL for the scalar loops
+*/
+
+const char *
+PRIV(scan_get_target)(void)
+{
+#if defined SCAN_X86
+switch (get_scan_level())
+  {
+  case SCAN_AVX2: return "AVX2";
+  case SCAN_SSSE3: return "SSSE3";
+  default: return "SSE2";
+  }
+#else
+return NULL;
+#endif
+}
+
+
+
+/*************************************************
+*        Find either of two code units           *
+*************************************************/
+
+/* The scalar version is also used to finish off the vector versions when
+there are fewer code units left than a vector holds. */
+
+static PCRE_PUCHAR
+scan_chars_scalar(PCRE_PUCHAR p, PCRE_PUCHAR end, pcre_uint32 c1,
+  pcre_uint32 c2)
+{
+if (c1 == c2)
+  {
+  for (; p < end; p++) if (UCHAR21TEST(p) == c1) return p;
+  }
+else
+  {
+  for (; p < end; p++)
+    {
+    register pcre_uint32 c = UCHAR21TEST(p);
+    if (c == c1 || c == c2) return p;
+    }
+  }
+return end;
+}
+
+#ifdef SCAN_X86
+static PCRE_PUCHAR
+scan_chars_sse2(PCRE_PUCHAR p, PCRE_PUCHAR end, pcre_uint32 c1, pcre_uint32 c2)
+{
+__m128i v1 = _mm_set1_epi8((char)c1);
+__m128i v2 = _mm_set1_epi8((char)c2);
+while (end - p >= 16)
+  {
+  __m128i data = _mm_loadu_si128((const __m128i *)p);
+  int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, v1),
+    _mm_cmpeq_epi8(data, v2)));
+  if (mask != 0) return p + __builtin_ctz((unsigned int)mask);
+  p += 16;
+  }
+return scan_chars_scalar(p, end, c1, c2);
+}
+
+__attribute__((target("avx2")))
+static PCRE_PUCHAR
+scan_chars_avx2(PCRE_PUCHAR p, PCRE_PUCHAR end, pcre_uint32 c1, pcre_uint32 c2)
+{
+__m256i v1 = _mm256_set1_epi8((char)c1);
+__m256i v2 = _mm256_set1_epi8((char)c2);
+while (end - p >= 32)
+  {
+  __m256i data = _mm256_loadu_si256((const __m256i *)p);
+  unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(
+    _mm256_cmpeq_epi8(data, v1), _mm256_cmpeq_epi8(data, v2)));
+  if (mask != 0) return p + __builtin_ctz(mask);
+  p += 32;
+  }
+return scan_chars_sse2(p, end, c1, c2);
+}
+#endif  /* SCAN_X86 */
+
+
+/* This is the function that the matchers call.
+
+Arguments:
+  p           where to start
+  end         the end of the subject
+  c1          a code unit to look for
+  c2          another one, or the same one again
+
+Returns:      a pointer to the first code unit that is c1 or c2, or end
+*/
+
+PCRE_PUCHAR
+PRIV(scan_chars)(PCRE_PUCHAR p, PCRE_PUCHAR end, pcre_uint32 c1,
+  pcre_uint32 c2)
+{
+#if defined SCAN_X86
+if (c1 == c2)
+  {
+  /* The C library's memchr() is vectorized almost everywhere. */
+  PCRE_PUCHAR q = (p < end)? (PCRE_PUCHAR)memchr(p, (int)c1, end - p) : NULL;
+  return (q == NULL)? end : q;
+  }
+#endif
+
+#if defined SCAN_X86
+if (get_scan_level() >= SCAN_AVX2) return scan_chars_avx2(p, end, c1, c2);
+return scan_chars_sse2(p, end, c1, c2);
+#else
+return scan_chars_scalar(p, end, c1, c2);
+#endif
+}
+
+
+
+/*************************************************
+*     Set up for scanning with a start bitmap    *
+*************************************************/
+
+/* The vector versions use the "shufti" method. Each byte value is split into
+its high and low nibbles, and each nibble indexes a 16-entry table of bit
+masks, one bit per "bucket"; a byte is a candidate if the two masks have a bit
+in common. A bucket is a set of high nibbles that share the same set of low
+nibbles in the bitmap, so if there are no more than 8 different sets of low
+nibbles the tables are exact. If there are more, the extra sets are merged into
+the last bucket, and the candidates it finds are checked against the bitmap.
+
+Arguments:
+  tables      the structure to set up
+  start_bits  the 32-byte bitmap from pcre_study()
+
+Returns:      nothing
+*/
+
+void
+PRIV(scan_bits_init)(scan_bits_tables *tables, const pcre_uint8 *start_bits)
+{
+pcre_uint16 buckets[8];
+int nbuckets = 0;
+int h, l, b;
+
+tables->start_bits = start_bits;
+tables->exact = TRUE;
+memset(tables->lo, 0, sizeof(tables->lo));
+memset(tables->hi, 0, sizeof(tables->hi));
+
+for (h = 0; h < 16; h++)
+  {
+  pcre_uint16 set = (pcre_uint16)(start_bits[2*h] | (start_bits[2*h+1] << 8));
+  if (set == 0) continue;
+  for (b = 0; b < nbuckets; b++) if (buckets[b] == set) break;
+  if (b >= nbuckets)
+    {
+    if (nbuckets < 8) buckets[nbuckets++] = set; else
+      {
+      b = 7;
+      buckets[7] |= set;
+      tables->exact = FALSE;
+      }
+    }
+  tables->hi[h] |= (pcre_uint8)(1u << b);
+  }
+
+for (b = 0; b < nbuckets; b++)
+  for (l = 0; l < 16; l++)
+    if ((buckets[b] & (1u << l)) != 0) tables->lo[l] |= (pcre_uint8)(1u << b);
+}
+
+
+
+/*************************************************
+*     Find a code unit that is in a start bitmap *
+*************************************************/
+
+/* Code units above 255 are treated as 255, as elsewhere. */
+
+static PCRE_PUCHAR
+scan_bits_scalar(const pcre_uint8 *start_bits, PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+for (; p < end; p++)
+  {
+  register pcre_uint32 c = UCHAR21TEST(p);
+#ifndef COMPILE_PCRE8
+  if (c > 255) c = 255;
+#endif
+  if ((start_bits[c/8] & (1 << (c&7))) != 0) return p;
+  }
+return end;
+}
+
+#ifdef SCAN_X86
+__attribute__((target("ssse3")))
+static PCRE_PUCHAR
+scan_bits_ssse3(const scan_bits_tables *tables, PCRE_PUCHAR p,
+  PCRE_PUCHAR end)
+{
+__m128i lo = _mm_loadu_si128((const __m128i *)tables->lo);
+__m128i hi = _mm_loadu_si128((const __m128i *)tables->hi);
+__m128i nibble = _mm_set1_epi8(0x0f);
+__m128i zero = _mm_setzero_si128();
+while (end - p >= 16)
+  {
+  __m128i data = _mm_loadu_si128((const __m128i *)p);
+  __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(data, nibble));
+  __m128i h = _mm_shuffle_epi8(hi,
+    _mm_and_si128(_mm_srli_epi16(data, 4), nibble));
+  unsigned int mask = 0xffffu & ~(unsigned int)_mm_movemask_epi8(
+    _mm_cmpeq_epi8(_mm_and_si128(l, h), zero));
+  while (mask != 0)
+    {
+    PCRE_PUCHAR q = p + __builtin_ctz(mask);
+    if (tables->exact || (tables->start_bits[*q/8] & (1 << (*q&7))) != 0)
+      return q;
+    mask &= mask - 1;
+    }
+  p += 16;
+  }
+return scan_bits_scalar(tables->start_bits, p, end);
+}
+
+__attribute__((target("avx2")))
+static PCRE_PUCHAR
+scan_bits_avx2(const scan_bits_tables *tables, PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+__m256i lo = _mm256_broadcastsi128_si256(
+  _mm_loadu_si128((const __m128i *)tables->lo));
+__m256i hi = _mm256_broadcastsi128_si256(
+  _mm_loadu_si128((const __m128i *)tables->hi));
+__m256i nibble = _mm256_set1_epi8(0x0f);
+__m256i zero = _mm256_setzero_si256();
+while (end - p >= 32)
+  {
+  __m256i data = _mm256_loadu_si256((const __m256i *)p);
+  __m256i l = _mm256_shuffle_epi8(lo, _mm256_and_si256(data, nibble));
+  __m256i h = _mm256_shuffle_epi8(hi,
+    _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble));
+  unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(
+    _mm256_cmpeq_epi8(_mm256_and_si256(l, h), zero));
+  while (mask != 0)
+    {
+    PCRE_PUCHAR q = p + __builtin_ctz(mask);
+    if (tables->exact || (tables->start_bits[*q/8] & (1 << (*q&7))) != 0)
+      return q;
+    mask &= mask - 1;
+    }
+  p += 32;
+  }
+
+/* The tail is finished by the scalar loop. Calling the SSSE3 version, whose
+instructions are not VEX encoded, straight after 256-bit instructions costs a
+state transition on some processors, which is far more than the scan itself on
+a short subject. */
+
+return scan_bits_scalar(tables->start_bits, p, end);
+}
+#endif  /* SCAN_X86 */
+
+
+/* This is the function that the matchers call.
+
+Arguments:
+  tables      set up by PRIV(scan_bits_init)()
+  p           where to start
+  end         the end of the subject
+
+Returns:      a pointer to the first code unit whose bit is set, or end
+*/
+
+PCRE_PUCHAR
+PRIV(scan_bits)(const scan_bits_tables *tables, PCRE_PUCHAR p,
+  PCRE_PUCHAR end)
+{
+#if defined SCAN_X86
+int level = get_scan_level();
+if (level >= SCAN_AVX2) return scan_bits_avx2(tables, p, end);
+if (level >= SCAN_SSSE3) return scan_bits_ssse3(tables, p, end);
+#endif
+return scan_bits_scalar(tables->start_bits, p, end);
+}
+
+/* End of pcre_scan.c */
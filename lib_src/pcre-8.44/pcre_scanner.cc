@@ -35,6 +35,12 @@
 
 #include <vector>
 #include <assert.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#elif defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
 
 #include "pcrecpp_internal.h"
 #include "pcre_scanner.h"
@@ -196,4 +202,183 @@ void Scanner::GetNextComments(vector<StringPiece> *ranges) {
   }
 }
 
+
+StreamScanner::StreamScanner(Reader reader, void* context, int chunk_size)
+  : reader_(reader),
+    context_(context),
+    fd_(-1),
+    chunk_size_(chunk_size > 0 ? chunk_size : kDefaultChunkSize),
+    buffer_(),
+    pos_(0),
+    dropped_(0),
+    dropped_lines_(0),
+    eof_(false),
+    error_(false),
+    skip_(NULL),
+    should_skip_(false),
+    skip_pending_(false),
+    vec_() {
+}
+
+StreamScanner::StreamScanner(int fd, int chunk_size)
+  : reader_(FdReader),
+    context_(&fd_),
+    fd_(fd),
+    chunk_size_(chunk_size > 0 ? chunk_size : kDefaultChunkSize),
+    buffer_(),
+    pos_(0),
+    dropped_(0),
+    dropped_lines_(0),
+    eof_(false),
+    error_(false),
+    skip_(NULL),
+    should_skip_(false),
+    skip_pending_(false),
+    vec_() {
+}
+
+StreamScanner::~StreamScanner() {
+  delete skip_;
+}
+
+int StreamScanner::FdReader(void* context, char* buffer, int size) {
+  const int fd = *static_cast<int*>(context);
+  for (;;) {
+#ifdef _WIN32
+    const int n = _read(fd, buffer, size);
+#else
+    const int n = (int)read(fd, buffer, size);
+#endif
+    if (n >= 0) return n;
+    if (errno != EINTR) return -1;
+  }
+}
+
+void StreamScanner::SetSkipExpression(const char* re) {
+  delete skip_;
+  if (re != NULL) {
+    skip_ = new RE(re);
+    should_skip_ = true;
+    skip_pending_ = true;
+  } else {
+    skip_ = NULL;
+    should_skip_ = false;
+  }
+}
+
+void StreamScanner::DisableSkip() {
+  assert(skip_ != NULL);
+  should_skip_ = false;
+}
+
+void StreamScanner::EnableSkip() {
+  assert(skip_ != NULL);
+  should_skip_ = true;
+  skip_pending_ = true;
+}
+
+int StreamScanner::LineNumber() const {
+  int count = 1 + dropped_lines_;
+  for (size_t i = 0; i < pos_; ++i)
+    if (buffer_[i] == '\n')
+      ++count;
+  return count;
+}
+
+long long StreamScanner::Offset() const {
+  return dropped_ + (long long)pos_;
+}
+
+bool StreamScanner::Fill() {
+  if (eof_) return false;
+
+  // Only the unconsumed input has to be kept.  It is usually a part of
+  // one token, so moving it down costs little.
+  if (pos_ > 0) {
+    for (size_t i = 0; i < pos_; ++i)
+      if (buffer_[i] == '\n')
+        ++dropped_lines_;
+    dropped_ += (long long)pos_;
+    buffer_.erase(0, pos_);
+    pos_ = 0;
+  }
+
+  const size_t used = buffer_.size();
+  buffer_.resize(used + chunk_size_);
+  int n = reader_(context_, &buffer_[used], chunk_size_);
+  if (n <= 0) {
+    eof_ = true;
+    error_ = (n < 0);
+    n = 0;
+  }
+  buffer_.resize(used + n);
+  return n > 0;
+}
+
+int StreamScanner::Match(const RE& re) {
+  const int groups = re.NumberOfCapturingGroups();
+  if (groups < 0) return PCRE_ERROR_NOMATCH;   // "re" did not compile
+  const int vecsize = (1 + groups) * 3;
+  if ((int)vec_.size() < vecsize) vec_.resize(vecsize);
+
+  // pcre_exec() never reports a partial match of an empty subject
+  while (pos_ == buffer_.size() && Fill()) {}
+
+  // A partial match, or a UTF-8 character cut off by the end of the data,
+  // means that the answer depends on what comes next. At the end of the
+  // input TryStreamMatch() stops asking for partial matches, so this
+  // loop ends.
+  for (;;) {
+    const StringPiece text(buffer_.data() + pos_,
+                           (int)(buffer_.size() - pos_));
+    const int rc = re.TryStreamMatch(text, eof_, &vec_[0], vecsize);
+    if (rc != PCRE_ERROR_PARTIAL && rc != PCRE_ERROR_SHORTUTF8) return rc;
+    Fill();
+  }
+}
+
+void StreamScanner::ConsumeSkip() {
+  skip_pending_ = false;
+  // An empty match of the skip expression would repeat for ever
+  while (Match(*skip_) >= 0 && vec_[1] > 0)
+    pos_ += vec_[1];
+}
+
+bool StreamScanner::AtEnd() {
+  if (should_skip_ && skip_pending_) ConsumeSkip();
+  while (pos_ == buffer_.size()) {
+    if (!Fill()) return true;
+  }
+  return false;
+}
+
+bool StreamScanner::LookingAt(const RE& re) {
+  if (should_skip_ && skip_pending_) ConsumeSkip();
+  return Match(re) >= 0;
+}
+
+bool StreamScanner::Consume(const RE& re,
+                            const Arg& arg0,
+                            const Arg& arg1,
+                            const Arg& arg2) {
+  if (should_skip_ && skip_pending_) ConsumeSkip();
+  if (Match(re) < 0) return false;
+
+  const Arg* const args[] = { &arg0, &arg1, &arg2 };
+  int n = 0;
+  while (n < 3 && args[n] != &RE::no_arg) n++;
+  if (re.NumberOfCapturingGroups() < n) return false;
+
+  const char* text = buffer_.data() + pos_;
+  for (int i = 0; i < n; i++) {
+    const int start = vec_[2*(i+1)];
+    const int limit = vec_[2*(i+1)+1];
+    if (!args[i]->Parse(text + start, limit - start)) return false;
+  }
+
+  pos_ += vec_[1];
+  skip_pending_ = true;
+  return true;
+}
+
 }   // namespace pcrecpp
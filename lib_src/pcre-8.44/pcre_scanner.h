@@ -167,6 +167,112 @@ class PCRECPP_EXP_DEFN Scanner {
   void ConsumeSkip();
 };
 
+// A Scanner that reads its input a chunk at a time, from a file
+// descriptor or from a reader function, instead of holding all of it in
+// memory.  It keeps only the unconsumed input and as much of the next
+// chunks as the current token needs: when a match reaches the end of
+// the data read so far, the match is repeated with more data, so a
+// token that crosses a chunk boundary is found as if the input were in
+// one piece.  Memory use is bounded by the chunk size plus the size of
+// the longest token or skipped run.
+//
+// Example: count the "key = value" lines of a large file:
+//
+//      StreamScanner scanner(fd);
+//      StringPiece key, value;
+//      scanner.SetSkipExpression("\\s+|#.*\n");
+//      while (scanner.Consume("(\\w+) = (\\S+)", &key, &value)) {
+//        ...;
+//      }
+//      if (!scanner.AtEnd() || scanner.error()) ...
+//
+// StringPiece arguments point into the scanner's buffer, and are valid
+// only until the next call of Consume, LookingAt, or AtEnd.  For the
+// same reason, input that matches the skip expression is skipped at the
+// start of those calls rather than at the end of Consume, so Offset()
+// and LineNumber() do not count it until then.  Comments cannot be
+// saved as in Scanner, because the skipped text is dropped.
+class PCRECPP_EXP_DEFN StreamScanner {
+ public:
+  // Read up to "size" bytes into "buffer".  Returns the number of bytes
+  // read, 0 at the end of the input, or -1 on error.
+  typedef int (*Reader)(void* context, char* buffer, int size);
+
+  static const int kDefaultChunkSize = 65536;
+
+  StreamScanner(Reader reader, void* context,
+                int chunk_size = kDefaultChunkSize);
+  explicit StreamScanner(int fd, int chunk_size = kDefaultChunkSize);
+  ~StreamScanner();
+
+  // Return the current one-based line number.  Unlike Scanner, this
+  // is cheap: newlines are counted as input is dropped.
+  int LineNumber() const;
+
+  // Return the byte-offset in the whole input that the scanner has
+  // reached.
+  long long Offset() const;
+
+  // Return the number of bytes of input currently held in memory.
+  int BufferSize() const { return (int)buffer_.capacity(); }
+
+  // Return true if all of the input has been consumed.  This may read
+  // input to find out.
+  bool AtEnd();
+
+  // Return true if the reader has failed.  The scanner then behaves as
+  // if the input had ended.
+  bool error() const { return error_; }
+
+  // As in Scanner.  Matching reads as much more input as "re" needs.
+  bool LookingAt(const RE& re);
+  bool Consume(const RE& re,
+               const Arg& arg0 = RE::no_arg,
+               const Arg& arg1 = RE::no_arg,
+               const Arg& arg2 = RE::no_arg);
+
+  // As in Scanner.  Skipping repeats as long as it succeeds.
+  void SetSkipExpression(const char* re);
+  void DisableSkip();
+  void EnableSkip();
+  void SkipCXXComments() {
+    SetSkipExpression("\\s|//.*\n|/[*](?:\n|.)*?[*]/");
+  }
+
+ private:
+  Reader        reader_;        // Supplies the input
+  void*         context_;       // Passed to reader_
+  int           fd_;            // Context of FdReader
+  int           chunk_size_;    // Bytes asked of reader_ at a time
+  std::string   buffer_;        // Input read but not yet dropped
+  size_t        pos_;           // Offset of the unconsumed input
+  long long     dropped_;       // Bytes of input dropped from buffer_
+  int           dropped_lines_; // Newlines in the dropped input
+  bool          eof_;           // reader_ has no more input
+  bool          error_;         // reader_ failed
+  RE*           skip_;          // If non-NULL, RE for skipping input
+  bool          should_skip_;   // If true, use skip_
+  bool          skip_pending_;  // If true, skip before the next match
+  std::vector<int> vec_;        // Ovector reused for every match
+
+  // Match "re" at the unconsumed input, reading more as needed.
+  // Returns the result of pcre_exec().
+  int Match(const RE& re);
+
+  // Drop the consumed input and append a chunk.  Returns false at the
+  // end of the input.
+  bool Fill();
+
+  static int FdReader(void* context, char* buffer, int size);
+
+  // Consume *skip_ if skipping is pending.
+  void ConsumeSkip();
+
+  // Not copyable
+  StreamScanner(const StreamScanner&);
+  StreamScanner& operator=(const StreamScanner&);
+};
+
 }   // namespace pcrecpp
 
 #endif /* _PCRE_SCANNER_H */
@@ -60,6 +60,7 @@ using std::vector;
 using std::string;
 using pcrecpp::StringPiece;
 using pcrecpp::Scanner;
+using pcrecpp::StreamScanner;
 
 static void TestScanner() {
   const char input[] = "\n"
@@ -146,6 +147,123 @@ static void TestBigComment() {
   CHECK_EQ(value, "value");
 }
 
+// Reader for StreamScanner that hands out a string in chunks
+struct StringReader {
+  const char* data;
+  int left;
+};
+
+static int ReadString(void* context, char* buffer, int size) {
+  StringReader* r = static_cast<StringReader*>(context);
+  const int n = size < r->left ? size : r->left;
+  memcpy(buffer, r->data, n);
+  r->data += n;
+  r->left -= n;
+  return n;
+}
+
+static void TestStreamScanner() {
+  const char input[] = "\n"
+                       "alpha = 1; // this sets alpha\n"
+                       "bravo = 22; /* bravo\n is set here */\n"
+                       "gamma = 333;\n"
+                       "delta = 4444\n";
+  const char *re = "(\\w+) = (\\d+);";
+
+  // Every chunk size must give what Scanner gives
+  for (int chunk = 1; chunk <= (int)sizeof(input); chunk++) {
+    Scanner s(input);
+    StringReader r = { input, (int)sizeof(input) - 1 };
+    StreamScanner ss(ReadString, &r, chunk);
+    s.SkipCXXComments();
+    ss.SkipCXXComments();
+
+    string var, svar;
+    int number, snumber;
+    for (;;) {
+      const bool ok = s.Consume(re, &var, &number);
+      CHECK_EQ(ss.Consume(re, &svar, &snumber), ok);
+      if (!ok) break;
+      CHECK_EQ(svar, var);
+      CHECK_EQ(snumber, number);
+    }
+    CHECK_EQ(ss.Offset(), s.Offset());
+    CHECK_EQ(ss.LineNumber(), s.LineNumber());
+    CHECK_EQ(ss.LookingAt("(\\w+) = (\\d+)"), true);
+    CHECK_EQ(ss.Consume("(\\w+) = (\\d+)", &svar, &snumber), true);
+    CHECK_EQ(svar, "delta");
+    CHECK_EQ(snumber, 4444);
+    CHECK_EQ(ss.AtEnd(), true);
+    CHECK_EQ(ss.error(), false);
+  }
+}
+
+// Reader for StreamScanner that makes at least "left" bytes of
+// "key<n> = <n>;" lines without holding them
+struct LineGenerator {
+  long long left;
+  long long line;
+  long long produced;
+  string pending;
+};
+
+static int GenerateLines(void* context, char* buffer, int size) {
+  LineGenerator* g = static_cast<LineGenerator*>(context);
+  int n = 0;
+  while (n < size && (g->left > 0 || !g->pending.empty())) {
+    if (g->pending.empty()) {
+      char line[64];
+      sprintf(line, "key%lld = %lld;\n", g->line, g->line);
+      g->pending = line;
+      g->line++;
+    }
+    int len = (int)g->pending.size();
+    if (len > size - n) len = size - n;
+    memcpy(buffer + n, g->pending.data(), len);
+    g->pending.erase(0, len);
+    g->left -= len;
+    g->produced += len;
+    n += len;
+  }
+  return n;
+}
+
+static void TestStreamScannerMemory() {
+  // Tokens are matched as they cross chunk boundaries, and the buffer
+  // stays near the chunk size however long the input is
+  LineGenerator g = { 1 << 20, 0, 0, "" };
+  StreamScanner ss(GenerateLines, &g, 4096);
+  ss.SetSkipExpression("\\s+");
+  long long value, lines = 0;
+  while (ss.Consume("key(\\d+) = (\\d+);", (void*)NULL, &value)) {
+    CHECK_EQ(value, lines);
+    lines++;
+  }
+  CHECK_EQ(ss.AtEnd(), true);
+  CHECK_EQ(ss.Offset(), g.produced);
+  CHECK_EQ(ss.LineNumber(), lines + 1);
+  if (ss.BufferSize() > 2 * 4096) {
+    fprintf(stderr, "StreamScanner buffer grew to %d\n", ss.BufferSize());
+    exit(1);
+  }
+
+  // The file descriptor constructor, and a token longer than a chunk
+  FILE* f = tmpfile();
+  string big(10000, 'x');
+  fprintf(f, "  %s  done", big.c_str());
+  fflush(f);
+  rewind(f);
+  StreamScanner fs(fileno(f), 100);
+  string word;
+  fs.SetSkipExpression("\\s+");
+  CHECK_EQ(fs.Consume("(\\w+)", &word), true);
+  CHECK_EQ(word, big);
+  CHECK_EQ(fs.Consume("(\\w+)", &word), true);
+  CHECK_EQ(word, "done");
+  CHECK_EQ(fs.AtEnd(), true);
+  fclose(f);
+}
+
 // TODO: also test scanner and big-comment in a thread with a
 //       small stack size
 
@@ -154,6 +272,8 @@ int main(int argc, char** argv) {
   (void)argv;
   TestScanner();
   TestBigComment();
+  TestStreamScanner();
+  TestStreamScannerMemory();
 
   // Done
   printf("OK\n");
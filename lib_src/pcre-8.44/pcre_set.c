@@ -0,0 +1,520 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains the external functions pcre_set_compile(),
+pcre_set_exec() and pcre_set_free(), which match a subject against several
+patterns at once and report which of them matched. They are intended for
+validating values against all the patterns that apply to them, as when a YANG
+type carries several "pattern" statements.
+
+The anchored members of a set are merged into a single pattern in which each
+member becomes an optional lookahead assertion at the start of the subject,
+followed by an empty named group that is set only if the member matched:
+
+  (?:(?=(?:member 1)(?<PCRE_SET_0>))|)(?:(?=(?:member 2)(?<PCRE_SET_1>))|)...
+
+One call of pcre_exec() on the merged pattern (with its study data and JIT
+code) then tests all the members, checking UTF validity and setting up the
+match only once. This pays off only when the merged pattern is JIT compiled;
+the interpreter runs it more slowly than it runs the members one by one, so
+without JIT code nothing is merged. A member that is not anchored, or that uses a construct whose
+meaning would change inside the merged pattern (back references, subroutine
+calls and recursion, callouts, and the (*VERB) items) is kept as a separate
+pattern and matched on its own. So is every member if the merged pattern fails
+to compile. A set can be used by several threads at once. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcre_internal.h"
+
+#define SET_NAME "PCRE_SET_"
+
+typedef struct set_member {
+  REAL_PCRE *re;                  /* Compiled on its own, or NULL if merged */
+  PUBL(extra) *extra;             /* Its study data, or NULL */
+  int group;                      /* Marker group in the merged pattern */
+} set_member;
+
+#if defined COMPILE_PCRE8
+#define SET_BLOCK real_pcre_set
+#define SET_SPTR PCRE_SPTR
+#elif defined COMPILE_PCRE16
+#define SET_BLOCK real_pcre16_set
+#define SET_SPTR PCRE_SPTR16
+#elif defined COMPILE_PCRE32
+#define SET_BLOCK real_pcre32_set
+#define SET_SPTR PCRE_SPTR32
+#endif
+
+struct SET_BLOCK {
+  REAL_PCRE *merged;              /* The merged members, or NULL */
+  PUBL(extra) *merged_extra;      /* Its study data, or NULL */
+  int ovector_size;               /* Ints needed to match it */
+  int count;                      /* Number of members */
+  set_member members[1];          /* Actually "count" of them */
+};
+
+/* Up to this many ints of ovector are kept on the stack by pcre_set_exec(). */
+
+#define SET_OVECTOR_STACK 96
+
+
+
+/*************************************************
+*       Check whether a member can be merged     *
+*************************************************/
+
+/* The text test is deliberately cautious; a false alarm just means that the
+member is matched on its own.
+
+Arguments:
+  pattern     the member's pattern
+  re          the member compiled on its own
+
+Returns:      TRUE if the member can be merged
+*/
+
+static BOOL
+mergeable(PCRE_PUCHAR pattern, const REAL_PCRE *re)
+{
+unsigned long int options;
+int backrefmax;
+
+if (PUBL(fullinfo)((const void *)re, NULL, PCRE_INFO_OPTIONS, &options) < 0 ||
+    (options & PCRE_ANCHORED) == 0)
+  return FALSE;
+if (PUBL(fullinfo)((const void *)re, NULL, PCRE_INFO_BACKREFMAX,
+    &backrefmax) < 0 || backrefmax != 0)
+  return FALSE;
+
+for (; *pattern != 0; pattern++)
+  {
+  if (pattern[0] == CHAR_BACKSLASH)
+    {
+    if (pattern[1] == CHAR_g || pattern[1] == CHAR_k) return FALSE;
+    if (pattern[1] != 0) pattern++;
+    continue;
+    }
+  if (pattern[0] != CHAR_LEFT_PARENTHESIS) continue;
+  if (pattern[1] == CHAR_ASTERISK) return FALSE;
+  if (pattern[1] != CHAR_QUESTION_MARK) continue;
+  switch (pattern[2])
+    {
+    case CHAR_R: case CHAR_AMPERSAND: case CHAR_C:
+    case CHAR_0: case CHAR_1: case CHAR_2: case CHAR_3: case CHAR_4:
+    case CHAR_5: case CHAR_6: case CHAR_7: case CHAR_8: case CHAR_9:
+    return FALSE;
+
+    case CHAR_P:
+    if (pattern[3] == CHAR_GREATER_THAN_SIGN ||
+        pattern[3] == CHAR_EQUALS_SIGN) return FALSE;
+    break;
+
+    case CHAR_PLUS: case CHAR_MINUS:
+    if (pattern[3] >= CHAR_0 && pattern[3] <= CHAR_9) return FALSE;
+    break;
+    }
+  }
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*    Copy ASCII text into a code unit string     *
+*************************************************/
+
+static pcre_uchar *
+append_text(pcre_uchar *p, const char *text)
+{
+while (*text != 0) *p++ = (pcre_uchar)*text++;
+return p;
+}
+
+
+
+/*************************************************
+*       Merge the mergeable members of a set     *
+*************************************************/
+
+/* Merging is done only if JIT compilation is requested and succeeds for the
+merged pattern. If anything goes wrong, the members are left to be matched on
+their own.
+
+Arguments:
+  set         the set, with each member compiled on its own
+  patterns    the member patterns
+  options     the compile options
+  study_options  the study options
+
+Returns:      nothing
+*/
+
+static void
+merge_members(struct SET_BLOCK *set, const PCRE_PUCHAR *patterns, int options,
+  int study_options)
+{
+const char *error;
+int erroroffset;
+size_t length = 0;
+pcre_uchar *pattern, *p;
+int i, n = 0, capture_count;
+REAL_PCRE *merged;
+
+if ((study_options & PCRE_STUDY_JIT_COMPILE) == 0) return;
+
+/* Mark the members to be merged with a group number of -1 for now. */
+
+for (i = 0; i < set->count; i++)
+  {
+  if (!mergeable(patterns[i], set->members[i].re)) continue;
+  set->members[i].group = -1;
+  length += STRLEN_UC(patterns[i]) + 48;
+  n++;
+  }
+if (n == 0) return;
+
+pattern = (pcre_uchar *)(PUBL(malloc))(IN_UCHARS(length + 1));
+if (pattern == NULL)
+  {
+  for (i = 0; i < set->count; i++) set->members[i].group = 0;
+  return;
+  }
+
+p = pattern;
+for (i = 0; i < set->count; i++)
+  {
+  char name[32];
+  unsigned int len;
+  if (set->members[i].group == 0) continue;
+  len = STRLEN_UC(patterns[i]);
+  sprintf(name, ")(?<" SET_NAME "%d>))|)", i);
+  p = append_text(p, "(?:(?=(?:");
+  memcpy(p, patterns[i], IN_UCHARS(len));
+  p += len;
+  p = append_text(p, name);
+  }
+*p = 0;
+
+merged = (REAL_PCRE *)PUBL(compile)((SET_SPTR)pattern,
+  options | PCRE_ANCHORED, &error, &erroroffset, NULL);
+if (merged == NULL || PUBL(fullinfo)((const void *)merged, NULL,
+    PCRE_INFO_CAPTURECOUNT, &capture_count) < 0)
+  goto FAILED;
+
+/* Find the marker group of each merged member. If any is missing, something
+in a member (a comment in extended mode, for example) has swallowed part of
+the merged pattern, so give up. */
+
+for (i = 0; i < set->count; i++)
+  {
+  char name[32];
+  pcre_uchar uname[32];
+  if (set->members[i].group == 0) continue;
+  sprintf(name, SET_NAME "%d", i);
+  *append_text(uname, name) = 0;
+  set->members[i].group = PUBL(get_stringnumber)((const void *)merged,
+    (SET_SPTR)uname);
+  if (set->members[i].group <= 0) goto FAILED;
+  }
+
+set->merged_extra = PUBL(study)((const void *)merged, study_options, &error);
+if (error != NULL || set->merged_extra == NULL ||
+    (set->merged_extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0)
+  goto FAILED;
+set->merged = merged;
+set->ovector_size = (capture_count + 1) * 3;
+
+/* The merged members are not needed on their own. */
+
+for (i = 0; i < set->count; i++)
+  {
+  set_member *member = set->members + i;
+  if (member->group <= 0) continue;
+  if (member->extra != NULL) PUBL(free_study)(member->extra);
+  (PUBL(free))(member->re);
+  member->re = NULL;
+  member->extra = NULL;
+  }
+(PUBL(free))(pattern);
+return;
+
+FAILED:
+for (i = 0; i < set->count; i++) set->members[i].group = 0;
+if (set->merged_extra != NULL) PUBL(free_study)(set->merged_extra);
+set->merged_extra = NULL;
+if (merged != NULL) (PUBL(free))(merged);
+(PUBL(free))(pattern);
+}
+
+
+
+/*************************************************
+*              Free a pattern set                *
+*************************************************/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_set_free(pcre_set *external_set)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_set_free(pcre16_set *external_set)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_set_free(pcre32_set *external_set)
+#endif
+{
+struct SET_BLOCK *set = (struct SET_BLOCK *)external_set;
+int i;
+
+if (set == NULL) return;
+for (i = 0; i < set->count; i++)
+  {
+  set_member *member = set->members + i;
+  if (member->extra != NULL) PUBL(free_study)(member->extra);
+  if (member->re != NULL) (PUBL(free))(member->re);
+  }
+if (set->merged_extra != NULL) PUBL(free_study)(set->merged_extra);
+if (set->merged != NULL) (PUBL(free))(set->merged);
+(PUBL(free))(set);
+}
+
+
+
+/*************************************************
+*            Compile a pattern set               *
+*************************************************/
+
+/* Every member is compiled with the same options and studied with the same
+study options. If a member fails to compile, the error and its offset are
+returned as for pcre_compile(), and the index of the member is returned via
+errorindex.
+
+Arguments:
+  patterns      a vector of member patterns
+  count         the number of members
+  options       compile options for every member
+  study_options study options, as for pcre_study()
+  errorptr      pointer to pointer to error text
+  erroroffset   where to put the error offset
+  errorindex    where to put the index of the failing member, or NULL
+
+Returns:        the set, or NULL on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_set * PCRE_CALL_CONVENTION
+pcre_set_compile(const char *const *patterns, int count, int options,
+  int study_options, const char **errorptr, int *erroroffset,
+  int *errorindex)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_set * PCRE_CALL_CONVENTION
+pcre16_set_compile(PCRE_SPTR16 const *patterns, int count, int options,
+  int study_options, const char **errorptr, int *erroroffset,
+  int *errorindex)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_set * PCRE_CALL_CONVENTION
+pcre32_set_compile(PCRE_SPTR32 const *patterns, int count, int options,
+  int study_options, const char **errorptr, int *erroroffset,
+  int *errorindex)
+#endif
+{
+struct SET_BLOCK *set;
+int i;
+
+if (errorptr == NULL) return NULL;
+*errorptr = NULL;
+if (erroroffset != NULL) *erroroffset = 0;
+if (errorindex != NULL) *errorindex = -1;
+
+if (patterns == NULL || count <= 0)
+  {
+  *errorptr = "no patterns in set";
+  return NULL;
+  }
+if ((study_options & ~PUBLIC_STUDY_OPTIONS) != 0)
+  {
+  *errorptr = "unknown or incorrect option bit(s) set";
+  return NULL;
+  }
+
+set = (struct SET_BLOCK *)(PUBL(malloc))(sizeof(struct SET_BLOCK) +
+  (count - 1) * sizeof(set_member));
+if (set == NULL)
+  {
+  *errorptr = "failed to get memory";
+  return NULL;
+  }
+memset(set, 0, sizeof(struct SET_BLOCK) + (count - 1) * sizeof(set_member));
+set->count = count;
+
+for (i = 0; i < count; i++)
+  {
+  set_member *member = set->members + i;
+  member->re = (REAL_PCRE *)PUBL(compile)(patterns[i], options, errorptr,
+    erroroffset, NULL);
+  if (member->re != NULL)
+    member->extra = PUBL(study)((const void *)member->re, study_options,
+      errorptr);
+  if (*errorptr != NULL)
+    {
+    if (errorindex != NULL) *errorindex = i;
+#if defined COMPILE_PCRE8
+    pcre_set_free((pcre_set *)set);
+#elif defined COMPILE_PCRE16
+    pcre16_set_free((pcre16_set *)set);
+#elif defined COMPILE_PCRE32
+    pcre32_set_free((pcre32_set *)set);
+#endif
+    return NULL;
+    }
+  }
+
+merge_members(set, (const PCRE_PUCHAR *)patterns, options, study_options);
+
+#if defined COMPILE_PCRE8
+return (pcre_set *)set;
+#elif defined COMPILE_PCRE16
+return (pcre16_set *)set;
+#elif defined COMPILE_PCRE32
+return (pcre32_set *)set;
+#endif
+}
+
+
+
+/*************************************************
+*         Match a subject against a set          *
+*************************************************/
+
+/* The subject is matched from its start against every member. The merged
+members are tested by lookahead assertions that match an empty string, so
+PCRE_NOTEMPTY and PCRE_NOTEMPTY_ATSTART cannot be supported and are rejected
+whether or not any members were merged.
+
+Arguments:
+  set           the set
+  subject       the subject string
+  length        its length
+  options       option bits, as for pcre_exec()
+  matched       a vector that is set to 1 for each member that matched and 0
+                  for each one that did not, or NULL
+
+Returns:        the number of members that matched, or a negative error code
+                  from pcre_exec(), or PCRE_ERROR_BADOPTION for PCRE_NOTEMPTY
+                  or PCRE_NOTEMPTY_ATSTART
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_set_exec(const pcre_set *external_set, const char *subject, int length,
+  int options, unsigned char *matched)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_set_exec(const pcre16_set *external_set, PCRE_SPTR16 subject,
+  int length, int options, unsigned char *matched)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_set_exec(const pcre32_set *external_set, PCRE_SPTR32 subject,
+  int length, int options, unsigned char *matched)
+#endif
+{
+const struct SET_BLOCK *set = (const struct SET_BLOCK *)external_set;
+int stack_ovector[SET_OVECTOR_STACK];
+int *ovector = stack_ovector;
+int total = 0;
+int rc = 0;
+int i;
+
+if (set == NULL || subject == NULL) return PCRE_ERROR_NULL;
+if ((options & (PCRE_NOTEMPTY|PCRE_NOTEMPTY_ATSTART)) != 0)
+  return PCRE_ERROR_BADOPTION;
+
+if (set->merged != NULL)
+  {
+  if (set->ovector_size > SET_OVECTOR_STACK)
+    {
+    ovector = (int *)(PUBL(malloc))(set->ovector_size * sizeof(int));
+    if (ovector == NULL) return PCRE_ERROR_NOMEMORY;
+    }
+  rc = PUBL(exec)((const void *)set->merged, set->merged_extra, subject,
+    length, 0, options, ovector, set->ovector_size);
+
+  /* The merged pattern always matches, possibly with an empty string; any
+  other result is an error, such as an invalid UTF string or a limit. The
+  subject has now been checked, so it need not be checked again. */
+
+  if (rc < 0) goto EXIT;
+  options |= PCRE_NO_UTF8_CHECK;
+  }
+
+for (i = 0; i < set->count; i++)
+  {
+  const set_member *member = set->members + i;
+  BOOL yield;
+
+  if (member->re == NULL)
+    yield = member->group < rc && ovector[2 * member->group] >= 0;
+  else
+    {
+    int mrc = PUBL(exec)((const void *)member->re, member->extra, subject,
+      length, 0, options, NULL, 0);
+    if (mrc < 0 && mrc != PCRE_ERROR_NOMATCH)
+      {
+      rc = mrc;
+      goto EXIT;
+      }
+    yield = mrc >= 0;
+    }
+
+  if (matched != NULL) matched[i] = yield? 1 : 0;
+  if (yield) total++;
+  }
+rc = total;
+
+EXIT:
+if (ovector != stack_ovector) (PUBL(free))(ovector);
+return rc;
+}
+
+/* End of pcre_set.c */
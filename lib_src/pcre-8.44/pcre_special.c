@@ -0,0 +1,1577 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+/* This module contains the internal functions that recognize a few simple
+shapes of pattern and match them without the interpreter. pcre_study() calls
+PRIV(special_compile)(), which looks for:
+
+  . A single literal string, with or without ^ or \A in front and $, \Z, or
+    \z after it. It is matched with memcmp(), after scanning for its first code
+    unit if it is not anchored.
+
+  . A list of literal alternatives, such as ^(?:get|put|post)$, which may be
+    caseless. A literal before or after a group, as in \.(?:xml|json)$, is
+    joined onto each of its alternatives. A small Aho-Corasick automaton is
+    built, with a dense table of transitions for each node. An anchored match
+    walks the trie; a search runs the automaton, skipping quickly to a
+    possible first code unit whenever it is back at the root.
+
+  . An anchored sequence of single character items, each of which may be
+    repeated, and of groups of such items that are optional or repeated, such
+    as ^[0-9a-fA-F]{2}(:[0-9a-fA-F]{2})*$. Each item becomes a table of 256
+    flags that is used in a tight loop. Only patterns in which no item can
+    match a character that could also start what follows it are accepted,
+    because every repeat of those can be matched greedily in a single pass,
+    with the same result as the interpreter.
+
+A specialized matcher finds the whole match, but no captured substrings, so
+pcre_exec() uses it only if the pattern has no capturing parentheses or the
+caller wants no offsets. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcre_internal.h"
+
+
+/* Limits on the size of a specialized matcher. Patterns that need more do not
+get one. */
+
+#define MAX_UNITS        1024       /* Code units in all the literals */
+#define MAX_ALTS         256        /* Literal alternatives */
+#define MAX_NODES        512        /* Nodes in the automaton */
+#define MAX_OPS          128        /* Items and groups in a sequence */
+#define MAX_DEPTH        32         /* Nesting of groups */
+
+/* The private structure name depends on the code unit width. */
+
+#if defined COMPILE_PCRE8
+#define SPECIAL_BLOCK real_pcre_special
+#elif defined COMPILE_PCRE16
+#define SPECIAL_BLOCK real_pcre16_special
+#elif defined COMPILE_PCRE32
+#define SPECIAL_BLOCK real_pcre32_special
+#endif
+
+/* The shapes of pattern. */
+
+enum { SHAPE_LITERAL, SHAPE_ALTERNATIVES, SHAPE_RUNS };
+
+/* The assertion at the end of the pattern, if any. */
+
+enum { END_NONE, END_EOD, END_EODN };
+
+/* The parts of a sequence. A group has a first set, which says whether to go
+into it, and a matching SOP_KET, which says whether to go round again. */
+
+enum { SOP_RUN, SOP_GROUP, SOP_KET };
+
+typedef struct sp_op {
+  int type;                   /* SOP_xxx */
+  int set;                    /* The item's set, or a group's first set */
+  int min;                    /* Minimum repeat */
+  int max;                    /* Maximum repeat, or -1 for no limit */
+  int other;                  /* The matching SOP_GROUP or SOP_KET */
+  BOOL tail_empty;            /* SOP_KET: what follows can match "" */
+} sp_op;
+
+/* A set of code units. In non-UTF modes other than 8-bit, a set either
+includes or excludes every unit above 255. */
+
+typedef struct sp_set {
+  pcre_uint8 bits[32];        /* Units below 256 */
+  BOOL large;                 /* TRUE if units above 255 are included */
+} sp_set;
+
+struct SPECIAL_BLOCK {
+  const REAL_PCRE *re;        /* The pattern it was built for */
+  int shape;                  /* SHAPE_xxx */
+  int end;                    /* END_xxx */
+  pcre_uchar nl;              /* The newline character for END_EODN */
+  BOOL circ;                  /* TRUE if it starts with ^ or \A */
+  BOOL anchored;              /* TRUE if it can only match at the start */
+  BOOL search;                /* TRUE if the automaton can be used to search */
+
+  /* A single literal. */
+
+  pcre_uchar *literal;
+  int length;
+
+  /* Literal alternatives. Node 0 is the root. An alternative ends at a node
+  if out[] is not negative; dict[] links to the next node on the failure path
+  at which one ends. */
+
+  pcre_uint16 *next;          /* 256 transitions per node */
+  int *depth;                 /* Distance from the root */
+  int *out;                   /* First alternative that ends here, or -1 */
+  int *dict;                  /* Next node with an alternative, or 0 */
+  int *lengths;               /* Length of each alternative */
+  int max_length;             /* Length of the longest one */
+  pcre_uint8 first_bits[32];  /* Code units that start an alternative */
+  scan_bits_tables scan;
+
+  /* A sequence of items and groups. */
+
+  sp_op *ops;
+  int op_count;
+  pcre_uint8 *maps;           /* 256 flags for each set */
+  BOOL *large;                /* Whether each set includes units above 255 */
+};
+
+/* The state of construction. */
+
+typedef struct sp_build {
+  const pcre_uint8 *lcc;      /* Lower casing table */
+  const pcre_uint8 *fcc;      /* Flip casing table */
+  const pcre_uint8 *ctypes;   /* Character types table */
+  pcre_uint32 nl;             /* The newline character */
+  BOOL nl_ok;                 /* TRUE if newline is a single character */
+  BOOL utf;
+  BOOL endonly;               /* PCRE_DOLLAR_ENDONLY */
+  BOOL circ;
+  int end;
+  int depth;
+
+  /* Literals: the set for each code unit, and where each alternative
+  starts. */
+
+  sp_set *units;
+  int unit_count;
+  int alt_start[MAX_ALTS + 1];
+  int alt_count;
+  BOOL exact;                 /* TRUE if every set is a single unit */
+  BOOL folded;                /* TRUE if every set is a whole case class */
+
+  /* Sequences. */
+
+  sp_op ops[MAX_OPS];
+  int op_count;
+  sp_set *sets;
+  int set_count;
+} sp_build;
+
+/* Minimum and maximum for the first six repeat opcodes of each kind; -1 is
+unlimited. The minimizing ones are not accepted. */
+
+static const int rep_min[] = { 0, 0, 1, 1, 0, 0 };
+static const int rep_max[] = { -1, -1, -1, -1, 1, 1 };
+
+/* Test a code unit against a table of flags and the setting for large
+units. */
+
+#if defined COMPILE_PCRE8
+#define IN_MAP(map, large, c) ((map)[c] != 0)
+#else
+#define IN_MAP(map, large, c) (((c) > 255)? (large) : ((map)[c] != 0))
+#endif
+
+
+
+/*************************************************
+*              Operations on sets                *
+*************************************************/
+
+static void
+set_add(sp_set *set, pcre_uint32 c)
+{
+set->bits[c/8] |= (pcre_uint8)(1 << (c&7));
+}
+
+static BOOL
+set_has(const sp_set *set, pcre_uint32 c)
+{
+return (set->bits[c/8] & (1 << (c&7))) != 0;
+}
+
+static void
+set_union(sp_set *set, const sp_set *other)
+{
+int i;
+for (i = 0; i < 32; i++) set->bits[i] |= other->bits[i];
+set->large |= other->large;
+}
+
+static BOOL
+set_overlap(const sp_set *a, const sp_set *b)
+{
+int i;
+if (a->large && b->large) return TRUE;
+for (i = 0; i < 32; i++) if ((a->bits[i] & b->bits[i]) != 0) return TRUE;
+return FALSE;
+}
+
+static BOOL
+set_equal(const sp_set *a, const sp_set *b)
+{
+return a->large == b->large && memcmp(a->bits, b->bits, 32) == 0;
+}
+
+/* Count the units in a set, stopping at 2. */
+
+static int
+set_size(const sp_set *set)
+{
+int c, n = 0;
+for (c = 0; c < 256 && n < 2; c++) if (set_has(set, c)) n++;
+return n;
+}
+
+/* In UTF mode a code unit above 127 is part of a multi-unit character, so a
+set that contains one cannot be tested a unit at a time. */
+
+static BOOL
+set_ascii(const sp_set *set)
+{
+int i;
+if (set->large) return FALSE;
+for (i = 16; i < 32; i++) if (set->bits[i] != 0) return FALSE;
+return TRUE;
+}
+
+
+
+/*************************************************
+*         Get the set for a single item          *
+*************************************************/
+
+/* The item is a character, a caseless character, a negated character, a
+class, or a character type. Caseless characters that are repeated are
+compared with their other case, while single ones are compared through the
+lower casing table, as in pcre_exec().
+
+Arguments:
+  b          the build state
+  op         the opcode, with repeats reduced to OP_CHAR, OP_CHARI, OP_NOT,
+               OP_NOTI, or the type opcode
+  p          points to the character, or to the class data
+  repeated   TRUE if the item came from a repeat opcode
+  set        where to put the set
+
+Returns:     FALSE if the item is not supported
+*/
+
+static BOOL
+item_set(sp_build *b, pcre_uchar op, const pcre_uchar *p, BOOL repeated,
+  sp_set *set)
+{
+pcre_uint32 c, fc = 0;
+#ifdef SUPPORT_UTF
+BOOL utf = b->utf;
+#endif
+
+memset(set, 0, sizeof(sp_set));
+if (op == OP_CHAR || op == OP_CHARI || op == OP_NOT || op == OP_NOTI)
+  {
+  GETCHARTEST(fc, p);
+  if (fc > 255) return FALSE;
+  }
+
+switch(op)
+  {
+  case OP_CHAR:
+  set_add(set, fc);
+  break;
+
+  case OP_CHARI:
+  if (repeated)
+    {
+    set_add(set, fc);
+    set_add(set, b->fcc[fc]);
+    }
+  else
+    {
+    for (c = 0; c < 256; c++)
+      if (b->lcc[c] == b->lcc[fc]) set_add(set, c);
+    }
+  break;
+
+  case OP_NOT:
+  case OP_NOTI:
+  memset(set->bits, 0xff, 32);
+  set->bits[fc/8] &= ~(1 << (fc&7));
+  if (op == OP_NOTI)
+    {
+    c = b->fcc[fc];
+    set->bits[c/8] &= ~(1 << (c&7));
+    }
+  set->large = TRUE;
+  break;
+
+  case OP_CLASS:
+  case OP_NCLASS:
+  memcpy(set->bits, p, 32);
+  set->large = op == OP_NCLASS;
+  break;
+
+  case OP_DIGIT:
+  case OP_WHITESPACE:
+  case OP_WORDCHAR:
+  case OP_NOT_DIGIT:
+  case OP_NOT_WHITESPACE:
+  case OP_NOT_WORDCHAR:
+    {
+    int bit = (op == OP_DIGIT || op == OP_NOT_DIGIT)? ctype_digit :
+      (op == OP_WHITESPACE || op == OP_NOT_WHITESPACE)? ctype_space :
+      ctype_word;
+    BOOL not = op == OP_NOT_DIGIT || op == OP_NOT_WHITESPACE ||
+      op == OP_NOT_WORDCHAR;
+    for (c = 0; c < 256; c++)
+      if (((b->ctypes[c] & bit) != 0) != not) set_add(set, c);
+    set->large = not;
+    }
+  break;
+
+  case OP_ANY:
+  if (!b->nl_ok) return FALSE;
+  memset(set->bits, 0xff, 32);
+  set->bits[b->nl/8] &= ~(1 << (b->nl&7));
+  set->large = TRUE;
+  break;
+
+  case OP_ALLANY:
+  case OP_ANYBYTE:
+  memset(set->bits, 0xff, 32);
+  set->large = TRUE;
+  break;
+
+  default:
+  return FALSE;
+  }
+
+#if defined COMPILE_PCRE8
+set->large = FALSE;
+#endif
+#ifdef SUPPORT_UTF
+if (utf && !set_ascii(set)) return FALSE;
+#endif
+return TRUE;
+}
+
+
+
+/*************************************************
+*          Add the units of a literal            *
+*************************************************/
+
+/* A literal is a sequence of OP_CHAR and OP_CHARI items. Each code unit is
+recorded as a set, which has more than one member for a caseless letter.
+
+Arguments:
+  b          the build state
+  code       the first item
+  end        the end of the items
+
+Returns:     FALSE if the items are not a literal
+*/
+
+static BOOL
+add_units(sp_build *b, const pcre_uchar *code, const pcre_uchar *end)
+{
+#ifdef SUPPORT_UTF
+BOOL utf = b->utf;
+#endif
+
+while (code < end)
+  {
+  pcre_uchar op = *code;
+  int len = 1, i;
+
+  if (op != OP_CHAR && op != OP_CHARI) return FALSE;
+#ifdef SUPPORT_UTF
+  if (utf && HAS_EXTRALEN(code[1])) len += GET_EXTRALEN(code[1]);
+#endif
+  if (b->unit_count + len > MAX_UNITS) return FALSE;
+
+  /* A character of more than one code unit can only be matched caselessly
+  through the other case of the whole character, so give up on that. In
+  UTF-16 the units of such a character are surrogates, which sets cannot
+  hold. */
+
+  if (len > 1)
+    {
+    if (op == OP_CHARI) return FALSE;
+    for (i = 0; i < len; i++)
+      {
+      sp_set *set = b->units + b->unit_count++;
+#ifndef COMPILE_PCRE8
+      if (code[1 + i] > 255) return FALSE;
+#endif
+      memset(set, 0, sizeof(sp_set));
+      set_add(set, code[1 + i]);
+      }
+    }
+  else
+    {
+    sp_set *set = b->units + b->unit_count;
+    if (!item_set(b, op, code + 1, FALSE, set)) return FALSE;
+    if (set_size(set) > 1) b->exact = FALSE;
+    if (op == OP_CHAR)
+      {
+      sp_set fold;
+      if (!item_set(b, OP_CHARI, code + 1, FALSE, &fold)) return FALSE;
+      if (!set_equal(set, &fold)) b->folded = FALSE;
+      }
+    b->unit_count++;
+    }
+  code += 1 + len;
+  }
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*          Add a literal alternative             *
+*************************************************/
+
+/* An alternative is a branch of literal items, with the literal prefix and
+suffix that surround its group, if any, joined on. The result must not be
+empty.
+
+Arguments:
+  b          the build state
+  code       the start of the branch
+  end        the OP_ALT or OP_KET that ends it
+  affix      the start and end of the prefix, then of the suffix
+
+Returns:     FALSE if the branch is not a literal
+*/
+
+static BOOL
+add_literal(sp_build *b, const pcre_uchar *code, const pcre_uchar *end,
+  const pcre_uchar **affix)
+{
+if (b->alt_count >= MAX_ALTS) return FALSE;
+b->alt_start[b->alt_count] = b->unit_count;
+
+if (!add_units(b, affix[0], affix[1]) || !add_units(b, code, end) ||
+    !add_units(b, affix[2], affix[3]))
+  return FALSE;
+
+if (b->unit_count == b->alt_start[b->alt_count]) return FALSE;
+b->alt_start[++b->alt_count] = b->unit_count;
+return TRUE;
+}
+
+
+
+/*************************************************
+*          Skip over literal items               *
+*************************************************/
+
+/* This is used to find the literal before and after a group.
+
+Arguments:
+  b          the build state
+  code       the first item
+  end        the end of the pattern's body
+
+Returns:     a pointer to the first item that is not a literal character
+*/
+
+static const pcre_uchar *
+skip_chars(sp_build *b, const pcre_uchar *code, const pcre_uchar *end)
+{
+#ifndef SUPPORT_UTF
+(void)b;
+#endif
+
+for (; code < end; code += 2)
+  {
+  if (*code != OP_CHAR && *code != OP_CHARI) break;
+#ifdef SUPPORT_UTF
+  if (b->utf && HAS_EXTRALEN(code[1])) code += GET_EXTRALEN(code[1]);
+#endif
+  }
+return code;
+}
+
+
+
+/*************************************************
+*       Recognize a list of literals             *
+*************************************************/
+
+/* The pattern is one group followed by OP_END. Its body may be a literal, or
+a single group of literal alternatives with a literal before and after it, or,
+if it has no assertions, a list of literal alternatives of its own. A group is
+expanded by joining its prefix and suffix onto each of its alternatives.
+
+Arguments:
+  b          the build state
+  code       the start of the pattern
+
+Returns:     FALSE if the pattern is not of this shape
+*/
+
+static BOOL
+get_literals(sp_build *b, const pcre_uchar *code)
+{
+const pcre_uchar *start = code + 1 + LINK_SIZE;
+const pcre_uchar *end = code + GET(code, 1);
+const pcre_uchar *group = NULL;
+const pcre_uchar *affix[4];
+
+b->exact = b->folded = TRUE;
+affix[0] = affix[1] = affix[2] = affix[3] = start;
+
+/* A list of alternatives in the pattern itself. */
+
+if (*end == OP_ALT)
+  {
+  for (;;)
+    {
+    if (!add_literal(b, start, end, affix)) return FALSE;
+    if (*end != OP_ALT) break;
+    start = end + 1 + LINK_SIZE;
+    end += GET(end, 1);
+    }
+  return *end == OP_KET && end[1 + LINK_SIZE] == OP_END;
+  }
+
+if (*end != OP_KET || end[1 + LINK_SIZE] != OP_END) return FALSE;
+
+if (*start == OP_CIRC || *start == OP_SOD)
+  {
+  b->circ = TRUE;
+  start++;
+  }
+
+/* Find the end of the literal or of the group and its suffix, which may be
+followed by an assertion. */
+
+code = skip_chars(b, start, end);
+if (code < end && (*code == OP_BRA || *code == OP_CBRA))
+  {
+  group = code;
+  affix[0] = start;
+  affix[1] = group;
+  do code += GET(code, 1); while (*code == OP_ALT);
+  if (*code != OP_KET) return FALSE;
+  affix[2] = code + 1 + LINK_SIZE;
+  code = affix[3] = skip_chars(b, affix[2], end);
+  }
+
+if (code < end)
+  {
+  switch(*code)
+    {
+    case OP_DOLL: b->end = b->endonly? END_EOD : END_EODN; break;
+    case OP_EODN: b->end = END_EODN; break;
+    case OP_EOD: b->end = END_EOD; break;
+    default: return FALSE;
+    }
+  if (code + 1 != end) return FALSE;
+  if (b->end == END_EODN && !b->nl_ok) return FALSE;
+  end = code;
+  }
+
+/* A single group that is not repeated. */
+
+if (group != NULL)
+  {
+  start = group + 1 + LINK_SIZE + ((*group == OP_CBRA)? IMM2_SIZE : 0);
+  code = group + GET(group, 1);
+  for (;;)
+    {
+    if (!add_literal(b, start, code, affix)) return FALSE;
+    if (*code != OP_ALT) break;
+    start = code + 1 + LINK_SIZE;
+    code += GET(code, 1);
+    }
+  return TRUE;
+  }
+
+return add_literal(b, start, end, affix);
+}
+
+
+
+/*************************************************
+*        Build the Aho-Corasick automaton        *
+*************************************************/
+
+/* The literals are first entered into a trie. A node is shared by two
+alternatives only if they reach it with the same set, and it is an error for
+two different nodes to be reached from the same node by one code unit. Then
+the missing transitions are filled in, breadth first, from the failure links.
+
+Arguments:
+  b          the build state
+  sp         the block, with next, depth, out, dict, and lengths allocated
+               for MAX_NODES nodes
+
+Returns:     the number of nodes, or -1 if the literals do not fit
+*/
+
+static int
+build_automaton(sp_build *b, struct SPECIAL_BLOCK *sp)
+{
+int *entry;                 /* The unit by which each node is reached */
+int *fail, *queue;
+pcre_uint8 *queued;
+int count = 1, head = 0, tail = 0;
+int a, k, c, u, v;
+int rc = -1;
+
+entry = (int *)(PUBL(malloc))(3 * MAX_NODES * sizeof(int) + MAX_NODES);
+if (entry == NULL) return -1;
+fail = entry + MAX_NODES;
+queue = fail + MAX_NODES;
+queued = (pcre_uint8 *)(queue + MAX_NODES);
+
+memset(sp->next, 0, 256 * MAX_NODES * sizeof(pcre_uint16));
+sp->depth[0] = 0;
+sp->out[0] = -1;
+sp->max_length = 0;
+memset(sp->first_bits, 0, 32);
+
+for (a = 0; a < b->alt_count; a++)
+  {
+  u = 0;
+  for (k = b->alt_start[a]; k < b->alt_start[a + 1]; k++)
+    {
+    const sp_set *set = b->units + k;
+    int target = -1;
+    BOOL missing = FALSE;
+
+    for (c = 0; c < 256; c++)
+      {
+      if (!set_has(set, c)) continue;
+      v = sp->next[u * 256 + c];
+      if (v == 0) missing = TRUE;
+      else if (target < 0) target = v;
+      else if (v != target) goto EXIT;
+      }
+
+    if (target >= 0)
+      {
+      if (missing || !set_equal(b->units + entry[target], set)) goto EXIT;
+      u = target;
+      continue;
+      }
+
+    if (count >= MAX_NODES) goto EXIT;
+    v = count++;
+    entry[v] = k;
+    sp->depth[v] = sp->depth[u] + 1;
+    sp->out[v] = -1;
+    for (c = 0; c < 256; c++)
+      if (set_has(set, c)) sp->next[u * 256 + c] = (pcre_uint16)v;
+    u = v;
+    }
+
+  if (sp->out[u] < 0) sp->out[u] = a;
+  sp->lengths[a] = b->alt_start[a + 1] - b->alt_start[a];
+  if (sp->lengths[a] > sp->max_length) sp->max_length = sp->lengths[a];
+  }
+
+/* Breadth first from the root. A node may be reached from its parent by
+more than one unit of a set, so it is queued only once. When a node is taken
+from the queue, its own transitions are still only to its children, and every
+node nearer the root is complete. */
+
+memset(queued, 0, count);
+fail[0] = 0;
+sp->dict[0] = 0;
+for (c = 0; c < 256; c++)
+  {
+  v = sp->next[c];
+  if (v == 0) continue;
+  sp->first_bits[c/8] |= (pcre_uint8)(1 << (c&7));
+  if (queued[v]) continue;
+  queued[v] = TRUE;
+  fail[v] = 0;
+  sp->dict[v] = 0;
+  queue[tail++] = v;
+  }
+
+while (head < tail)
+  {
+  u = queue[head++];
+  for (c = 0; c < 256; c++)
+    {
+    v = sp->next[u * 256 + c];
+    if (v == 0)
+      {
+      sp->next[u * 256 + c] = sp->next[fail[u] * 256 + c];
+      continue;
+      }
+    if (queued[v]) continue;
+    queued[v] = TRUE;
+    fail[v] = sp->next[fail[u] * 256 + c];
+    sp->dict[v] = (sp->out[fail[v]] >= 0)? fail[v] : sp->dict[fail[v]];
+    queue[tail++] = v;
+    }
+  }
+
+rc = count;
+
+EXIT:
+(PUBL(free))(entry);
+return rc;
+}
+
+
+
+/*************************************************
+*          Add a set for a sequence              *
+*************************************************/
+
+/* Sets are shared by items that match the same code units.
+
+Arguments:
+  b          the build state
+  set        the set
+
+Returns:     the set number, or -1 if there are too many
+*/
+
+static int
+add_set(sp_build *b, const sp_set *set)
+{
+int i;
+for (i = 0; i < b->set_count; i++)
+  if (set_equal(b->sets + i, set)) return i;
+if (b->set_count >= MAX_OPS) return -1;
+b->sets[b->set_count] = *set;
+return b->set_count++;
+}
+
+
+
+/*************************************************
+*       Read a single item and its repeat        *
+*************************************************/
+
+/*
+Arguments:
+  b          the build state
+  code       points to the item
+  set        where to put its set
+  minp       where to put the minimum repeat
+  maxp       where to put the maximum repeat, -1 for no limit
+
+Returns:     pointer to the next item, or NULL if the item is not supported
+*/
+
+static const pcre_uchar *
+read_item(sp_build *b, const pcre_uchar *code, sp_set *set, int *minp,
+  int *maxp)
+{
+pcre_uchar op = *code;
+const pcre_uchar *p = code + 1;
+int min = 1, max = 1, r;
+#ifdef SUPPORT_UTF
+BOOL utf = b->utf;
+#endif
+
+if (op == OP_CLASS || op == OP_NCLASS)
+  {
+  if (!item_set(b, op, p, FALSE, set)) return NULL;
+  p = code + PRIV(OP_lengths)[op];
+  if (*p >= OP_CRSTAR && *p <= OP_CRPOSRANGE)
+    {
+    r = *p - OP_CRSTAR;
+    if (r >= OP_CRPOSSTAR - OP_CRSTAR)
+      {
+      r -= OP_CRPOSSTAR - OP_CRSTAR;
+      if (r == 3) r = OP_CRRANGE - OP_CRSTAR; else r *= 2;
+      }
+    if ((r & 1) != 0) return NULL;        /* Minimizing */
+    if (r < 6)
+      {
+      min = rep_min[r];
+      max = rep_max[r];
+      }
+    else
+      {
+      min = GET2(p, 1);
+      max = GET2(p, 1 + IMM2_SIZE);
+      if (max == 0) max = -1;
+      }
+    p += PRIV(OP_lengths)[*p];
+    }
+  }
+
+else if (op >= OP_STAR && op <= OP_TYPEPOSUPTO)
+  {
+  pcre_uchar base;
+
+  if (op < OP_STARI) { base = OP_CHAR; r = op - OP_STAR; }
+  else if (op < OP_NOTSTAR) { base = OP_CHARI; r = op - OP_STARI; }
+  else if (op < OP_NOTSTARI) { base = OP_NOT; r = op - OP_NOTSTAR; }
+  else if (op < OP_TYPESTAR) { base = OP_NOTI; r = op - OP_NOTSTARI; }
+  else { base = 0; r = op - OP_TYPESTAR; }
+
+  if (r < 6)
+    {
+    if ((r & 1) != 0) return NULL;        /* Minimizing */
+    min = rep_min[r];
+    max = rep_max[r];
+    }
+  else if (r < OP_POSSTAR - OP_STAR)
+    {
+    if (r == OP_MINUPTO - OP_STAR) return NULL;
+    max = GET2(p, 0);
+    min = (r == OP_EXACT - OP_STAR)? max : 0;
+    p += IMM2_SIZE;
+    }
+  else if (r == OP_POSUPTO - OP_STAR)
+    {
+    min = 0;
+    max = GET2(p, 0);
+    p += IMM2_SIZE;
+    }
+  else
+    {
+    min = rep_min[(r - (OP_POSSTAR - OP_STAR)) * 2];
+    max = rep_max[(r - (OP_POSSTAR - OP_STAR)) * 2];
+    }
+
+  if (base == 0)
+    {
+    if (!item_set(b, *p, p + 1, TRUE, set)) return NULL;
+    p++;
+    }
+  else
+    {
+    if (!item_set(b, base, p, TRUE, set)) return NULL;
+    p++;
+#ifdef SUPPORT_UTF
+    if (utf && HAS_EXTRALEN(p[-1])) return NULL;
+#endif
+    }
+  }
+
+else
+  {
+  if (!item_set(b, op, p, FALSE, set)) return NULL;
+  if (op == OP_CHAR || op == OP_CHARI || op == OP_NOT || op == OP_NOTI) p++;
+  }
+
+*minp = min;
+*maxp = max;
+return p;
+}
+
+
+
+/*************************************************
+*          Compile a sequence                    *
+*************************************************/
+
+/* Groups that are neither optional nor repeated are flattened into the
+sequence that contains them. Others must have a single branch; limited repeats
+of groups have already been written out by pcre_compile(), using BRAZERO for
+the optional copies. Possessive groups are treated as greedy, which gives the
+same result once check_sequence() has accepted the sequence.
+
+Arguments:
+  b          the build state
+  code       the first item
+  end        the OP_KET that ends the sequence
+  top        TRUE for the pattern itself, where ^ and $ may appear
+
+Returns:     FALSE if the sequence is not supported
+*/
+
+static BOOL
+compile_sequence(sp_build *b, const pcre_uchar *code, const pcre_uchar *end,
+  BOOL top)
+{
+const pcre_uchar *first = code;
+#ifdef SUPPORT_UTF
+BOOL utf = b->utf;
+#endif
+
+if (++b->depth > MAX_DEPTH) return FALSE;
+
+while (code < end)
+  {
+  pcre_uchar op = *code;
+  int min = 1, max = 1;
+  sp_set set;
+
+  switch(op)
+    {
+    case OP_CIRC:
+    case OP_SOD:
+    if (!top || code != first) return FALSE;
+    b->circ = TRUE;
+    code++;
+    continue;
+
+    case OP_DOLL:
+    case OP_EODN:
+    case OP_EOD:
+    if (!top || code + 1 != end) return FALSE;
+    b->end = (op == OP_EOD || (op == OP_DOLL && b->endonly))?
+      END_EOD : END_EODN;
+    if (b->end == END_EODN && !b->nl_ok) return FALSE;
+    code++;
+    continue;
+
+    case OP_BRAZERO:
+    case OP_BRAPOSZERO:
+    min = 0;
+    code++;
+    if (*code != OP_BRA && *code != OP_CBRA && *code != OP_BRAPOS &&
+        *code != OP_CBRAPOS) return FALSE;
+    /* Fall through */
+
+    case OP_BRA:
+    case OP_BRAPOS:
+    case OP_CBRA:
+    case OP_CBRAPOS:
+      {
+      const pcre_uchar *ket = code + GET(code, 1);
+      const pcre_uchar *start = code + 1 + LINK_SIZE +
+        ((*code == OP_CBRA || *code == OP_CBRAPOS)? IMM2_SIZE : 0);
+      int g, k;
+
+      if (*ket == OP_KETRMAX || *ket == OP_KETRPOS) max = -1;
+        else if (*ket != OP_KET) return FALSE;
+      if (min == 1 && max == 1)
+        {
+        if (!compile_sequence(b, start, ket, FALSE)) return FALSE;
+        }
+      else
+        {
+        if (b->op_count >= MAX_OPS) return FALSE;
+        g = b->op_count++;
+        b->ops[g].type = SOP_GROUP;
+        b->ops[g].min = min;
+        b->ops[g].max = max;
+        if (!compile_sequence(b, start, ket, FALSE) ||
+            b->op_count >= MAX_OPS)
+          return FALSE;
+        k = b->op_count++;
+        b->ops[k].type = SOP_KET;
+        b->ops[k].other = g;
+        b->ops[g].other = k;
+        }
+      code = ket + 1 + LINK_SIZE;
+      }
+    continue;
+
+    /* A character of more than one code unit is a run of each unit. This is
+    not possible for the surrogates of UTF-16. */
+
+    case OP_CHAR:
+#ifdef SUPPORT_UTF
+    if (utf && HAS_EXTRALEN(code[1]))
+      {
+      int len = 1 + GET_EXTRALEN(code[1]), i;
+      for (i = 0; i < len; i++)
+        {
+        sp_op *sop;
+        int s;
+#ifndef COMPILE_PCRE8
+        if (code[1 + i] > 255) return FALSE;
+#endif
+        memset(&set, 0, sizeof(sp_set));
+        set_add(&set, code[1 + i]);
+        if ((s = add_set(b, &set)) < 0 || b->op_count >= MAX_OPS)
+          return FALSE;
+        sop = b->ops + b->op_count++;
+        sop->type = SOP_RUN;
+        sop->set = s;
+        sop->min = sop->max = 1;
+        }
+      code += 1 + len;
+      continue;
+      }
+#endif
+    break;
+    }
+
+  code = read_item(b, code, &set, &min, &max);
+  if (code == NULL || code > end) return FALSE;
+  if (max != 0)
+    {
+    sp_op *sop;
+    int s = add_set(b, &set);
+    if (s < 0 || b->op_count >= MAX_OPS) return FALSE;
+    sop = b->ops + b->op_count++;
+    sop->type = SOP_RUN;
+    sop->set = s;
+    sop->min = min;
+    sop->max = max;
+    }
+  }
+
+b->depth--;
+return TRUE;
+}
+
+
+
+/*************************************************
+*     Find the first units of a sequence         *
+*************************************************/
+
+/*
+Arguments:
+  b          the build state
+  from       the first op
+  to         the op after the last
+  first      where to put the set of units that can start it
+
+Returns:     TRUE if the sequence can match an empty string
+*/
+
+static BOOL
+sequence_first(const sp_build *b, int from, int to, sp_set *first)
+{
+int k = from;
+
+memset(first, 0, sizeof(sp_set));
+while (k < to)
+  {
+  const sp_op *sop = b->ops + k;
+  if (sop->type == SOP_RUN)
+    {
+    set_union(first, b->sets + sop->set);
+    if (sop->min > 0) return FALSE;
+    k++;
+    }
+  else
+    {
+    sp_set body;
+    BOOL nullable = sequence_first(b, k + 1, sop->other, &body);
+    set_union(first, &body);
+    if (sop->min > 0 && !nullable) return FALSE;
+    k = sop->other + 1;
+    }
+  }
+return TRUE;
+}
+
+
+
+/*************************************************
+*   Check that a sequence can match greedily     *
+*************************************************/
+
+/* Working backwards, each optional part must not be able to start with a
+unit that could start what follows it. Groups must not match an empty string.
+The first set of each group is recorded.
+
+Arguments:
+  b          the build state
+  from       the first op
+  to         the op after the last
+  follow     the units that can follow the sequence
+
+Returns:     FALSE if the sequence is not deterministic
+*/
+
+static BOOL
+check_sequence(sp_build *b, int from, int to, const sp_set *follow)
+{
+sp_set after = *follow;
+int k = to;
+
+while (k > from)
+  {
+  sp_op *sop = b->ops + k - 1;
+  if (sop->type == SOP_RUN)
+    {
+    const sp_set *set = b->sets + sop->set;
+    if ((sop->max < 0 || sop->max > sop->min) && set_overlap(set, &after))
+      return FALSE;
+    if (sop->min > 0) after = *set; else set_union(&after, set);
+    k--;
+    }
+  else
+    {
+    sp_op *group = b->ops + sop->other;
+    sp_set first, body_follow;
+    int s;
+
+    if (sequence_first(b, sop->other + 1, k - 1, &first) ||
+        set_overlap(&first, &after))
+      return FALSE;
+    body_follow = after;
+    if (group->max < 0) set_union(&body_follow, &first);
+    if (!check_sequence(b, sop->other + 1, k - 1, &body_follow)) return FALSE;
+    if ((s = add_set(b, &first)) < 0) return FALSE;
+    group->set = s;
+    if (group->min > 0) after = first; else set_union(&after, &first);
+    k = sop->other;
+    }
+  }
+return TRUE;
+}
+
+
+
+/*************************************************
+*      Build a specialized matcher               *
+*************************************************/
+
+/* Called by pcre_study() for every pattern.
+
+Argument:   the compiled pattern
+Returns:    a pointer to the matcher, or NULL if the pattern has none of the
+              shapes that are recognized, or there is no memory
+*/
+
+void *
+PRIV(special_compile)(const REAL_PCRE *re)
+{
+sp_build *b;
+struct SPECIAL_BLOCK *sp = NULL;
+struct SPECIAL_BLOCK *work = NULL;
+const pcre_uchar *code, *end;
+const pcre_uint8 *tables;
+size_t size;
+BOOL literals, nullable;
+int newline, count, i, c;
+
+if ((re->options & PCRE_FIRSTLINE) != 0) return NULL;
+
+code = (const pcre_uchar *)re + re->name_table_offset +
+  re->name_count * re->name_entry_size;
+
+tables = re->tables;
+if (tables == NULL) tables = PRIV(default_tables);
+
+switch(re->options & PCRE_NEWLINE_BITS)
+  {
+  case 0: newline = NEWLINE; break;
+  case PCRE_NEWLINE_CR: newline = CHAR_CR; break;
+  case PCRE_NEWLINE_LF: newline = CHAR_NL; break;
+  default: newline = -1; break;
+  }
+
+b = (sp_build *)(PUBL(malloc))(sizeof(sp_build) +
+  (MAX_UNITS + MAX_OPS) * sizeof(sp_set));
+if (b == NULL) return NULL;
+memset(b, 0, sizeof(sp_build));
+b->units = (sp_set *)(b + 1);
+b->sets = b->units + MAX_UNITS;
+b->lcc = tables + lcc_offset;
+b->fcc = tables + fcc_offset;
+b->ctypes = tables + ctypes_offset;
+b->nl_ok = newline == CHAR_CR || newline == CHAR_NL;
+b->nl = b->nl_ok? (pcre_uint32)newline : 0;
+b->utf = (re->options & PCRE_UTF8) != 0;
+b->endonly = (re->options & PCRE_DOLLAR_ENDONLY) != 0;
+
+/* A single literal. */
+
+literals = get_literals(b, code);
+if (literals && b->exact && b->alt_count == 1)
+  {
+  size = sizeof(struct SPECIAL_BLOCK) + b->unit_count * sizeof(pcre_uchar);
+  sp = (struct SPECIAL_BLOCK *)(PUBL(malloc))(size);
+  if (sp == NULL) goto EXIT;
+  memset(sp, 0, sizeof(struct SPECIAL_BLOCK));
+  sp->shape = SHAPE_LITERAL;
+  sp->literal = (pcre_uchar *)(sp + 1);
+  sp->length = b->unit_count;
+  for (i = 0; i < b->unit_count; i++)
+    {
+    for (c = 0; !set_has(b->units + i, c); c++) {}
+    sp->literal[i] = (pcre_uchar)c;
+    }
+  }
+
+/* Literal alternatives. The automaton is built at its largest size and then
+copied. */
+
+else if (literals)
+  {
+  size = sizeof(struct SPECIAL_BLOCK) + 3 * MAX_NODES * sizeof(int) +
+    MAX_ALTS * sizeof(int) + 256 * MAX_NODES * sizeof(pcre_uint16);
+  work = (struct SPECIAL_BLOCK *)(PUBL(malloc))(size);
+  if (work == NULL) goto EXIT;
+  work->depth = (int *)(work + 1);
+  work->out = work->depth + MAX_NODES;
+  work->dict = work->out + MAX_NODES;
+  work->lengths = work->dict + MAX_NODES;
+  work->next = (pcre_uint16 *)(work->lengths + MAX_ALTS);
+  if ((count = build_automaton(b, work)) < 0) goto EXIT;
+
+  size = sizeof(struct SPECIAL_BLOCK) + 3 * count * sizeof(int) +
+    b->alt_count * sizeof(int) + 256 * count * sizeof(pcre_uint16);
+  sp = (struct SPECIAL_BLOCK *)(PUBL(malloc))(size);
+  if (sp == NULL) goto EXIT;
+  memset(sp, 0, sizeof(struct SPECIAL_BLOCK));
+  sp->shape = SHAPE_ALTERNATIVES;
+  sp->depth = (int *)(sp + 1);
+  sp->out = sp->depth + count;
+  sp->dict = sp->out + count;
+  sp->lengths = sp->dict + count;
+  sp->next = (pcre_uint16 *)(sp->lengths + b->alt_count);
+  memcpy(sp->depth, work->depth, count * sizeof(int));
+  memcpy(sp->out, work->out, count * sizeof(int));
+  memcpy(sp->dict, work->dict, count * sizeof(int));
+  memcpy(sp->lengths, work->lengths, b->alt_count * sizeof(int));
+  memcpy(sp->next, work->next, 256 * count * sizeof(pcre_uint16));
+  memcpy(sp->first_bits, work->first_bits, 32);
+  sp->max_length = work->max_length;
+  PRIV(scan_bits_init)(&sp->scan, sp->first_bits);
+
+  /* The failure links depend only on the node if every set is either a
+  single unit or a whole case class. */
+
+  sp->search = b->exact || b->folded;
+  }
+
+/* A sequence of runs and groups. */
+
+else
+  {
+  sp_set follow;
+
+  b->circ = FALSE;
+  b->end = END_NONE;
+  end = code + GET(code, 1);
+  if (*end != OP_KET || end[1 + LINK_SIZE] != OP_END ||
+      !compile_sequence(b, code + 1 + LINK_SIZE, end, TRUE) ||
+      b->op_count == 0)
+    goto EXIT;
+
+  memset(&follow, 0, sizeof(sp_set));
+  if (b->end == END_EODN) set_add(&follow, b->nl);
+  if (!check_sequence(b, 0, b->op_count, &follow)) goto EXIT;
+
+  /* Record for each group whether everything after it can match an empty
+  string, working backwards. */
+
+  nullable = TRUE;
+  for (i = b->op_count - 1; i >= 0; i--)
+    {
+    sp_op *sop = b->ops + i;
+    if (sop->type == SOP_KET) sop->tail_empty = nullable;
+    else if (sop->type == SOP_RUN) nullable = nullable && sop->min == 0;
+    else nullable = sop->min == 0 && b->ops[sop->other].tail_empty;
+    }
+
+  size = sizeof(struct SPECIAL_BLOCK) + b->op_count * sizeof(sp_op) +
+    b->set_count * (sizeof(BOOL) + 256);
+  sp = (struct SPECIAL_BLOCK *)(PUBL(malloc))(size);
+  if (sp == NULL) goto EXIT;
+  memset(sp, 0, sizeof(struct SPECIAL_BLOCK));
+  sp->shape = SHAPE_RUNS;
+  sp->ops = (sp_op *)(sp + 1);
+  sp->large = (BOOL *)(sp->ops + b->op_count);
+  sp->maps = (pcre_uint8 *)(sp->large + b->set_count);
+  sp->op_count = b->op_count;
+  memcpy(sp->ops, b->ops, b->op_count * sizeof(sp_op));
+  for (i = 0; i < b->set_count; i++)
+    {
+    sp->large[i] = b->sets[i].large;
+    for (c = 0; c < 256; c++)
+      sp->maps[i * 256 + c] = set_has(b->sets + i, c)? 1 : 0;
+    }
+  }
+
+sp->re = re;
+sp->end = b->end;
+sp->nl = (pcre_uchar)b->nl;
+sp->circ = b->circ;
+sp->anchored = (re->options & PCRE_ANCHORED) != 0;
+
+EXIT:
+if (work != NULL) (PUBL(free))(work);
+(PUBL(free))(b);
+return sp;
+}
+
+
+
+/*************************************************
+*      Check the assertion at the end            *
+*************************************************/
+
+static BOOL
+end_ok(const struct SPECIAL_BLOCK *sp, PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+switch(sp->end)
+  {
+  case END_EOD: return p == end;
+  case END_EODN: return p == end || (p == end - 1 && *p == sp->nl);
+  }
+return TRUE;
+}
+
+
+
+/*************************************************
+*      Match with a specialized matcher          *
+*************************************************/
+
+/* Called by pcre_exec() when there are none of the options that the matchers
+do not handle.
+
+Arguments:
+  re            the compiled pattern
+  special       the matcher
+  subject       the subject string
+  length        its length
+  start_offset  where to start
+  anchored      TRUE if PCRE_ANCHORED was given to pcre_exec()
+  match         where to put the start and end offsets of a match
+
+Returns:        SPECIAL_NOMATCH, SPECIAL_MATCH, or SPECIAL_FAILED if the
+                matcher cannot be used
+*/
+
+int
+PRIV(special_exec)(const REAL_PCRE *re, void *special, PCRE_PUCHAR subject,
+  int length, int start_offset, BOOL anchored, int *match)
+{
+const struct SPECIAL_BLOCK *sp = (const struct SPECIAL_BLOCK *)special;
+PCRE_PUCHAR start = subject + start_offset;
+PCRE_PUCHAR end = subject + length;
+PCRE_PUCHAR p = start;
+
+if (sp->re != re) return SPECIAL_FAILED;
+if (sp->circ && start_offset != 0) return SPECIAL_NOMATCH;
+anchored = anchored || sp->anchored;
+
+switch(sp->shape)
+  {
+  /* A literal at a fixed place is compared. Otherwise, if it must end at the
+  end of the subject, there are at most two places to look; if not, look for
+  its first code unit and compare the rest. */
+
+  case SHAPE_LITERAL:
+    {
+    size_t rest = (sp->length - 1) * sizeof(pcre_uchar);
+    PCRE_PUCHAR last = end - sp->length;
+
+    if (last < start) return SPECIAL_NOMATCH;
+    if (!anchored && sp->end != END_NONE)
+      {
+      if (sp->end == END_EODN && *(end - 1) == sp->nl && last - 1 >= start &&
+          memcmp(last - 1, sp->literal, sp->length * sizeof(pcre_uchar)) == 0)
+        p = last - 1;
+      else if (memcmp(last, sp->literal, sp->length * sizeof(pcre_uchar))
+          == 0)
+        p = last;
+      else return SPECIAL_NOMATCH;
+      }
+    else if (anchored)
+      {
+      if (memcmp(p, sp->literal, sp->length * sizeof(pcre_uchar)) != 0 ||
+          !end_ok(sp, p + sp->length, end))
+        return SPECIAL_NOMATCH;
+      }
+    else for (;; p++)
+      {
+      p = PRIV(scan_chars)(p, last + 1, sp->literal[0], sp->literal[0]);
+      if (p > last) return SPECIAL_NOMATCH;
+      if (memcmp(p + 1, sp->literal + 1, rest) == 0) break;
+      }
+    match[0] = (int)(p - subject);
+    match[1] = match[0] + sp->length;
+    }
+  return SPECIAL_MATCH;
+
+  /* An anchored match follows the trie: a transition that does not take it
+  one step further from the root is a failure transition. The first
+  alternative that matches wins. */
+
+  case SHAPE_ALTERNATIVES:
+  if (anchored)
+    {
+    int s = 0, best = -1;
+    while (p < end)
+      {
+      pcre_uint32 c = *p++;
+      int t;
+#ifndef COMPILE_PCRE8
+      if (c > 255) break;
+#endif
+      t = sp->next[s * 256 + c];
+      if (sp->depth[t] != sp->depth[s] + 1) break;
+      s = t;
+      if (sp->out[s] >= 0 && (best < 0 || sp->out[s] < best) &&
+          end_ok(sp, p, end))
+        best = sp->out[s];
+      }
+    if (best < 0) return SPECIAL_NOMATCH;
+    match[0] = start_offset;
+    match[1] = start_offset + sp->lengths[best];
+    return SPECIAL_MATCH;
+    }
+
+  /* A search finds the match that starts first, and of those the first
+  alternative. It can stop when no match that starts earlier than the best one
+  can still end. When the automaton is at the root, skip to a code unit that
+  can start an alternative. If the match must end at the end of the subject,
+  it cannot start before the longest alternative, with a newline, would. */
+
+  else if (sp->search)
+    {
+    int s = 0, best = -1, best_start = 0;
+    if (sp->end != END_NONE && end - p > sp->max_length + 1)
+      p = end - sp->max_length - 1;
+    for (;;)
+      {
+      pcre_uint32 c;
+      int u;
+
+      if (s == 0)
+        {
+        if (best >= 0) break;
+        p = PRIV(scan_bits)(&sp->scan, p, end);
+        }
+      if (p >= end) break;
+      c = *p++;
+#ifndef COMPILE_PCRE8
+      if (c > 255) { s = 0; continue; }
+#endif
+      s = sp->next[s * 256 + c];
+      for (u = (sp->out[s] >= 0)? s : sp->dict[s]; u != 0; u = sp->dict[u])
+        {
+        int a = sp->out[u];
+        int m = (int)(p - subject) - sp->lengths[a];
+        if ((best < 0 || m < best_start || (m == best_start && a < best)) &&
+            end_ok(sp, p, end))
+          {
+          best = a;
+          best_start = m;
+          }
+        }
+      if (best >= 0 && (int)(p - subject) - best_start >= sp->max_length)
+        break;
+      }
+    if (best < 0) return SPECIAL_NOMATCH;
+    match[0] = best_start;
+    match[1] = best_start + sp->lengths[best];
+    return SPECIAL_MATCH;
+    }
+  return SPECIAL_FAILED;
+
+  /* A sequence is matched in one pass. Each run takes as many units as it
+  can, and a group is entered, or entered again, if the next unit can start
+  it. If that iteration then fails, the match ends where it started, provided
+  that nothing after the group has to match anything. */
+
+  case SHAPE_RUNS:
+  if (!anchored) return SPECIAL_FAILED;
+    {
+    const sp_op *ops = sp->ops;
+    PCRE_PUCHAR fallback = NULL;
+    int pc = 0;
+
+    while (pc < sp->op_count)
+      {
+      const sp_op *sop = ops + pc;
+      const pcre_uint8 *map;
+
+      switch(sop->type)
+        {
+        case SOP_RUN:
+          {
+          PCRE_PUCHAR q = p;
+          PCRE_PUCHAR limit = (sop->max < 0 || sop->max > end - p)?
+            end : p + sop->max;
+          map = sp->maps + sop->set * 256;
+          while (q < limit && IN_MAP(map, sp->large[sop->set], *q)) q++;
+          if (q - p < sop->min)
+            {
+            if (fallback == NULL || !end_ok(sp, fallback, end))
+              return SPECIAL_NOMATCH;
+            p = fallback;
+            pc = sp->op_count;
+            break;
+            }
+          p = q;
+          pc++;
+          }
+        break;
+
+        case SOP_GROUP:
+        map = sp->maps + sop->set * 256;
+        if (sop->min > 0 || (p < end && IN_MAP(map, sp->large[sop->set], *p)))
+          {
+          if (sop->min == 0 && ops[sop->other].tail_empty) fallback = p;
+          pc++;
+          }
+        else pc = sop->other + 1;
+        break;
+
+        case SOP_KET:
+          {
+          const sp_op *group = ops + sop->other;
+          map = sp->maps + group->set * 256;
+          if (group->max < 0 && p < end &&
+              IN_MAP(map, sp->large[group->set], *p))
+            {
+            if (sop->tail_empty) fallback = p;
+            pc = sop->other + 1;
+            }
+          else pc++;
+          }
+        break;
+        }
+      }
+
+    if (!end_ok(sp, p, end)) return SPECIAL_NOMATCH;
+    match[0] = start_offset;
+    match[1] = (int)(p - subject);
+    }
+  return SPECIAL_MATCH;
+  }
+
+return SPECIAL_FAILED;
+}
+
+
+
+/*************************************************
+*          Free a specialized matcher            *
+*************************************************/
+
+void
+PRIV(special_free)(void *special)
+{
+(PUBL(free))(special);
+}
+
+/* End of pcre_special.c */
@@ -0,0 +1,545 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+/* This module contains the external functions pcre_stream_create(),
+pcre_stream_feed(), pcre_stream_exec() and pcre_stream_free(), which find
+the matches of a pattern in data that arrives in pieces, such as reads from a
+socket, without the caller having to keep the data or to restart partial
+matches.
+
+The stream keeps the data that has not yet been searched, plus enough of the
+data before it for lookbehind assertions, \b, and ^ in multiline mode. Each
+search uses PCRE_PARTIAL_HARD. When a match might continue into data that has
+not arrived, pcre_exec() returns a partial match, and the data from where that
+match started is kept; the match is retried from the same place when more data
+is fed. Everything else is dropped when the next piece is fed, so the memory
+used depends on the longest pending match, not on the length of the stream.
+
+pcre_dfa_exec() with PCRE_DFA_RESTART would need less data to be kept, but it
+cannot report where a match that began in an earlier piece started, so it is
+not used. */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcre_internal.h"
+
+#if defined COMPILE_PCRE8
+#define STREAM_BLOCK real_pcre_stream
+#define STREAM_SPTR PCRE_SPTR
+#elif defined COMPILE_PCRE16
+#define STREAM_BLOCK real_pcre16_stream
+#define STREAM_SPTR PCRE_SPTR16
+#elif defined COMPILE_PCRE32
+#define STREAM_BLOCK real_pcre32_stream
+#define STREAM_SPTR PCRE_SPTR32
+#endif
+
+struct STREAM_BLOCK {
+  const REAL_PCRE *re;            /* The pattern */
+  const PUBL(extra) *extra;       /* Its study data, or NULL */
+  int options;                    /* Options for every pcre_exec() call */
+  BOOL utf;                       /* The pattern is in UTF mode */
+  int lookbehind;                 /* Characters to keep before a search */
+  pcre_uchar *buffer;             /* The data that is kept */
+  int size;                       /* Its size in code units */
+  int length;                     /* Code units in use */
+  int complete;                   /* Code units that end in a whole char */
+  int start;                      /* Where the next search starts */
+  int keep;                       /* First code unit that must be kept */
+  size_t base;                    /* Stream offset of buffer[0] */
+  BOOL empty;                     /* The last match was empty */
+  BOOL last;                      /* The last piece has been fed */
+  int ovector_size;               /* Size of ovector */
+  int *ovector;                   /* For pcre_exec() */
+};
+
+/* The options that may be given to pcre_stream_create(). Partial matching
+and the UTF check are managed by the stream. */
+
+#define STREAM_OPTIONS (PUBLIC_EXEC_OPTIONS & ~(PCRE_NO_UTF8_CHECK| \
+  PCRE_PARTIAL_HARD|PCRE_PARTIAL_SOFT))
+
+/* The smallest buffer that is allocated, in code units. */
+
+#define STREAM_MIN_BUFFER 1024
+
+
+
+/*************************************************
+*      Move back or forward by characters        *
+*************************************************/
+
+/* In UTF mode these step over whole characters. The buffer is known to hold
+valid UTF up to "complete".
+
+Arguments:
+  stream      the stream
+  offset      an offset in the buffer
+  count       the number of characters to move back
+
+Returns:      the new offset, which is not less than zero
+*/
+
+static int
+back_chars(const struct STREAM_BLOCK *stream, int offset, int count)
+{
+while (count-- > 0 && offset > 0)
+  {
+  offset--;
+#ifdef SUPPORT_UTF
+  if (stream->utf)
+    {
+#if defined COMPILE_PCRE8
+    while (offset > 0 && (stream->buffer[offset] & 0xc0) == 0x80) offset--;
+#elif defined COMPILE_PCRE16
+    if (offset > 0 && (stream->buffer[offset] & 0xfc00) == 0xdc00) offset--;
+#endif
+    }
+#else
+  (void)stream;
+#endif
+  }
+return offset;
+}
+
+
+/* Arguments and return are as for back_chars(), for one character forward;
+the offset is less than stream->complete. */
+
+static int
+next_char(const struct STREAM_BLOCK *stream, int offset)
+{
+offset++;
+#ifdef SUPPORT_UTF
+if (stream->utf)
+  {
+#if defined COMPILE_PCRE8
+  while (offset < stream->complete && (stream->buffer[offset] & 0xc0) == 0x80)
+    offset++;
+#elif defined COMPILE_PCRE16
+  if (offset < stream->complete && (stream->buffer[offset] & 0xfc00) == 0xdc00)
+    offset++;
+#endif
+  }
+#else
+(void)stream;
+#endif
+return offset;
+}
+
+
+
+/*************************************************
+*               Free a stream                    *
+*************************************************/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre_stream_free(pcre_stream *external_stream)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre16_stream_free(pcre16_stream *external_stream)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN void PCRE_CALL_CONVENTION
+pcre32_stream_free(pcre32_stream *external_stream)
+#endif
+{
+struct STREAM_BLOCK *stream = (struct STREAM_BLOCK *)external_stream;
+if (stream == NULL) return;
+if (stream->buffer != NULL) (PUBL(free))(stream->buffer);
+if (stream->ovector != NULL) (PUBL(free))(stream->ovector);
+(PUBL(free))(stream);
+}
+
+
+
+/*************************************************
+*              Create a stream                   *
+*************************************************/
+
+/* The pattern and its study data are not copied, so they must remain valid
+until the stream is freed.
+
+Arguments:
+  argument_re   the compiled pattern
+  extra_data    its study data, or NULL
+  options       options for pcre_exec(), other than partial matching and
+                  PCRE_NO_UTF8_CHECK
+  errorcode     where to put an error code, or NULL
+
+Returns:        the stream, or NULL on error
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_stream * PCRE_CALL_CONVENTION
+pcre_stream_create(const pcre *argument_re, const pcre_extra *extra_data,
+  int options, int *errorcode)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_stream * PCRE_CALL_CONVENTION
+pcre16_stream_create(const pcre16 *argument_re,
+  const pcre16_extra *extra_data, int options, int *errorcode)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_stream * PCRE_CALL_CONVENTION
+pcre32_stream_create(const pcre32 *argument_re,
+  const pcre32_extra *extra_data, int options, int *errorcode)
+#endif
+{
+const REAL_PCRE *re = (const REAL_PCRE *)argument_re;
+struct STREAM_BLOCK *stream;
+unsigned long int pattern_options;
+int capture_count, lookbehind, rc;
+
+if (errorcode == NULL) errorcode = &rc;
+*errorcode = 0;
+
+if (re == NULL)
+  {
+  *errorcode = PCRE_ERROR_NULL;
+  return NULL;
+  }
+if ((options & ~STREAM_OPTIONS) != 0)
+  {
+  *errorcode = PCRE_ERROR_BADOPTION;
+  return NULL;
+  }
+if ((rc = PUBL(fullinfo)((const void *)re, NULL, PCRE_INFO_OPTIONS,
+      &pattern_options)) < 0 ||
+    (rc = PUBL(fullinfo)((const void *)re, NULL, PCRE_INFO_CAPTURECOUNT,
+      &capture_count)) < 0 ||
+    (rc = PUBL(fullinfo)((const void *)re, NULL, PCRE_INFO_MAXLOOKBEHIND,
+      &lookbehind)) < 0)
+  {
+  *errorcode = rc;
+  return NULL;
+  }
+
+stream = (struct STREAM_BLOCK *)(PUBL(malloc))(sizeof(struct STREAM_BLOCK));
+if (stream == NULL)
+  {
+  *errorcode = PCRE_ERROR_NOMEMORY;
+  return NULL;
+  }
+memset(stream, 0, sizeof(struct STREAM_BLOCK));
+stream->re = re;
+stream->extra = extra_data;
+stream->options = options;
+stream->utf = (pattern_options & PCRE_UTF8) != 0;
+
+/* One character more than the longest lookbehind is kept before each search,
+because \b and ^ in multiline mode look at the previous character. */
+
+stream->lookbehind = lookbehind + 1;
+stream->ovector_size = (capture_count + 1) * 3;
+stream->ovector = (int *)(PUBL(malloc))(stream->ovector_size * sizeof(int));
+if (stream->ovector == NULL)
+  {
+  *errorcode = PCRE_ERROR_NOMEMORY;
+#if defined COMPILE_PCRE8
+  pcre_stream_free((pcre_stream *)stream);
+  return NULL;
+  }
+return (pcre_stream *)stream;
+#elif defined COMPILE_PCRE16
+  pcre16_stream_free((pcre16_stream *)stream);
+  return NULL;
+  }
+return (pcre16_stream *)stream;
+#elif defined COMPILE_PCRE32
+  pcre32_stream_free((pcre32_stream *)stream);
+  return NULL;
+  }
+return (pcre32_stream *)stream;
+#endif
+}
+
+
+
+/*************************************************
+*           Add data to a stream                 *
+*************************************************/
+
+/* The data that is no longer needed is dropped, and the new piece is
+appended. In UTF mode the piece is checked; a character may be split between
+two pieces.
+
+Arguments:
+  external_stream  the stream
+  data             the new piece
+  length           its length in code units
+  last             non-zero if this is the last piece
+
+Returns:           0, or a negative error code
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_stream_feed(pcre_stream *external_stream, const char *data, int length,
+  int last)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_stream_feed(pcre16_stream *external_stream, PCRE_SPTR16 data,
+  int length, int last)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_stream_feed(pcre32_stream *external_stream, PCRE_SPTR32 data,
+  int length, int last)
+#endif
+{
+struct STREAM_BLOCK *stream = (struct STREAM_BLOCK *)external_stream;
+int keep;
+
+if (stream == NULL || (data == NULL && length != 0)) return PCRE_ERROR_NULL;
+if (length < 0) return PCRE_ERROR_BADLENGTH;
+if (stream->last) return PCRE_ERROR_STREAMEND;
+
+/* Drop what is no longer needed. The data before the next search is kept
+for lookbehinds, unless a partial match needs even more. */
+
+keep = back_chars(stream, stream->start, stream->lookbehind);
+if (keep > stream->keep) keep = stream->keep;
+if (keep > 0)
+  {
+  stream->length -= keep;
+  stream->complete -= keep;
+  stream->start -= keep;
+  stream->keep -= keep;
+  stream->base += keep;
+  memmove(stream->buffer, stream->buffer + keep,
+    IN_UCHARS(stream->length));
+  }
+
+if (length > INT_MAX - stream->length) return PCRE_ERROR_NOMEMORY;
+if (stream->length + length > stream->size)
+  {
+  int size = stream->size > STREAM_MIN_BUFFER? stream->size :
+    STREAM_MIN_BUFFER;
+  pcre_uchar *buffer;
+  while (size < stream->length + length)
+    size = (size > INT_MAX / 2)? INT_MAX : size * 2;
+  buffer = (pcre_uchar *)(PUBL(malloc))(IN_UCHARS(size));
+  if (buffer == NULL) return PCRE_ERROR_NOMEMORY;
+  if (stream->length > 0)
+    memcpy(buffer, stream->buffer, IN_UCHARS(stream->length));
+  if (stream->buffer != NULL) (PUBL(free))(stream->buffer);
+  stream->buffer = buffer;
+  stream->size = size;
+  }
+
+if (length > 0)
+  memcpy(stream->buffer + stream->length, data, IN_UCHARS(length));
+
+/* Check the new characters, from the end of the last whole one. A check that
+fails because the data ends in the middle of a character is not an error
+unless this is the last piece; the rest of the character should follow. */
+
+#ifdef SUPPORT_UTF
+if (stream->utf)
+  {
+  int erroroffset;
+  int errorcode = PRIV(valid_utf)(stream->buffer + stream->complete,
+    stream->length + length - stream->complete, &erroroffset);
+  if (errorcode != 0)
+    {
+#if defined COMPILE_PCRE8
+    BOOL truncated = errorcode <= PCRE_UTF8_ERR5;
+#elif defined COMPILE_PCRE16
+    BOOL truncated = errorcode == PCRE_UTF16_ERR1;
+#elif defined COMPILE_PCRE32
+    BOOL truncated = FALSE;
+#endif
+    if (!truncated) return PCRE_ERROR_BADUTF8;
+    if (last) return PCRE_ERROR_SHORTUTF8;
+    stream->length += length;
+    stream->complete += erroroffset;
+    return 0;
+    }
+  }
+#endif
+
+stream->length += length;
+stream->complete = stream->length;
+stream->last = last != 0;
+return 0;
+}
+
+
+
+/*************************************************
+*        Find the next match in a stream         *
+*************************************************/
+
+/* The offsets in ovector are relative to the data returned via subject,
+which stays valid until the next piece is fed; its first code unit is at
+offset *base in the stream. The result is PCRE_ERROR_NOMATCH when there is no
+further match in the data fed so far. More data may then be fed, unless the
+last piece has been, and pcre_stream_exec() called again.
+
+Arguments:
+  external_stream  the stream
+  offsets          vector for the offsets of the match and its substrings
+  offsetcount      the number of elements in the vector
+  subject          where to put a pointer to the data, or NULL
+  base             where to put the stream offset of the data, or NULL
+
+Returns:           > 0 => success; value is the number of elements filled in
+                   = 0 => success, but offsets is not big enough
+                    -1 => no further match in the data fed so far
+                  < -1 => some kind of unexpected problem
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_stream_exec(pcre_stream *external_stream, int *offsets, int offsetcount,
+  const char **subject, size_t *base)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre16_stream_exec(pcre16_stream *external_stream, int *offsets,
+  int offsetcount, PCRE_SPTR16 *subject, size_t *base)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre32_stream_exec(pcre32_stream *external_stream, int *offsets,
+  int offsetcount, PCRE_SPTR32 *subject, size_t *base)
+#endif
+{
+struct STREAM_BLOCK *stream = (struct STREAM_BLOCK *)external_stream;
+int *ovector;
+int rc, pairs;
+
+if (stream == NULL || (offsets == NULL && offsetcount > 0))
+  return PCRE_ERROR_NULL;
+if (offsetcount < 0) return PCRE_ERROR_BADCOUNT;
+ovector = stream->ovector;
+
+if (subject != NULL) *subject = (STREAM_SPTR)stream->buffer;
+if (base != NULL) *base = stream->base;
+
+for (;;)
+  {
+  int options = stream->options | PCRE_NO_UTF8_CHECK;
+  if (!stream->last) options |= PCRE_PARTIAL_HARD;
+
+  /* After an empty match, look for a non-empty one at the same place, as
+  Perl does for a global match, before moving on by one character. */
+
+  if (stream->empty) options |= PCRE_NOTEMPTY_ATSTART | PCRE_ANCHORED;
+
+  /* An empty subject is never a partial match. */
+
+  if (stream->start >= stream->complete && !stream->last)
+    rc = PCRE_ERROR_NOMATCH;
+  else
+    rc = PUBL(exec)((const void *)stream->re, stream->extra,
+      (STREAM_SPTR)stream->buffer, stream->complete, stream->start, options,
+      ovector, stream->ovector_size);
+
+  if (rc >= 0)
+    {
+    int check[3], crc;
+
+    /* PCRE_PARTIAL_HARD gives a partial match only if a character was
+    inspected at the end of the data, so an empty match there, or before a
+    final newline, may depend on what follows: $ in multiline mode and \Z
+    are examples. If a match attempt that starts at the same place finds it
+    too, it is held back until more data arrives. */
+
+    if (stream->last || ovector[0] != ovector[1] ||
+        ovector[0] < stream->complete - 2)
+      break;
+    crc = PUBL(exec)((const void *)stream->re, stream->extra,
+      (STREAM_SPTR)stream->buffer, stream->complete, ovector[0],
+      options | PCRE_ANCHORED, check, 3);
+    if (crc < 0 && crc != PCRE_ERROR_PARTIAL) break;
+    stream->start = ovector[0];
+    stream->keep = back_chars(stream, ovector[0], stream->lookbehind);
+    return PCRE_ERROR_NOMATCH;
+    }
+
+  if (rc == PCRE_ERROR_PARTIAL)
+    {
+    /* Keep the characters that were inspected, and those that a lookbehind
+    later in the pattern might inspect. The match is tried again from where
+    it started. */
+
+    stream->start = ovector[2];
+    stream->keep = back_chars(stream, ovector[2], stream->lookbehind);
+    if (stream->keep > ovector[0]) stream->keep = ovector[0];
+    return PCRE_ERROR_NOMATCH;
+    }
+
+  if (rc != PCRE_ERROR_NOMATCH) return rc;
+
+  if (stream->empty)
+    {
+    stream->empty = FALSE;
+    if (stream->start < stream->complete)
+      {
+      stream->start = next_char(stream, stream->start);
+      continue;
+      }
+    if (!stream->last)
+      {
+      stream->empty = TRUE;       /* Still to be moved on */
+      stream->keep = stream->start;
+      return PCRE_ERROR_NOMATCH;
+      }
+    }
+
+  /* There is nothing more to be found in the data that has been fed. */
+
+  stream->start = stream->complete;
+  stream->keep = stream->complete;
+  return PCRE_ERROR_NOMATCH;
+  }
+
+stream->empty = ovector[0] == ovector[1];
+stream->start = ovector[1];
+stream->keep = ovector[1];
+
+/* As for pcre_exec(), the first two thirds of offsets are filled in, and 0 is
+returned if that is not enough. */
+
+pairs = offsetcount / 3;
+if (pairs > stream->ovector_size / 3) pairs = stream->ovector_size / 3;
+if (pairs > 0) memcpy(offsets, ovector, 2 * pairs * sizeof(int));
+return (rc > pairs)? 0 : rc;
+}
+
+/* End of pcre_stream.c */
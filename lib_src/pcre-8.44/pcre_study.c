@@ -1428,19 +1428,58 @@ return yield;
 
 
 
+/*************************************************
+*         Get a block for study data             *
+*************************************************/
+
+/* This function gets a pcre[16]_extra block together with the study data that
+follows it and the library's private data that follows that, and links them
+up. The private block is not counted in the size of the study data, so it is
+never written out with a saved pattern. It is called by study_pattern() and by
+the pattern cache.
+
+Argument:   the arena to allocate in, or NULL to use malloc()
+Returns:    pointer to a zeroed pcre[16]_extra block with the study data flag
+              set, or NULL if there is no memory
+*/
+
+PUBL(extra) *
+PRIV(study_alloc)(void *arena)
+{
+size_t size = sizeof(PUBL(extra)) + sizeof(pcre_study_block);
+PUBL(extra) *extra;
+pcre_study_data *study;
+
+if (arena == NULL) extra = (PUBL(extra) *)(PUBL(malloc))(size);
+  else extra = (PUBL(extra) *)PRIV(arena_alloc_extra)(arena, size);
+if (extra == NULL) return NULL;
+memset(extra, 0, size);
+
+study = (pcre_study_data *)((char *)extra + sizeof(PUBL(extra)));
+extra->flags = PCRE_EXTRA_STUDY_DATA | PCRE_EXTRA_PRIVATE;
+if (arena != NULL) extra->flags |= PCRE_EXTRA_ARENA;
+extra->study_data = study;
+study->size = sizeof(pcre_study_data);
+return extra;
+}
+
+
+
 /*************************************************
 *          Study a compiled expression           *
 *************************************************/
 
 /* This function is handed a compiled expression that it must study to produce
 information that will speed up the matching. It returns a pcre[16]_extra block
-which then gets handed back to pcre_exec().
+which then gets handed back to pcre_exec(). It is called by pcre_study() and
+pcre_study_arena().
 
 Arguments:
   re        points to the compiled expression
   options   contains option bits
   errorptr  points to where to place error messages;
             set NULL unless error
+  arena     the arena for the pcre[16]_extra block, or NULL to use malloc()
 
 Returns:    pointer to a pcre[16]_extra block, with study_data filled in and
               the appropriate flags set;
@@ -1448,14 +1487,17 @@ Returns:    pointer to a pcre[16]_extra block, with study_data filled in and
 */
 
 #if defined COMPILE_PCRE8
-PCRE_EXP_DEFN pcre_extra * PCRE_CALL_CONVENTION
-pcre_study(const pcre *external_re, int options, const char **errorptr)
+static pcre_extra *
+study_pattern(const pcre *external_re, int options, const char **errorptr,
+  void *arena)
 #elif defined COMPILE_PCRE16
-PCRE_EXP_DEFN pcre16_extra * PCRE_CALL_CONVENTION
-pcre16_study(const pcre16 *external_re, int options, const char **errorptr)
+static pcre16_extra *
+study_pattern(const pcre16 *external_re, int options, const char **errorptr,
+  void *arena)
 #elif defined COMPILE_PCRE32
-PCRE_EXP_DEFN pcre32_extra * PCRE_CALL_CONVENTION
-pcre32_study(const pcre32 *external_re, int options, const char **errorptr)
+static pcre32_extra *
+study_pattern(const pcre32 *external_re, int options, const char **errorptr,
+  void *arena)
 #endif
 {
 int min;
@@ -1558,7 +1600,8 @@ greater than zero, or if JIT optimization has been requested, or if
 PCRE_STUDY_EXTRA_NEEDED is set, get a pcre[16]_extra block and a
 pcre_study_data block. The study data is put in the latter, which is pointed to
 by the former, which may also get additional data set later by the calling
-program. At the moment, the size of pcre_study_data is fixed. We nevertheless
+program. The library's own per-study state lives in a private block after the
+study data. At the moment, the size of pcre_study_data is fixed. We nevertheless
 save it in a field for returning via the pcre_fullinfo() function so that if it
 becomes variable in the future, we don't have to change that code. */
 
@@ -1569,19 +1612,14 @@ if (bits_set || min > 0 || (options & (
 #endif
     PCRE_STUDY_EXTRA_NEEDED)) != 0)
   {
-  extra = (PUBL(extra) *)(PUBL(malloc))
-    (sizeof(PUBL(extra)) + sizeof(pcre_study_data));
+  extra = PRIV(study_alloc)(arena);
   if (extra == NULL)
     {
     *errorptr = "failed to get memory";
     return NULL;
     }
 
-  study = (pcre_study_data *)((char *)extra + sizeof(PUBL(extra)));
-  extra->flags = PCRE_EXTRA_STUDY_DATA;
-  extra->study_data = study;
-
-  study->size = sizeof(pcre_study_data);
+  study = (pcre_study_data *)extra->study_data;
   study->flags = 0;
 
   /* Set the start bits always, to avoid unset memory errors if the
@@ -1622,10 +1660,16 @@ if (bits_set || min > 0 || (options & (
   /* If JIT support was compiled and requested, attempt the JIT compilation.
   If no starting bytes were found, and the minimum length is zero, and JIT
   compilation fails, abandon the extra block and return NULL, unless
-  PCRE_STUDY_EXTRA_NEEDED is set. */
+  PCRE_STUDY_EXTRA_NEEDED is set. JIT compilation is skipped altogether if the
+  one-time self test found that JIT code cannot run in this process; matching
+  then falls back to the interpreter. */
 
 #ifdef SUPPORT_JIT
   extra->executable_jit = NULL;
+  if ((options & (PCRE_STUDY_JIT_COMPILE | PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE |
+      PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE)) != 0 && !PRIV(jit_usable)())
+    options &= ~(PCRE_STUDY_JIT_COMPILE | PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE |
+      PCRE_STUDY_JIT_PARTIAL_HARD_COMPILE);
   if ((options & PCRE_STUDY_JIT_COMPILE) != 0)
     PRIV(jit_compile)(re, extra, JIT_COMPILE);
   if ((options & PCRE_STUDY_JIT_PARTIAL_SOFT_COMPILE) != 0)
@@ -1643,20 +1687,121 @@ if (bits_set || min > 0 || (options & (
 #elif defined COMPILE_PCRE32
     pcre32_free_study(extra);
 #endif
+    if (arena != NULL) PRIV(arena_free)(arena, extra);
     extra = NULL;
     }
 #endif
+
+  /* Build a lazy DFA if the caller asked for one and the pattern qualifies,
+  unless JIT code was compiled. */
+
+  if (extra != NULL && (options & PCRE_STUDY_LAZY_DFA) != 0 &&
+      (extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0)
+    {
+    pcre_study_private *priv = STUDY_PRIVATE(extra);
+    priv->lazy_dfa = PRIV(lazy_dfa_compile)(re);
+    if (priv->lazy_dfa != NULL) extra->flags |= PCRE_EXTRA_LAZY_DFA;
+    }
+
+  /* Likewise a specialized matcher for a literal, a list of literals, or a
+  simple sequence of character runs. */
+
+  if (extra != NULL && (options & PCRE_STUDY_NO_SPECIAL) == 0 &&
+      (extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) == 0)
+    {
+    pcre_study_private *priv = STUDY_PRIVATE(extra);
+    priv->special = PRIV(special_compile)(re);
+    if (priv->special != NULL) extra->flags |= PCRE_EXTRA_SPECIAL;
+    }
   }
 
 return extra;
 }
 
 
+/*************************************************
+*          Study a compiled expression           *
+*************************************************/
+
+/* This function is handed a compiled expression that it must study to produce
+information that will speed up the matching. It returns a pcre[16]_extra block
+which then gets handed back to pcre_exec().
+
+Arguments:
+  re        points to the compiled expression
+  options   contains option bits
+  errorptr  points to where to place error messages;
+            set NULL unless error
+
+Returns:    pointer to a pcre[16]_extra block, with study_data filled in and
+              the appropriate flags set;
+            NULL on error or if no optimization possible
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_extra * PCRE_CALL_CONVENTION
+pcre_study(const pcre *external_re, int options, const char **errorptr)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_extra * PCRE_CALL_CONVENTION
+pcre16_study(const pcre16 *external_re, int options, const char **errorptr)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_extra * PCRE_CALL_CONVENTION
+pcre32_study(const pcre32 *external_re, int options, const char **errorptr)
+#endif
+{
+return study_pattern(external_re, options, errorptr, NULL);
+}
+
+
+/*************************************************
+*       Study a compiled expression in an arena  *
+*************************************************/
+
+/* This is the same as pcre_study(), except that the pcre[16]_extra block and
+the study data are placed in an arena. The block must not be freed by the
+caller; pcre_arena_free() releases it, together with any JIT code attached to
+it. If the arena is full, NULL is returned with an error message.
+
+Arguments:
+  arena     the arena
+  re        points to the compiled expression
+  options   contains option bits
+  errorptr  points to where to place error messages;
+            set NULL unless error
+
+Returns:    pointer to a pcre[16]_extra block, or NULL as for pcre_study()
+*/
+
+#if defined COMPILE_PCRE8
+PCRE_EXP_DEFN pcre_extra * PCRE_CALL_CONVENTION
+pcre_study_arena(pcre_arena *arena, const pcre *external_re, int options,
+  const char **errorptr)
+#elif defined COMPILE_PCRE16
+PCRE_EXP_DEFN pcre16_extra * PCRE_CALL_CONVENTION
+pcre16_study_arena(pcre16_arena *arena, const pcre16 *external_re,
+  int options, const char **errorptr)
+#elif defined COMPILE_PCRE32
+PCRE_EXP_DEFN pcre32_extra * PCRE_CALL_CONVENTION
+pcre32_study_arena(pcre32_arena *arena, const pcre32 *external_re,
+  int options, const char **errorptr)
+#endif
+{
+if (arena == NULL)
+  {
+  *errorptr = "no arena";
+  return NULL;
+  }
+return study_pattern(external_re, options, errorptr, arena);
+}
+
+
 /*************************************************
 *          Free the study data                   *
 *************************************************/
 
-/* This function frees the memory that was obtained by pcre_study().
+/* This function frees the memory that was obtained by pcre_study(). For study
+data in an arena, only what is attached to it is freed, and the flags for those
+parts are cleared so that pcre_arena_free() does not free them again.
 
 Argument:   a pointer to the pcre[16]_extra block
 Returns:    nothing
@@ -1680,6 +1825,20 @@ if ((extra->flags & PCRE_EXTRA_EXECUTABLE_JIT) != 0 &&
      extra->executable_jit != NULL)
   PRIV(jit_free)(extra->executable_jit);
 #endif
+if ((extra->flags & (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE)) ==
+      (PCRE_EXTRA_LAZY_DFA | PCRE_EXTRA_PRIVATE) &&
+    STUDY_PRIVATE(extra)->lazy_dfa != NULL)
+  PRIV(lazy_dfa_free)(STUDY_PRIVATE(extra)->lazy_dfa);
+if ((extra->flags & (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE)) ==
+      (PCRE_EXTRA_SPECIAL | PCRE_EXTRA_PRIVATE) &&
+    STUDY_PRIVATE(extra)->special != NULL)
+  PRIV(special_free)(STUDY_PRIVATE(extra)->special);
+if ((extra->flags & PCRE_EXTRA_ARENA) != 0)
+  {
+  extra->flags &= ~(PCRE_EXTRA_EXECUTABLE_JIT | PCRE_EXTRA_LAZY_DFA |
+    PCRE_EXTRA_SPECIAL);
+  return;
+  }
 PUBL(free)(extra);
 }
 
@@ -39,7 +39,20 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 /* This module contains an internal function for validating UTF-8 character
-strings. */
+strings, and the external function that lets an application check a subject
+once before matching it against several patterns.
+
+Valid input is skipped with vector instructions when they are available, using
+the method of Keiser and Lemire ("Validating UTF-8 in less than one instruction
+per byte", 2021), in which three 16-entry table lookups on the nibbles of each
+byte and its predecessor classify every error that a pair of bytes can show.
+On x86 the SSSE3 and AVX2 versions are compiled with function attributes and
+chosen at run time; without SSSE3 only runs of ASCII are skipped. Other
+processors use the scalar loop. When a vector finds an error, or
+there are too few bytes left to fill one, the scalar loop takes over at the
+start of the character that was being checked, so that the error codes and
+offsets are always those of the scalar loop. Define PCRE_NO_SIMD_SCAN to build
+the scalar loop only. */
 
 
 #ifdef HAVE_CONFIG_H
@@ -48,6 +61,228 @@ strings. */
 
 #include "pcre_internal.h"
 
+#if defined SUPPORT_UTF && !defined PCRE_NO_SIMD_SCAN
+#if defined __GNUC__ && (defined __x86_64__ || \
+    (defined __i386__ && defined __SSE2__))
+#define UTF_X86
+#include <immintrin.h>
+#endif
+#endif
+
+#ifdef UTF_X86
+
+/* The error classes that the lookups can find. Each table entry has the bits
+of the classes that are possible given one nibble, so a class is present when
+all three lookups for a byte have its bit set. A 3-byte or 4-byte lead must be
+followed by two or three continuation bytes; that is checked separately, and
+0x80 in the result of the lookups marks a continuation byte that follows
+another one, which is an error unless that check says otherwise. */
+
+#define UTF8_TOO_SHORT   0x01   /* 11______ 0_______ or 11______ 11______ */
+#define UTF8_TOO_LONG    0x02   /* 0_______ 10______ */
+#define UTF8_OVERLONG_3  0x04   /* 11100000 100_____ */
+#define UTF8_TOO_LARGE   0x08   /* 11110100 1001____ and up */
+#define UTF8_SURROGATE   0x10   /* 11101101 101_____ */
+#define UTF8_OVERLONG_2  0x20   /* 1100000_ 10______ */
+#define UTF8_TOO_LARGE_1000 0x40  /* 11110101 1000____ and up */
+#define UTF8_OVERLONG_4  0x40   /* 11110000 1000____ */
+#define UTF8_TWO_CONTS   0x80   /* 10______ 10______ */
+
+#define UTF8_CARRY (UTF8_TOO_SHORT|UTF8_TOO_LONG|UTF8_TWO_CONTS)
+
+/* Indexed by the high nibble of the previous byte. */
+
+static const pcre_uint8 utf8_byte1_high[16] = {
+  UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+  UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+  UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+  UTF8_TOO_SHORT|UTF8_OVERLONG_2,
+  UTF8_TOO_SHORT,
+  UTF8_TOO_SHORT|UTF8_OVERLONG_3|UTF8_SURROGATE,
+  UTF8_TOO_SHORT|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000|UTF8_OVERLONG_4 };
+
+/* Indexed by the low nibble of the previous byte. */
+
+static const pcre_uint8 utf8_byte1_low[16] = {
+  UTF8_CARRY|UTF8_OVERLONG_3|UTF8_OVERLONG_2|UTF8_OVERLONG_4,
+  UTF8_CARRY|UTF8_OVERLONG_2,
+  UTF8_CARRY,
+  UTF8_CARRY,
+  UTF8_CARRY|UTF8_TOO_LARGE,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000|UTF8_SURROGATE,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000,
+  UTF8_CARRY|UTF8_TOO_LARGE|UTF8_TOO_LARGE_1000 };
+
+/* Indexed by the high nibble of the byte itself. */
+
+static const pcre_uint8 utf8_byte2_high[16] = {
+  UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+  UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+  UTF8_TOO_LONG|UTF8_OVERLONG_2|UTF8_TWO_CONTS|UTF8_OVERLONG_3|
+    UTF8_TOO_LARGE_1000|UTF8_OVERLONG_4,
+  UTF8_TOO_LONG|UTF8_OVERLONG_2|UTF8_TWO_CONTS|UTF8_OVERLONG_3|UTF8_TOO_LARGE,
+  UTF8_TOO_LONG|UTF8_OVERLONG_2|UTF8_TWO_CONTS|UTF8_SURROGATE|UTF8_TOO_LARGE,
+  UTF8_TOO_LONG|UTF8_OVERLONG_2|UTF8_TWO_CONTS|UTF8_SURROGATE|UTF8_TOO_LARGE,
+  UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT };
+
+/* A vector ends in the middle of a character if any of its last three bytes
+is a lead byte for more bytes than remain. The last 16 bytes are the limits for
+a 16-byte vector. */
+
+static const pcre_uint8 utf8_incomplete_limit[32] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf };
+
+/* Levels of vector support, in increasing order. */
+
+enum { UTF_SSE2, UTF_SSSE3, UTF_AVX2 };
+
+static int utf_level = -1;        /* Not yet known */
+
+/* Find out what the processor supports. Several threads may do this at the
+same time, but they all store the same value. */
+
+static int
+get_utf_level(void)
+{
+int level = utf_level;
+if (level < 0)
+  {
+  __builtin_cpu_init();
+  level = __builtin_cpu_supports("avx2")? UTF_AVX2 :
+    __builtin_cpu_supports("ssse3")? UTF_SSSE3 : UTF_SSE2;
+  utf_level = level;
+  }
+return level;
+}
+
+
+
+/*************************************************
+*      Skip valid UTF-8 with vector instructions *
+*************************************************/
+
+/* Each of these returns a pointer to the start of the first vector that is not
+known to be valid, or to the remainder that is too short for a vector. Every
+character that starts before that point and ends before it is valid; the one
+that spans it has yet to be checked. */
+
+static PCRE_PUCHAR
+skip_ascii_sse2(PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+while (end - p >= 16 &&
+    _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p)) == 0)
+  p += 16;
+return p;
+}
+
+__attribute__((target("ssse3")))
+static PCRE_PUCHAR
+skip_valid_ssse3(PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+__m128i byte1_high = _mm_loadu_si128((const __m128i *)utf8_byte1_high);
+__m128i byte1_low = _mm_loadu_si128((const __m128i *)utf8_byte1_low);
+__m128i byte2_high = _mm_loadu_si128((const __m128i *)utf8_byte2_high);
+__m128i limit = _mm_loadu_si128(
+  (const __m128i *)(utf8_incomplete_limit + 16));
+__m128i nibble = _mm_set1_epi8(0x0f);
+__m128i zero = _mm_setzero_si128();
+__m128i prev = zero;
+__m128i incomplete = zero;
+
+while (end - p >= 16)
+  {
+  __m128i data = _mm_loadu_si128((const __m128i *)p);
+  __m128i error;
+
+  if (_mm_movemask_epi8(data) == 0) error = incomplete; else
+    {
+    __m128i prev1 = _mm_alignr_epi8(data, prev, 15);
+    __m128i prev2 = _mm_alignr_epi8(data, prev, 14);
+    __m128i prev3 = _mm_alignr_epi8(data, prev, 13);
+    __m128i special = _mm_and_si128(_mm_and_si128(
+      _mm_shuffle_epi8(byte1_high,
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+      _mm_shuffle_epi8(byte1_low, _mm_and_si128(prev1, nibble))),
+      _mm_shuffle_epi8(byte2_high,
+        _mm_and_si128(_mm_srli_epi16(data, 4), nibble)));
+    __m128i must23 = _mm_or_si128(
+      _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80)),
+      _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80)));
+    error = _mm_xor_si128(
+      _mm_and_si128(must23, _mm_set1_epi8((char)0x80)), special);
+    }
+
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xffff) break;
+  incomplete = _mm_subs_epu8(data, limit);
+  prev = data;
+  p += 16;
+  }
+return p;
+}
+
+__attribute__((target("avx2")))
+static PCRE_PUCHAR
+skip_valid_avx2(PCRE_PUCHAR p, PCRE_PUCHAR end)
+{
+__m256i byte1_high = _mm256_broadcastsi128_si256(
+  _mm_loadu_si128((const __m128i *)utf8_byte1_high));
+__m256i byte1_low = _mm256_broadcastsi128_si256(
+  _mm_loadu_si128((const __m128i *)utf8_byte1_low));
+__m256i byte2_high = _mm256_broadcastsi128_si256(
+  _mm_loadu_si128((const __m128i *)utf8_byte2_high));
+__m256i limit = _mm256_loadu_si256((const __m256i *)utf8_incomplete_limit);
+__m256i nibble = _mm256_set1_epi8(0x0f);
+__m256i zero = _mm256_setzero_si256();
+__m256i prev = zero;
+__m256i incomplete = zero;
+
+while (end - p >= 32)
+  {
+  __m256i data = _mm256_loadu_si256((const __m256i *)p);
+  __m256i error;
+
+  if (_mm256_movemask_epi8(data) == 0) error = incomplete; else
+    {
+    /* The AVX2 byte shifts work within each 128-bit lane, so the lane that
+    precedes each one is made up first. */
+
+    __m256i shifted = _mm256_permute2x128_si256(prev, data, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(data, shifted, 15);
+    __m256i prev2 = _mm256_alignr_epi8(data, shifted, 14);
+    __m256i prev3 = _mm256_alignr_epi8(data, shifted, 13);
+    __m256i special = _mm256_and_si256(_mm256_and_si256(
+      _mm256_shuffle_epi8(byte1_high,
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+      _mm256_shuffle_epi8(byte1_low, _mm256_and_si256(prev1, nibble))),
+      _mm256_shuffle_epi8(byte2_high,
+        _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble)));
+    __m256i must23 = _mm256_or_si256(
+      _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80)),
+      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80)));
+    error = _mm256_xor_si256(
+      _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80)), special);
+    }
+
+  if (!_mm256_testz_si256(error, error)) break;
+  incomplete = _mm256_subs_epu8(data, limit);
+  prev = data;
+  p += 32;
+  }
+return p;
+}
+#endif  /* UTF_X86 */
+
 
 /*************************************************
 *         Validate a UTF-8 string                *
@@ -103,18 +338,12 @@ Returns:       = 0    if the string is a valid UTF-8 string
                > 0    otherwise, setting the offset of the bad character
 */
 
-int
-PRIV(valid_utf)(PCRE_PUCHAR string, int length, int *erroroffset)
-{
 #ifdef SUPPORT_UTF
+static int
+valid_utf_scalar(PCRE_PUCHAR string, int length, int *erroroffset)
+{
 register PCRE_PUCHAR p;
 
-if (length < 0)
-  {
-  for (p = string; *p != 0; p++);
-  length = (int)(p - string);
-  }
-
 for (p = string; length-- > 0; p++)
   {
   register pcre_uchar ab, c, d;
@@ -289,13 +518,85 @@ for (p = string; length-- > 0; p++)
     }
   }
 
+return PCRE_UTF8_ERR0;   /* This indicates success */
+}
+#endif  /* SUPPORT_UTF */
+
+
+int
+PRIV(valid_utf)(PCRE_PUCHAR string, int length, int *erroroffset)
+{
+#ifdef SUPPORT_UTF
+#ifdef UTF_X86
+PCRE_PUCHAR p;
+PCRE_PUCHAR q;
+int rc;
+#endif
+
+if (length < 0) length = (int)strlen((const char *)string);
+
+#ifdef UTF_X86
+switch (get_utf_level())
+  {
+  case UTF_AVX2: p = skip_valid_avx2(string, string + length); break;
+  case UTF_SSSE3: p = skip_valid_ssse3(string, string + length); break;
+  default: p = skip_ascii_sse2(string, string + length); break;
+  }
+
+/* Back up to the start of the character that spans p, so that the scalar
+loop sees it whole. Everything before p is valid, so there is a lead byte
+within four bytes. */
+
+for (q = p; q > string && p - q < 4; )
+  if ((*(--q) & 0xc0) != 0x80) break;
+rc = valid_utf_scalar(q, length - (int)(q - string), erroroffset);
+if (rc != PCRE_UTF8_ERR0) *erroroffset += (int)(q - string);
+return rc;
+#else
+return valid_utf_scalar(string, length, erroroffset);
+#endif
+
 #else  /* Not SUPPORT_UTF */
 (void)(string);  /* Keep picky compilers happy */
 (void)(length);
 (void)(erroroffset);
+return PCRE_UTF8_ERR0;   /* This indicates success */
 #endif
+}
 
-return PCRE_UTF8_ERR0;   /* This indicates success */
+
+
+/*************************************************
+*    Validate a UTF-8 string for the caller      *
+*************************************************/
+
+/* This lets an application that matches the same subject against several
+patterns check it once, and then pass PCRE_NO_UTF8_CHECK to each match.
+
+Arguments:
+  string       points to the string
+  length       length of string, or -1 if the string is zero-terminated
+  erroroffset  where to put the offset of the bad character, or NULL
+
+Returns:       0 if the string is valid, PCRE_UTF8_ERR1 to PCRE_UTF8_ERR21
+               if it is not, or PCRE_ERROR_BADOPTION if UTF support was not
+               compiled
+*/
+
+PCRE_EXP_DEFN int PCRE_CALL_CONVENTION
+pcre_valid_utf8(const char *string, int length, int *erroroffset)
+{
+#ifdef SUPPORT_UTF
+int offset = 0;
+int rc = PRIV(valid_utf)((PCRE_PUCHAR)string, length, &offset);
+if (erroroffset != NULL) *erroroffset = (rc == PCRE_UTF8_ERR0)? -1 : offset;
+return rc;
+#else
+(void)(string);
+(void)(length);
+if (erroroffset != NULL) *erroroffset = -1;
+return PCRE_ERROR_BADOPTION;
+#endif
 }
 
 /* End of pcre_valid_utf8.c */
@@ -0,0 +1,3089 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+           Copyright (c) 1997-2020 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+/* This program is the PCRE benchmark driver. Each benchmark is a case with a
+name: with no arguments every case is run in turn, otherwise only the cases
+that are named. The -n option sets the amount of work that a case does (a
+number of values, rounds or megabytes, depending on the case); each case has
+its own default. Run "pcrebench -help" for the options and the cases. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "pcre.h"
+#include "pcreposix.h"
+#include "pcre_bench.h"
+
+/* The arguments that are passed to every case. A zero or NULL field asks for
+the case's default; a negative threshold means that none was given. */
+
+typedef struct bench_args {
+  long count;                     /* Amount of work (-n) */
+  const char *cache_file;         /* Pattern cache file for "cache" (-f) */
+  const char **modules;           /* YANG modules or directories (-y) */
+  int module_count;
+  const char *baseline_file;      /* Baseline to compare with (-b) */
+  const char *write_file;         /* Baseline to write (-w) */
+  double threshold;               /* Percent change that fails (-r) */
+  int threads;                    /* Threads for "batch" (-j) */
+} bench_args;
+
+/* A case returns 0 if it ran, 1 if it found a wrong result, or 2 if it was
+slower than the baseline by more than the -r threshold. The exit status is the
+OR of the values that the cases return. */
+
+typedef int (*bench_function)(const bench_args *);
+
+typedef struct bench_case {
+  const char *name;
+  bench_function run;
+  const char *description;
+} bench_case;
+
+
+/*************************************************
+*       JIT compared with the interpreter       *
+*************************************************/
+
+/* Validate a million YANG leaf values against the patterns of
+ietf-inet-types and ietf-yang-types, first with the interpreter and then with
+JIT compiled code, and print the time per value for each. The count is the
+number of values. */
+
+#define JIT_VALUES 1000000
+
+/* Time "count" validations of the sample values of one pattern, cycling
+through the valid and invalid values. Returns the number of matches. */
+
+static long
+jit_run_values(const pcre *re, const pcre_extra *extra, const bench_pattern *p,
+  long count, double *elapsed)
+{
+const char *values[8];
+int lengths[8];
+int nvalues = 0;
+int ovector[30];
+long matches = 0;
+long i;
+double start;
+
+for (i = 0; i < 4 && p->valid[i] != NULL; i++) values[nvalues++] = p->valid[i];
+for (i = 0; i < 4 && p->invalid[i] != NULL; i++)
+  values[nvalues++] = p->invalid[i];
+for (i = 0; i < nvalues; i++) lengths[i] = (int)strlen(values[i]);
+
+start = bench_now_ns();
+for (i = 0; i < count; i++)
+  {
+  int n = (int)(i % nvalues);
+  if (pcre_exec(re, extra, values[n], lengths[n], 0, 0, ovector, 30) >= 0)
+    matches++;
+  }
+*elapsed = bench_now_ns() - start;
+return matches;
+}
+
+static int
+bench_jit(const bench_args *args)
+{
+long total = (args->count > 0)? args->count : JIT_VALUES;
+long per_pattern;
+int options = bench_yang_options();
+int jit = 0, jit_usable = 0;
+double interp_total = 0, jit_total = 0;
+long validated = 0;
+const char *target = NULL;
+int i;
+
+(void)pcre_config(PCRE_CONFIG_JIT, &jit);
+(void)pcre_config(PCRE_CONFIG_JITUSABLE, &jit_usable);
+if (jit) (void)pcre_config(PCRE_CONFIG_JITTARGET, (void *)&target);
+
+printf("JIT: %s%s%s\n", jit? "compiled in" : "not compiled in",
+  jit? (jit_usable? ", self test passed, target " :
+    ", self test FAILED - interpreter only") : "",
+  (jit && jit_usable && target != NULL)? target : "");
+
+per_pattern = total / BENCH_YANG_PATTERN_COUNT;
+if (per_pattern < 1) per_pattern = 1;
+
+printf("\n%-16s %-18s %12s %12s %8s\n", "module", "type", "interp ns",
+  "jit ns", "speedup");
+
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  const bench_pattern *p = bench_yang_patterns + i;
+  const char *error;
+  int erroroffset;
+  pcre *re;
+  pcre_extra *interp_extra, *jit_extra;
+  double interp_ns, jit_ns;
+  long interp_matches, jit_matches;
+
+  re = pcre_compile(p->pattern, options, &error, &erroroffset, NULL);
+  if (re == NULL)
+    {
+    printf("%-16s %-18s skipped: %s\n", p->module, p->type, error);
+    continue;
+    }
+
+  interp_extra = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED, &error);
+  jit_extra = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED | PCRE_STUDY_JIT_COMPILE,
+    &error);
+  pcre_assign_jit_stack(jit_extra, pcre_jit_thread_stack, NULL);
+
+  interp_matches = jit_run_values(re, interp_extra, p, per_pattern,
+    &interp_ns);
+  jit_matches = jit_run_values(re, jit_extra, p, per_pattern, &jit_ns);
+
+  if (interp_matches != jit_matches)
+    {
+    printf("** %s %s: interpreter matched %ld values, JIT matched %ld\n",
+      p->module, p->type, interp_matches, jit_matches);
+    return 1;
+    }
+
+  printf("%-16s %-18s %12.1f %12.1f %7.2fx\n", p->module, p->type,
+    interp_ns / per_pattern, jit_ns / per_pattern,
+    (jit_ns > 0)? interp_ns / jit_ns : 0.0);
+
+  interp_total += interp_ns;
+  jit_total += jit_ns;
+  validated += per_pattern;
+  bench_sink += interp_matches;
+
+  pcre_free_study(interp_extra);
+  pcre_free_study(jit_extra);
+  pcre_free(re);
+  }
+
+if (validated > 0)
+  printf("\n%ld values: interpreter %.1f ms (%.1f ns/value), "
+    "JIT %.1f ms (%.1f ns/value), speedup %.2fx\n", validated,
+    interp_total / 1e6, interp_total / validated, jit_total / 1e6,
+    jit_total / validated, (jit_total > 0)? interp_total / jit_total : 0.0);
+
+pcre_jit_free_unused_memory();
+return 0;
+}
+
+
+/*************************************************
+*              Pattern cache file               *
+*************************************************/
+
+/* Measure the pattern compilation part of a daemon's start-up, with and
+without a pattern cache file. The patterns are the built-in ietf-inet-types and
+ietf-yang-types corpus plus the "pattern" statements of any YANG modules given
+with -y (files, or directories that are searched for *.yang files), for example
+share/yang/modules/netopeer2. Each "start" compiles and studies every pattern
+once; with the cache, it also opens and closes the cache file, which is given
+by -f. The case also checks that every cached pattern is identical to a freshly
+compiled one. The count is the number of starts. */
+
+#define CACHE_STARTS   200
+#define CACHE_FILE     "pcrebench.cache"
+#define CACHE_PATTERNS 4096
+
+static char *cache_patterns[CACHE_PATTERNS];
+static int cache_pattern_count = 0;
+
+static void
+cache_add_pattern(const char *pattern)
+{
+size_t length = strlen(pattern);
+if (cache_pattern_count >= CACHE_PATTERNS) return;
+cache_patterns[cache_pattern_count] = (char *)malloc(length + 1);
+if (cache_patterns[cache_pattern_count] == NULL) return;
+memcpy(cache_patterns[cache_pattern_count++], pattern, length + 1);
+}
+
+/* Turn an XML Schema regular expression into the anchored Perl form, in the
+way libyang does: ^ and $ are ordinary characters in XML Schema, so they are
+escaped, and the whole expression is anchored. */
+
+static void
+cache_add_yang_pattern(const char *xsd)
+{
+size_t length = strlen(xsd);
+char *buffer = (char *)malloc(2 * length + 8);
+char *p = buffer;
+const char *s;
+int in_class = 0;
+
+if (buffer == NULL) return;
+p += sprintf(p, "^(?:");
+for (s = xsd; *s != 0; s++)
+  {
+  if (*s == '\\' && s[1] != 0)
+    {
+    *p++ = *s++;
+    *p++ = *s;
+    continue;
+    }
+  if (*s == '[') in_class = 1;
+    else if (*s == ']') in_class = 0;
+  if (*s == '$' || (*s == '^' && !(in_class && s[-1] == '[')))
+    *p++ = '\\';
+  *p++ = *s;
+  }
+strcpy(p, ")$");
+cache_add_pattern(buffer);
+free(buffer);
+}
+
+/* Read one YANG string argument, which may be several quoted strings joined
+by "+". Returns a pointer after the argument, with the value in "out". */
+
+static const char *
+yang_read_string(const char *s, char *out, size_t size)
+{
+size_t n = 0;
+
+for (;;)
+  {
+  char quote;
+  while (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n') s++;
+  if (*s != '"' && *s != '\'') break;
+  quote = *s++;
+  while (*s != 0 && *s != quote)
+    {
+    char c = *s++;
+    if (quote == '"' && c == '\\' && *s != 0)
+      {
+      c = *s++;
+      if (c == 'n') c = '\n';
+        else if (c == 't') c = '\t';
+        else if (c != '"' && c != '\\' && n + 1 < size) out[n++] = '\\';
+      }
+    if (n + 1 < size) out[n++] = c;
+    }
+  if (*s == quote) s++;
+  while (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n') s++;
+  if (*s != '+') break;
+  s++;
+  }
+out[n] = 0;
+return s;
+}
+
+/* Find the "pattern" statements in a YANG module, skipping comments and the
+text of other strings. */
+
+static void
+yang_scan_module(const char *name)
+{
+FILE *f = fopen(name, "rb");
+char *text, *value;
+const char *s;
+long size;
+
+if (f == NULL) return;
+fseek(f, 0, SEEK_END);
+size = ftell(f);
+fseek(f, 0, SEEK_SET);
+text = (char *)malloc((size_t)size + 1);
+value = (char *)malloc((size_t)size + 1);
+if (text == NULL || value == NULL ||
+    fread(text, 1, (size_t)size, f) != (size_t)size)
+  {
+  free(text);
+  free(value);
+  fclose(f);
+  return;
+  }
+fclose(f);
+text[size] = 0;
+
+for (s = text; *s != 0;)
+  {
+  if (s[0] == '/' && s[1] == '/')
+    {
+    while (*s != 0 && *s != '\n') s++;
+    }
+  else if (s[0] == '/' && s[1] == '*')
+    {
+    const char *end = strstr(s + 2, "*/");
+    s = (end == NULL)? s + strlen(s) : end + 2;
+    }
+  else if (*s == '"' || *s == '\'')
+    s = yang_read_string(s, value, (size_t)size + 1);
+  else if (strncmp(s, "pattern", 7) == 0 && (s == text ||
+      strchr(" \t\r\n;{}", s[-1]) != NULL) &&
+      strchr(" \t\r\n", s[7]) != NULL)
+    {
+    s = yang_read_string(s + 7, value, (size_t)size + 1);
+    cache_add_yang_pattern(value);
+    }
+  else s++;
+  }
+
+free(text);
+free(value);
+}
+
+static void
+yang_scan_path(const char *path)
+{
+#ifdef HAVE_DIRENT_H
+DIR *dir = opendir(path);
+if (dir != NULL)
+  {
+  struct dirent *d;
+  while ((d = readdir(dir)) != NULL)
+    {
+    size_t length = strlen(d->d_name);
+    char *name;
+    if (length < 5 || strcmp(d->d_name + length - 5, ".yang") != 0) continue;
+    name = (char *)malloc(strlen(path) + length + 2);
+    if (name == NULL) continue;
+    sprintf(name, "%s/%s", path, d->d_name);
+    yang_scan_module(name);
+    free(name);
+    }
+  closedir(dir);
+  return;
+  }
+#endif
+yang_scan_module(path);
+}
+
+/* One start-up: compile and study every pattern, optionally through the
+cache. Returns the number of patterns that compiled. */
+
+static int
+cache_start(const char *cache_file, int options)
+{
+pcre_cache *cache = NULL;
+const char *error;
+int erroroffset;
+int compiled = 0;
+int i;
+
+if (cache_file != NULL)
+  {
+  cache = pcre_cache_open(cache_file, &error);
+  if (cache == NULL) return -1;
+  }
+
+for (i = 0; i < cache_pattern_count; i++)
+  {
+  pcre_extra *extra;
+  pcre *re = pcre_cache_compile(cache, cache_patterns[i], options, 0, &extra,
+    &error, &erroroffset);
+  if (re == NULL) continue;
+  compiled++;
+  pcre_free_study(extra);
+  pcre_free(re);
+  }
+
+if (cache != NULL)
+  {
+  if (pcre_cache_save(cache) != 0) compiled = -1;
+  pcre_cache_close(cache);
+  }
+return compiled;
+}
+
+/* Check that every pattern from the cache is byte-for-byte what pcre_compile()
+and pcre_study() produce. */
+
+static int
+cache_verify(const char *cache_file, int options)
+{
+const char *error;
+int erroroffset;
+int bad = 0;
+int i;
+pcre_cache *cache = pcre_cache_open(cache_file, &error);
+
+if (cache == NULL) return 1;
+for (i = 0; i < cache_pattern_count; i++)
+  {
+  pcre_extra *cached_extra, *extra;
+  pcre *cached = pcre_cache_compile(cache, cache_patterns[i], options,
+    PCRE_STUDY_EXTRA_NEEDED, &cached_extra, &error, &erroroffset);
+  pcre *re = pcre_compile(cache_patterns[i], options, &error, &erroroffset,
+    NULL);
+  size_t size = 0, cached_size = 0;
+  int minlength = 0, cached_minlength = 0;
+  const unsigned char *bits = NULL, *cached_bits = NULL;
+
+  if (re == NULL || cached == NULL)
+    {
+    if ((re == NULL) != (cached == NULL)) bad++;
+    if (re != NULL) pcre_free(re);
+    if (cached != NULL) pcre_free(cached);
+    pcre_free_study(cached_extra);
+    continue;
+    }
+  extra = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED, &error);
+  (void)pcre_fullinfo(re, NULL, PCRE_INFO_SIZE, &size);
+  (void)pcre_fullinfo(cached, NULL, PCRE_INFO_SIZE, &cached_size);
+  (void)pcre_fullinfo(re, extra, PCRE_INFO_MINLENGTH, &minlength);
+  (void)pcre_fullinfo(cached, cached_extra, PCRE_INFO_MINLENGTH,
+    &cached_minlength);
+  (void)pcre_fullinfo(re, extra, PCRE_INFO_FIRSTTABLE, &bits);
+  (void)pcre_fullinfo(cached, cached_extra, PCRE_INFO_FIRSTTABLE,
+    &cached_bits);
+  if (size != cached_size || memcmp(re, cached, size) != 0 ||
+      minlength != cached_minlength ||
+      (bits == NULL) != (cached_bits == NULL) ||
+      (bits != NULL && memcmp(bits, cached_bits, 32) != 0))
+    {
+    printf("** cached pattern differs: %s\n", cache_patterns[i]);
+    bad++;
+    }
+  pcre_free_study(extra);
+  pcre_free_study(cached_extra);
+  pcre_free(re);
+  pcre_free(cached);
+  }
+pcre_cache_close(cache);
+return bad;
+}
+
+static int
+bench_cache(const bench_args *args)
+{
+const char *cache_file = (args->cache_file != NULL)? args->cache_file :
+  CACHE_FILE;
+long starts = (args->count > 0)? args->count : CACHE_STARTS;
+int options = bench_yang_options();
+int compiled = 0;
+int rc = 0;
+double t, plain_ns, populate_ns, cached_ns;
+long i;
+
+for (i = 0; i < args->module_count; i++) yang_scan_path(args->modules[i]);
+printf("%d patterns from YANG modules, ", cache_pattern_count);
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  cache_add_pattern(bench_yang_patterns[i].pattern);
+printf("%d in total\n", cache_pattern_count);
+
+/* Start without a cache file, then populate one, then use it. */
+
+(void)remove(cache_file);
+
+t = bench_now_ns();
+for (i = 0; i < starts; i++) compiled = cache_start(NULL, options);
+plain_ns = (bench_now_ns() - t) / starts;
+
+t = bench_now_ns();
+compiled = cache_start(cache_file, options);
+populate_ns = bench_now_ns() - t;
+if (compiled < 0)
+  {
+  printf("** failed to write %s\n", cache_file);
+  rc = 1;
+  goto EXIT;
+  }
+
+t = bench_now_ns();
+for (i = 0; i < starts; i++) compiled = cache_start(cache_file, options);
+cached_ns = (bench_now_ns() - t) / starts;
+
+if (cache_verify(cache_file, options) != 0)
+  {
+  rc = 1;
+  goto EXIT;
+  }
+
+printf("%d patterns compiled, %ld starts each\n", compiled, starts);
+printf("no cache:          %10.1f us per start\n", plain_ns / 1000);
+printf("populating cache:  %10.1f us\n", populate_ns / 1000);
+printf("with cache:        %10.1f us per start (%.2fx)\n", cached_ns / 1000,
+  (cached_ns > 0)? plain_ns / cached_ns : 0.0);
+
+EXIT:
+(void)remove(cache_file);
+while (cache_pattern_count > 0) free(cache_patterns[--cache_pattern_count]);
+return rc;
+}
+
+
+/*************************************************
+*         Skipping to a start of match          *
+*************************************************/
+
+/* Measure unanchored searches through a buffer of synthetic syslog lines, in
+which the interesting lines are rare, so that most of the time goes in
+skipping to possible starting points. Every match of each pattern is found
+with pcre_exec() and pcre_dfa_exec() and the throughput is shown. The count is
+the size of the buffer in megabytes. */
+
+#define SCAN_MEGABYTES 16
+#define SCAN_RARE_INTERVAL 5000   /* One rare line in this many */
+
+static const char *scan_common_lines[] = {
+  "%s netconf-srv sshd[%d]: Accepted publickey for admin from 192.0.2.%d "
+    "port %d ssh2\n",
+  "%s netconf-srv netopeer2-server[%d]: Session %d: thread %d event "
+    "new RPC.\n",
+  "%s netconf-srv sysrepo[%d]: Applying changes to running datastore "
+    "(%d edits, %d ms).\n",
+  "%s netconf-srv kernel: [%d.%06d] eth0: link up, 1000 Mbps, full duplex\n",
+  "%s netconf-srv cron[%d]: (root) CMD (run-parts /etc/cron.hourly) "
+    "pid %d rc %d\n"
+};
+
+static const char *scan_rare_lines[] = {
+  "%s netconf-srv kernel: [%d.%06d] Kernel panic - not syncing: "
+    "Fatal exception %d\n",
+  "%s netconf-srv sysrepo[%d]: Segmentation fault in worker %d (#%d)\n",
+  "%s netconf-srv netopeer2-server[%d]: OOM: cannot allocate %d bytes "
+    "(%d)\n"
+};
+
+typedef struct scan_pattern {
+  const char *name;               /* What the pattern exercises */
+  const char *pattern;
+} scan_pattern;
+
+static const scan_pattern scan_patterns[] = {
+  { "first char",          "Segmentation fault" },
+  { "caseless first char", "(?i)kernel panic" },
+  { "start bitmap",        "[#$%]\\d+" },
+  { "start bitmap alts",   "(?:OOM|oops|BUG): " }
+};
+
+#define SCAN_PATTERN_COUNT (int)(sizeof(scan_patterns) / sizeof(scan_pattern))
+
+/* Fill a buffer with log lines. Returns the length used. */
+
+static size_t
+scan_make_log(char *buffer, size_t size)
+{
+size_t used = 0;
+unsigned long seed = 12345;
+long line = 0;
+
+for (;;)
+  {
+  char stamp[32];
+  char text[256];
+  const char *format;
+  int n, a, b, c;
+
+  seed = seed * 1103515245UL + 12345UL;
+  a = (int)((seed >> 8) % 100000);
+  b = (int)((seed >> 4) % 255);
+  c = (int)((seed >> 12) % 65536);
+
+  sprintf(stamp, "2020-02-12T%02ld:%02ld:%02ld.%03ldZ", (line / 3600000) % 24,
+    (line / 60000) % 60, (line / 1000) % 60, line % 1000);
+  format = (line % SCAN_RARE_INTERVAL == SCAN_RARE_INTERVAL - 1)?
+    scan_rare_lines[(line / SCAN_RARE_INTERVAL) % 3] :
+    scan_common_lines[seed % 5];
+  n = sprintf(text, format, stamp, a, b, c);
+  if (used + n >= size) break;
+  memcpy(buffer + used, text, n);
+  used += n;
+  line++;
+  }
+
+return used;
+}
+
+/* Find every match in the buffer. Returns the number of matches. */
+
+static long
+scan_find_all(const pcre *re, const pcre_extra *extra, const char *buffer,
+  int length, int dfa)
+{
+int ovector[30];
+int workspace[100];
+int start = 0;
+long count = 0;
+
+while (start < length)
+  {
+  int rc = dfa?
+    pcre_dfa_exec(re, extra, buffer, length, start, 0, ovector, 30,
+      workspace, 100) :
+    pcre_exec(re, extra, buffer, length, start, 0, ovector, 30);
+  if (rc < 0) break;
+  count++;
+  start = (ovector[1] > ovector[0])? ovector[1] : ovector[0] + 1;
+  }
+
+return count;
+}
+
+static int
+bench_scan(const bench_args *args)
+{
+long megabytes = (args->count > 0)? args->count : SCAN_MEGABYTES;
+const char *target = NULL;
+char *buffer;
+size_t size;
+int length, i;
+int rc = 0;
+
+size = (size_t)megabytes * 1024 * 1024;
+buffer = (char *)malloc(size);
+if (buffer == NULL)
+  {
+  printf("** Failed to get %ld megabytes\n", megabytes);
+  return 1;
+  }
+length = (int)scan_make_log(buffer, size);
+
+(void)pcre_config(PCRE_CONFIG_SIMDSCAN, (void *)&target);
+printf("Start-of-match scanning: %s\n", (target != NULL)? target : "scalar");
+printf("Subject: %d bytes of log lines\n", length);
+
+printf("\n%-20s %-22s %8s %10s %10s\n", "test", "pattern", "matches",
+  "exec MB/s", "dfa MB/s");
+
+for (i = 0; i < SCAN_PATTERN_COUNT; i++)
+  {
+  const scan_pattern *p = scan_patterns + i;
+  const char *error;
+  int erroroffset;
+  pcre *re;
+  pcre_extra *extra;
+  double start, exec_ns, dfa_ns;
+  long exec_count, dfa_count;
+
+  re = pcre_compile(p->pattern, 0, &error, &erroroffset, NULL);
+  if (re == NULL)
+    {
+    printf("** %s: %s at offset %d\n", p->pattern, error, erroroffset);
+    rc = 1;
+    break;
+    }
+  extra = pcre_study(re, 0, &error);
+
+  start = bench_now_ns();
+  exec_count = scan_find_all(re, extra, buffer, length, 0);
+  exec_ns = bench_now_ns() - start;
+
+  start = bench_now_ns();
+  dfa_count = scan_find_all(re, extra, buffer, length, 1);
+  dfa_ns = bench_now_ns() - start;
+
+  if (exec_count != dfa_count)
+    {
+    printf("** %s: pcre_exec() found %ld matches, pcre_dfa_exec() %ld\n",
+      p->pattern, exec_count, dfa_count);
+    rc = 1;
+    }
+  else
+    {
+    printf("%-20s %-22s %8ld %10.0f %10.0f\n", p->name, p->pattern,
+      exec_count, length / (exec_ns / 1e9) / 1e6,
+      length / (dfa_ns / 1e9) / 1e6);
+    bench_sink += exec_count;
+    }
+
+  if (extra != NULL) pcre_free_study(extra);
+  pcre_free(re);
+  if (rc != 0) break;
+  }
+
+free(buffer);
+return rc;
+}
+
+
+/*************************************************
+*                 Pattern sets                  *
+*************************************************/
+
+/* Measure the validation of string leaves whose types carry several patterns,
+as happens when a YANG typedef is derived from another and adds restrictions of
+its own. Each leaf value is checked against all of its patterns, first by
+calling pcre_exec() for each pattern and then by a single call of
+pcre_set_exec(), with and without JIT. The count is the number of rounds. */
+
+#define SET_ROUNDS 200000
+#define SET_MEMBERS 6
+
+typedef struct set_leaf_type {
+  const char *name;                       /* The derived type */
+  const char *patterns[SET_MEMBERS + 1];  /* NULL terminated */
+  const char *values[8];                  /* NULL terminated */
+} set_leaf_type;
+
+static const set_leaf_type set_leaf_types[] = {
+  { "private-ipv4-address",
+    { "^(([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])\\.){3}"
+      "([0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])(%[\\p{N}\\p{L}]+)?$",
+      "^[^%]*$",
+      "^(10\\.|172\\.(1[6-9]|2[0-9]|3[01])\\.|192\\.168\\.).*$",
+      NULL },
+    { "10.0.0.1", "192.168.1.254", "172.16.0.1%eth0", "192.0.2.1",
+      "256.1.1.1", "10.1.2", NULL } },
+
+  { "global-ipv6-address",
+    { "^((:|[0-9a-fA-F]{0,4}):)([0-9a-fA-F]{0,4}:){0,5}"
+      "((([0-9a-fA-F]{0,4}:)?(:|[0-9a-fA-F]{0,4}))|"
+      "(((25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])\\.){3}"
+      "(25[0-5]|2[0-4][0-9]|[01]?[0-9]?[0-9])))(%[\\p{N}\\p{L}]+)?$",
+      "^(?:(([^:]+:){6}(([^:]+:[^:]+)|(.*\\..*)))|"
+      "((([^:]+:)*[^:]+)?::(([^:]+:)*[^:]+)?)(%.+)?)$",
+      "^[23][0-9a-fA-F]{3}:.*$",
+      "^[^%]*$",
+      NULL },
+    { "2001:db8::1", "fe80::1%eth0", "2001:db8:0:0:0:0:0:1", "::1",
+      "2001:db8::g", "3fff:1:2:3:4:5:6:7", NULL } },
+
+  { "unicast-mac-address",
+    { "^([0-9a-fA-F]{2}(:[0-9a-fA-F]{2})*)?$",
+      "^[0-9a-fA-F]{2}(:[0-9a-fA-F]{2}){5}$",
+      "^([0-9a-fA-F]{2}(:[0-9a-fA-F]{2})*)?$",
+      "^[0-9a-f:]*$",
+      "^.[02468ace].*$",
+      NULL },
+    { "00:1b:21:3c:4d:5e", "02:00:5e:10:00:01", "FF:FF:FF:FF:FF:FF",
+      "01:00:5e:00:00:fb", "00:1b:21:3c:4d", "0g:1b:21:3c:4d:5e", NULL } },
+
+  { "module-name",
+    { "^[a-zA-Z_][a-zA-Z0-9\\-_.]*$",
+      "^(?:.|..|[^xX].*|.[^mM].*|..[^lL].*)$",
+      "^.{1,64}$",
+      "^[a-z].*$",
+      "^[^.]*$",
+      "^(?!ietf-|iana-).*$",
+      NULL },
+    { "interface", "acme-routing", "ietf-interfaces", "xml", "Bad.Name",
+      "1st", "a-very-long-module-name-that-is-still-below-the-limit", NULL } }
+};
+
+#define SET_LEAF_TYPE_COUNT \
+  (int)(sizeof(set_leaf_types) / sizeof(set_leaf_type))
+
+typedef struct set_compiled_type {
+  int count;
+  pcre *re[SET_MEMBERS];
+  pcre_extra *extra[SET_MEMBERS];
+  pcre_set *set;
+} set_compiled_type;
+
+static void
+set_free_type(set_compiled_type *c)
+{
+int i;
+for (i = 0; i < c->count; i++)
+  {
+  if (c->extra[i] != NULL) pcre_free_study(c->extra[i]);
+  pcre_free(c->re[i]);
+  }
+if (c->set != NULL) pcre_set_free(c->set);
+}
+
+static int
+set_compile_type(const set_leaf_type *t, int options, int study_options,
+  set_compiled_type *c)
+{
+const char *error;
+int erroroffset, errorindex;
+
+c->set = NULL;
+for (c->count = 0; t->patterns[c->count] != NULL; c->count++)
+  {
+  int i = c->count;
+  c->re[i] = pcre_compile(t->patterns[i], options, &error, &erroroffset,
+    NULL);
+  if (c->re[i] == NULL)
+    {
+    printf("** %s: %s at offset %d\n", t->patterns[i], error, erroroffset);
+    set_free_type(c);
+    return 0;
+    }
+  c->extra[i] = pcre_study(c->re[i], study_options, &error);
+  }
+
+c->set = pcre_set_compile(t->patterns, c->count, options, study_options,
+  &error, &erroroffset, &errorindex);
+if (c->set == NULL)
+  {
+  printf("** %s member %d: %s at offset %d\n", t->name, errorindex, error,
+    erroroffset);
+  set_free_type(c);
+  return 0;
+  }
+return 1;
+}
+
+/* Check one value against every pattern separately. */
+
+static int
+set_match_each(const set_compiled_type *c, const char *value, int length,
+  unsigned char *matched)
+{
+int i, ovector[3], count = 0;
+for (i = 0; i < c->count; i++)
+  {
+  matched[i] = pcre_exec(c->re[i], c->extra[i], value, length, 0, 0,
+    ovector, 3) >= 0;
+  count += matched[i];
+  }
+return count;
+}
+
+static int
+bench_set(const bench_args *args)
+{
+long rounds = (args->count > 0)? args->count : SET_ROUNDS;
+int options = bench_yang_options();
+int jit = 0;
+int pass, t;
+
+(void)pcre_config(PCRE_CONFIG_JIT, &jit);
+
+printf("%ld rounds of each value\n", rounds);
+printf("\n%-22s %4s %-5s %12s %12s %8s\n", "type", "pats", "mode",
+  "each ns/val", "set ns/val", "speedup");
+
+for (pass = 0; pass < (jit? 2 : 1); pass++)
+  {
+  int study_options = (pass == 0)? 0 : PCRE_STUDY_JIT_COMPILE;
+
+  for (t = 0; t < SET_LEAF_TYPE_COUNT; t++)
+    {
+    const set_leaf_type *type = set_leaf_types + t;
+    set_compiled_type c;
+    int nvalues, v;
+    long r;
+    double start, each_ns, set_ns;
+
+    if (!set_compile_type(type, options, study_options, &c)) return 1;
+    for (nvalues = 0; type->values[nvalues] != NULL; nvalues++);
+
+    /* Check that both methods agree before timing them. */
+
+    for (v = 0; v < nvalues; v++)
+      {
+      unsigned char each[SET_MEMBERS], set[SET_MEMBERS];
+      int len = (int)strlen(type->values[v]);
+      int n1 = set_match_each(&c, type->values[v], len, each);
+      int n2 = pcre_set_exec(c.set, type->values[v], len, 0, set);
+      if (n1 != n2 || memcmp(each, set, c.count) != 0)
+        {
+        printf("** %s: results differ for \"%s\" (%d, %d)\n", type->name,
+          type->values[v], n1, n2);
+        set_free_type(&c);
+        return 1;
+        }
+      }
+
+    start = bench_now_ns();
+    for (r = 0; r < rounds; r++)
+      for (v = 0; v < nvalues; v++)
+        {
+        unsigned char matched[SET_MEMBERS];
+        bench_sink += set_match_each(&c, type->values[v],
+          (int)strlen(type->values[v]), matched);
+        }
+    each_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (r = 0; r < rounds; r++)
+      for (v = 0; v < nvalues; v++)
+        {
+        unsigned char matched[SET_MEMBERS];
+        bench_sink += pcre_set_exec(c.set, type->values[v],
+          (int)strlen(type->values[v]), 0, matched);
+        }
+    set_ns = bench_now_ns() - start;
+
+    printf("%-22s %4d %-5s %12.1f %12.1f %7.2fx\n", type->name, c.count,
+      (pass == 0)? "interp" : "jit", each_ns / (rounds * nvalues),
+      set_ns / (rounds * nvalues), each_ns / set_ns);
+    set_free_type(&c);
+    }
+  }
+
+return 0;
+}
+
+
+/*************************************************
+*                 The lazy DFA                  *
+*************************************************/
+
+/* Compare the interpreter with the lazy DFA that pcre_study() builds for
+anchored patterns when PCRE_STUDY_LAZY_DFA is given. The first table validates
+the YANG corpus values without asking for offsets, which is how a schema
+validator uses pcre_exec(); the second runs patterns on which the interpreter
+backtracks exponentially against subjects of increasing length. The count is
+the number of rounds for the first table. */
+
+#define LAZY_ROUNDS 200000
+
+typedef struct lazy_blowup_pattern {
+  const char *pattern;
+  char fill;                      /* Repeated to make the subject */
+  const char *tail;               /* Appended to make it fail */
+} lazy_blowup_pattern;
+
+static const lazy_blowup_pattern lazy_blowups[] = {
+  { "^(a|aa)*$",              'a', "!" },
+  { "^(a+)+$",                'a', "!" },
+  { "^(\\w+\\s?)*$",          'x', "!" },
+  { "^([0-9a-f]{1,4}:?)*$",   'a', "g" }
+};
+
+#define LAZY_BLOWUP_COUNT \
+  (int)(sizeof(lazy_blowups) / sizeof(lazy_blowup_pattern))
+
+static const int lazy_blowup_lengths[] = { 12, 16, 20, 24 };
+
+/* Time one pcre_exec() call per subject for a number of rounds. Returns the
+nanoseconds per call. */
+
+static double
+lazy_time_exec(const pcre *re, const pcre_extra *extra, const char **subjects,
+  int nsubjects, long rounds)
+{
+double start = bench_now_ns();
+long r;
+int s;
+
+for (r = 0; r < rounds; r++)
+  for (s = 0; s < nsubjects; s++)
+    bench_sink += pcre_exec(re, extra, subjects[s], (int)strlen(subjects[s]),
+      0, 0, NULL, 0);
+return (bench_now_ns() - start) / ((double)rounds * nsubjects);
+}
+
+static int
+bench_lazydfa(const bench_args *args)
+{
+long rounds = (args->count > 0)? args->count : LAZY_ROUNDS;
+int options = bench_yang_options();
+int i, j;
+
+printf("%ld rounds of each value\n", rounds);
+printf("\n%-18s %-18s %5s %12s %12s %8s\n", "module", "typedef", "dfa",
+  "interp ns", "lazy ns", "speedup");
+
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  const bench_pattern *p = bench_yang_patterns + i;
+  const char *subjects[8];
+  const char *error;
+  int erroroffset, nsubjects = 0;
+  pcre *re;
+  pcre_extra *interp, *lazy;
+  double interp_ns, lazy_ns;
+
+  re = pcre_compile(p->pattern, options, &error, &erroroffset, NULL);
+  if (re == NULL) continue;
+  interp = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED, &error);
+  lazy = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_LAZY_DFA, &error);
+
+  for (j = 0; p->valid[j] != NULL; j++)
+    subjects[nsubjects++] = p->valid[j];
+  for (j = 0; p->invalid[j] != NULL; j++)
+    subjects[nsubjects++] = p->invalid[j];
+
+  for (j = 0; j < nsubjects; j++)
+    {
+    int len = (int)strlen(subjects[j]);
+    int rc1 = pcre_exec(re, interp, subjects[j], len, 0, 0, NULL, 0);
+    int rc2 = pcre_exec(re, lazy, subjects[j], len, 0, 0, NULL, 0);
+    if (rc1 != rc2)
+      {
+      printf("** %s: results differ for \"%s\" (%d, %d)\n", p->type,
+        subjects[j], rc1, rc2);
+      pcre_free_study(interp);
+      pcre_free_study(lazy);
+      pcre_free(re);
+      return 1;
+      }
+    }
+
+  interp_ns = lazy_time_exec(re, interp, subjects, nsubjects, rounds);
+  lazy_ns = lazy_time_exec(re, lazy, subjects, nsubjects, rounds);
+
+  printf("%-18s %-18s %5s %12.1f %12.1f %7.2fx\n", p->module, p->type,
+    ((lazy->flags & PCRE_EXTRA_LAZY_DFA) != 0)? "yes" : "no", interp_ns,
+    lazy_ns, interp_ns / lazy_ns);
+
+  pcre_free_study(interp);
+  pcre_free_study(lazy);
+  pcre_free(re);
+  }
+
+printf("\n%-22s %6s %5s %14s %12s\n", "pattern", "length", "dfa",
+  "interp ns", "lazy ns");
+
+for (i = 0; i < LAZY_BLOWUP_COUNT; i++)
+  {
+  const lazy_blowup_pattern *p = lazy_blowups + i;
+  const char *error;
+  int erroroffset;
+  pcre *re;
+  pcre_extra *interp, *lazy;
+
+  re = pcre_compile(p->pattern, 0, &error, &erroroffset, NULL);
+  if (re == NULL)
+    {
+    printf("** %s: %s at offset %d\n", p->pattern, error, erroroffset);
+    return 1;
+    }
+  interp = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED, &error);
+  lazy = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_LAZY_DFA, &error);
+
+  /* The match limit is lifted so that the interpreter really does the work
+  instead of giving up with PCRE_ERROR_MATCHLIMIT. */
+
+  interp->flags |= PCRE_EXTRA_MATCH_LIMIT;
+  interp->match_limit = 0x7fffffffL;
+
+  for (j = 0; j < (int)(sizeof(lazy_blowup_lengths) / sizeof(int)); j++)
+    {
+    char subject[64];
+    const char *subjects[1];
+    int n = lazy_blowup_lengths[j];
+
+    memset(subject, p->fill, n);
+    strcpy(subject + n, p->tail);
+    subjects[0] = subject;
+
+    printf("%-22s %6d %5s %14.0f %12.1f\n", p->pattern, n,
+      ((lazy->flags & PCRE_EXTRA_LAZY_DFA) != 0)? "yes" : "no",
+      lazy_time_exec(re, interp, subjects, 1, 1),
+      lazy_time_exec(re, lazy, subjects, 1, 1000));
+    }
+
+  pcre_free_study(interp);
+  pcre_free_study(lazy);
+  pcre_free(re);
+  }
+
+return 0;
+}
+
+
+/*************************************************
+*                Checking UTF-8                 *
+*************************************************/
+
+/* Measure the UTF-8 check that pcre_exec() makes on each subject, by calling
+pcre_valid_utf8() on buffers of different scripts, and shows what it costs a
+search that is repeated with several patterns when the subject is checked once
+and PCRE_NO_UTF8_CHECK is passed to each match. The count is the size of the
+buffers in megabytes. */
+
+#define UTF8_MEGABYTES 16
+#define UTF8_REPEAT 8                  /* Checks of each buffer */
+
+typedef struct utf8_text_kind {
+  const char *name;
+  const char *words[4];           /* Repeated to fill the buffer */
+} utf8_text_kind;
+
+static const utf8_text_kind utf8_kinds[] = {
+  { "ASCII",     { "interface ", "eth0 ", "mtu 1500 ", "up\n" } },
+  { "Latin",     { "r\xc3\xa9seau ", "donn\xc3\xa9" "es ", "d\xc3\xa9" "faut ",
+                   "activ\xc3\xa9\n" } },
+  { "CJK",       { "\xe6\x8e\xa5\xe5\x8f\xa3 ", "\xe7\xbd\x91\xe7\xbb\x9c ",
+                   "\xe9\x85\x8d\xe7\xbd\xae ",
+                   "\xe7\x8a\xb6\xe6\x80\x81\n" } },
+  { "emoji",     { "ok \xf0\x9f\x98\x80 ", "\xf0\x9f\x9a\x80\xf0\x9f\x9a\x80 ",
+                   "up ", "\xf0\x9f\x91\x8d\n" } }
+};
+
+#define UTF8_KIND_COUNT (int)(sizeof(utf8_kinds) / sizeof(utf8_text_kind))
+
+static const char *utf8_patterns[] = {
+  "down", "error", "\\d{5}", "fail(ed|ure)" };
+
+#define UTF8_PATTERN_COUNT (int)(sizeof(utf8_patterns) / sizeof(char *))
+
+/* Fill a buffer with words. Returns the length used. */
+
+static size_t
+utf8_make_text(const utf8_text_kind *kind, char *buffer, size_t size)
+{
+size_t used = 0;
+unsigned long seed = 12345;
+
+for (;;)
+  {
+  const char *word;
+  size_t n;
+  seed = seed * 1103515245UL + 12345UL;
+  word = kind->words[(seed >> 16) % 4];
+  n = strlen(word);
+  if (used + n >= size) break;
+  memcpy(buffer + used, word, n);
+  used += n;
+  }
+return used;
+}
+
+static int
+bench_utf8(const bench_args *args)
+{
+long megabytes = (args->count > 0)? args->count : UTF8_MEGABYTES;
+const char *target = NULL;
+pcre *re[UTF8_PATTERN_COUNT];
+pcre_extra *extra[UTF8_PATTERN_COUNT];
+char *buffer;
+size_t size;
+int i, k, utf = 0;
+int npatterns = 0;
+int rc = 0;
+
+(void)pcre_config(PCRE_CONFIG_UTF8, &utf);
+if (!utf)
+  {
+  printf("** This PCRE was built without UTF support\n");
+  return 1;
+  }
+
+size = (size_t)megabytes * 1024 * 1024;
+buffer = (char *)malloc(size);
+if (buffer == NULL)
+  {
+  printf("** Failed to get %ld megabytes\n", megabytes);
+  return 1;
+  }
+
+for (; npatterns < UTF8_PATTERN_COUNT; npatterns++)
+  {
+  const char *error;
+  int erroroffset;
+  re[npatterns] = pcre_compile(utf8_patterns[npatterns], PCRE_UTF8, &error,
+    &erroroffset, NULL);
+  if (re[npatterns] == NULL)
+    {
+    printf("** %s: %s at offset %d\n", utf8_patterns[npatterns], error,
+      erroroffset);
+    rc = 1;
+    goto EXIT;
+    }
+  extra[npatterns] = pcre_study(re[npatterns], 0, &error);
+  }
+
+(void)pcre_config(PCRE_CONFIG_SIMDSCAN, (void *)&target);
+printf("Vector instructions: %s\n", (target != NULL)? target : "none");
+printf("Buffers: %ld megabytes\n", megabytes);
+printf("\n%-8s %12s %16s %16s\n", "text", "check MB/s", "search each ms",
+  "search once ms");
+
+for (k = 0; k < UTF8_KIND_COUNT; k++)
+  {
+  int length = (int)utf8_make_text(utf8_kinds + k, buffer, size);
+  int erroroffset, r;
+  double start, check_ns, each_ns, once_ns;
+
+  start = bench_now_ns();
+  for (r = 0; r < UTF8_REPEAT; r++)
+    {
+    if (pcre_valid_utf8(buffer, length, &erroroffset) != 0)
+      {
+      printf("** %s: invalid UTF-8 at offset %d\n", utf8_kinds[k].name,
+        erroroffset);
+      rc = 1;
+      goto EXIT;
+      }
+    }
+  check_ns = (bench_now_ns() - start) / UTF8_REPEAT;
+
+  /* Search with every pattern, first letting pcre_exec() check the subject
+  each time, and then checking it once beforehand. */
+
+  start = bench_now_ns();
+  for (i = 0; i < UTF8_PATTERN_COUNT; i++)
+    {
+    int ovector[30];
+    bench_sink += pcre_exec(re[i], extra[i], buffer, length, 0, 0, ovector,
+      30);
+    }
+  each_ns = bench_now_ns() - start;
+
+  start = bench_now_ns();
+  if (pcre_valid_utf8(buffer, length, NULL) == 0)
+    for (i = 0; i < UTF8_PATTERN_COUNT; i++)
+      {
+      int ovector[30];
+      bench_sink += pcre_exec(re[i], extra[i], buffer, length, 0,
+        PCRE_NO_UTF8_CHECK, ovector, 30);
+      }
+  once_ns = bench_now_ns() - start;
+
+  printf("%-8s %12.0f %16.2f %16.2f\n", utf8_kinds[k].name,
+    length / (check_ns / 1e9) / 1e6, each_ns / 1e6, once_ns / 1e6);
+  }
+
+EXIT:
+for (i = 0; i < npatterns; i++)
+  {
+  if (extra[i] != NULL) pcre_free_study(extra[i]);
+  pcre_free(re[i]);
+  }
+free(buffer);
+return rc;
+}
+
+
+/*************************************************
+*             Shared pattern cache              *
+*************************************************/
+
+/* Compare compiling a pattern each time it is used with getting it from a
+shared pattern cache, as a function that builds a pcrecpp::RE object on every
+call would. The first table gives the cost per use for each pattern of the YANG
+corpus, including one pcre_exec() on a valid value. The second runs several
+threads that use the whole corpus through one cache, first with room for every
+pattern and then with room for a quarter of them, so that most lookups miss.
+The count is the number of rounds. */
+
+#define LRU_ROUNDS 20000
+#define LRU_MAX_THREADS 8
+
+static long lru_rounds;
+
+/* Use a pattern once, compiling and studying it from scratch. */
+
+static void
+lru_use_compiled(const bench_pattern *p, int options)
+{
+const char *error;
+int erroroffset;
+pcre *re = pcre_compile(p->pattern, options, &error, &erroroffset, NULL);
+pcre_extra *extra = pcre_study(re, 0, &error);
+bench_sink += pcre_exec(re, extra, p->valid[0], (int)strlen(p->valid[0]), 0,
+  0, NULL, 0);
+pcre_free_study(extra);
+pcre_free(re);
+}
+
+/* Use a pattern once, getting it from a cache. */
+
+static void
+lru_use_cached(pcre_lru_cache *cache, const bench_pattern *p, int options)
+{
+const char *error;
+int erroroffset;
+const pcre_extra *extra;
+const pcre *re = pcre_compile_cached(cache, p->pattern, options, &error,
+  &erroroffset, NULL, &extra);
+bench_sink += pcre_exec(re, extra, p->valid[0], (int)strlen(p->valid[0]), 0,
+  0, NULL, 0);
+pcre_release_cached(re);
+}
+
+#ifndef _WIN32
+typedef struct lru_thread_arg {
+  pcre_lru_cache *cache;
+  int options;
+  int seed;
+} lru_thread_arg;
+
+/* Each thread visits the corpus in its own order. */
+
+static void *
+lru_thread_main(void *argument)
+{
+lru_thread_arg *arg = (lru_thread_arg *)argument;
+unsigned int state = (unsigned int)arg->seed * 2654435761U + 1;
+long r;
+
+for (r = 0; r < lru_rounds * BENCH_YANG_PATTERN_COUNT; r++)
+  {
+  state = state * 1103515245U + 12345U;
+  lru_use_cached(arg->cache, bench_yang_patterns +
+    (state >> 8) % BENCH_YANG_PATTERN_COUNT, arg->options);
+  }
+return NULL;
+}
+
+/* Run a number of threads through one cache and print a line. */
+
+static void
+lru_run_threads(int capacity, int nthreads, int options)
+{
+pthread_t threads[LRU_MAX_THREADS];
+lru_thread_arg args[LRU_MAX_THREADS];
+pcre_lru_cache *cache = pcre_lru_cache_create(capacity, 0);
+unsigned long int hits, misses, evictions;
+double start, ns;
+int i;
+
+start = bench_now_ns();
+for (i = 0; i < nthreads; i++)
+  {
+  args[i].cache = cache;
+  args[i].options = options;
+  args[i].seed = i;
+  pthread_create(threads + i, NULL, lru_thread_main, args + i);
+  }
+for (i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+ns = bench_now_ns() - start;
+
+pcre_lru_cache_info(cache, PCRE_LRUINFO_HITS, &hits);
+pcre_lru_cache_info(cache, PCRE_LRUINFO_MISSES, &misses);
+pcre_lru_cache_info(cache, PCRE_LRUINFO_EVICTIONS, &evictions);
+printf("%8d %7d %12.2f %10lu %10lu %10lu\n", capacity, nthreads,
+  (double)nthreads * lru_rounds * BENCH_YANG_PATTERN_COUNT / ns * 1000.0,
+  hits, misses, evictions);
+pcre_lru_cache_free(cache);
+}
+#endif
+
+static int
+bench_lru(const bench_args *args)
+{
+int options = bench_yang_options();
+pcre_lru_cache *cache;
+int i;
+
+lru_rounds = (args->count > 0)? args->count : LRU_ROUNDS;
+
+printf("%ld rounds of each pattern\n", lru_rounds);
+printf("\n%-18s %-18s %12s %12s %8s\n", "module", "typedef", "compile ns",
+  "cached ns", "speedup");
+
+cache = pcre_lru_cache_create(0, 0);
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  const bench_pattern *p = bench_yang_patterns + i;
+  double start, compile_ns, cached_ns;
+  long r;
+
+  start = bench_now_ns();
+  for (r = 0; r < lru_rounds; r++) lru_use_compiled(p, options);
+  compile_ns = (bench_now_ns() - start) / lru_rounds;
+
+  start = bench_now_ns();
+  for (r = 0; r < lru_rounds; r++) lru_use_cached(cache, p, options);
+  cached_ns = (bench_now_ns() - start) / lru_rounds;
+
+  printf("%-18s %-18s %12.1f %12.1f %7.2fx\n", p->module, p->type,
+    compile_ns, cached_ns, compile_ns / cached_ns);
+  }
+pcre_lru_cache_free(cache);
+
+#ifndef _WIN32
+printf("\n%8s %7s %12s %10s %10s %10s\n", "capacity", "threads", "Muses/s",
+  "hits", "misses", "evictions");
+for (i = 1; i <= LRU_MAX_THREADS; i *= 2)
+  lru_run_threads(256, i, options);
+for (i = 1; i <= LRU_MAX_THREADS; i *= 2)
+  lru_run_threads(BENCH_YANG_PATTERN_COUNT / 4, i, options);
+#endif
+
+return 0;
+}
+
+
+/*************************************************
+*                 The POSIX API                 *
+*************************************************/
+
+/* Measure the cost of matching through the POSIX API against calling
+pcre_exec() directly. The first table matches the values of the YANG corpus
+with pcre_exec() on an unstudied pattern, as the POSIX wrapper used to, and
+with the pattern studied; with regexec() on the pattern compiled with
+REG_NOSUB; and with regexec() asking for one offset, and for more than
+POSIX_MALLOC_THRESHOLD, which needs a workspace. The options are those that
+regcomp() would use, so captures are not disabled as they are elsewhere. The
+second table finds the lines of a large buffer that match a pattern, using
+REG_STARTEND and by copying each line to make it NUL-terminated. The count is
+the number of rounds for the first table. */
+
+#define POSIX_ROUNDS 100000
+#define POSIX_MANY_MATCHES 16
+#define POSIX_BUFFER_LINES 100000
+
+static const char *const posix_line_patterns[] = {
+  "^[a-z]+=[0-9]+$",
+  "error",
+  "^[^=]*=(0x[0-9a-f]+|[0-9]+)$"
+};
+
+#define POSIX_LINE_PATTERN_COUNT \
+  (int)(sizeof(posix_line_patterns) / sizeof(const char *))
+
+/* Time a matching method over a set of subjects. */
+
+typedef int (*posix_match_fn)(const void *, const char *);
+
+static double
+posix_time_match(posix_match_fn fn, const void *data, const char **subjects,
+  int nsubjects, long rounds)
+{
+double start = bench_now_ns();
+long r;
+int s;
+
+for (r = 0; r < rounds; r++)
+  for (s = 0; s < nsubjects; s++)
+    bench_sink += fn(data, subjects[s]);
+return (bench_now_ns() - start) / ((double)rounds * nsubjects);
+}
+
+typedef struct posix_native_data {
+  const pcre *re;
+  const pcre_extra *extra;
+} posix_native_data;
+
+static int
+posix_match_native(const void *data, const char *subject)
+{
+const posix_native_data *d = (const posix_native_data *)data;
+int ovector[30];
+return pcre_exec(d->re, d->extra, subject, (int)strlen(subject), 0, 0,
+  ovector, 30);
+}
+
+static int
+posix_match_nosub(const void *data, const char *subject)
+{
+return regexec((const regex_t *)data, subject, 0, NULL, 0);
+}
+
+static int
+posix_match_one(const void *data, const char *subject)
+{
+regmatch_t pmatch[1];
+return regexec((const regex_t *)data, subject, 1, pmatch, 0);
+}
+
+static int
+posix_match_many(const void *data, const char *subject)
+{
+regmatch_t pmatch[POSIX_MANY_MATCHES];
+return regexec((const regex_t *)data, subject, POSIX_MANY_MATCHES, pmatch, 0);
+}
+
+static int
+bench_posix(const bench_args *args)
+{
+long rounds = (args->count > 0)? args->count : POSIX_ROUNDS;
+int options = bench_yang_options() & PCRE_UTF8;
+int cflags = (options != 0)? REG_UTF8 : 0;
+char *buffer, *p;
+int i, j;
+
+printf("%ld rounds of each value\n", rounds);
+printf("\n%-18s %-18s %9s %9s %9s %9s %9s\n", "module", "typedef",
+  "exec ns", "study ns", "nosub ns", "1 ns", "16 ns");
+
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  const bench_pattern *p = bench_yang_patterns + i;
+  const char *subjects[8];
+  const char *error;
+  int erroroffset, nsubjects = 0;
+  posix_native_data plain, studied;
+  regex_t preg, preg_nosub;
+  pcre *re;
+  pcre_extra *extra;
+
+  re = pcre_compile(p->pattern, options, &error, &erroroffset, NULL);
+  if (re == NULL)
+    {
+    printf("** %s: %s at offset %d\n", p->type, error, erroroffset);
+    return 1;
+    }
+  if (regcomp(&preg, p->pattern, cflags) != 0)
+    {
+    printf("** %s: regcomp() failed\n", p->type);
+    pcre_free(re);
+    return 1;
+    }
+  if (regcomp(&preg_nosub, p->pattern, cflags | REG_NOSUB) != 0)
+    {
+    printf("** %s: regcomp() failed with REG_NOSUB\n", p->type);
+    regfree(&preg);
+    pcre_free(re);
+    return 1;
+    }
+  extra = pcre_study(re, 0, &error);
+  plain.re = studied.re = re;
+  plain.extra = NULL;
+  studied.extra = extra;
+
+  for (j = 0; p->valid[j] != NULL; j++)
+    subjects[nsubjects++] = p->valid[j];
+  for (j = 0; p->invalid[j] != NULL; j++)
+    subjects[nsubjects++] = p->invalid[j];
+
+  for (j = 0; j < nsubjects; j++)
+    {
+    if ((posix_match_native(&plain, subjects[j]) >= 0) !=
+        (posix_match_many(&preg, subjects[j]) == 0))
+      {
+      printf("** %s: results differ for \"%s\"\n", p->type, subjects[j]);
+      regfree(&preg);
+      regfree(&preg_nosub);
+      pcre_free_study(extra);
+      pcre_free(re);
+      return 1;
+      }
+    }
+
+  printf("%-18s %-18s %9.1f %9.1f %9.1f %9.1f %9.1f\n", p->module, p->type,
+    posix_time_match(posix_match_native, &plain, subjects, nsubjects,
+      rounds),
+    posix_time_match(posix_match_native, &studied, subjects, nsubjects,
+      rounds),
+    posix_time_match(posix_match_nosub, &preg_nosub, subjects, nsubjects,
+      rounds),
+    posix_time_match(posix_match_one, &preg, subjects, nsubjects, rounds),
+    posix_time_match(posix_match_many, &preg, subjects, nsubjects, rounds));
+
+  regfree(&preg);
+  regfree(&preg_nosub);
+  pcre_free_study(extra);
+  pcre_free(re);
+  }
+
+/* A buffer of lines, none of them NUL-terminated. */
+
+buffer = (char *)malloc(POSIX_BUFFER_LINES * 32);
+if (buffer == NULL)
+  {
+  printf("** Failed to get a buffer for %d lines\n", POSIX_BUFFER_LINES);
+  return 1;
+  }
+for (i = 0, p = buffer; i < POSIX_BUFFER_LINES; i++)
+  p += sprintf(p, (i % 7 == 0)? "error%d=0x%x\n" : "key%c=%d\n",
+    (i % 7 == 0)? i : 'a' + i % 26, i * 37);
+
+printf("\n%-30s %8s %12s %12s\n", "pattern", "matches", "startend ms",
+  "copy ms");
+
+for (i = 0; i < POSIX_LINE_PATTERN_COUNT; i++)
+  {
+  regex_t preg;
+  regmatch_t pmatch[2];
+  char line[64];
+  double start, startend_ns, copy_ns;
+  int count1 = 0, count2 = 0;
+  char *q;
+
+  if (regcomp(&preg, posix_line_patterns[i], 0) != 0)
+    {
+    printf("** %s: regcomp() failed\n", posix_line_patterns[i]);
+    free(buffer);
+    return 1;
+    }
+
+  start = bench_now_ns();
+  for (q = buffer; q < p; q = strchr(q, '\n') + 1)
+    {
+    pmatch[0].rm_so = 0;
+    pmatch[0].rm_eo = (int)(strchr(q, '\n') - q);
+    if (regexec(&preg, q, 2, pmatch, REG_STARTEND) == 0) count1++;
+    }
+  startend_ns = bench_now_ns() - start;
+
+  start = bench_now_ns();
+  for (q = buffer; q < p; q = strchr(q, '\n') + 1)
+    {
+    size_t length = (size_t)(strchr(q, '\n') - q);
+    memcpy(line, q, length);
+    line[length] = 0;
+    if (regexec(&preg, line, 2, pmatch, 0) == 0) count2++;
+    }
+  copy_ns = bench_now_ns() - start;
+
+  if (count1 != count2)
+    {
+    printf("** %s: counts differ (%d, %d)\n", posix_line_patterns[i], count1,
+      count2);
+    regfree(&preg);
+    free(buffer);
+    return 1;
+    }
+  printf("%-30s %8d %12.2f %12.2f\n", posix_line_patterns[i], count1,
+    startend_ns / 1e6, copy_ns / 1e6);
+  regfree(&preg);
+  }
+
+free(buffer);
+return 0;
+}
+
+
+/*************************************************
+*             Specialized matchers              *
+*************************************************/
+
+/* Compare the interpreter, the lazy DFA, and the specialized matchers that
+pcre_study() attaches to literals, lists of literals, and simple sequences of
+character runs. The first table validates the YANG corpus values, asking for
+the offsets of the match as a schema validator that reports errors does; the
+second searches short lines for literals and lists of literals. The count is
+the number of rounds. */
+
+#define SPECIAL_ROUNDS 200000
+#define SPECIAL_OVECCOUNT 30
+
+typedef struct special_search {
+  const char *name;               /* What the pattern exercises */
+  const char *pattern;
+} special_search;
+
+static const special_search special_searches[] = {
+  { "literal",              "Segmentation fault" },
+  { "anchored literal",     "^netconf-srv kernel:" },
+  { "caseless literal",     "(?i)kernel panic" },
+  { "literal list",         "(?:OOM|oops|BUG|panic): " },
+  { "anchored list",        "^(?:GET|PUT|POST|DELETE|PATCH)$" },
+  { "suffix literal",       "\\.(?:xml|json)$" }
+};
+
+#define SPECIAL_SEARCH_COUNT \
+  (int)(sizeof(special_searches) / sizeof(special_search))
+
+static const char *special_lines[] = {
+  "netconf-srv sshd[4121]: Accepted publickey for admin from 192.0.2.7",
+  "netconf-srv kernel: [1021.000311] eth0: link up, 1000 Mbps, full duplex",
+  "netconf-srv sysrepo[77]: Segmentation fault in worker 3 (#12)",
+  "netconf-srv kernel: [1022.104411] Kernel panic - not syncing: oops: 0x1",
+  "POST",
+  "/data/ietf-interfaces:interfaces/interface=eth0.json",
+  "netconf-srv netopeer2-server[310]: OOM: cannot allocate 65536 bytes",
+  "DELETE"
+};
+
+#define SPECIAL_LINE_COUNT (int)(sizeof(special_lines) / sizeof(char *))
+
+/* The three ways of studying a pattern. */
+
+static const int special_study_options[] = {
+  PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_NO_SPECIAL,
+  PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_LAZY_DFA|PCRE_STUDY_NO_SPECIAL,
+  PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_LAZY_DFA
+};
+
+/* Time one pcre_exec() call per subject for a number of rounds. Returns the
+nanoseconds per call. */
+
+static double
+special_time_exec(const pcre *re, const pcre_extra *extra,
+  const char **subjects, int nsubjects, long rounds)
+{
+int ovector[SPECIAL_OVECCOUNT];
+double start = bench_now_ns();
+long r;
+int s;
+
+for (r = 0; r < rounds; r++)
+  for (s = 0; s < nsubjects; s++)
+    bench_sink += pcre_exec(re, extra, subjects[s], (int)strlen(subjects[s]),
+      0, 0, ovector, SPECIAL_OVECCOUNT);
+return (bench_now_ns() - start) / ((double)rounds * nsubjects);
+}
+
+/* Compile a pattern, study it in the three ways, check that they agree on
+every subject, and print the times. Returns FALSE if they disagree. */
+
+static int
+special_compare(const char *title, const char *pattern, int options,
+  const char **subjects, int nsubjects, long rounds)
+{
+pcre_extra *extra[3];
+double ns[3];
+const char *error;
+int erroroffset, i, j;
+pcre *re = pcre_compile(pattern, options, &error, &erroroffset, NULL);
+
+if (re == NULL)
+  {
+  printf("** %s: %s at offset %d\n", title, error, erroroffset);
+  return 0;
+  }
+for (i = 0; i < 3; i++)
+  extra[i] = pcre_study(re, special_study_options[i], &error);
+
+for (j = 0; j < nsubjects; j++)
+  {
+  int len = (int)strlen(subjects[j]);
+  int ov0[SPECIAL_OVECCOUNT], ov[SPECIAL_OVECCOUNT];
+  int rc0 = pcre_exec(re, extra[0], subjects[j], len, 0, 0, ov0,
+    SPECIAL_OVECCOUNT);
+  for (i = 1; i < 3; i++)
+    {
+    int rc = pcre_exec(re, extra[i], subjects[j], len, 0, 0, ov,
+      SPECIAL_OVECCOUNT);
+    if (rc != rc0 || (rc > 0 && memcmp(ov, ov0, 2 * rc * sizeof(int)) != 0))
+      {
+      printf("** %s: results differ for \"%s\"\n", title, subjects[j]);
+      for (i = 0; i < 3; i++) pcre_free_study(extra[i]);
+      pcre_free(re);
+      return 0;
+      }
+    }
+  }
+
+for (i = 0; i < 3; i++)
+  ns[i] = special_time_exec(re, extra[i], subjects, nsubjects, rounds);
+
+printf("%-24s %8s %10.1f %10.1f %10.1f %7.2fx\n", title,
+  ((extra[2]->flags & PCRE_EXTRA_SPECIAL) != 0)? "yes" : "no", ns[0], ns[1],
+  ns[2], ns[0] / ns[2]);
+
+for (i = 0; i < 3; i++) pcre_free_study(extra[i]);
+pcre_free(re);
+return 1;
+}
+
+static int
+bench_special(const bench_args *args)
+{
+long rounds = (args->count > 0)? args->count : SPECIAL_ROUNDS;
+int options = bench_yang_options();
+int i, j;
+
+printf("%ld rounds of each subject\n", rounds);
+printf("\n%-24s %8s %10s %10s %10s %8s\n", "typedef", "special",
+  "interp ns", "lazy ns", "special ns", "speedup");
+
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  const bench_pattern *p = bench_yang_patterns + i;
+  const char *subjects[8];
+  int nsubjects = 0;
+
+  for (j = 0; p->valid[j] != NULL; j++) subjects[nsubjects++] = p->valid[j];
+  for (j = 0; p->invalid[j] != NULL; j++)
+    subjects[nsubjects++] = p->invalid[j];
+  if (!special_compare(p->type, p->pattern, options, subjects, nsubjects,
+      rounds))
+    return 1;
+  }
+
+printf("\n%-24s %8s %10s %10s %10s %8s\n", "search", "special",
+  "interp ns", "lazy ns", "special ns", "speedup");
+
+for (i = 0; i < SPECIAL_SEARCH_COUNT; i++)
+  if (!special_compare(special_searches[i].name, special_searches[i].pattern,
+      0, special_lines, SPECIAL_LINE_COUNT, rounds))
+    return 1;
+
+return 0;
+}
+
+
+/*************************************************
+*              Unicode properties               *
+*************************************************/
+
+/* Measure matching that looks up Unicode properties for each character: \p
+escapes, \w, \s, and POSIX classes in UCP mode, grapheme clusters, and caseless
+matching in UTF-8 mode. Each pattern is matched repeatedly through texts in
+several scripts, as a global search would, and the rate is shown in megabytes
+per second, for the interpreter and, if it is available, the JIT. The count is
+the size of the texts in kilobytes. */
+
+#define UCD_KILOBYTES 256
+#define UCD_REPEAT 4                  /* Searches of each text */
+
+typedef struct ucd_text_kind {
+  const char *name;
+  const char *words[4];           /* Repeated to fill the text */
+} ucd_text_kind;
+
+static const ucd_text_kind ucd_kinds[] = {
+  { "ASCII",     { "Interface ", "eth0 ", "mtu 1500, ", "up\n" } },
+  { "Latin",     { "R\xc3\xa9seau ", "donn\xc3\xa9" "es ",
+                   "d\xc3\xa9" "faut, ", "activ\xc3\xa9\n" } },
+  { "Greek",     { "\xce\x94\xce\xaf\xce\xba\xcf\x84\xcf\x85\xce\xbf ",
+                   "\xce\xb4\xce\xb5\xce\xb4\xce\xbf\xce\xbc\xce\xad\xce\xbd"
+                   "\xce\xb1 ", "1500, ", "\xce\xb5\xce\xbd\xce\xb5\xcf\x81"
+                   "\xce\xb3\xcf\x8c\n" } },
+  { "CJK",       { "\xe6\x8e\xa5\xe5\x8f\xa3 ", "\xe7\xbd\x91\xe7\xbb\x9c ",
+                   "\xe9\x85\x8d\xe7\xbd\xae\xe3\x80\x81",
+                   "\xe7\x8a\xb6\xe6\x80\x81\n" } }
+};
+
+#define UCD_KIND_COUNT (int)(sizeof(ucd_kinds) / sizeof(ucd_text_kind))
+
+/* The texts contain no mathematical symbols, so the ucd_patterns that end with
+\p{Sm} try every starting position without finding a match. */
+
+static const char *ucd_patterns[] = {
+  "\\p{L}+\\p{Sm}",
+  "\\p{Lu}\\p{Ll}+\\p{Nd}",
+  "(*UCP)\\w+\\p{Sm}",
+  "(*UCP)\\s+\\p{Sm}",
+  "(*UCP)[[:alnum:]]+\\p{Sm}",
+  "\\X{3}\\p{Sm}",
+  "\\p{Xan}+\\P{Xan}",
+  "(?i)\\w\xc3\x89"
+};
+
+#define UCD_PATTERN_COUNT (int)(sizeof(ucd_patterns) / sizeof(char *))
+
+/* Fill a buffer with words. Returns the length used. */
+
+static int
+ucd_make_text(const ucd_text_kind *kind, char *buffer, size_t size)
+{
+size_t used = 0;
+unsigned long seed = 12345;
+
+for (;;)
+  {
+  const char *word;
+  size_t n;
+  seed = seed * 1103515245UL + 12345UL;
+  word = kind->words[(seed >> 16) % 4];
+  n = strlen(word);
+  if (used + n >= size) break;
+  memcpy(buffer + used, word, n);
+  used += n;
+  }
+return (int)used;
+}
+
+/* Find every match in a text, UCD_REPEAT times. Returns the rate in megabytes
+per second. */
+
+static double
+ucd_search_all(const pcre *re, const pcre_extra *extra, const char *text,
+  int length)
+{
+double start = bench_now_ns();
+int r;
+
+for (r = 0; r < UCD_REPEAT; r++)
+  {
+  int offset = 0;
+  int ovector[30];
+  while (offset < length && pcre_exec(re, extra, text, length, offset,
+      PCRE_NO_UTF8_CHECK, ovector, 30) > 0)
+    {
+    bench_sink++;
+    offset = (ovector[1] > ovector[0])? ovector[1] : ovector[1] + 1;
+    while (offset < length && (text[offset] & 0xc0) == 0x80) offset++;
+    }
+  }
+return (double)length * UCD_REPEAT / ((bench_now_ns() - start) / 1e9) / 1e6;
+}
+
+static int
+bench_ucd(const bench_args *args)
+{
+long kilobytes = (args->count > 0)? args->count : UCD_KILOBYTES;
+char *texts[UCD_KIND_COUNT];
+int lengths[UCD_KIND_COUNT];
+int i, k, jit = 0, ucp = 0, pass;
+int ntexts = 0;
+int rc = 0;
+
+(void)pcre_config(PCRE_CONFIG_UNICODE_PROPERTIES, &ucp);
+if (!ucp)
+  {
+  printf("** This PCRE was built without Unicode property support\n");
+  return 1;
+  }
+(void)pcre_config(PCRE_CONFIG_JIT, &jit);
+
+for (; ntexts < UCD_KIND_COUNT; ntexts++)
+  {
+  texts[ntexts] = (char *)malloc((size_t)kilobytes * 1024);
+  if (texts[ntexts] == NULL)
+    {
+    printf("** Failed to get %ld kilobytes\n", kilobytes);
+    rc = 1;
+    goto EXIT;
+    }
+  lengths[ntexts] = ucd_make_text(ucd_kinds + ntexts, texts[ntexts],
+    (size_t)kilobytes * 1024);
+  }
+
+printf("Texts: %ld kilobytes\n", kilobytes);
+
+for (pass = 0; pass < (jit? 2 : 1); pass++)
+  {
+  printf("\n%-26s", (pass == 0)? "interpreter MB/s" : "JIT MB/s");
+  for (k = 0; k < UCD_KIND_COUNT; k++) printf(" %8s", ucd_kinds[k].name);
+  printf("\n");
+
+  for (i = 0; i < UCD_PATTERN_COUNT; i++)
+    {
+    const char *error;
+    int erroroffset;
+    pcre *re;
+    pcre_extra *extra;
+
+    re = pcre_compile(ucd_patterns[i], PCRE_UTF8, &error, &erroroffset, NULL);
+    if (re == NULL)
+      {
+      printf("** %s: %s at offset %d\n", ucd_patterns[i], error, erroroffset);
+      rc = 1;
+      goto EXIT;
+      }
+    extra = pcre_study(re, (pass == 0)? 0 : PCRE_STUDY_JIT_COMPILE, &error);
+
+    printf("%-26s", ucd_patterns[i]);
+    for (k = 0; k < UCD_KIND_COUNT; k++)
+      printf(" %8.1f", ucd_search_all(re, extra, texts[k], lengths[k]));
+    printf("\n");
+
+    if (extra != NULL) pcre_free_study(extra);
+    pcre_free(re);
+    }
+  }
+
+EXIT:
+for (k = 0; k < ntexts; k++) free(texts[k]);
+return rc;
+}
+
+
+/*************************************************
+*                     Arenas                     *
+*************************************************/
+
+/* Compare loading the YANG corpus, as a schema validator does at startup,
+with pcre_compile() and pcre_study() against pcre_compile_arena() and
+pcre_study_arena(). Each round compiles and studies every pattern of the
+corpus, then frees them all. The memory functions are wrapped to count the
+blocks that are still allocated when the schema has been loaded, which is what
+fragments the heap. The lazy DFAs and specialized matchers that studying
+attaches are on the heap either way, because they are changed while matching.
+The count is the number of rounds. */
+
+#define ARENA_ROUNDS 2000
+#define ARENA_SIZE (256 * 1024)
+
+static long arena_live_blocks;
+static void *(*arena_saved_malloc)(size_t);
+static void (*arena_saved_free)(void *);
+
+static void *
+arena_counting_malloc(size_t size)
+{
+arena_live_blocks++;
+return arena_saved_malloc(size);
+}
+
+static void
+arena_counting_free(void *block)
+{
+if (block != NULL) arena_live_blocks--;
+arena_saved_free(block);
+}
+
+/* Load the schema once with pcre_malloc() and once into an arena. Returns the
+number of bytes used in the arena, or 0 on error. The number of live blocks
+after loading is returned via the pointers. */
+
+static size_t
+arena_count_blocks(int options, long *heap_blocks, long *arena_blocks)
+{
+pcre *re[BENCH_YANG_PATTERN_COUNT];
+pcre_extra *extra[BENCH_YANG_PATTERN_COUNT];
+pcre_arena *arena;
+const char *error;
+int erroroffset, i, n;
+size_t used;
+
+arena_live_blocks = 0;
+for (n = 0; n < BENCH_YANG_PATTERN_COUNT; n++)
+  {
+  re[n] = pcre_compile(bench_yang_patterns[n].pattern, options, &error,
+    &erroroffset, NULL);
+  if (re[n] == NULL) break;
+  extra[n] = pcre_study(re[n], PCRE_STUDY_EXTRA_NEEDED, &error);
+  }
+*heap_blocks = arena_live_blocks;
+for (i = 0; i < n; i++)
+  {
+  pcre_free_study(extra[i]);
+  pcre_free(re[i]);
+  }
+if (n < BENCH_YANG_PATTERN_COUNT) return 0;
+
+arena_live_blocks = 0;
+arena = pcre_arena_create(NULL, ARENA_SIZE);
+if (arena == NULL) return 0;
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  {
+  re[i] = pcre_compile_arena(arena, bench_yang_patterns[i].pattern, options,
+    NULL, &error, &erroroffset, NULL);
+  if (re[i] == NULL)
+    {
+    pcre_arena_free(arena);
+    return 0;
+    }
+  (void)pcre_study_arena(arena, re[i], PCRE_STUDY_EXTRA_NEEDED, &error);
+  }
+*arena_blocks = arena_live_blocks;
+used = pcre_arena_used(arena);
+pcre_arena_free(arena);
+return used;
+}
+
+/* Time loading and freeing the schema, with the heap or with an arena.
+Returns the microseconds per round. */
+
+static double
+arena_time_load(int options, long rounds, int use_arena)
+{
+pcre *re[BENCH_YANG_PATTERN_COUNT];
+pcre_extra *extra[BENCH_YANG_PATTERN_COUNT];
+const char *error;
+int erroroffset, i;
+double start = bench_now_ns();
+long r;
+
+for (r = 0; r < rounds; r++)
+  {
+  if (use_arena)
+    {
+    pcre_arena *arena = pcre_arena_create(NULL, ARENA_SIZE);
+    if (arena == NULL) return -1;
+    for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+      {
+      re[i] = pcre_compile_arena(arena, bench_yang_patterns[i].pattern,
+        options, NULL, &error, &erroroffset, NULL);
+      extra[i] = pcre_study_arena(arena, re[i], PCRE_STUDY_EXTRA_NEEDED,
+        &error);
+      bench_sink += (extra[i] != NULL);
+      }
+    pcre_arena_free(arena);
+    }
+  else
+    {
+    for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+      {
+      re[i] = pcre_compile(bench_yang_patterns[i].pattern, options, &error,
+        &erroroffset, NULL);
+      extra[i] = pcre_study(re[i], PCRE_STUDY_EXTRA_NEEDED, &error);
+      bench_sink += (extra[i] != NULL);
+      }
+    for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+      {
+      pcre_free_study(extra[i]);
+      pcre_free(re[i]);
+      }
+    }
+  }
+return (bench_now_ns() - start) / ((double)rounds * 1000.0);
+}
+
+static int
+bench_arena(const bench_args *args)
+{
+long rounds = (args->count > 0)? args->count : ARENA_ROUNDS;
+int options = bench_yang_options();
+long heap_blocks, arena_blocks;
+double heap_us, arena_us;
+size_t used;
+
+/* Count blocks only while this case runs. */
+
+arena_saved_malloc = pcre_malloc;
+arena_saved_free = pcre_free;
+pcre_malloc = arena_counting_malloc;
+pcre_free = arena_counting_free;
+used = arena_count_blocks(options, &heap_blocks, &arena_blocks);
+pcre_malloc = arena_saved_malloc;
+pcre_free = arena_saved_free;
+
+if (used == 0)
+  {
+  printf("** Failed to load the corpus\n");
+  return 1;
+  }
+
+printf("%d patterns, %ld rounds\n", BENCH_YANG_PATTERN_COUNT, rounds);
+
+heap_us = arena_time_load(options, rounds, 0);
+arena_us = arena_time_load(options, rounds, 1);
+if (arena_us < 0)
+  {
+  printf("** Failed to create an arena\n");
+  return 1;
+  }
+
+printf("\n%-10s %12s %14s\n", "", "live blocks", "load+free us");
+printf("%-10s %12ld %14.1f\n", "heap", heap_blocks, heap_us);
+printf("%-10s %12ld %14.1f\n", "arena", arena_blocks, arena_us);
+printf("\narena bytes used: %lu\n", (unsigned long)used);
+return 0;
+}
+
+
+/*************************************************
+*             All matching engines              *
+*************************************************/
+
+/* For every pattern of the YANG corpus, measure the time to compile the
+pattern, to study it with and without JIT compilation, and to match its sample
+values with the interpreter alone, with pcre_exec() after a normal study (which
+may use a lazy DFA or a specialized matcher), with pcre_dfa_exec(), and with
+JIT code. The calls of pcre_malloc() and pcre_stack_malloc() that each of these
+makes are counted too. The results can be saved as a baseline (-w) and later
+runs compared with it (-b, -r), so that a change in the library can be checked
+for regressions on the same machine. The count is the minimum duration of one
+measurement in milliseconds. */
+
+#define ENGINES_MIN_MS 20         /* Minimum duration of one measurement */
+#define ENGINES_WORKSPACE 1000    /* Size of the pcre_dfa_exec() workspace */
+#define ENGINES_MAX_VALUES 8      /* Valid plus invalid values of a pattern */
+
+/* The measurements made for each pattern, in the order of the table columns.
+Match times are per value; the others are per call, including the call that
+frees the result. A negative time means that the measurement was not made. */
+
+enum { M_COMPILE, M_STUDY, M_JITSTUDY, M_INTERP, M_EXEC, M_DFA, M_JIT,
+  M_COUNT };
+
+static const char *engines_measures[M_COUNT] = {
+  "compile", "study", "jitstudy", "interp", "exec", "dfa", "jit" };
+
+typedef struct engines_result {
+  double ns[M_COUNT];             /* Time per call or per value */
+  double allocs[M_COUNT];         /* Allocations per call or per value */
+} engines_result;
+
+/* The "pattern" statements of the other modules installed with netopeer2, in
+the form libyang gives them. XML Schema has no anchors, so the "$" characters
+of iana-crypt-hash are literal and libyang escapes them. */
+
+static const bench_pattern engines_module_patterns[] = {
+  { "iana-crypt-hash", "crypt-hash",
+    "^(?:\\$0\\$.*|\\$1\\$[a-zA-Z0-9./]{1,8}\\$[a-zA-Z0-9./]{22}"
+    "|\\$5\\$(rounds=\\d+\\$)?[a-zA-Z0-9./]{1,16}\\$[a-zA-Z0-9./]{43}"
+    "|\\$6\\$(rounds=\\d+\\$)?[a-zA-Z0-9./]{1,16}\\$[a-zA-Z0-9./]{86})$",
+    { "$1$saltsalt$qvfN3ZPkN8Ld7C0uVWJ8X/",
+      "$5$rounds=5000$usesomesillystri$"
+      "KqJWpanXZHKq2BOB43TSaYhEWsQ1Lr5QNyPCDH/Tp.6",
+      "$6$saltstring$svn8UoSVapNtMuq1ukKS4tPQd8iKwSMHWjl/O817G3uBnIFNjnQJue"
+      "sI68u4OTLiBFdcbYEdFCoEOfaS35inz1", NULL },
+    { "$1$saltsalt$qvfN3ZPk",
+      "$5$rounds=$ab$xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx",
+      "$2a$10$abc", NULL } },
+
+  { "ietf-netconf-acm", "matchall-string-type",
+    "^\\*$",
+    { "*", NULL },
+    { "**", "", "admin", NULL } },
+
+  { "ietf-netconf-acm", "group-name-type",
+    "^[^\\*].*$",
+    { "admin", "limited-users", "x", NULL },
+    { "*", "*admin", "", NULL } },
+
+  { "ietf-netconf-server", "anchor-time",
+    "^\\d{4}-\\d{2}-\\d{2}T\\d{2}:\\d{2}(Z|[\\+\\-]\\d{2}:\\d{2})$",
+    { "2019-07-02T08:30Z", "2020-01-31T23:59+05:30", NULL },
+    { "2019-07-02T08:30:00Z", "2019-07-02T08:30", "2019-7-02T08:30Z",
+      NULL } },
+
+  { "ietf-x509-cert-to-name", "tls-fingerprint",
+    "^([0-9a-fA-F]){2}(:([0-9a-fA-F]){2}){0,254}$",
+    { "01:e0:d4:f8:5b:9a:21:6d:3f:42:a3:2c:57:8b:12:9e:ac:4d:1e:07:bb",
+      "ff", "0A:1b", NULL },
+    { "01:e0:d4:f8:5b:9a:21:6d:3f:42:a3:2c:57:8b:12:9e:ac:4d:1e:07:b",
+      "0a1b", "", NULL } }
+};
+
+#define ENGINES_MODULE_COUNT \
+  (int)(sizeof(engines_module_patterns) / sizeof(bench_pattern))
+
+#define ENGINES_CORPUS_COUNT (BENCH_YANG_PATTERN_COUNT + ENGINES_MODULE_COUNT)
+
+/* One unit of work to be timed: a pattern, its sample values, and the
+compiled pattern and study data to use. */
+
+typedef struct engines_job {
+  const bench_pattern *p;
+  int options;                    /* Compile options */
+  int study_options;              /* Study options */
+  pcre *re;
+  pcre_extra *extra;
+  const char *values[ENGINES_MAX_VALUES];
+  int lengths[ENGINES_MAX_VALUES];
+  int nvalues;
+  int nvalid;
+} engines_job;
+
+typedef int (*engines_function)(engines_job *);
+
+static double engines_min_ns;
+static unsigned long engines_alloc_count;
+static void *(*engines_saved_malloc)(size_t);
+static void (*engines_saved_free)(void *);
+
+/* These replace pcre_malloc() and pcre_stack_malloc() while the case runs,
+so that every allocation the library makes is counted. */
+
+static void *
+engines_counting_malloc(size_t size)
+{
+engines_alloc_count++;
+return engines_saved_malloc(size);
+}
+
+static void
+engines_counting_free(void *block)
+{
+engines_saved_free(block);
+}
+
+/* Each job function does one unit of work and returns a number that is added
+to bench_sink, so that the work cannot be optimized away. The match functions
+try every sample value once and return the number that matched. */
+
+static int
+engines_compile(engines_job *job)
+{
+const char *error;
+int erroroffset;
+pcre *re = pcre_compile(job->p->pattern, job->options, &error, &erroroffset,
+  NULL);
+if (re == NULL) return 0;
+pcre_free(re);
+return 1;
+}
+
+static int
+engines_study(engines_job *job)
+{
+const char *error;
+pcre_extra *extra = pcre_study(job->re, job->study_options, &error);
+if (extra == NULL) return 0;
+pcre_free_study(extra);
+return 1;
+}
+
+static int
+engines_exec(engines_job *job)
+{
+int ovector[30];
+int matches = 0;
+int i;
+for (i = 0; i < job->nvalues; i++)
+  if (pcre_exec(job->re, job->extra, job->values[i], job->lengths[i], 0, 0,
+      ovector, 30) >= 0)
+    matches++;
+return matches;
+}
+
+static int
+engines_dfa(engines_job *job)
+{
+int ovector[30];
+int workspace[ENGINES_WORKSPACE];
+int matches = 0;
+int i;
+for (i = 0; i < job->nvalues; i++)
+  if (pcre_dfa_exec(job->re, job->extra, job->values[i], job->lengths[i], 0,
+      0, ovector, 30, workspace, ENGINES_WORKSPACE) >= 0)
+    matches++;
+return matches;
+}
+
+/* Run a job "iterations" times, leaving the number of allocations it made in
+engines_alloc_count, and return the elapsed time. */
+
+static double
+engines_time_batch(engines_function fn, engines_job *job, long iterations)
+{
+long i;
+double start;
+engines_alloc_count = 0;
+start = bench_now_ns();
+for (i = 0; i < iterations; i++) bench_sink += fn(job);
+return bench_now_ns() - start;
+}
+
+/* The job is repeated, with the repeat count growing, until one batch takes
+at least engines_min_ns, so that short jobs are not dominated by the clock.
+The batch is then run twice more and the fastest of the three is kept, which
+filters out most interference from the rest of the system.
+
+Arguments:
+  fn          the job function
+  job         the job data
+  per_call    the number of units one call of fn counts as
+  result      where to put the results
+  m           which measurement this is
+
+Returns:      nothing
+*/
+
+static void
+engines_measure(engines_function fn, engines_job *job, int per_call,
+  engines_result *result, int m)
+{
+long iterations = 1;
+double elapsed, best;
+unsigned long allocs;
+int run;
+
+for (;;)
+  {
+  elapsed = engines_time_batch(fn, job, iterations);
+  if (elapsed >= engines_min_ns || iterations >= 0x40000000L) break;
+  iterations *= (elapsed < engines_min_ns / 10)? 10 : 2;
+  }
+
+best = elapsed;
+allocs = engines_alloc_count;
+for (run = 0; run < 2; run++)
+  {
+  elapsed = engines_time_batch(fn, job, iterations);
+  if (elapsed < best) best = elapsed;
+  }
+
+result->ns[m] = best / ((double)iterations * per_call);
+result->allocs[m] = (double)allocs / ((double)iterations * per_call);
+}
+
+/* Before an engine is timed, check that it matches exactly the valid values.
+A difference is reported, but the engine is timed all the same. */
+
+static int
+engines_check(engines_function fn, engines_job *job, const char *engine)
+{
+int matches = fn(job);
+if (matches == job->nvalid) return 1;
+printf("** %s %s: %s matched %d values, expected %d\n", job->p->module,
+  job->p->type, engine, matches, job->nvalid);
+return 0;
+}
+
+/* Measure one pattern with every engine.
+
+Arguments:
+  p           the pattern and its sample values
+  options     compile options
+  jit         TRUE if JIT compilation is usable
+  result      where to put the results
+
+Returns:      1 if all went well, 0 if the pattern did not compile or an
+              engine gave a wrong answer
+*/
+
+static int
+engines_one(const bench_pattern *p, int options, int jit,
+  engines_result *result)
+{
+engines_job job;
+const char *error;
+int erroroffset;
+int ok = 1;
+int i;
+
+memset(&job, 0, sizeof(job));
+job.p = p;
+job.options = options;
+for (i = 0; i < 4 && p->valid[i] != NULL; i++)
+  job.values[job.nvalues++] = p->valid[i];
+job.nvalid = job.nvalues;
+for (i = 0; i < 4 && p->invalid[i] != NULL; i++)
+  job.values[job.nvalues++] = p->invalid[i];
+for (i = 0; i < job.nvalues; i++) job.lengths[i] = (int)strlen(job.values[i]);
+
+for (i = 0; i < M_COUNT; i++) result->ns[i] = result->allocs[i] = -1;
+
+job.re = pcre_compile(p->pattern, options, &error, &erroroffset, NULL);
+if (job.re == NULL)
+  {
+  printf("** %s %s: compile failed at offset %d: %s\n", p->module, p->type,
+    erroroffset, error);
+  return 0;
+  }
+engines_measure(engines_compile, &job, 1, result, M_COMPILE);
+
+job.study_options = 0;
+engines_measure(engines_study, &job, 1, result, M_STUDY);
+if (jit)
+  {
+  job.study_options = PCRE_STUDY_JIT_COMPILE;
+  engines_measure(engines_study, &job, 1, result, M_JITSTUDY);
+  }
+
+/* The interpreter alone: study for the start-up optimizations, but without
+a lazy DFA or a specialized matcher. */
+
+job.extra = pcre_study(job.re, PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_NO_SPECIAL,
+  &error);
+ok &= engines_check(engines_exec, &job, "the interpreter");
+engines_measure(engines_exec, &job, job.nvalues, result, M_INTERP);
+pcre_free_study(job.extra);
+
+/* pcre_exec() after a study that allows every optimization, and
+pcre_dfa_exec(). */
+
+job.extra = pcre_study(job.re, PCRE_STUDY_EXTRA_NEEDED|PCRE_STUDY_LAZY_DFA,
+  &error);
+ok &= engines_check(engines_exec, &job, "pcre_exec()");
+engines_measure(engines_exec, &job, job.nvalues, result, M_EXEC);
+ok &= engines_check(engines_dfa, &job, "pcre_dfa_exec()");
+engines_measure(engines_dfa, &job, job.nvalues, result, M_DFA);
+pcre_free_study(job.extra);
+
+if (jit)
+  {
+  int jitted = 0;
+  job.extra = pcre_study(job.re, PCRE_STUDY_EXTRA_NEEDED|
+    PCRE_STUDY_JIT_COMPILE, &error);
+  (void)pcre_fullinfo(job.re, job.extra, PCRE_INFO_JIT, &jitted);
+  if (jitted)
+    {
+    pcre_assign_jit_stack(job.extra, pcre_jit_thread_stack, NULL);
+    ok &= engines_check(engines_exec, &job, "JIT code");
+    engines_measure(engines_exec, &job, job.nvalues, result, M_JIT);
+    }
+  pcre_free_study(job.extra);
+  }
+
+pcre_free(job.re);
+return ok;
+}
+
+/* A baseline file has a comment line giving the library version, then one
+line per pattern: its index in the corpus, module and type, then the time and
+the allocation count of each measurement. A pattern is compared only when all
+three agree, so that a changed corpus does not give misleading results. */
+
+static int
+engines_write_baseline(const char *filename, const bench_pattern **corpus,
+  const engines_result *results, const int *valid)
+{
+FILE *f = fopen(filename, "w");
+int i, m;
+
+if (f == NULL)
+  {
+  printf("** Failed to open %s for writing\n", filename);
+  return 0;
+  }
+
+fprintf(f, "# pcrebench engines baseline, PCRE %s\n", pcre_version());
+for (i = 0; i < ENGINES_CORPUS_COUNT; i++)
+  {
+  if (!valid[i]) continue;
+  fprintf(f, "%d %s %s", i, corpus[i]->module, corpus[i]->type);
+  for (m = 0; m < M_COUNT; m++) fprintf(f, " %.2f", results[i].ns[m]);
+  for (m = 0; m < M_COUNT; m++) fprintf(f, " %.4f", results[i].allocs[m]);
+  fprintf(f, "\n");
+  }
+
+fclose(f);
+return 1;
+}
+
+static int
+engines_read_baseline(const char *filename, const bench_pattern **corpus,
+  engines_result *baseline, int *present)
+{
+FILE *f = fopen(filename, "r");
+char line[512];
+
+if (f == NULL)
+  {
+  printf("** Failed to open %s\n", filename);
+  return 0;
+  }
+
+while (fgets(line, sizeof(line), f) != NULL)
+  {
+  char module[64], type[64];
+  engines_result r;
+  int index, m, n;
+  char *s;
+
+  if (line[0] == '#')
+    {
+    printf("%s", line + 2);
+    continue;
+    }
+  if (sscanf(line, "%d %63s %63s%n", &index, module, type, &n) != 3) continue;
+  if (index < 0 || index >= ENGINES_CORPUS_COUNT ||
+      strcmp(module, corpus[index]->module) != 0 ||
+      strcmp(type, corpus[index]->type) != 0)
+    continue;
+
+  s = line + n;
+  for (m = 0; m < 2 * M_COUNT; m++)
+    {
+    double *value = (m < M_COUNT)? r.ns + m : r.allocs + m - M_COUNT;
+    char *end;
+    *value = strtod(s, &end);
+    if (end == s) break;
+    s = end;
+    }
+  if (m < 2 * M_COUNT) continue;
+
+  baseline[index] = r;
+  present[index] = 1;
+  }
+
+fclose(f);
+return 1;
+}
+
+static void
+engines_print_header(const char *title)
+{
+int m;
+printf("\n%s\n%-23s", title, "");
+for (m = 0; m < M_COUNT; m++) printf(" %8s", engines_measures[m]);
+printf("\n");
+}
+
+static void
+engines_print_value(double value, int decimals)
+{
+if (value < 0) printf(" %8s", "-"); else printf(" %8.*f", decimals, value);
+}
+
+/* Compare the results with a baseline. Each time is shown as a percentage
+change, and the change over the whole corpus is the mean of the ratios.
+Returns the number of times that are worse than the baseline by more than the
+threshold, or -1 if the baseline cannot be read. */
+
+static int
+engines_compare(const char *filename, double threshold,
+  const bench_pattern **corpus, const engines_result *results,
+  const int *valid)
+{
+engines_result baseline[ENGINES_CORPUS_COUNT];
+int present[ENGINES_CORPUS_COUNT];
+double ratio_sum[M_COUNT];
+int ratio_count[M_COUNT];
+int regressions = 0;
+int i, m;
+
+memset(present, 0, sizeof(present));
+printf("\n");
+if (!engines_read_baseline(filename, corpus, baseline, present)) return -1;
+
+for (m = 0; m < M_COUNT; m++)
+  {
+  ratio_sum[m] = 0;
+  ratio_count[m] = 0;
+  }
+
+engines_print_header("Change in time against the baseline, percent "
+  "(* worse than -r)");
+for (i = 0; i < ENGINES_CORPUS_COUNT; i++)
+  {
+  if (!valid[i] || !present[i]) continue;
+  printf("%2d %-20.20s", i, corpus[i]->type);
+  for (m = 0; m < M_COUNT; m++)
+    {
+    double now = results[i].ns[m], then = baseline[i].ns[m];
+    double change;
+    if (now <= 0 || then <= 0)
+      {
+      engines_print_value(-1, 0);
+      continue;
+      }
+    change = (now / then - 1) * 100;
+    ratio_sum[m] += now / then;
+    ratio_count[m]++;
+    if (threshold >= 0 && change > threshold)
+      {
+      printf(" %7.1f*", change);
+      regressions++;
+      }
+    else printf(" %+8.1f", change);
+    }
+  printf("\n");
+
+  for (m = 0; m < M_COUNT; m++)
+    if (results[i].allocs[m] >= 0 && baseline[i].allocs[m] >= 0 &&
+        (results[i].allocs[m] > baseline[i].allocs[m] + 0.005 ||
+         results[i].allocs[m] < baseline[i].allocs[m] - 0.005))
+      printf("   %s allocations: %.2f, baseline %.2f\n", engines_measures[m],
+        results[i].allocs[m], baseline[i].allocs[m]);
+  }
+
+printf("%-23s", "mean");
+for (m = 0; m < M_COUNT; m++)
+  {
+  if (ratio_count[m] == 0) engines_print_value(-1, 0);
+  else printf(" %+8.1f", (ratio_sum[m] / ratio_count[m] - 1) * 100);
+  }
+printf("\n");
+return regressions;
+}
+
+static int
+bench_engines(const bench_args *args)
+{
+long min_ms = (args->count > 0)? args->count : ENGINES_MIN_MS;
+const bench_pattern *corpus[ENGINES_CORPUS_COUNT];
+engines_result results[ENGINES_CORPUS_COUNT];
+int valid[ENGINES_CORPUS_COUNT];
+void *(*saved_stack_malloc)(size_t) = pcre_stack_malloc;
+void (*saved_stack_free)(void *) = pcre_stack_free;
+int options = bench_yang_options();
+int jit = 0, jit_usable = 0;
+int rc = 0;
+int i, m;
+
+for (i = 0; i < BENCH_YANG_PATTERN_COUNT; i++)
+  corpus[i] = bench_yang_patterns + i;
+for (i = 0; i < ENGINES_MODULE_COUNT; i++)
+  corpus[BENCH_YANG_PATTERN_COUNT + i] = engines_module_patterns + i;
+
+(void)pcre_config(PCRE_CONFIG_JIT, &jit);
+(void)pcre_config(PCRE_CONFIG_JITUSABLE, &jit_usable);
+
+engines_min_ns = min_ms * 1e6;
+printf("%d patterns, at least %ld ms per measurement\n", ENGINES_CORPUS_COUNT,
+  min_ms);
+
+/* Count allocations only while this case runs. */
+
+engines_saved_malloc = pcre_malloc;
+engines_saved_free = pcre_free;
+pcre_malloc = pcre_stack_malloc = engines_counting_malloc;
+pcre_free = pcre_stack_free = engines_counting_free;
+
+for (i = 0; i < ENGINES_CORPUS_COUNT; i++)
+  {
+  valid[i] = engines_one(corpus[i], options, jit && jit_usable, results + i);
+  if (!valid[i]) rc = 1;
+  }
+
+pcre_malloc = engines_saved_malloc;
+pcre_free = engines_saved_free;
+pcre_stack_malloc = saved_stack_malloc;
+pcre_stack_free = saved_stack_free;
+
+engines_print_header("Nanoseconds per compile or study, and per value "
+  "matched");
+for (i = 0; i < ENGINES_CORPUS_COUNT; i++)
+  {
+  if (!valid[i]) continue;
+  printf("%2d %-20.20s", i, corpus[i]->type);
+  for (m = 0; m < M_COUNT; m++)
+    engines_print_value(results[i].ns[m], (m < M_INTERP)? 0 : 1);
+  printf("\n");
+  }
+
+engines_print_header("Allocations per compile or study, and per value "
+  "matched");
+for (i = 0; i < ENGINES_CORPUS_COUNT; i++)
+  {
+  if (!valid[i]) continue;
+  printf("%2d %-20.20s", i, corpus[i]->type);
+  for (m = 0; m < M_COUNT; m++) engines_print_value(results[i].allocs[m], 2);
+  printf("\n");
+  }
+
+if (args->baseline_file != NULL)
+  {
+  int regressions = engines_compare(args->baseline_file, args->threshold,
+    corpus, results, valid);
+  if (regressions < 0) return 1;
+  if (regressions > 0)
+    {
+    printf("\n%d times are worse than the baseline by more than %.1f%%\n",
+      regressions, args->threshold);
+    rc |= 2;
+    }
+  }
+
+if (args->write_file != NULL)
+  {
+  if (!engines_write_baseline(args->write_file, corpus, results, valid))
+    rc |= 1;
+  else printf("\nResults written to %s\n", args->write_file);
+  }
+
+return rc;
+}
+
+
+/*************************************************
+*                Batch matching                  *
+*************************************************/
+
+/* Validate leaf values, a mixture of IPv4 and IPv6 addresses with some invalid
+ones, against the ietf-inet-types ipv4-address and ipv6-address patterns, as
+for a long leaf-list of type inet:ip-address. Each pattern is tried first with
+one call of pcre_exec() per value, then with one call of pcre_exec_batch() on
+the calling thread, and then with pcre_exec_batch() on several threads (-j),
+with and without JIT; each is timed as the best of five rounds. The count is
+the number of values. */
+
+#define BATCH_VALUES 100000
+#define BATCH_THREADS 4
+#define BATCH_VALUE_SIZE 48
+#define BATCH_ROUNDS 5
+
+/* Make the values. Nine in twenty are IPv4 addresses, nine in twenty are IPv6
+addresses, and the rest are invalid. A simple generator is used so that every
+run gets the same values. */
+
+static unsigned long batch_seed;
+
+static unsigned int
+batch_random(void)
+{
+batch_seed = batch_seed * 1103515245UL + 12345UL;
+return (unsigned int)((batch_seed >> 16) & 0x7fff);
+}
+
+static void
+batch_make_value(char *buffer, int i)
+{
+switch (i % 20)
+  {
+  case 0:
+  sprintf(buffer, "%u.%u.%u", batch_random() % 256, batch_random() % 256,
+    batch_random() % 256);
+  break;
+
+  case 1:
+  sprintf(buffer, "2001:db8::%x::%x", batch_random(), batch_random());
+  break;
+
+  default:
+  if (i % 2 == 0)
+    sprintf(buffer, "%u.%u.%u.%u", batch_random() % 256,
+      batch_random() % 256, batch_random() % 256, batch_random() % 256);
+  else if (i % 4 == 1)
+    sprintf(buffer, "2001:db8:%x:%x::%x", batch_random(), batch_random(),
+      batch_random());
+  else
+    sprintf(buffer, "fe80::%x:%x%%eth%u", batch_random(), batch_random(),
+      batch_random() % 4);
+  break;
+  }
+}
+
+/* Validate every value with pcre_exec(), or with pcre_exec_batch() on
+"threads" threads if threads is not zero. This is done BATCH_ROUNDS times and
+the fastest time is returned in elapsed. Returns the number that matched. */
+
+static int
+batch_validate(const pcre *re, const pcre_extra *extra, const char **values,
+  const int *lengths, int count, int threads, int *results, double *elapsed)
+{
+int matched = 0;
+int round;
+
+*elapsed = 0;
+for (round = 0; round < BATCH_ROUNDS; round++)
+  {
+  double start = bench_now_ns();
+  double took;
+
+  if (threads == 0)
+    {
+    int i;
+    matched = 0;
+    for (i = 0; i < count; i++)
+      {
+      results[i] = pcre_exec(re, extra, values[i], lengths[i], 0, 0, NULL,
+        0);
+      if (results[i] >= 0) matched++;
+      }
+    }
+  else matched = pcre_exec_batch(re, extra, values, lengths, count, 0,
+    threads, results);
+
+  took = bench_now_ns() - start;
+  if (round == 0 || took < *elapsed) *elapsed = took;
+  }
+
+return matched;
+}
+
+static int
+bench_batch(const bench_args *args)
+{
+int count = (args->count > 0)? (int)args->count : BATCH_VALUES;
+int threads = (args->threads > 1)? args->threads : BATCH_THREADS;
+int options = bench_yang_options();
+char *buffer;
+const char **values;
+int *lengths, *expected, *results;
+int jit = 0;
+int rc = 0;
+int p, i;
+
+(void)pcre_config(PCRE_CONFIG_JIT, &jit);
+
+buffer = (char *)malloc((size_t)count * BATCH_VALUE_SIZE);
+values = (const char **)malloc(count * sizeof(char *));
+lengths = (int *)malloc(count * sizeof(int));
+expected = (int *)malloc(count * sizeof(int));
+results = (int *)malloc(count * sizeof(int));
+if (buffer == NULL || values == NULL || lengths == NULL || expected == NULL ||
+    results == NULL)
+  {
+  printf("** Failed to get memory for %d values\n", count);
+  rc = 1;
+  goto EXIT;
+  }
+
+batch_seed = 12345;
+for (i = 0; i < count; i++)
+  {
+  char *value = buffer + (size_t)i * BATCH_VALUE_SIZE;
+  batch_make_value(value, i);
+  values[i] = value;
+  lengths[i] = (int)strlen(value);
+  }
+
+#ifndef _WIN32
+printf("%d values, %d threads, %ld processors online\n", count, threads,
+  sysconf(_SC_NPROCESSORS_ONLN));
+#else
+printf("%d values, no threads on Windows\n", count);
+#endif
+
+printf("\n%-14s %-4s %8s %12s %12s %12s\n", "type", "jit", "matched",
+  "exec ns", "batch ns", "threads ns");
+
+for (p = 0; p < 2; p++)
+  {
+  const bench_pattern *pattern = bench_yang_patterns + p;
+  const char *error;
+  int erroroffset, pass;
+  pcre *re = pcre_compile(pattern->pattern, options, &error, &erroroffset,
+    NULL);
+
+  if (re == NULL)
+    {
+    printf("** %s: %s at offset %d\n", pattern->type, error, erroroffset);
+    rc = 1;
+    goto EXIT;
+    }
+
+  for (pass = 0; pass < (jit? 2 : 1); pass++)
+    {
+    pcre_extra *extra = pcre_study(re, PCRE_STUDY_EXTRA_NEEDED |
+      ((pass == 0)? 0 : PCRE_STUDY_JIT_COMPILE), &error);
+    double exec_ns, batch_ns, threads_ns;
+    int matched, batch_matched, threads_matched;
+
+    if (pass != 0) pcre_assign_jit_stack(extra, pcre_jit_thread_stack, NULL);
+
+    matched = batch_validate(re, extra, values, lengths, count, 0, expected,
+      &exec_ns);
+    batch_matched = batch_validate(re, extra, values, lengths, count, 1,
+      results, &batch_ns);
+    if (batch_matched != matched ||
+        memcmp(results, expected, count * sizeof(int)) != 0)
+      {
+      printf("** %s: pcre_exec_batch() differs from pcre_exec()\n",
+        pattern->type);
+      rc = 1;
+      }
+    else
+      {
+      threads_matched = batch_validate(re, extra, values, lengths, count,
+        threads, results, &threads_ns);
+      if (threads_matched != matched ||
+          memcmp(results, expected, count * sizeof(int)) != 0)
+        {
+        printf("** %s: pcre_exec_batch() on %d threads differs from "
+          "pcre_exec()\n", pattern->type, threads);
+        rc = 1;
+        }
+      }
+    if (rc != 0)
+      {
+      pcre_free_study(extra);
+      pcre_free(re);
+      goto EXIT;
+      }
+
+    printf("%-14s %-4s %8d %12.1f %12.1f %12.1f\n", pattern->type,
+      (pass == 0)? "no" : "yes", matched, exec_ns / count, batch_ns / count,
+      threads_ns / count);
+    bench_sink += matched;
+    pcre_free_study(extra);
+    }
+
+  pcre_free(re);
+  }
+
+EXIT:
+free(buffer);
+free((void *)values);
+free(lengths);
+free(expected);
+free(results);
+return rc;
+}
+
+
+/*************************************************
+*               The list of cases               *
+*************************************************/
+
+static const bench_case cases[] = {
+  { "jit",     bench_jit,     "YANG values, interpreter and JIT" },
+  { "cache",   bench_cache,   "start-up with and without a cache file" },
+  { "scan",    bench_scan,    "unanchored searches through a log buffer" },
+  { "set",     bench_set,     "types with several patterns, one set match" },
+  { "lazydfa", bench_lazydfa, "anchored patterns with and without lazy DFA" },
+  { "utf8",    bench_utf8,    "UTF-8 checks of buffers in several scripts" },
+  { "lru",     bench_lru,     "compiling every use against a shared cache" },
+  { "posix",   bench_posix,   "regexec() against pcre_exec(); REG_STARTEND" },
+  { "special", bench_special, "interpreter, lazy DFA, specialized matchers" },
+  { "ucd",     bench_ucd,     "Unicode property tests on several scripts" },
+  { "arena",   bench_arena,   "loading the YANG corpus into an arena" },
+  { "engines", bench_engines, "every engine on the corpus, with baselines" },
+  { "batch",   bench_batch,   "pcre_exec_batch() against pcre_exec() calls" }
+};
+
+#define CASE_COUNT (int)(sizeof(cases) / sizeof(bench_case))
+
+
+/*************************************************
+*                 Main program                  *
+*************************************************/
+
+static void
+usage(void)
+{
+int i;
+printf("Usage: pcrebench [options] [case]...\n");
+printf("  -b <file>     compare \"engines\" with a baseline file\n");
+printf("  -f <file>     pattern cache file for \"cache\" (default %s)\n",
+  CACHE_FILE);
+printf("  -help         show this usage message\n");
+printf("  -j <count>    threads for \"batch\" (default %d)\n", BATCH_THREADS);
+printf("  -n <count>    amount of work for each case (values, rounds, ...)\n");
+printf("  -r <percent>  with -b, exit with status 2 if a time is worse\n"
+       "                than the baseline by more than this percentage\n");
+printf("  -w <file>     save the results of \"engines\" as a baseline\n");
+printf("  -y <path>     add the patterns of a YANG module, or of the modules\n"
+       "                in a directory, to \"cache\"\n");
+printf("\nCases (all of them are run if none is named):\n");
+for (i = 0; i < CASE_COUNT; i++)
+  printf("  %-13s %s\n", cases[i].name, cases[i].description);
+}
+
+int
+main(int argc, char **argv)
+{
+bench_args args;
+const bench_case *run[CASE_COUNT];
+int nrun = 0;
+int rc = 0;
+int i, j;
+
+memset(&args, 0, sizeof(args));
+args.threshold = -1;
+args.modules = (const char **)malloc(argc * sizeof(char *));
+if (args.modules == NULL)
+  {
+  printf("** Failed to get memory\n");
+  return 1;
+  }
+
+for (i = 1; i < argc; i++)
+  {
+  const char *arg = argv[i];
+  if (strcmp(arg, "-n") == 0 && i + 1 < argc) args.count = atol(argv[++i]);
+  else if (strcmp(arg, "-f") == 0 && i + 1 < argc)
+    args.cache_file = argv[++i];
+  else if (strcmp(arg, "-y") == 0 && i + 1 < argc)
+    args.modules[args.module_count++] = argv[++i];
+  else if (strcmp(arg, "-b") == 0 && i + 1 < argc)
+    args.baseline_file = argv[++i];
+  else if (strcmp(arg, "-w") == 0 && i + 1 < argc)
+    args.write_file = argv[++i];
+  else if (strcmp(arg, "-r") == 0 && i + 1 < argc)
+    args.threshold = atof(argv[++i]);
+  else if (strcmp(arg, "-j") == 0 && i + 1 < argc)
+    args.threads = atoi(argv[++i]);
+  else if (strcmp(arg, "-help") == 0 || strcmp(arg, "--help") == 0)
+    {
+    usage();
+    return 0;
+    }
+  else if (arg[0] == '-')
+    {
+    printf("** Unknown or malformed option %s\n", arg);
+    usage();
+    return 1;
+    }
+  else
+    {
+    for (j = 0; j < CASE_COUNT; j++)
+      if (strcmp(arg, cases[j].name) == 0) break;
+    if (j >= CASE_COUNT)
+      {
+      printf("** Unknown case %s\n", arg);
+      usage();
+      return 1;
+      }
+    if (nrun < CASE_COUNT) run[nrun++] = cases + j;
+    }
+  }
+
+if (nrun == 0)
+  for (j = 0; j < CASE_COUNT; j++) run[nrun++] = cases + j;
+
+printf("PCRE version %s\n", pcre_version());
+
+for (i = 0; i < nrun; i++)
+  {
+  printf("\n---- %s: %s\n\n", run[i]->name, run[i]->description);
+  rc |= run[i]->run(&args);
+  }
+
+free((void *)args.modules);
+return rc;
+}
+
+/* End of pcrebench.c */
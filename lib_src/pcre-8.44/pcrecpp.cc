@@ -561,6 +561,34 @@ bool RE::Extract(const StringPiece& rewrite,
 
 /***** Actual matching and rewriting code *****/
 
+// Run pcre_exec() with the match limits from "re_options"
+static int ExecWithLimits(const pcre* re,
+                          const RE_Options& re_options,
+                          const StringPiece& text,
+                          int startpos,
+                          int options,
+                          int *vec,
+                          int vecsize) {
+  pcre_extra extra = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  if (re_options.match_limit() > 0) {
+    extra.flags |= PCRE_EXTRA_MATCH_LIMIT;
+    extra.match_limit = re_options.match_limit();
+  }
+  if (re_options.match_limit_recursion() > 0) {
+    extra.flags |= PCRE_EXTRA_MATCH_LIMIT_RECURSION;
+    extra.match_limit_recursion = re_options.match_limit_recursion();
+  }
+
+  return pcre_exec(re,              // The regular expression object
+                   &extra,
+                   (text.data() == NULL) ? "" : text.data(),
+                   text.size(),
+                   startpos,
+                   options,
+                   vec,
+                   vecsize);
+}
+
 int RE::TryMatch(const StringPiece& text,
                  int startpos,
                  Anchor anchor,
@@ -573,16 +601,6 @@ int RE::TryMatch(const StringPiece& text,
     return 0;
   }
 
-  pcre_extra extra = { 0, 0, 0, 0, 0, 0, 0, 0 };
-  if (options_.match_limit() > 0) {
-    extra.flags |= PCRE_EXTRA_MATCH_LIMIT;
-    extra.match_limit = options_.match_limit();
-  }
-  if (options_.match_limit_recursion() > 0) {
-    extra.flags |= PCRE_EXTRA_MATCH_LIMIT_RECURSION;
-    extra.match_limit_recursion = options_.match_limit_recursion();
-  }
-
   // int options = 0;
   // Changed by PH as a result of bugzilla #1288
   int options = (options_.all_options() & PCRE_NO_UTF8_CHECK);
@@ -592,14 +610,7 @@ int RE::TryMatch(const StringPiece& text,
   if (!empty_ok)
     options |= PCRE_NOTEMPTY;
 
-  int rc = pcre_exec(re,              // The regular expression object
-                     &extra,
-                     (text.data() == NULL) ? "" : text.data(),
-                     text.size(),
-                     startpos,
-                     options,
-                     vec,
-                     vecsize);
+  int rc = ExecWithLimits(re, options_, text, startpos, options, vec, vecsize);
 
   // Handle errors
   if (rc == PCRE_ERROR_NOMATCH) {
@@ -619,6 +630,18 @@ int RE::TryMatch(const StringPiece& text,
   return rc;
 }
 
+int RE::TryStreamMatch(const StringPiece& text,
+                       bool at_end,
+                       int *vec,
+                       int vecsize) const {
+  if (re_partial_ == NULL) return PCRE_ERROR_NOMATCH;
+  int options = (options_.all_options() & PCRE_NO_UTF8_CHECK) |
+                PCRE_ANCHORED;
+  if (!at_end)
+    options |= PCRE_PARTIAL_HARD;
+  return ExecWithLimits(re_partial_, options_, text, 0, options, vec, vecsize);
+}
+
 bool RE::DoMatchImpl(const StringPiece& text,
                      Anchor anchor,
                      int* consumed,
@@ -678,6 +678,18 @@ class PCRECPP_EXP_DEFN RE {
                int *vec,
                int vecsize) const;
 
+  // Match against the start of "text" for StreamScanner, which sees its
+  // input a chunk at a time.  Unless "at_end" is true, a match that
+  // might change if "text" went on, and an incomplete UTF-8 character
+  // at the end of "text", give PCRE_ERROR_PARTIAL or
+  // PCRE_ERROR_SHORTUTF8 (see PCRE_PARTIAL_HARD).  Returns the result
+  // of pcre_exec().
+  int TryStreamMatch(const StringPiece& text,
+                     bool at_end,
+                     int *vec,
+                     int vecsize) const;
+  friend class StreamScanner;
+
   // Append the "rewrite" string, with backslash subsitutions from "text"
   // and "vec", to string "out".
   bool Rewrite(string *out,
@@ -69,6 +69,16 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <bzlib.h>
 #endif
 
+/* Searching files in parallel (--threads) needs POSIX threads, mmap(), and
+open_memstream(). */
+
+#if !defined _WIN32 && !defined NATIVE_ZOS && defined HAVE_UNISTD_H
+#define PCREGREP_THREADS
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
+
 #include "pcre.h"
 
 #define FALSE 0
@@ -94,7 +104,12 @@ enum { FN_NONE, FN_DEFAULT, FN_MATCH_ONLY, FN_NOMATCH_ONLY, FN_FORCE };
 
 /* File reading styles */
 
-enum { FR_PLAIN, FR_LIBZ, FR_LIBBZ2 };
+enum { FR_PLAIN, FR_LIBZ, FR_LIBBZ2, FR_MMAP };
+
+/* A value for hyphenpending in a grep_state (see below) that means "whatever
+the previous file left". */
+
+#define HYPHEN_INHERIT 2
 
 /* Actions for the -d and -D options */
 
@@ -172,6 +187,7 @@ static int error_count = 0;
 static int filenames = FN_DEFAULT;
 static int pcre_options = 0;
 static int process_options = 0;
+static int threads = 1;
 
 #ifdef SUPPORT_PCREGREP_JIT
 static int study_options = PCRE_STUDY_JIT_COMPILE;
@@ -185,7 +201,6 @@ static unsigned long int match_limit_recursion = 0;
 static BOOL count_only = FALSE;
 static BOOL do_colour = FALSE;
 static BOOL file_offsets = FALSE;
-static BOOL hyphenpending = FALSE;
 static BOOL invert = FALSE;
 static BOOL line_buffered = FALSE;
 static BOOL line_offsets = FALSE;
@@ -198,6 +213,43 @@ static BOOL show_only_matching = FALSE;
 static BOOL silent = FALSE;
 static BOOL utf8 = FALSE;
 
+/* When files are searched in parallel, the error count and the resource error
+flag are shared by the threads, and a mutex keeps each error message in one
+piece. */
+
+#ifdef PCREGREP_THREADS
+static pthread_mutex_t error_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_ERRORS() pthread_mutex_lock(&error_mutex)
+#define UNLOCK_ERRORS() pthread_mutex_unlock(&error_mutex)
+#else
+#define LOCK_ERRORS()
+#define UNLOCK_ERRORS()
+#endif
+
+/* Structure for the state that pcregrep() needs for a file: where the output
+goes, the input buffer, and whether a "--" separator is pending from an earlier
+file. When files are searched in parallel each one has its own, the output
+being collected in memory until it is the file's turn to be printed. Because
+the previous file may not have been searched yet, hyphenpending then starts
+as HYPHEN_INHERIT; if a separator would be printed at the start of the file,
+hyphenwanted is set instead, and the decision is made when printing. */
+
+typedef struct grep_state {
+  FILE *out;
+  char *buffer;
+  int hyphenpending;
+  BOOL hyphenwanted;
+} grep_state;
+
+/* Structure for a file that has been mapped into memory. */
+
+typedef struct mapped_file {
+  char *data;
+  size_t length;
+} mapped_file;
+
+static grep_state main_state = { NULL, NULL, FALSE, FALSE };
+
 /* Structure for list of --only-matching capturing numbers. */
 
 typedef struct omstr {
@@ -324,6 +376,7 @@ used to identify them. */
 #define N_EXCLUDE_FROM (-19)
 #define N_INCLUDE_FROM (-20)
 #define N_OM_SEPARATOR (-21)
+#define N_THREADS      (-22)
 
 static option_item optionlist[] = {
   { OP_NODATA,     N_NULL,   NULL,              "",              "terminate options" },
@@ -387,6 +440,11 @@ static option_item optionlist[] = {
   { OP_OP_NUMBER, 'S',      &S_arg,            "jeffS",         "replace matched (sub)string with X" },
 #endif
   { OP_NODATA,    's',      NULL,              "no-messages",   "suppress error messages" },
+#ifdef PCREGREP_THREADS
+  { OP_NUMBER,    N_THREADS, &threads,         "threads=number", "search files in parallel using this many threads" },
+#else
+  { OP_NUMBER,    N_THREADS, &threads,         "threads=number", "ignored: this pcregrep does not support threads" },
+#endif
   { OP_NODATA,    'u',      NULL,              "utf-8",         "use UTF-8 mode" },
   { OP_NODATA,    'V',      NULL,              "version",       "print version information and exit" },
   { OP_NODATA,    'v',      NULL,              "invert-match",  "select non-matching lines" },
@@ -1378,6 +1436,7 @@ and at the end of the file. The data in the line is written using fwrite() so
 that a binary zero does not terminate it.
 
 Arguments:
+  gs                the state for this file
   lastmatchnumber   the number of the last matching line, plus one
   lastmatchrestart  where we restarted after the last match
   endptr            end of available data
@@ -1387,8 +1446,8 @@ Returns:            nothing
 */
 
 static void
-do_after_lines(unsigned long int lastmatchnumber, char *lastmatchrestart,
-  char *endptr, char *printname)
+do_after_lines(grep_state *gs, unsigned long int lastmatchnumber,
+  char *lastmatchrestart, char *endptr, char *printname)
 {
 if (after_context > 0 && lastmatchnumber > 0)
   {
@@ -1397,13 +1456,13 @@ if (after_context > 0 && lastmatchnumber > 0)
     {
     int ellength;
     char *pp = lastmatchrestart;
-    if (printname != NULL) fprintf(stdout, "%s-", printname);
-    if (number) fprintf(stdout, "%lu-", lastmatchnumber++);
+    if (printname != NULL) fprintf(gs->out, "%s-", printname);
+    if (number) fprintf(gs->out, "%lu-", lastmatchnumber++);
     pp = end_of_line(pp, endptr, &ellength);
-    FWRITE(lastmatchrestart, 1, pp - lastmatchrestart, stdout);
+    FWRITE(lastmatchrestart, 1, pp - lastmatchrestart, gs->out);
     lastmatchrestart = pp;
     }
-  hyphenpending = TRUE;
+  gs->hyphenpending = TRUE;
   }
 }
 
@@ -1450,6 +1509,7 @@ for (i = 1; p != NULL; p = p->next, i++)
     startoffset, options, offsets, OFFSET_SIZE);
   if (*mrc >= 0) return TRUE;
   if (*mrc == PCRE_ERROR_NOMATCH) continue;
+  LOCK_ERRORS();
   fprintf(stderr, "pcregrep: pcre_exec() gave error %d while matching ", *mrc);
   if (patterns->next != NULL) fprintf(stderr, "pattern number %d to ", i);
   fprintf(stderr, "%s", msg);
@@ -1463,6 +1523,7 @@ for (i = 1; p != NULL; p = p->next, i++)
     fprintf(stderr, "pcregrep: Too many errors - abandoned.\n");
     pcregrep_exit(2);
     }
+  UNLOCK_ERRORS();
   return invert;    /* No more matching; don't show the line again */
   }
 
@@ -1482,11 +1543,17 @@ context printing or for multiline scanning. For large files, the pointer will
 be in the middle third most of the time, so the bottom third is available for
 "before" context printing.
 
+When the file has been mapped into memory, the buffer is a window onto the
+mapping that slides along it instead of being shifted and refilled, so that
+the results are the same as when the file is read.
+
 Arguments:
+  gs           the state for this file
   handle       the fopened FILE stream for a normal file
                the gzFile pointer when reading is via libz
                the BZFILE pointer when reading is via libbz2
-  frtype       FR_PLAIN, FR_LIBZ, or FR_LIBBZ2
+               a mapped_file block for a file mapped into memory
+  frtype       FR_PLAIN, FR_LIBZ, FR_LIBBZ2, or FR_MMAP
   filename     the file name or NULL (for errors)
   printname    the file name if it is to be printed for each match
                or NULL if the file name is not to be printed
@@ -1499,7 +1566,8 @@ Returns:       0 if there was at least one match
 */
 
 static int
-pcregrep(void *handle, int frtype, char *filename, char *printname)
+pcregrep(grep_state *gs, void *handle, int frtype, char *filename,
+  char *printname)
 {
 int rc = 1;
 int filepos = 0;
@@ -1508,13 +1576,16 @@ unsigned long int linenumber = 1;
 unsigned long int lastmatchnumber = 0;
 unsigned long int count = 0;
 char *lastmatchrestart = NULL;
-char *ptr = main_buffer;
+char *buffer = gs->buffer;
+char *mapend = NULL;
+char *ptr;
 char *endptr;
 size_t bufflength;
 BOOL binary = FALSE;
 BOOL endhyphenpending = FALSE;
 BOOL input_line_buffered = line_buffered;
 FILE *in = NULL;                    /* Ensure initialized */
+FILE *out = gs->out;
 
 #ifdef SUPPORT_LIBZ
 gzFile ingz = NULL;
@@ -1532,11 +1603,20 @@ fail. */
 
 (void)frtype;
 
+if (frtype == FR_MMAP)
+  {
+  buffer = ((mapped_file *)handle)->data;
+  mapend = buffer + ((mapped_file *)handle)->length;
+  bufflength = ((size_t)(mapend - buffer) > (size_t)bufsize)?
+    (size_t)bufsize : (size_t)(mapend - buffer);
+  }
+else
+
 #ifdef SUPPORT_LIBZ
 if (frtype == FR_LIBZ)
   {
   ingz = (gzFile)handle;
-  bufflength = gzread (ingz, main_buffer, bufsize);
+  bufflength = gzread (ingz, buffer, bufsize);
   }
 else
 #endif
@@ -1545,7 +1625,7 @@ else
 if (frtype == FR_LIBBZ2)
   {
   inbz2 = (BZFILE *)handle;
-  bufflength = BZ2_bzread(inbz2, main_buffer, bufsize);
+  bufflength = BZ2_bzread(inbz2, buffer, bufsize);
   if ((int)bufflength < 0) return 2;   /* Gotcha: bufflength is size_t; */
   }                                    /* without the cast it is unsigned. */
 else
@@ -1555,11 +1635,12 @@ else
   in = (FILE *)handle;
   if (is_file_tty(in)) input_line_buffered = TRUE;
   bufflength = input_line_buffered?
-    read_one_line(main_buffer, bufsize, in) :
-    fread(main_buffer, 1, bufsize, in);
+    read_one_line(buffer, bufsize, in) :
+    fread(buffer, 1, bufsize, in);
   }
 
-endptr = main_buffer + bufflength;
+ptr = buffer;
+endptr = buffer + bufflength;
 
 /* Unless binary-files=text, see if we have a binary file. This uses the same
 rule as GNU grep, namely, a search for a binary zero byte near the start of the
@@ -1568,7 +1649,7 @@ file. */
 if (binary_files != BIN_TEXT)
   {
   binary =
-    memchr(main_buffer, 0, (bufflength > 1024)? 1024 : bufflength) != NULL;
+    memchr(buffer, 0, (bufflength > 1024)? 1024 : bufflength) != NULL;
   if (binary && binary_files == BIN_NOMATCH) return 1;
   }
 
@@ -1607,13 +1688,15 @@ while (ptr < endptr)
   of the buffer without a line terminator. This means the line is too long to
   handle. */
 
-  if (endlinelength == 0 && t == main_buffer + bufsize)
+  if (endlinelength == 0 && t == buffer + bufsize)
     {
+    LOCK_ERRORS();
     fprintf(stderr, "pcregrep: line %lu%s%s is too long for the internal buffer\n"
                     "pcregrep: check the --buffer-size option\n",
                     linenumber,
                     (filename == NULL)? "" : " of file ",
                     (filename == NULL)? "" : filename);
+    UNLOCK_ERRORS();
     return 2;
     }
 
@@ -1706,7 +1789,7 @@ while (ptr < endptr)
 
     else if (binary)
       {
-      fprintf(stdout, "Binary file %s matches\n", filename);
+      fprintf(out, "Binary file %s matches\n", filename);
       return 0;
       }
 
@@ -1715,7 +1798,7 @@ while (ptr < endptr)
 
     else if (filenames == FN_MATCH_ONLY)
       {
-      fprintf(stdout, "%s\n", printname);
+      fprintf(out, "%s\n", printname);
       return 0;
       }
 
@@ -1746,19 +1829,19 @@ while (ptr < endptr)
           prevoffsets[0] = offsets[0];
           prevoffsets[1] = offsets[1];
 
-          if (printname != NULL) fprintf(stdout, "%s:", printname);
-          if (number) fprintf(stdout, "%lu:", linenumber);
+          if (printname != NULL) fprintf(out, "%s:", printname);
+          if (number) fprintf(out, "%lu:", linenumber);
 
           /* Handle --line-offsets */
 
           if (line_offsets)
-            fprintf(stdout, "%d,%d\n", (int)(matchptr + offsets[0] - ptr),
+            fprintf(out, "%d,%d\n", (int)(matchptr + offsets[0] - ptr),
               offsets[1] - offsets[0]);
 
           /* Handle --file-offsets */
 
           else if (file_offsets)
-            fprintf(stdout, "%d,%d\n",
+            fprintf(out, "%d,%d\n",
               (int)(filepos + matchptr + offsets[0] - ptr),
               offsets[1] - offsets[0]);
 
@@ -1777,16 +1860,16 @@ while (ptr < endptr)
                 int plen = offsets[2*n + 1] - offsets[2*n];
                 if (plen > 0)
                   {
-                  if (printed) fprintf(stdout, "%s", om_separator);
-                  if (do_colour) fprintf(stdout, "%c[%sm", 0x1b, colour_string);
-                  FWRITE(matchptr + offsets[n*2], 1, plen, stdout);
-                  if (do_colour) fprintf(stdout, "%c[00m", 0x1b);
+                  if (printed) fprintf(out, "%s", om_separator);
+                  if (do_colour) fprintf(out, "%c[%sm", 0x1b, colour_string);
+                  FWRITE(matchptr + offsets[n*2], 1, plen, out);
+                  if (do_colour) fprintf(out, "%c[00m", 0x1b);
                   printed = TRUE;
                   }
                 }
               }
 
-            if (printed || printname != NULL || number) fprintf(stdout, "\n");
+            if (printed || printname != NULL || number) fprintf(out, "\n");
             }
           }
 
@@ -1801,7 +1884,7 @@ while (ptr < endptr)
         (PCRE2 does this better.) */
 
         match = FALSE;
-        if (line_buffered) fflush(stdout);
+        if (line_buffered) fflush(out);
         rc = 0;                      /* Had some success */
 
         startoffset = offsets[1];    /* Restart after the match */
@@ -1861,21 +1944,28 @@ while (ptr < endptr)
         while (lastmatchrestart < p)
           {
           char *pp = lastmatchrestart;
-          if (printname != NULL) fprintf(stdout, "%s-", printname);
-          if (number) fprintf(stdout, "%lu-", lastmatchnumber++);
+          if (printname != NULL) fprintf(out, "%s-", printname);
+          if (number) fprintf(out, "%lu-", lastmatchnumber++);
           pp = end_of_line(pp, endptr, &ellength);
-          FWRITE(lastmatchrestart, 1, pp - lastmatchrestart, stdout);
+          FWRITE(lastmatchrestart, 1, pp - lastmatchrestart, out);
           lastmatchrestart = pp;
           }
-        if (lastmatchrestart != ptr) hyphenpending = TRUE;
+        if (lastmatchrestart != ptr) gs->hyphenpending = TRUE;
         }
 
-      /* If there were non-contiguous lines printed above, insert hyphens. */
+      /* If there were non-contiguous lines printed above, insert hyphens. If
+      this depends on a file that may not yet have been searched, leave it to
+      whoever prints this file's output. */
 
-      if (hyphenpending)
+      if (gs->hyphenpending == HYPHEN_INHERIT)
         {
-        fprintf(stdout, "--\n");
-        hyphenpending = FALSE;
+        gs->hyphenpending = FALSE;
+        gs->hyphenwanted = TRUE;
+        }
+      else if (gs->hyphenpending)
+        {
+        fprintf(out, "--\n");
+        gs->hyphenpending = FALSE;
         hyphenprinted = TRUE;
         }
 
@@ -1887,24 +1977,24 @@ while (ptr < endptr)
         int linecount = 0;
         char *p = ptr;
 
-        while (p > main_buffer && (lastmatchnumber == 0 || p > lastmatchrestart) &&
+        while (p > buffer && (lastmatchnumber == 0 || p > lastmatchrestart) &&
                linecount < before_context)
           {
           linecount++;
-          p = previous_line(p, main_buffer);
+          p = previous_line(p, buffer);
           }
 
         if (lastmatchnumber > 0 && p > lastmatchrestart && !hyphenprinted)
-          fprintf(stdout, "--\n");
+          fprintf(out, "--\n");
 
         while (p < ptr)
           {
           int ellength;
           char *pp = p;
-          if (printname != NULL) fprintf(stdout, "%s-", printname);
-          if (number) fprintf(stdout, "%lu-", linenumber - linecount--);
+          if (printname != NULL) fprintf(out, "%s-", printname);
+          if (number) fprintf(out, "%lu-", linenumber - linecount--);
           pp = end_of_line(pp, endptr, &ellength);
-          FWRITE(p, 1, pp - p, stdout);
+          FWRITE(p, 1, pp - p, out);
           p = pp;
           }
         }
@@ -1915,8 +2005,8 @@ while (ptr < endptr)
       if (after_context > 0 || before_context > 0)
         endhyphenpending = TRUE;
 
-      if (printname != NULL) fprintf(stdout, "%s:", printname);
-      if (number) fprintf(stdout, "%lu:", linenumber);
+      if (printname != NULL) fprintf(out, "%s:", printname);
+      if (number) fprintf(out, "%lu:", linenumber);
 
       /* In multiline mode, we want to print to the end of the line in which
       the end of the matched string is found, so we adjust linelength and the
@@ -1948,9 +2038,9 @@ while (ptr < endptr)
         {
         int first = S_arg * 2;
         int last  = first + 1;
-        FWRITE(ptr, 1, offsets[first], stdout);
-        fprintf(stdout, "X");
-        FWRITE(ptr + offsets[last], 1, linelength - offsets[last], stdout);
+        FWRITE(ptr, 1, offsets[first], out);
+        fprintf(out, "X");
+        FWRITE(ptr + offsets[last], 1, linelength - offsets[last], out);
         }
       else
 #endif
@@ -1961,10 +2051,10 @@ while (ptr < endptr)
       if (do_colour && !invert)
         {
         int plength;
-        FWRITE(ptr, 1, offsets[0], stdout);
-        fprintf(stdout, "%c[%sm", 0x1b, colour_string);
-        FWRITE(ptr + offsets[0], 1, offsets[1] - offsets[0], stdout);
-        fprintf(stdout, "%c[00m", 0x1b);
+        FWRITE(ptr, 1, offsets[0], out);
+        fprintf(out, "%c[%sm", 0x1b, colour_string);
+        FWRITE(ptr + offsets[0], 1, offsets[1] - offsets[0], out);
+        fprintf(out, "%c[00m", 0x1b);
         for (;;)
           {
           startoffset = offsets[1];
@@ -1972,10 +2062,10 @@ while (ptr < endptr)
               !match_patterns(matchptr, length, options, startoffset, offsets,
                 &mrc))
             break;
-          FWRITE(matchptr + startoffset, 1, offsets[0] - startoffset, stdout);
-          fprintf(stdout, "%c[%sm", 0x1b, colour_string);
-          FWRITE(matchptr + offsets[0], 1, offsets[1] - offsets[0], stdout);
-          fprintf(stdout, "%c[00m", 0x1b);
+          FWRITE(matchptr + startoffset, 1, offsets[0] - startoffset, out);
+          fprintf(out, "%c[%sm", 0x1b, colour_string);
+          FWRITE(matchptr + offsets[0], 1, offsets[1] - offsets[0], out);
+          fprintf(out, "%c[00m", 0x1b);
           }
 
         /* In multiline mode, we may have already printed the complete line
@@ -1983,18 +2073,18 @@ while (ptr < endptr)
         may be no more to print. */
 
         plength = (int)((linelength + endlinelength) - startoffset);
-        if (plength > 0) FWRITE(ptr + startoffset, 1, plength, stdout);
+        if (plength > 0) FWRITE(ptr + startoffset, 1, plength, out);
         }
 
       /* Not colouring; no need to search for further matches */
 
-      else FWRITE(ptr, 1, linelength + endlinelength, stdout);
+      else FWRITE(ptr, 1, linelength + endlinelength, out);
       }
 
     /* End of doing what has to be done for a match. If --line-buffered was
     given, flush the output. */
 
-    if (line_buffered) fflush(stdout);
+    if (line_buffered) fflush(out);
     rc = 0;    /* Had some success */
 
     /* Remember where the last match happened for after_context. We remember
@@ -2035,7 +2125,7 @@ while (ptr < endptr)
 
   if (input_line_buffered && bufflength < (size_t)bufsize)
     {
-    int add = read_one_line(ptr, bufsize - (int)(ptr - main_buffer), in);
+    int add = read_one_line(ptr, bufsize - (int)(ptr - buffer), in);
     bufflength += add;
     endptr += add;
     }
@@ -2045,40 +2135,51 @@ while (ptr < endptr)
   1/3 and refill it. Before we do this, if some unprinted "after" lines are
   about to be lost, print them. */
 
-  if (bufflength >= (size_t)bufsize && ptr > main_buffer + 2*bufthird)
+  if (bufflength >= (size_t)bufsize && ptr > buffer + 2*bufthird)
     {
     if (after_context > 0 &&
         lastmatchnumber > 0 &&
-        lastmatchrestart < main_buffer + bufthird)
+        lastmatchrestart < buffer + bufthird)
       {
-      do_after_lines(lastmatchnumber, lastmatchrestart, endptr, printname);
+      do_after_lines(gs, lastmatchnumber, lastmatchrestart, endptr, printname);
       lastmatchnumber = 0;
       }
 
+    /* For a mapped file, just move the window; nothing else changes. */
+
+    if (frtype == FR_MMAP)
+      {
+      buffer += bufthird;
+      bufflength = ((size_t)(mapend - buffer) > (size_t)bufsize)?
+        (size_t)bufsize : (size_t)(mapend - buffer);
+      endptr = buffer + bufflength;
+      continue;
+      }
+
     /* Now do the shuffle */
 
-    memmove(main_buffer, main_buffer + bufthird, 2*bufthird);
+    memmove(buffer, buffer + bufthird, 2*bufthird);
     ptr -= bufthird;
 
 #ifdef SUPPORT_LIBZ
     if (frtype == FR_LIBZ)
       bufflength = 2*bufthird +
-        gzread (ingz, main_buffer + 2*bufthird, bufthird);
+        gzread (ingz, buffer + 2*bufthird, bufthird);
     else
 #endif
 
 #ifdef SUPPORT_LIBBZ2
     if (frtype == FR_LIBBZ2)
       bufflength = 2*bufthird +
-        BZ2_bzread(inbz2, main_buffer + 2*bufthird, bufthird);
+        BZ2_bzread(inbz2, buffer + 2*bufthird, bufthird);
     else
 #endif
 
     bufflength = 2*bufthird +
       (input_line_buffered?
-       read_one_line(main_buffer + 2*bufthird, bufthird, in) :
-       fread(main_buffer + 2*bufthird, 1, bufthird, in));
-    endptr = main_buffer + bufflength;
+       read_one_line(buffer + 2*bufthird, bufthird, in) :
+       fread(buffer + 2*bufthird, 1, bufthird, in));
+    endptr = buffer + bufflength;
 
     /* Adjust any last match point */
 
@@ -2091,8 +2192,8 @@ hyphenpending if it prints something. */
 
 if (!show_only_matching && !count_only)
   {
-  do_after_lines(lastmatchnumber, lastmatchrestart, endptr, printname);
-  hyphenpending |= endhyphenpending;
+  do_after_lines(gs, lastmatchnumber, lastmatchrestart, endptr, printname);
+  if (endhyphenpending) gs->hyphenpending = TRUE;
   }
 
 /* Print the file name if we are looking for those without matches and there
@@ -2100,7 +2201,7 @@ were none. If we found a match, we won't have got this far. */
 
 if (filenames == FN_NOMATCH_ONLY)
   {
-  fprintf(stdout, "%s\n", printname);
+  fprintf(out, "%s\n", printname);
   return 0;
   }
 
@@ -2111,8 +2212,8 @@ if (count_only && !quiet)
   if (count > 0 || !omit_zero_count)
     {
     if (printname != NULL && filenames != FN_NONE)
-      fprintf(stdout, "%s:", printname);
-    fprintf(stdout, "%lu\n", count);
+      fprintf(out, "%s:", printname);
+    fprintf(out, "%lu\n", count);
     }
   }
 
@@ -2121,35 +2222,88 @@ return rc;
 
 
 
+#ifdef PCREGREP_THREADS
 /*************************************************
-*     Grep a file or recurse into a directory    *
+*         Map a regular file into memory         *
 *************************************************/
 
-/* Given a path name, if it's a directory, scan all the files if we are
-recursing; if it's a file, grep it.
+/* This is used when searching in parallel, so that each worker does not have
+to copy the file through its buffer. Only non-empty regular files are mapped,
+and not when --line-buffered is set, because the file is then read one line at
+a time. If mapping is not possible, the file is read normally, which also
+reports any error.
 
 Arguments:
-  pathname          the path to investigate
-  dir_recurse       TRUE if recursing is wanted (-r or -drecurse)
-  only_one_at_top   TRUE if the path is the only one at toplevel
+  pathname    the path of the file
+  mapped      where to put the address and length
 
-Returns:  -1 the file/directory was skipped
-           0 if there was at least one match
+Returns:      TRUE if the file has been mapped
+*/
+
+static BOOL
+map_file(char *pathname, mapped_file *mapped)
+{
+struct stat statbuf;
+void *data;
+int fd;
+
+if (line_buffered) return FALSE;
+fd = open(pathname, O_RDONLY);
+if (fd < 0) return FALSE;
+
+if (fstat(fd, &statbuf) < 0 || (statbuf.st_mode & S_IFMT) != S_IFREG ||
+    statbuf.st_size <= 0 || (off_t)(size_t)statbuf.st_size != statbuf.st_size)
+  {
+  close(fd);
+  return FALSE;
+  }
+
+data = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+close(fd);
+if (data == MAP_FAILED) return FALSE;
+
+#ifdef MADV_SEQUENTIAL
+(void)madvise(data, (size_t)statbuf.st_size, MADV_SEQUENTIAL);
+#endif
+
+mapped->data = (char *)data;
+mapped->length = (size_t)statbuf.st_size;
+return TRUE;
+}
+#endif  /* PCREGREP_THREADS */
+
+
+
+/*************************************************
+*             Open and grep one file             *
+*************************************************/
+
+/* This is called from grep_or_recurse() for a file that is to be searched, or
+from a worker thread for a file taken from the work queue.
+
+Arguments:
+  gs           the state for this file
+  pathname     the path of the file
+  printname    the file name if it is to be printed for each match
+               or NULL if the file name is not to be printed
+
+Returns:   0 if there was at least one match
            1 if there were no matches
            2 there was some kind of error
-
-However, file opening failures are suppressed if "silent" is set.
 */
 
 static int
-grep_or_recurse(char *pathname, BOOL dir_recurse, BOOL only_one_at_top)
+grep_file(grep_state *gs, char *pathname, char *printname)
 {
 int rc = 1;
 int frtype;
 void *handle;
-char *lastcomp;
 FILE *in = NULL;           /* Ensure initialized */
 
+#ifdef PCREGREP_THREADS
+mapped_file mapped;
+#endif
+
 #ifdef SUPPORT_LIBZ
 gzFile ingz = NULL;
 #endif
@@ -2162,16 +2316,423 @@ BZFILE *inbz2 = NULL;
 int pathlen;
 #endif
 
+#if defined SUPPORT_LIBZ || defined SUPPORT_LIBBZ2
+pathlen = (int)(strlen(pathname));
+#endif
+
+/* Open using zlib if it is supported and the file name ends with .gz. */
+
+#ifdef SUPPORT_LIBZ
+if (pathlen > 3 && strcmp(pathname + pathlen - 3, ".gz") == 0)
+  {
+  ingz = gzopen(pathname, "rb");
+  if (ingz == NULL)
+    {
+    if (!silent)
+      fprintf(stderr, "pcregrep: Failed to open %s: %s\n", pathname,
+        strerror(errno));
+    return 2;
+    }
+  handle = (void *)ingz;
+  frtype = FR_LIBZ;
+  }
+else
+#endif
+
+/* Otherwise open with bz2lib if it is supported and the name ends with .bz2. */
+
+#ifdef SUPPORT_LIBBZ2
+if (pathlen > 4 && strcmp(pathname + pathlen - 4, ".bz2") == 0)
+  {
+  inbz2 = BZ2_bzopen(pathname, "rb");
+  handle = (void *)inbz2;
+  frtype = FR_LIBBZ2;
+  }
+else
+#endif
+
+/* Otherwise use plain fopen(), or map the file into memory when searching in
+parallel. The label is so that we can come back here if an attempt to read a
+.bz2 file indicates that it really is a plain file. */
+
+#ifdef SUPPORT_LIBBZ2
+PLAIN_FILE:
+#endif
+
+#ifdef PCREGREP_THREADS
+if (threads > 1 && map_file(pathname, &mapped))
+  {
+  handle = (void *)&mapped;
+  frtype = FR_MMAP;
+  }
+else
+#endif
+
+  {
+  in = fopen(pathname, "rb");
+  handle = (void *)in;
+  frtype = FR_PLAIN;
+  }
+
+/* All the opening methods return errno when they fail. */
+
+if (handle == NULL)
+  {
+  if (!silent)
+    fprintf(stderr, "pcregrep: Failed to open %s: %s\n", pathname,
+      strerror(errno));
+  return 2;
+  }
+
+/* Now grep the file */
+
+rc = pcregrep(gs, handle, frtype, pathname, printname);
+
+/* Close in an appropriate manner. */
+
+#ifdef PCREGREP_THREADS
+if (frtype == FR_MMAP)
+  munmap(mapped.data, mapped.length);
+else
+#endif
+
+#ifdef SUPPORT_LIBZ
+if (frtype == FR_LIBZ)
+  gzclose(ingz);
+else
+#endif
+
+/* If it is a .bz2 file and the result is 3, it means that the first attempt to
+read failed. If the error indicates that the file isn't in fact bzipped, try
+again as a normal file. */
+
+#ifdef SUPPORT_LIBBZ2
+if (frtype == FR_LIBBZ2)
+  {
+  if (rc == 3)
+    {
+    int errnum;
+    const char *err = BZ2_bzerror(inbz2, &errnum);
+    if (errnum == BZ_DATA_ERROR_MAGIC)
+      {
+      BZ2_bzclose(inbz2);
+      goto PLAIN_FILE;
+      }
+    else if (!silent)
+      fprintf(stderr, "pcregrep: Failed to read %s using bzlib: %s\n",
+        pathname, err);
+    rc = 2;    /* The normal "something went wrong" code */
+    }
+  BZ2_bzclose(inbz2);
+  }
+else
+#endif
+
+/* Normal file close */
+
+fclose(in);
+
+/* Pass back the yield from pcregrep(). */
+
+return rc;
+}
+
+
+
+#ifdef PCREGREP_THREADS
+/*************************************************
+*          Search files in parallel              *
+*************************************************/
+
+/* When --threads is greater than one, grep_or_recurse() walks the directories
+as usual, but instead of searching each file it appends it to a work queue.
+Worker threads take files from the queue and search them with their own
+buffers, collecting the output in memory. The main thread prints the output
+of each file, in queue order, once it has been searched, so that the result is
+the same as searching the files one at a time. The number of files that have
+been queued but not yet printed is limited, so that the output waiting in
+memory does not grow without bound. */
+
+#define JOBS_PER_THREAD 8
+
+typedef struct grep_job {
+  struct grep_job *next;
+  BOOL done;                  /* Searched, output available */
+  BOOL showname;              /* Print the file name with each line */
+  int rc;                     /* Yield from grep_file() */
+  int hyphenpending;          /* State when the search finished */
+  BOOL hyphenwanted;
+  char *output;               /* Output collected by open_memstream() */
+  size_t outlength;
+  char pathname[1];           /* Extends beyond the structure */
+} grep_job;
+
+static grep_job *job_head = NULL;      /* Oldest file not yet printed */
+static grep_job *job_tail = NULL;
+static grep_job *job_next = NULL;      /* Next file to be searched */
+static int job_count = 0;              /* Queued but not printed */
+static int job_rc = 1;                 /* Combined yield of printed files */
+static BOOL job_walk_done = FALSE;
+
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t job_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t job_finished = PTHREAD_COND_INITIALIZER;
+
+static pthread_t *workers = NULL;
+static char **worker_buffers = NULL;
+static int worker_count = 0;
+
+
+/* This is the function that each worker thread runs. It searches queued files
+until the queue is empty and there will be no more.
+
+Argument:  the worker's input buffer, bufsize bytes long
+Returns:   NULL
+*/
+
+static void *
+grep_worker(void *arg)
+{
+pthread_mutex_lock(&job_mutex);
+for (;;)
+  {
+  grep_state gs;
+  grep_job *job;
+
+  while (job_next == NULL && !job_walk_done)
+    pthread_cond_wait(&job_ready, &job_mutex);
+  if ((job = job_next) == NULL) break;
+  job_next = job->next;
+  pthread_mutex_unlock(&job_mutex);
+
+  gs.buffer = (char *)arg;
+  gs.hyphenpending = HYPHEN_INHERIT;
+  gs.hyphenwanted = FALSE;
+  gs.out = open_memstream(&job->output, &job->outlength);
+
+  if (gs.out == NULL)
+    {
+    fprintf(stderr, "pcregrep: Failed to create output buffer for %s: %s\n",
+      job->pathname, strerror(errno));
+    job->output = NULL;
+    job->rc = 2;
+    }
+  else
+    {
+    job->rc = grep_file(&gs, job->pathname,
+      job->showname? job->pathname : NULL);
+    fclose(gs.out);
+    }
+
+  job->hyphenpending = gs.hyphenpending;
+  job->hyphenwanted = gs.hyphenwanted;
+
+  pthread_mutex_lock(&job_mutex);
+  job->done = TRUE;
+  pthread_cond_broadcast(&job_finished);
+  }
+pthread_mutex_unlock(&job_mutex);
+return NULL;
+}
+
+
+/* Print the output of searched files, in queue order, and collect their
+yields in job_rc. Files are printed as soon as they have been searched; in
+addition, this waits until no more than a given number remain unprinted.
+
+Argument:  the number of files that may remain
+Returns:   nothing
+*/
+
+static void
+print_jobs(int keep)
+{
+pthread_mutex_lock(&job_mutex);
+while (job_head != NULL && (job_head->done || job_count > keep))
+  {
+  grep_job *job = job_head;
+
+  while (!job->done) pthread_cond_wait(&job_finished, &job_mutex);
+  job_head = job->next;
+  if (job_head == NULL) job_tail = NULL;
+  job_count--;
+  pthread_mutex_unlock(&job_mutex);
+
+  /* A file whose first separator depended on its predecessor gets it now. If
+  it printed no context, the pending state passes through it unchanged. */
+
+  if (job->hyphenwanted && main_state.hyphenpending)
+    fprintf(stdout, "--\n");
+  if (job->hyphenpending != HYPHEN_INHERIT)
+    main_state.hyphenpending = job->hyphenpending;
+
+  if (job->output != NULL)
+    {
+    FWRITE(job->output, 1, job->outlength, stdout);
+    free(job->output);
+    }
+  if (line_buffered) fflush(stdout);
+
+  if (job->rc > 1) job_rc = job->rc;
+    else if (job->rc == 0 && job_rc == 1) job_rc = 0;
+  free(job);
+
+  pthread_mutex_lock(&job_mutex);
+  }
+pthread_mutex_unlock(&job_mutex);
+}
+
+
+/* Add a file to the work queue. If too many files are waiting to be printed,
+this waits for the oldest ones to finish.
+
+Arguments:
+  pathname   the path of the file
+  showname   TRUE if the file name is to be printed for each match
+
+Returns:     -1 (the yield is collected by print_jobs()),
+              2 if memory could not be obtained
+*/
+
+static int
+queue_file(char *pathname, BOOL showname)
+{
+grep_job *job = (grep_job *)malloc(sizeof(grep_job) + strlen(pathname));
+
+if (job == NULL)
+  {
+  fprintf(stderr, "pcregrep: malloc failed\n");
+  return 2;
+  }
+
+job->next = NULL;
+job->done = FALSE;
+job->showname = showname;
+job->output = NULL;
+job->outlength = 0;
+strcpy(job->pathname, pathname);
+
+pthread_mutex_lock(&job_mutex);
+if (job_tail == NULL) job_head = job; else job_tail->next = job;
+job_tail = job;
+if (job_next == NULL) job_next = job;
+job_count++;
+pthread_cond_signal(&job_ready);
+pthread_mutex_unlock(&job_mutex);
+
+print_jobs(JOBS_PER_THREAD * worker_count);
+return -1;
+}
+
+
+/* Start the worker threads, each with its own input buffer.
+
+Argument:  the number of threads
+Returns:   TRUE if they were started, FALSE after an error
+*/
+
+static BOOL
+start_workers(int count)
+{
+int i;
+
+workers = (pthread_t *)malloc(count * sizeof(pthread_t));
+worker_buffers = (char **)calloc(count, sizeof(char *));
+if (workers == NULL || worker_buffers == NULL) goto FAILED;
+
+for (i = 0; i < count; i++)
+  {
+  worker_buffers[i] = (char *)malloc(bufsize);
+  if (worker_buffers[i] == NULL) goto FAILED;
+  if (pthread_create(&workers[i], NULL, grep_worker, worker_buffers[i]) != 0)
+    {
+    free(worker_buffers[i]);
+    worker_buffers[i] = NULL;
+    fprintf(stderr, "pcregrep: Failed to start thread: %s\n", strerror(errno));
+    return FALSE;
+    }
+  worker_count++;
+  }
+return TRUE;
+
+FAILED:
+fprintf(stderr, "pcregrep: malloc failed\n");
+return FALSE;
+}
+
+
+/* Print whatever is left in the queue, stop the worker threads, and free
+their buffers.
+
+Arguments: none
+Returns:   the combined yield of all the queued files
+*/
+
+static int
+finish_workers(void)
+{
+int i;
+
+print_jobs(0);
+
+pthread_mutex_lock(&job_mutex);
+job_walk_done = TRUE;
+pthread_cond_broadcast(&job_ready);
+pthread_mutex_unlock(&job_mutex);
+
+for (i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+if (worker_buffers != NULL)
+  for (i = 0; i < threads; i++) free(worker_buffers[i]);
+free(workers);
+free(worker_buffers);
+worker_count = 0;
+return job_rc;
+}
+#endif  /* PCREGREP_THREADS */
+
+
+
+/*************************************************
+*     Grep a file or recurse into a directory    *
+*************************************************/
+
+/* Given a path name, if it's a directory, scan all the files if we are
+recursing; if it's a file, grep it.
+
+Arguments:
+  pathname          the path to investigate
+  dir_recurse       TRUE if recursing is wanted (-r or -drecurse)
+  only_one_at_top   TRUE if the path is the only one at toplevel
+
+Returns:  -1 the file/directory was skipped
+           0 if there was at least one match
+           1 if there were no matches
+           2 there was some kind of error
+
+However, file opening failures are suppressed if "silent" is set.
+*/
+
+static int
+grep_or_recurse(char *pathname, BOOL dir_recurse, BOOL only_one_at_top)
+{
+int rc = 1;
+char *lastcomp;
+char *printname;
+
 #if defined NATIVE_ZOS
 int zos_type;
 FILE *zos_test_file;
 #endif
 
-/* If the file name is "-" we scan stdin */
+/* If the file name is "-" we scan stdin, after printing everything that comes
+before it if files are being searched in parallel. */
 
 if (strcmp(pathname, "-") == 0)
   {
-  return pcregrep(stdin, FR_PLAIN, stdin_name,
+#ifdef PCREGREP_THREADS
+  if (threads > 1) print_jobs(0);
+#endif
+  return pcregrep(&main_state, stdin, FR_PLAIN, stdin_name,
     (filenames > FN_DEFAULT || (filenames == FN_DEFAULT && !only_one_at_top))?
       stdin_name : NULL);
   }
@@ -2288,111 +2849,17 @@ else if (
 and recursion or skipping was not requested, or if we have anything else and
 skipping was not requested. The scan proceeds. If this is the first and only
 argument at top level, we don't show the file name, unless we are only showing
-the file name, or the filename was forced (-H). */
-
-#if defined SUPPORT_LIBZ || defined SUPPORT_LIBBZ2
-pathlen = (int)(strlen(pathname));
-#endif
+the file name, or the filename was forced (-H). When searching in parallel, the
+file is put on the work queue and its yield is collected when it is printed. */
 
-/* Open using zlib if it is supported and the file name ends with .gz. */
+printname = (filenames > FN_DEFAULT ||
+  (filenames == FN_DEFAULT && !only_one_at_top))? pathname : NULL;
 
-#ifdef SUPPORT_LIBZ
-if (pathlen > 3 && strcmp(pathname + pathlen - 3, ".gz") == 0)
-  {
-  ingz = gzopen(pathname, "rb");
-  if (ingz == NULL)
-    {
-    if (!silent)
-      fprintf(stderr, "pcregrep: Failed to open %s: %s\n", pathname,
-        strerror(errno));
-    return 2;
-    }
-  handle = (void *)ingz;
-  frtype = FR_LIBZ;
-  }
-else
-#endif
-
-/* Otherwise open with bz2lib if it is supported and the name ends with .bz2. */
-
-#ifdef SUPPORT_LIBBZ2
-if (pathlen > 4 && strcmp(pathname + pathlen - 4, ".bz2") == 0)
-  {
-  inbz2 = BZ2_bzopen(pathname, "rb");
-  handle = (void *)inbz2;
-  frtype = FR_LIBBZ2;
-  }
-else
+#ifdef PCREGREP_THREADS
+if (threads > 1) return queue_file(pathname, printname != NULL);
 #endif
 
-/* Otherwise use plain fopen(). The label is so that we can come back here if
-an attempt to read a .bz2 file indicates that it really is a plain file. */
-
-#ifdef SUPPORT_LIBBZ2
-PLAIN_FILE:
-#endif
-  {
-  in = fopen(pathname, "rb");
-  handle = (void *)in;
-  frtype = FR_PLAIN;
-  }
-
-/* All the opening methods return errno when they fail. */
-
-if (handle == NULL)
-  {
-  if (!silent)
-    fprintf(stderr, "pcregrep: Failed to open %s: %s\n", pathname,
-      strerror(errno));
-  return 2;
-  }
-
-/* Now grep the file */
-
-rc = pcregrep(handle, frtype, pathname, (filenames > FN_DEFAULT ||
-  (filenames == FN_DEFAULT && !only_one_at_top))? pathname : NULL);
-
-/* Close in an appropriate manner. */
-
-#ifdef SUPPORT_LIBZ
-if (frtype == FR_LIBZ)
-  gzclose(ingz);
-else
-#endif
-
-/* If it is a .bz2 file and the result is 3, it means that the first attempt to
-read failed. If the error indicates that the file isn't in fact bzipped, try
-again as a normal file. */
-
-#ifdef SUPPORT_LIBBZ2
-if (frtype == FR_LIBBZ2)
-  {
-  if (rc == 3)
-    {
-    int errnum;
-    const char *err = BZ2_bzerror(inbz2, &errnum);
-    if (errnum == BZ_DATA_ERROR_MAGIC)
-      {
-      BZ2_bzclose(inbz2);
-      goto PLAIN_FILE;
-      }
-    else if (!silent)
-      fprintf(stderr, "pcregrep: Failed to read %s using bzlib: %s\n",
-        pathname, err);
-    rc = 2;    /* The normal "something went wrong" code */
-    }
-  BZ2_bzclose(inbz2);
-  }
-else
-#endif
-
-/* Normal file close */
-
-fclose(in);
-
-/* Pass back the yield from pcregrep(). */
-
-return rc;
+return grep_file(&main_state, pathname, printname);
 }
 
 
@@ -3150,6 +3617,12 @@ if (jfriedl_XT != 0 || jfriedl_XR != 0)
   }
 #endif
 
+/* Without thread support, --threads is accepted but ignored. */
+
+#ifndef PCREGREP_THREADS
+threads = 1;
+#endif
+
 /* Get memory for the main buffer. */
 
 bufsize = 3*bufthird;
@@ -3161,6 +3634,9 @@ if (main_buffer == NULL)
   goto EXIT2;
   }
 
+main_state.out = stdout;
+main_state.buffer = main_buffer;
+
 /* If no patterns were provided by -e, and there are no files provided by -f,
 the first argument is the one and only pattern, and it must exist. */
 
@@ -3202,7 +3678,7 @@ if (match_limit > 0 || match_limit_recursion > 0)
 /* Unless JIT has been explicitly disabled, arrange a stack for it to use. */
 
 #ifdef SUPPORT_PCREGREP_JIT
-if ((study_options & PCRE_STUDY_JIT_COMPILE) != 0)
+if ((study_options & PCRE_STUDY_JIT_COMPILE) != 0 && threads <= 1)
   jit_stack = pcre_jit_stack_alloc(32*1024, 1024*1024);
 #endif
 
@@ -3221,6 +3697,8 @@ for (j = 1, cp = patterns; cp != NULL; j++, cp = cp->next)
 #ifdef SUPPORT_PCREGREP_JIT
   if (jit_stack != NULL && cp->hint != NULL)
     pcre_assign_jit_stack(cp->hint, NULL, jit_stack);
+  else if (threads > 1 && cp->hint != NULL)
+    pcre_assign_jit_stack(cp->hint, pcre_jit_thread_stack, NULL);
 #endif
   }
 
@@ -3277,11 +3755,17 @@ no file arguments, search stdin, and then exit. */
 
 if (file_lists == NULL && i >= argc)
   {
-  rc = pcregrep(stdin, FR_PLAIN, stdin_name,
+  rc = pcregrep(&main_state, stdin, FR_PLAIN, stdin_name,
     (filenames > FN_DEFAULT)? stdin_name : NULL);
   goto EXIT;
   }
 
+/* If files are to be searched in parallel, start the worker threads. */
+
+#ifdef PCREGREP_THREADS
+if (threads > 1 && !start_workers(threads)) goto EXIT2;
+#endif
+
 /* If any files that contains a list of files to search have been specified,
 read them line by line and search the given files. */
 
@@ -3330,6 +3814,15 @@ for (; i < argc; i++)
   }
 
 EXIT:
+#ifdef PCREGREP_THREADS
+if (workers != NULL)
+  {
+  int frc = finish_workers();
+  if (frc > 1) rc = frc;
+    else if (frc == 0 && rc == 1) rc = 0;
+  }
+#endif
+
 #ifdef SUPPORT_PCREGREP_JIT
 if (jit_stack != NULL) pcre_jit_stack_free(jit_stack);
 #endif
@@ -66,6 +66,33 @@ does so after it has set PCRE_EXP_DECL to "export" if it is not already set. */
 #include "pcre_internal.h"
 #include "pcreposix.h"
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+
+/* A compiled pattern is copied into a block with room after it for a pointer
+to its study data, which is a separate allocation. The re_pcre field of a
+regex_t points to the start of the block, so it is an ordinary compiled pattern
+that can be passed to the native API or freed by pcre_free(), although freeing
+it that way leaks the study data. */
+
+#define POSIX_EXTRA_OFFSET(re) \
+  (((size_t)((const REAL_PCRE *)(re))->size + 7) & ~(size_t)7)
+#define POSIX_EXTRA(re) \
+  (*(pcre_extra **)((char *)(re) + POSIX_EXTRA_OFFSET(re)))
+
+/* When the ovector that pcre_exec() needs is too large for the stack,
+regexec() uses a workspace that belongs to the calling thread, and that grows
+as necessary, instead of getting and freeing memory on every call. The
+workspace is freed when the thread exits. */
+
+typedef struct posix_workspace {
+  size_t size;                    /* Number of ints in the ovector */
+  BOOL busy;                      /* In use by this thread (from a callout) */
+  int *ovector;
+} posix_workspace;
+
 
 /* Table to translate PCRE compile time error codes into POSIX error codes. */
 
@@ -245,6 +272,9 @@ return length + addlength;
 PCREPOSIX_EXP_DEFN void PCRE_CALL_CONVENTION
 regfree(regex_t *preg)
 {
+if (preg->re_pcre == NULL) return;
+if (POSIX_EXTRA(preg->re_pcre) != NULL)
+  pcre_free_study(POSIX_EXTRA(preg->re_pcre));
 (PUBL(free))(preg->re_pcre);
 }
 
@@ -273,6 +303,7 @@ int erroffset;
 int errorcode;
 int options = 0;
 int re_nsub = 0;
+pcre *re;
 
 if ((cflags & REG_ICASE) != 0)    options |= PCRE_CASELESS;
 if ((cflags & REG_NEWLINE) != 0)  options |= PCRE_MULTILINE;
@@ -282,19 +313,34 @@ if ((cflags & REG_UTF8) != 0)     options |= PCRE_UTF8;
 if ((cflags & REG_UCP) != 0)      options |= PCRE_UCP;
 if ((cflags & REG_UNGREEDY) != 0) options |= PCRE_UNGREEDY;
 
-preg->re_pcre = pcre_compile2(pattern, options, &errorcode, &errorptr,
-  &erroffset, NULL);
+preg->re_pcre = NULL;
+re = pcre_compile2(pattern, options, &errorcode, &errorptr, &erroffset, NULL);
 preg->re_erroffset = erroffset;
 
 /* Safety: if the error code is too big for the translation vector (which
 should not happen, but we all make mistakes), return REG_BADPAT. */
 
-if (preg->re_pcre == NULL)
+if (re == NULL)
   {
   return (errorcode < (int)(sizeof(eint)/sizeof(const int)))?
     eint[errorcode] : REG_BADPAT;
   }
 
+/* Move the pattern into a block with room for the study data pointer, and
+study it there, so that regexec() can use the start-of-match optimizations. A
+failure to study is not an error. */
+
+preg->re_pcre = (PUBL(malloc))(POSIX_EXTRA_OFFSET(re) + sizeof(pcre_extra *));
+if (preg->re_pcre == NULL)
+  {
+  (PUBL(free))(re);
+  return REG_ESPACE;
+  }
+memcpy(preg->re_pcre, re, ((REAL_PCRE *)re)->size);
+(PUBL(free))(re);
+POSIX_EXTRA(preg->re_pcre) =
+  pcre_study((const pcre *)preg->re_pcre, 0, &errorptr);
+
 (void)pcre_fullinfo((const pcre *)preg->re_pcre, NULL, PCRE_INFO_CAPTURECOUNT,
   &re_nsub);
 preg->re_nsub = (size_t)re_nsub;
@@ -305,16 +351,92 @@ return 0;
 
 
 
+/*************************************************
+*        Get the thread's matching workspace     *
+*************************************************/
+
+/* Without POSIX threads there is no workspace, and regexec() gets and frees
+memory for a large ovector on each call. */
+
+#ifndef _WIN32
+static pthread_once_t workspace_once = PTHREAD_ONCE_INIT;
+static pthread_key_t workspace_key;
+static BOOL workspace_key_valid = FALSE;
+
+static void
+workspace_release(void *workspace)
+{
+free(((posix_workspace *)workspace)->ovector);
+free(workspace);
+}
+
+static void
+workspace_init(void)
+{
+workspace_key_valid =
+  pthread_key_create(&workspace_key, workspace_release) == 0;
+}
+#endif
+
+/*
+Arguments:
+  size        the number of ints needed
+
+Returns:      the workspace, or NULL if there is none or it is busy
+*/
+
+static posix_workspace *
+thread_workspace(size_t size)
+{
+#ifndef _WIN32
+posix_workspace *workspace;
+
+pthread_once(&workspace_once, workspace_init);
+if (!workspace_key_valid) return NULL;
+
+workspace = (posix_workspace *)pthread_getspecific(workspace_key);
+if (workspace == NULL)
+  {
+  workspace = (posix_workspace *)malloc(sizeof(posix_workspace));
+  if (workspace == NULL) return NULL;
+  memset(workspace, 0, sizeof(posix_workspace));
+  if (pthread_setspecific(workspace_key, workspace) != 0)
+    {
+    free(workspace);
+    return NULL;
+    }
+  }
+
+if (workspace->busy) return NULL;
+if (workspace->size < size)
+  {
+  int *ovector = (int *)malloc(sizeof(int) * size);
+  if (ovector == NULL) return NULL;
+  free(workspace->ovector);
+  workspace->ovector = ovector;
+  workspace->size = size;
+  }
+return workspace;
+#else
+(void)size;
+return NULL;
+#endif
+}
+
+
+
+
 /*************************************************
 *              Match a regular expression        *
 *************************************************/
 
 /* Unfortunately, PCRE requires 3 ints of working space for each captured
-substring, so we have to get and release working store instead of just using
-the POSIX structures as was done in earlier releases when PCRE needed only 2
-ints. However, if the number of possible capturing brackets is small, use a
-block of store on the stack, to reduce the use of malloc/free. The threshold is
-in a macro that can be changed at configure time.
+substring, so we have to find working store instead of just using the POSIX
+structures as was done in earlier releases when PCRE needed only 2 ints. If the
+number of possible capturing brackets is small, a block of store on the stack
+is used; the threshold is in a macro that can be changed at configure time.
+Otherwise the calling thread's workspace is used, and memory is got and freed
+only if that cannot be used.
 
 If REG_NOSUB was specified at compile time, the PCRE_NO_AUTO_CAPTURE flag will
 be set. When this is the case, the nmatch and pmatch arguments are ignored, and
@@ -328,6 +450,7 @@ int rc, so, eo;
 int options = 0;
 int *ovector = NULL;
 int small_ovector[POSIX_MALLOC_THRESHOLD * 3];
+posix_workspace *workspace = NULL;
 BOOL allocated_ovector = FALSE;
 BOOL nosub =
   (REAL_PCRE_OPTIONS((const pcre *)preg->re_pcre) & PCRE_NO_AUTO_CAPTURE) != 0;
@@ -351,9 +474,18 @@ else if (nmatch > 0)
   else
     {
     if (nmatch > INT_MAX/(sizeof(int) * 3)) return REG_ESPACE;
-    ovector = (int *)malloc(sizeof(int) * nmatch * 3);
-    if (ovector == NULL) return REG_ESPACE;
-    allocated_ovector = TRUE;
+    workspace = thread_workspace(nmatch * 3);
+    if (workspace != NULL)
+      {
+      ovector = workspace->ovector;
+      workspace->busy = TRUE;
+      }
+    else
+      {
+      ovector = (int *)malloc(sizeof(int) * nmatch * 3);
+      if (ovector == NULL) return REG_ESPACE;
+      allocated_ovector = TRUE;
+      }
     }
   }
 
@@ -364,7 +496,13 @@ start location rather than being passed as a PCRE "starting offset". */
 
 if ((eflags & REG_STARTEND) != 0)
   {
-  if (pmatch == NULL) return REG_INVARG;
+  if (pmatch == NULL || pmatch[0].rm_so < 0 ||
+      pmatch[0].rm_eo < pmatch[0].rm_so)
+    {
+    if (workspace != NULL) workspace->busy = FALSE;
+    if (allocated_ovector) free(ovector);
+    return REG_INVARG;
+    }
   so = pmatch[0].rm_so;
   eo = pmatch[0].rm_eo;
   }
@@ -374,9 +512,10 @@ else
   eo = (int)strlen(string);
   }
 
-rc = pcre_exec((const pcre *)preg->re_pcre, NULL, string + so, (eo - so),
-  0, options, ovector, (int)(nmatch * 3));
+rc = pcre_exec((const pcre *)preg->re_pcre, POSIX_EXTRA(preg->re_pcre),
+  string + so, (eo - so), 0, options, ovector, (int)(nmatch * 3));
 
+if (workspace != NULL) workspace->busy = FALSE;
 if (rc == 0) rc = (int)nmatch;    /* All captured slots were filled in */
 
 /* Successful match */
@@ -1045,6 +1045,49 @@ static int stack_guard_return;
 static int use_utf;
 static const unsigned char *last_callout_mark = NULL;
 
+/* With -profile, the counters of each pattern are kept in this list, which is
+sorted by time, longest first, and printed at the end. */
+
+typedef struct profile_item {
+  struct profile_item *next;
+  char *pattern;
+  pcre_profile counters;
+} profile_item;
+
+static profile_item *profile_list = NULL;
+
+/* The <xxx> modifiers that pass a pattern or its subjects to one of the other
+compiling and matching functions of the 8-bit library. */
+
+#define TEST_CACHE        0x0001    /* pcre_cache_compile() */
+#define TEST_SET          0x0002    /* pcre_set_compile() */
+#define TEST_LAZY_DFA     0x0004    /* Study with PCRE_STUDY_LAZY_DFA */
+#define TEST_LRU          0x0008    /* pcre_compile_cached() */
+#define TEST_STREAM       0x0010    /* pcre_stream_create() */
+#define TEST_SPECIAL      0x0020    /* Report the specialized matcher */
+#define TEST_NO_SPECIAL   0x0040    /* Study with PCRE_STUDY_NO_SPECIAL */
+#define TEST_ARENA        0x0080    /* pcre_compile_arena() */
+#define TEST_BATCH        0x0100    /* pcre_exec_batch() */
+
+/* The file that <cache> writes, and the size of the arena that <arena> uses.
+The cache file is removed at the end by RunTest with the other saved files. */
+
+#define CACHE_FILE "testsavedcache"
+#define ARENA_SIZE 16384
+
+/* A batch is also run as this many copies of itself divided among this many
+threads, which is enough for pcre_exec_batch() to use them. */
+
+#define BATCH_COPIES  4096
+#define BATCH_THREADS 4
+
+/* Patterns compiled with <lru> come from this cache, which is made when it is
+first needed. */
+
+#ifdef SUPPORT_PCRE8
+static pcre_lru_cache *lru_cache = NULL;
+#endif
+
 /* The buffers grow automatically if very long input lines are encountered. */
 
 static int buffer_size = 50000;
@@ -2456,6 +2499,76 @@ return rc;
 
 
 
+/*************************************************
+*       Record and print pattern profiles        *
+*************************************************/
+
+/* This is called for each pattern as it is freed when -profile is set. The
+pattern has no profile unless PCRE was built with profiling support.
+
+Arguments:
+  re        compiled regex
+  pattern   the text of the pattern, or NULL if it was loaded from a file
+
+Returns:    nothing
+*/
+
+static void
+add_profile(pcre *re, const char *pattern)
+{
+pcre_profile counters;
+profile_item *item;
+profile_item **pp = &profile_list;
+
+if (new_info(re, NULL, PCRE_INFO_PROFILE, &counters) != 0) return;
+item = (profile_item *)malloc(sizeof(profile_item));
+if (pattern == NULL) pattern = "(loaded from file)";
+if (item == NULL ||
+    (item->pattern = (char *)malloc(strlen(pattern) + 1)) == NULL)
+  {
+  free(item);
+  return;
+  }
+strcpy(item->pattern, pattern);
+item->counters = counters;
+while (*pp != NULL && (*pp)->counters.seconds >= counters.seconds)
+  pp = &((*pp)->next);
+item->next = *pp;
+*pp = item;
+}
+
+
+/* Print the list made by add_profile() and free it. */
+
+static void
+print_profile(void)
+{
+int rc = 0;
+(void)PCRE_CONFIG(PCRE_CONFIG_PROFILE, &rc);
+if (!rc)
+  {
+  fprintf(outfile, "** This version of PCRE was built without profiling "
+    "support\n");
+  return;
+  }
+fprintf(outfile, "--------------------------------------\n");
+fprintf(outfile, "     Calls  Match calls   DFA states        Units"
+  "    Time (ms)  Pattern\n");
+while (profile_list != NULL)
+  {
+  profile_item *item = profile_list;
+  fprintf(outfile, "%10lu %12lu %12lu %12lu %12.4f  /%s/\n",
+    item->counters.calls, item->counters.match_calls,
+    item->counters.dfa_states, item->counters.units,
+    item->counters.seconds * 1000.0, item->pattern);
+  profile_list = item->next;
+  free(item->pattern);
+  free(item);
+  }
+}
+
+
+
 /*************************************************
 *             Swap byte functions                *
 *************************************************/
@@ -2910,6 +3023,493 @@ return 0;
 
 
 
+/*************************************************
+*            Check test mode modifier            *
+*************************************************/
+
+/* The <xxx> modifiers that select other compiling and matching functions are
+recognized here, before check_mc_option() is called for the others.
+
+Arguments:
+  p           points after the leading '<'
+
+Returns:      the TEST_xxx bit for the modifier, or 0 if it is not one
+*/
+
+static int
+check_test_mode(pcre_uint8 *p)
+{
+if (strncmpic(p, (pcre_uint8 *)"cache>", 6) == 0) return TEST_CACHE;
+if (strncmpic(p, (pcre_uint8 *)"set>", 4) == 0) return TEST_SET;
+if (strncmpic(p, (pcre_uint8 *)"lazy_dfa>", 9) == 0) return TEST_LAZY_DFA;
+if (strncmpic(p, (pcre_uint8 *)"lru>", 4) == 0) return TEST_LRU;
+if (strncmpic(p, (pcre_uint8 *)"stream>", 7) == 0) return TEST_STREAM;
+if (strncmpic(p, (pcre_uint8 *)"special>", 8) == 0) return TEST_SPECIAL;
+if (strncmpic(p, (pcre_uint8 *)"no_special>", 11) == 0) return TEST_NO_SPECIAL;
+if (strncmpic(p, (pcre_uint8 *)"arena>", 6) == 0) return TEST_ARENA;
+if (strncmpic(p, (pcre_uint8 *)"batch>", 6) == 0) return TEST_BATCH;
+return 0;
+}
+
+
+
+/*************************************************
+*          Show an unsuccessful result           *
+*************************************************/
+
+/* This is used for the results of the functions that the test mode modifiers
+select, which are shown without the offsets that pcre_exec() might set.
+
+Arguments:
+  rc          a negative return code
+
+Returns:      nothing
+*/
+
+static void
+show_error(int rc)
+{
+if (rc == PCRE_ERROR_NOMATCH)
+  fprintf(outfile, "No match\n");
+else if (rc == PCRE_ERROR_BADUTF8 || rc == PCRE_ERROR_SHORTUTF8)
+  fprintf(outfile, "Error %d (%s UTF-8 string)\n", rc,
+    (rc == PCRE_ERROR_BADUTF8)? "bad" : "short");
+else if (rc < 0 && (-rc) < (int)(sizeof(errtexts)/sizeof(const char *)) &&
+    errtexts[-rc] != NULL)
+  fprintf(outfile, "Error %d (%s)\n", rc, errtexts[-rc]);
+else
+  fprintf(outfile, "Error %d (Unexpected value)\n", rc);
+}
+
+
+
+#ifdef SUPPORT_PCRE8
+
+/*************************************************
+*      Compile via a file of saved patterns      *
+*************************************************/
+
+/* This is used for <cache>. The pattern is compiled into an empty cache, which
+is written to CACHE_FILE, and is then fetched again from the file, so that both
+the compiling and the loading paths are tested. The two results must be the
+same.
+
+Arguments:
+  pattern        the pattern
+  options        compile options
+  study_options  study options, used if extra_ptr is not NULL
+  extra_ptr      where to put the study data, or NULL
+  errorptr       where to put an error message
+  erroroffset    where to put the error offset
+
+Returns:         the compiled pattern, or NULL on error
+*/
+
+static pcre *
+cache_compile(const char *pattern, int options, int study_options,
+  pcre_extra **extra_ptr, const char **errorptr, int *erroroffset)
+{
+pcre_cache *cache;
+pcre *re, *loaded;
+pcre_extra *loaded_extra = NULL;
+int rc;
+
+(void)remove(CACHE_FILE);
+cache = pcre_cache_open(CACHE_FILE, errorptr);
+if (cache == NULL) return NULL;
+re = pcre_cache_compile(cache, pattern, options, study_options, extra_ptr,
+  errorptr, erroroffset);
+rc = (re == NULL)? 0 : pcre_cache_save(cache);
+pcre_cache_close(cache);
+if (re == NULL) return NULL;
+if (rc < 0)
+  {
+  fprintf(outfile, "** Failed to write the cache file: error %d\n", rc);
+  return re;
+  }
+
+cache = pcre_cache_open(CACHE_FILE, errorptr);
+if (cache == NULL) return re;
+loaded = pcre_cache_compile(cache, pattern, options, study_options,
+  (extra_ptr == NULL)? NULL : &loaded_extra, errorptr, erroroffset);
+pcre_cache_close(cache);
+if (loaded == NULL)
+  {
+  fprintf(outfile, "** Failed to load the pattern from the cache file\n");
+  return re;
+  }
+
+if (REAL_PCRE_SIZE(loaded) != REAL_PCRE_SIZE(re) ||
+    memcmp(loaded, re, REAL_PCRE_SIZE(re)) != 0 ||
+    (extra_ptr != NULL && memcmp(loaded_extra->study_data,
+      (*extra_ptr)->study_data, sizeof(pcre_study_data)) != 0))
+  fprintf(outfile, "** The pattern loaded from the cache file is different\n");
+
+new_free(re);
+if (extra_ptr != NULL)
+  {
+  pcre_free_study(*extra_ptr);
+  *extra_ptr = loaded_extra;
+  }
+return loaded;
+}
+
+
+
+/*************************************************
+*     Check a match against the interpreter      *
+*************************************************/
+
+/* This is used for <lazy_dfa> and <special>. The subject is matched again
+without the study data, which leaves only the interpreter, and a message is
+output if the result is different.
+
+Arguments:
+  re                compiled pattern
+  bptr              the subject
+  len               its length
+  start_offset      where to start matching
+  options           pcre_exec() options
+  count             what pcre_exec() returned with the study data
+  use_offsets       the offsets it set
+  use_size_offsets  the size of the offset vector
+
+Returns:            nothing
+*/
+
+static void
+check_interpreter(pcre *re, pcre_uint8 *bptr, int len, int start_offset,
+  int options, int count, int *use_offsets, int use_size_offsets)
+{
+int i, pairs, rc;
+int *offsets = (int *)malloc((use_size_offsets + 1) * sizeof(int));
+
+if (offsets == NULL) return;
+rc = pcre_exec(re, NULL, (char *)bptr, len, start_offset, options, offsets,
+  use_size_offsets);
+pairs = (rc > 0)? rc : (rc == 0)? use_size_offsets/3 : 0;
+if (rc == PCRE_ERROR_PARTIAL && use_size_offsets >= 2) pairs = 1;
+for (i = 0; rc == count && i < 2 * pairs; i++)
+  if (offsets[i] != use_offsets[i]) break;
+if (rc != count || i < 2 * pairs)
+  fprintf(outfile, "** The interpreter gives a different result (%d)\n", rc);
+free(offsets);
+}
+
+
+
+/*************************************************
+*        Compile via the shared LRU cache        *
+*************************************************/
+
+/* This is used for <lru>. The pattern is fetched from the cache twice; the
+second call must be a hit that returns the same compiled pattern. The caller
+releases the pattern instead of freeing it.
+
+Arguments:
+  pattern        the pattern
+  options        compile options
+  errorptr       where to put an error message
+  erroroffset    where to put the error offset
+  tables         character tables, or NULL
+
+Returns:         the compiled pattern, or NULL on error
+*/
+
+static pcre *
+lru_compile(const char *pattern, int options, const char **errorptr,
+  int *erroroffset, const unsigned char *tables)
+{
+const pcre *re, *again;
+unsigned long int hits = 0, hits_after = 0;
+
+if (lru_cache == NULL) lru_cache = pcre_lru_cache_create(0, 0);
+if (lru_cache == NULL)
+  {
+  *errorptr = "failed to get memory";
+  *erroroffset = 0;
+  return NULL;
+  }
+
+re = pcre_compile_cached(lru_cache, pattern, options, errorptr, erroroffset,
+  tables, NULL);
+if (re == NULL) return NULL;
+
+(void)pcre_lru_cache_info(lru_cache, PCRE_LRUINFO_HITS, &hits);
+again = pcre_compile_cached(lru_cache, pattern, options, errorptr,
+  erroroffset, tables, NULL);
+(void)pcre_lru_cache_info(lru_cache, PCRE_LRUINFO_HITS, &hits_after);
+if (again != re || hits_after != hits + 1)
+  fprintf(outfile, "** The cache did not return the pattern it compiled\n");
+if (again != NULL) (void)pcre_release_cached(again);
+return (pcre *)re;
+}
+
+
+
+/*************************************************
+*        Find the matches in a stream            *
+*************************************************/
+
+/* This is used for <stream>. The subject is fed to a stream a piece at a time,
+and the matches are recorded as a list of integers: for each match, the number
+of pairs of offsets and then the pairs, which are relative to the start of the
+stream. An error ends the list with its negative code.
+
+Arguments:
+  re          compiled pattern
+  extra       its study data, or NULL
+  options     pcre_stream_create() options
+  bptr        the subject
+  len         its length
+  piece       the number of bytes to feed at a time
+  list        where to put the list, which the caller frees; NULL if there
+                is no memory
+  used        where to put its length
+
+Returns:      nothing
+*/
+
+#define STREAM_OVECSIZE 30
+
+static void
+stream_matches(pcre *re, pcre_extra *extra, int options, pcre_uint8 *bptr,
+  int len, int piece, int **list, int *used)
+{
+int ovector[STREAM_OVECSIZE];
+int size = 64;
+int fed = 0;
+int rc = 0;
+pcre_stream *stream;
+
+*used = 0;
+*list = (int *)malloc(size * sizeof(int));
+if (*list == NULL) return;
+
+stream = pcre_stream_create(re, extra, options, &rc);
+if (stream == NULL)
+  {
+  (*list)[(*used)++] = rc;
+  return;
+  }
+
+for (;;)
+  {
+  int n = (len - fed < piece)? len - fed : piece;
+  int last = fed + n >= len;
+
+  rc = pcre_stream_feed(stream, (const char *)bptr + fed, n, last);
+  fed += n;
+
+  while (rc >= 0)
+    {
+    const char *subject;
+    size_t base;
+    int i;
+
+    rc = pcre_stream_exec(stream, ovector, STREAM_OVECSIZE, &subject, &base);
+    if (rc < 0) break;
+    if (rc == 0) rc = STREAM_OVECSIZE/3;
+
+    if (ovector[1] > ovector[0] && memcmp(subject + ovector[0],
+        bptr + base + ovector[0], ovector[1] - ovector[0]) != 0)
+      fprintf(outfile, "** The stream returned the wrong data\n");
+
+    if (*used + 2 * rc + 2 > size)
+      {
+      int *new_list;
+      size = 2 * size + 2 * rc;
+      new_list = (int *)realloc(*list, size * sizeof(int));
+      if (new_list == NULL)
+        {
+        free(*list);
+        *list = NULL;
+        pcre_stream_free(stream);
+        return;
+        }
+      *list = new_list;
+      }
+
+    (*list)[(*used)++] = rc;
+    for (i = 0; i < 2 * rc; i++)
+      (*list)[(*used)++] = (ovector[i] < 0)? -1 : (int)base + ovector[i];
+    }
+
+  if (rc != PCRE_ERROR_NOMATCH)
+    {
+    (*list)[(*used)++] = rc;
+    break;
+    }
+  if (last) break;
+  }
+
+pcre_stream_free(stream);
+}
+
+
+
+/*************************************************
+*       Show the matches in a stream             *
+*************************************************/
+
+/* This is used for <stream>. The matches are found with the whole subject fed
+at once, and shown with their offsets. They are then found again with the
+subject fed 1 to 8 bytes at a time, which must give the same list.
+
+Arguments:
+  re          compiled pattern
+  extra       its study data, or NULL
+  options     pcre_stream_create() options
+  bptr        the subject
+  len         its length
+
+Returns:      nothing
+*/
+
+static void
+run_stream(pcre *re, pcre_extra *extra, int options, pcre_uint8 *bptr,
+  int len)
+{
+int *list, *other;
+int used, other_used, i, piece;
+
+stream_matches(re, extra, options, bptr, len, (len > 0)? len : 1, &list,
+  &used);
+if (list == NULL)
+  {
+  fprintf(outfile, "** Failed to get memory for a stream\n");
+  return;
+  }
+
+if (used == 0) fprintf(outfile, "No match\n");
+for (i = 0; i < used;)
+  {
+  int j;
+  int pairs = list[i++];
+  if (pairs < 0)
+    {
+    show_error(pairs);
+    break;
+    }
+  for (j = 0; j < pairs; j++, i += 2)
+    {
+    fprintf(outfile, "%2d: ", j);
+    if (list[i] < 0) fprintf(outfile, "<unset>"); else
+      (void)pchars(bptr + list[i],
+        (list[i+1] > list[i])? list[i+1] - list[i] : 0, outfile);
+    if (j == 0) fprintf(outfile, " (%d)", list[i]);
+    fprintf(outfile, "\n");
+    }
+  }
+
+for (piece = 1; piece < len && piece <= 8; piece++)
+  {
+  stream_matches(re, extra, options, bptr, len, piece, &other, &other_used);
+  if (other == NULL) break;
+  if (other_used != used || memcmp(other, list, used * sizeof(int)) != 0)
+    fprintf(outfile, "** Different matches when fed %d byte%s at a time\n",
+      piece, (piece == 1)? "" : "s");
+  free(other);
+  }
+free(list);
+}
+
+
+
+/*************************************************
+*      Match the lines of a subject as a batch   *
+*************************************************/
+
+/* This is used for <batch>. The subject is split at each newline, the pieces
+are matched by pcre_exec_batch(), and the result for each is shown. Each
+result is checked against pcre_exec(), and the batch is run again as at least
+BATCH_COPIES subjects divided among BATCH_THREADS threads, which must give the
+same results.
+
+Arguments:
+  re          compiled pattern
+  extra       its study data, or NULL
+  bptr        the subject
+  len         its length
+  options     pcre_exec() options
+
+Returns:      nothing
+*/
+
+static void
+run_batch(pcre *re, pcre_extra *extra, pcre_uint8 *bptr, int len, int options)
+{
+int i, n, rc, copies, matched;
+const char **subjects;
+int *lengths, *results;
+pcre_uint8 *p = bptr;
+
+for (i = 0, n = 1; i < len; i++) if (bptr[i] == '\n') n++;
+copies = (BATCH_COPIES + n - 1)/n;
+
+subjects = (const char **)malloc(n * copies * sizeof(const char *));
+lengths = (int *)malloc(n * copies * sizeof(int));
+results = (int *)malloc(n * (copies + 1) * sizeof(int));
+if (subjects == NULL || lengths == NULL || results == NULL)
+  {
+  fprintf(outfile, "** Failed to get memory for a batch\n");
+  goto FREE;
+  }
+
+for (i = 0; i < n; i++)
+  {
+  pcre_uint8 *end = p;
+  while (end < bptr + len && *end != '\n') end++;
+  subjects[i] = (const char *)p;
+  lengths[i] = (int)(end - p);
+  p = end + 1;
+  }
+
+rc = pcre_exec_batch(re, extra, subjects, lengths, n, options, 1, results);
+if (rc < 0)
+  {
+  show_error(rc);
+  goto FREE;
+  }
+
+for (i = 0, matched = 0; i < n; i++)
+  {
+  int single = pcre_exec(re, extra, subjects[i], lengths[i], 0, options, NULL,
+    0);
+  fprintf(outfile, "%2d: ", i);
+  if (results[i] < 0) show_error(results[i]); else
+    {
+    fprintf(outfile, "Matched\n");
+    matched++;
+    }
+  if (single != results[i])
+    fprintf(outfile, "** pcre_exec() gives %d\n", single);
+  }
+if (rc != matched)
+  fprintf(outfile, "** pcre_exec_batch() returned %d\n", rc);
+
+for (i = n; i < n * copies; i++)
+  {
+  subjects[i] = subjects[i % n];
+  lengths[i] = lengths[i % n];
+  }
+rc = pcre_exec_batch(re, extra, subjects, lengths, n * copies, options,
+  BATCH_THREADS, results + n);
+for (i = 0; i < n * copies; i++)
+  if (results[n + i] != results[i % n]) break;
+if (rc != matched * copies || i < n * copies)
+  fprintf(outfile, "** The batch gives different results in threads\n");
+
+FREE:
+free(subjects);
+free(lengths);
+free(results);
+}
+
+#endif  /* SUPPORT_PCRE8 */
+
+
+
 /*************************************************
 *             Usage function                     *
 *************************************************/
@@ -2944,6 +3544,7 @@ printf("     ucp          Unicode Properties supported [0, 1]\n");
 printf("     jit          Just-in-time compiler supported [0, 1]\n");
 printf("     newline      Newline type [CR, LF, CRLF, ANYCRLF, ANY]\n");
 printf("     bsr          \\R type [ANYCRLF, ANY]\n");
+printf("     profile      match profiling supported [0, 1]\n");
 printf("  -d       debug: show compiled code and information (-b and -i)\n");
 #if !defined NODFA
 printf("  -dfa     force DFA matching for all subjects\n");
@@ -2957,6 +3558,7 @@ printf("  -i       show information about compiled patterns\n"
 #if !defined NOPOSIX
 printf("  -p       use POSIX interface\n");
 #endif
+printf("  -profile show match profiles of all patterns, slowest first\n");
 printf("  -q       quiet: do not output PCRE version number at start\n");
 printf("  -S <n>   set stack size to <n> megabytes\n");
 printf("  -s       force each pattern to be studied at basic level\n"
@@ -2995,6 +3597,7 @@ int op = 1;
 int timeit = 0;
 int timeitm = 0;
 int showtotaltimes = 0;
+int showprofile = 0;
 int showinfo = 0;
 int showstore = 0;
 int force_study = -1;
@@ -3133,6 +3736,7 @@ while (argc > 1 && argv[op][0] == '-')
 #endif
     }
   else if (strcmp(arg, "-q") == 0) quiet = 1;
+  else if (strcmp(arg, "-profile") == 0) showprofile = 1;
   else if (strcmp(arg, "-b") == 0) debug = 1;
   else if (strcmp(arg, "-i") == 0) showinfo = 1;
   else if (strcmp(arg, "-d") == 0) showinfo = debug = 1;
@@ -3287,6 +3891,12 @@ while (argc > 1 && argv[op][0] == '-')
         (void)PCRE_CONFIG(PCRE_CONFIG_BSR, &rc);
         printf("%s\n", rc? "ANYCRLF" : "ANY");
         }
+      else if (strcmp(argv[op + 1], "profile") == 0)
+        {
+        (void)PCRE_CONFIG(PCRE_CONFIG_PROFILE, &rc);
+        printf("%d\n", rc);
+        yield = rc;
+        }
       else if (strcmp(argv[op + 1], "ebcdic") == 0)
         {
 #ifdef EBCDIC
@@ -3350,6 +3960,8 @@ are set, either both UTFs are supported or both are not supported. */
       }
     else
       printf("  No just-in-time compiler support\n");
+    (void)PCRE_CONFIG(PCRE_CONFIG_PROFILE, &rc);
+    printf("  %s profiling support\n", rc? "Match" : "No match");
     (void)PCRE_CONFIG(PCRE_CONFIG_NEWLINE, &rc);
     print_newline_config(rc, FALSE);
     (void)PCRE_CONFIG(PCRE_CONFIG_BSR, &rc);
@@ -3472,6 +4084,7 @@ while (!done)
   pcre_uint8 *markptr;
   pcre_uint8 *p, *pp, *ppp;
   pcre_uint8 *to_file = NULL;
+  char *profile_pattern = NULL;
   const pcre_uint8 *tables = NULL;
   unsigned long int get_options;
   unsigned long int true_size, true_study_size = 0;
@@ -3487,8 +4100,15 @@ while (!done)
   int do_showrest = 0;
   int do_showcaprest = 0;
   int do_flip = 0;
+  int test_mode = 0;
   int erroroffset, len, delimiter, poffset;
 
+#ifdef SUPPORT_PCRE8
+  pcre_set *set = NULL;
+  pcre_arena *arena = NULL;
+  int set_count = 0;
+#endif
+
 #if !defined NODFA
   int dfa_matched = 0;
 #endif
@@ -3725,14 +4345,16 @@ while (!done)
       {
       if (*pp == '<' && strchr((char *)lockout, '>') != NULL)
         {
-        int x = check_mc_option(pp+1, outfile, FALSE, "modifier");
+        int x = check_test_mode(pp+1);
+        if (x == 0) x = check_mc_option(pp+1, outfile, FALSE, "modifier");
         if (x == 0) goto SKIP_DATA;
 
         for (ppp = lockout; *ppp != 0; ppp++)
           {
           if (*ppp == '<')
             {
-            int y = check_mc_option(ppp+1, outfile, FALSE, "modifier");
+            int y = check_test_mode(ppp+1);
+            if (y == 0) y = check_mc_option(ppp+1, outfile, FALSE, "modifier");
             if (y == 0)
               {
               printf("** Error in modifier forbid data - giving up.\n");
@@ -3903,9 +4525,13 @@ while (!done)
 
       case '<':
         {
-        int x = check_mc_option(pp, outfile, FALSE, "modifier");
-        if (x == 0) goto SKIP_DATA;
-        options |= x;
+        int x = check_test_mode(pp);
+        if (x != 0) test_mode |= x; else
+          {
+          x = check_mc_option(pp, outfile, FALSE, "modifier");
+          if (x == 0) goto SKIP_DATA;
+          options |= x;
+          }
         while (*pp++ != '>');
         }
       break;
@@ -3921,6 +4547,86 @@ while (!done)
       }
     }
 
+  /* The test mode modifiers are supported only by the 8-bit library. Those
+  that select study options imply /S, without JIT, so that the results are the
+  same with and without -s+. */
+
+  if (test_mode != 0)
+    {
+#ifdef SUPPORT_PCRE8
+    if (pcre_mode != PCRE8_MODE)
+#endif
+      {
+      fprintf(outfile, "** Test mode modifiers are supported only in 8-bit "
+        "mode\n");
+      goto SKIP_DATA;
+      }
+#if !defined NOPOSIX
+    if (posix || do_posix)
+      {
+      fprintf(outfile, "** Test mode modifiers cannot be used with /P\n");
+      goto SKIP_DATA;
+      }
+#endif
+    if ((test_mode & TEST_CACHE) != 0 && tables != NULL)
+      {
+      fprintf(outfile, "** The <cache> modifier cannot be used with /L or /T\n");
+      goto SKIP_DATA;
+      }
+    if ((test_mode & TEST_LRU) != 0 && (locale_set || do_flip))
+      {
+      fprintf(outfile, "** The <lru> modifier cannot be used with /F or /L\n");
+      goto SKIP_DATA;
+      }
+    if ((test_mode & (TEST_LAZY_DFA|TEST_SPECIAL|TEST_NO_SPECIAL)) != 0)
+      {
+      do_study = 1;
+      study_options &= ~PCRE_STUDY_ALLJIT;
+      study_options |= PCRE_STUDY_EXTRA_NEEDED;
+      if ((test_mode & TEST_LAZY_DFA) != 0)
+        study_options |= PCRE_STUDY_LAZY_DFA;
+      if ((test_mode & TEST_NO_SPECIAL) != 0)
+        study_options |= PCRE_STUDY_NO_SPECIAL;
+      }
+    }
+
+  /* Handle compiling a pattern set, whose members are the lines of the
+  pattern. There is no information to show. */
+
+#ifdef SUPPORT_PCRE8
+  if ((test_mode & TEST_SET) != 0)
+    {
+    const char **members;
+    int errorindex = -1;
+
+    for (pp = p, set_count = 1; *pp != 0; pp++)
+      if (*pp == '\n') set_count++;
+    members = (const char **)malloc(set_count * sizeof(const char *));
+    if (members == NULL)
+      {
+      fprintf(outfile, "** Failed to get memory for a pattern set\n");
+      goto SKIP_DATA;
+      }
+    members[0] = (const char *)p;
+    for (pp = p, len = 1; *pp != 0; pp++)
+      {
+      if (*pp != '\n') continue;
+      *pp = 0;
+      members[len++] = (const char *)(pp + 1);
+      }
+    set = pcre_set_compile(members, set_count, options, study_options,
+      &error, &erroroffset, &errorindex);
+    free(members);
+    if (set == NULL)
+      {
+      fprintf(outfile, "Failed: %s at offset %d in pattern %d\n", error,
+        erroroffset, errorindex);
+      goto SKIP_DATA;
+      }
+    }
+  else
+#endif
+
   /* Handle compiling via the POSIX interface, which doesn't support the
   timing, showing, or debugging options, nor the ability to pass over
   local character tables. Neither does it have 16-bit support. */
@@ -3958,6 +4664,14 @@ while (!done)
 #endif  /* !defined NOPOSIX */
 
     {
+    /* Keep the text of the pattern for the -profile report. */
+
+    if (showprofile)
+      {
+      profile_pattern = (char *)malloc(strlen((char *)p) + 1);
+      if (profile_pattern != NULL) strcpy(profile_pattern, (char *)p);
+      }
+
     /* In 16- or 32-bit mode, convert the input. */
 
 #ifdef SUPPORT_PCRE16
@@ -4031,8 +4745,28 @@ while (!done)
           (double)CLOCKS_PER_SEC);
       }
 
-    PCRE_COMPILE(re, p, options, &error, &erroroffset, tables);
+#ifdef SUPPORT_PCRE8
+    if ((test_mode & TEST_ARENA) != 0)
+      {
+      arena = pcre_arena_create(NULL, ARENA_SIZE);
+      if (arena == NULL)
+        {
+        error = "failed to get memory";
+        erroroffset = 0;
+        }
+      else re = pcre_compile_arena(arena, (char *)p, options, NULL, &error,
+        &erroroffset, tables);
+      }
+    else if ((test_mode & TEST_CACHE) != 0)
+      re = cache_compile((char *)p, options, study_options,
+        (do_study || (force_study >= 0 && !no_force_study))? &extra : NULL,
+        &error, &erroroffset);
+    else if ((test_mode & TEST_LRU) != 0)
+      re = lru_compile((char *)p, options, &error, &erroroffset, tables);
+    else
+#endif
 
+    PCRE_COMPILE(re, p, options, &error, &erroroffset, tables);
     /* Compilation failed; go back for another re, skipping to blank line
     if non-interactive. */
 
@@ -4093,6 +4827,9 @@ while (!done)
         real_pcre_size = sizeof(real_pcre32);
 #endif
       new_info(re, NULL, PCRE_INFO_SIZE, &size);
+      if ((REAL_PCRE_FLAGS(re) & PCRE_PROFILED) != 0)
+        size = ((profile_data *)((char *)re + size -
+          PROFILE_BLOCK_SIZE))->code_size;
       fprintf(outfile, "Memory allocation (code space): %d\n",
         (int)(size - real_pcre_size - name_count * name_entry_size));
       }
@@ -4122,6 +4859,13 @@ while (!done)
           (((double)time_taken * 1000.0) / (double)timeit) /
             (double)CLOCKS_PER_SEC);
         }
+#ifdef SUPPORT_PCRE8
+      if ((test_mode & TEST_ARENA) != 0)
+        extra = pcre_study_arena(arena, re, study_options, &error);
+      else if ((test_mode & TEST_CACHE) != 0)
+        error = NULL;           /* Studied when it was compiled */
+      else
+#endif
       PCRE_STUDY(extra, re, study_options, &error);
       if (error != NULL)
         fprintf(outfile, "Failed to study: %s\n", error);
@@ -4138,6 +4882,17 @@ while (!done)
         }
       }
 
+#ifdef SUPPORT_PCRE8
+    /* Say whether <lazy_dfa> and <special> got what they asked for. */
+
+    if ((test_mode & TEST_LAZY_DFA) != 0)
+      fprintf(outfile, "Lazy DFA was %sbuilt\n", (extra != NULL &&
+        (extra->flags & PCRE_EXTRA_LAZY_DFA) != 0)? "" : "not ");
+    if ((test_mode & TEST_SPECIAL) != 0)
+      fprintf(outfile, "Specialized matcher was %sbuilt\n", (extra != NULL &&
+        (extra->flags & PCRE_EXTRA_SPECIAL) != 0)? "" : "not ");
+#endif
+
     /* If /K was present, we set up for handling MARK data. */
 
     if (do_mark)
@@ -4169,7 +4924,7 @@ while (!done)
       pcre_uint32 first_char, need_char;
       pcre_uint32 match_limit, recursion_limit;
       int count, backrefmax, first_char_set, need_char_set, okpartial, jchanged,
-        hascrorlf, maxlookbehind, match_empty;
+        hascrorlf, maxlookbehind, match_empty, superlinear;
       int nameentrysize, namecount;
       const pcre_uint8 *nametable;
 
@@ -4186,6 +4941,7 @@ while (!done)
           new_info(re, NULL, PCRE_INFO_JCHANGED, &jchanged) +
           new_info(re, NULL, PCRE_INFO_HASCRORLF, &hascrorlf) +
           new_info(re, NULL, PCRE_INFO_MATCH_EMPTY, &match_empty) +
+          new_info(re, NULL, PCRE_INFO_SUPERLINEAR, &superlinear) +
           new_info(re, NULL, PCRE_INFO_MAXLOOKBEHIND, &maxlookbehind)
           != 0)
         goto SKIP_DATA;
@@ -4233,6 +4989,7 @@ while (!done)
       if (!okpartial)  fprintf(outfile, "Partial matching not supported\n");
       if (hascrorlf)   fprintf(outfile, "Contains explicit CR or LF match\n");
       if (match_empty) fprintf(outfile, "May match empty string\n");
+      if (superlinear) fprintf(outfile, "May backtrack in super-linear time\n");
 
       all_options = REAL_PCRE_OPTIONS(re);
       if (do_flip) all_options = swap_uint32(all_options);
@@ -5111,6 +5868,46 @@ while (!done)
 
 #endif  /* !defined NOPOSIX */
 
+    /* Handle matching via a pattern set, a batch, or a stream, which show
+    only which patterns or lines matched, or the matches found in the stream. */
+
+#ifdef SUPPORT_PCRE8
+    if (set != NULL)
+      {
+      unsigned char *matched = (unsigned char *)malloc(set_count);
+      if (matched == NULL)
+        {
+        fprintf(outfile, "** Failed to get memory for a pattern set\n");
+        goto NEXT_DATA;
+        }
+      count = pcre_set_exec(set, (char *)bptr, len, options, matched);
+      if (count < 0) show_error(count);
+      else if (count == 0) fprintf(outfile, "No match\n");
+      else
+        {
+        int i;
+        fprintf(outfile, "Matched:");
+        for (i = 0; i < set_count; i++)
+          if (matched[i]) fprintf(outfile, " %d", i);
+        fprintf(outfile, "\n");
+        }
+      free(matched);
+      goto NEXT_DATA;
+      }
+
+    if ((test_mode & TEST_BATCH) != 0)
+      {
+      run_batch(re, extra, bptr, len, options);
+      goto NEXT_DATA;
+      }
+
+    if ((test_mode & TEST_STREAM) != 0)
+      {
+      run_stream(re, extra, options, bptr, len);
+      goto NEXT_DATA;
+      }
+#endif
+
     /* Handle matching via the native interface - repeats for /g and /G */
 
     /* Ensure that there is a JIT callback if we want to verify that JIT was
@@ -5226,6 +6023,11 @@ while (!done)
         {
         PCRE_EXEC(count, re, extra, bptr, len, start_offset,
           options | g_notempty, use_offsets, use_size_offsets);
+#ifdef SUPPORT_PCRE8
+        if ((test_mode & (TEST_LAZY_DFA|TEST_SPECIAL)) != 0)
+          check_interpreter(re, bptr, len, start_offset, options | g_notempty,
+            count, use_offsets, use_size_offsets);
+#endif
         if (count == 0)
           {
           fprintf(outfile, "Matched, but too many substrings\n");
@@ -5703,11 +6505,28 @@ while (!done)
   if ((posix || do_posix) && preg.re_pcre != 0) regfree(&preg);
 #endif
 
+  if (showprofile && re != NULL) add_profile(re, profile_pattern);
+  free(profile_pattern);
+
+  /* Patterns from an arena or the LRU cache are not freed separately. */
+
+#ifdef SUPPORT_PCRE8
+  if (set != NULL) pcre_set_free(set);
+  if (arena != NULL || (re != NULL && (test_mode & TEST_LRU) != 0))
+    {
+    if ((test_mode & TEST_LRU) != 0) (void)pcre_release_cached(re);
+    re = NULL;
+    }
+#endif
+
   if (re != NULL) new_free(re);
   if (extra != NULL)
     {
     PCRE_FREE_STUDY(extra);
     }
+#ifdef SUPPORT_PCRE8
+  if (arena != NULL) pcre_arena_free(arena);
+#endif
   if (locale_set)
     {
     new_free((void *)tables);
@@ -5740,8 +6559,14 @@ if (showtotaltimes)
       (double)CLOCKS_PER_SEC);
   }
 
+if (showprofile) print_profile();
+
 EXIT:
 
+#ifdef SUPPORT_PCRE8
+if (lru_cache != NULL) pcre_lru_cache_free(lru_cache);
+#endif
+
 if (infile != NULL && infile != stdin) fclose(infile);
 if (outfile != NULL && outfile != stdout) fclose(outfile);
 